@@ -85,6 +85,7 @@ enum class CheatType : int32_t
     EnableAllDrawableTrackPieces,
     CreateDucks,
     RemoveDucks,
+    SetGuestCount,
     Count,
 };
 
@@ -147,6 +147,7 @@ namespace OpenRCT2
             //       If objects use GetContext() in their destructor things won't go well.
 
             GameActions::ClearQueue();
+            scenario_save_async_flush();
             network_close();
             window_close_all();
 
@@ -509,6 +510,9 @@ namespace OpenRCT2
         bool LoadParkFromFile(const std::string& path, bool loadTitleScreenOnFail) final override
         {
             log_verbose("Context::LoadParkFromFile(%s)", path.c_str());
+
+            // The file may still be written by a background save.
+            scenario_save_async_flush();
             try
             {
                 auto fs = FileStream(path, FILE_MODE_OPEN);
@@ -1012,6 +1016,7 @@ namespace OpenRCT2
 #endif
 
             Twitch::Update();
+            scenario_save_async_update();
             chat_update();
             _stdInOutConsole.ProcessEvalQueue();
             _uiContext->Update();
@@ -13,6 +13,7 @@
 #include "Context.h"
 #include "Editor.h"
 #include "FileClassifier.h"
+#include "GameState.h"
 #include "GameStateSnapshots.h"
 #include "Input.h"
 #include "OpenRCT2.h"
@@ -42,6 +43,7 @@
 #include "ride/Ride.h"
 #include "ride/RideRatings.h"
 #include "ride/Station.h"
+#include "ride/StationQueues.h"
 #include "ride/Track.h"
 #include "ride/TrackDesign.h"
 #include "ride/Vehicle.h"
@@ -52,6 +54,7 @@
 #include "util/SawyerCoding.h"
 #include "util/Util.h"
 #include "windows/Intent.h"
+#include "world/ActiveTiles.h"
 #include "world/Banner.h"
 #include "world/Climate.h"
 #include "world/Entrance.h"
@@ -59,7 +62,9 @@
 #include "world/Map.h"
 #include "world/MapAnimation.h"
 #include "world/Park.h"
+#include "world/ParkStatistics.h"
 #include "world/Scenery.h"
+#include "world/SpatialHash.h"
 #include "world/Sprite.h"
 #include "world/Surface.h"
 #include "world/Water.h"
@@ -567,6 +572,17 @@ void game_load_init()
         GameActions::ClearQueue();
         reset_sprite_spatial_index();
     }
+    else
+    {
+        // Clients keep the sprite quadrants sent by the server, the staff and litter buckets are only kept locally.
+        SpatialHash::Reset();
+    }
+    ParkStatistics::Reset();
+    StationQueues::Reset();
+    peep_reset_level_of_detail();
+    ActiveTiles::Reset();
+    vehicle_wake_all();
+    GetContext()->GetGameState()->ResetRandomStreams();
     reset_all_sprite_quadrant_placements();
     scenery_set_default_placement_configuration();
 
@@ -636,12 +652,15 @@ void save_game_cmd(const utf8* name /* = nullptr */)
 void save_game_with_name(const utf8* name)
 {
     log_verbose("Saving to %s", name);
-    if (scenario_save(name, 0x80000000 | (gConfigGeneral.save_plugin_data ? 1 : 0)))
-    {
-        log_verbose("Saved to %s", name);
-        gCurrentLoadedPath = name;
-        gScreenAge = 0;
-    }
+    std::string path = name;
+    scenario_save_async(name, 0x80000000 | (gConfigGeneral.save_plugin_data ? 1 : 0), [path](bool result) {
+        if (result)
+        {
+            log_verbose("Saved to %s", path.c_str());
+            gCurrentLoadedPath = path;
+            gScreenAge = 0;
+        }
+    });
 }
 
 void* create_save_game_as_intent()
@@ -772,6 +791,9 @@ void game_autosave()
         timeName, sizeof(timeName), "autosave_%04u-%02u-%02u_%02u-%02u-%02u%s", currentDate.year, currentDate.month,
         currentDate.day, currentTime.hour, currentTime.minute, currentTime.second, fileExtension);
 
+    // The previous save may still be writing to a file that is about to be deleted or backed up.
+    scenario_save_async_flush();
+
     int32_t autosavesToKeep = gConfigGeneral.autosave_amount;
     limit_autosave_count(autosavesToKeep - 1, (gScreenFlags & SCREEN_FLAGS_EDITOR));
 
@@ -791,8 +813,10 @@ void game_autosave()
         platform_file_copy(path, backupPath, true);
     }
 
-    if (!scenario_save(path, saveFlags))
-        std::fprintf(stderr, "Could not autosave the scenario. Is the save folder writeable?\n");
+    scenario_save_async(path, saveFlags, [](bool result) {
+        if (!result)
+            std::fprintf(stderr, "Could not autosave the scenario. Is the save folder writeable?\n");
+    });
 }
 
 static void game_load_or_quit_no_save_prompt_callback(int32_t result, const utf8* path)
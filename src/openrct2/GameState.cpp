@@ -30,9 +30,11 @@
 #include "title/TitleSequencePlayer.h"
 #include "ui/UiContext.h"
 #include "windows/Intent.h"
+#include "world/ActiveTiles.h"
 #include "world/Climate.h"
 #include "world/MapAnimation.h"
 #include "world/Park.h"
+#include "world/ParkStatistics.h"
 #include "world/Scenery.h"
 
 #include <algorithm>
@@ -52,9 +54,11 @@
 #include "ride/RideGroupManager.h"
 #include "ride/ShopItem.h"
 #include "ride/Station.h"
+#include "ride/StationQueues.h"
 #include "ride/Track.h"
 #include "ride/TrackData.h"
 #include "ride/TrackDesign.h"
+#include "ride/Vehicle.h"
 #include "interface/Window.h"
 
 using namespace OpenRCT2;
@@ -78,6 +82,12 @@ void GameState::InitAll(int32_t mapSize)
     banner_init();
     ride_init_all();
     reset_sprite_list();
+    ParkStatistics::Reset();
+    StationQueues::Reset();
+    peep_reset_level_of_detail();
+    ActiveTiles::Reset();
+    vehicle_wake_all();
+    ResetRandomStreams();
     staff_reset_modes();
     date_reset();
     climate_reset(CLIMATE_COOL_AND_WET);
@@ -101,6 +111,27 @@ void GameState::InitAll(int32_t mapSize)
   //auto result3 = GameActions::Execute(&setCheatAction);
 }
 
+void GameState::SeedRandomStreams(uint64_t seed)
+{
+    _randomSeed = seed;
+    for (size_t i = 0; i < _randomStreams.size(); i++)
+    {
+        _randomStreams[i] = Random::Rct2::Split(seed, static_cast<uint32_t>(i));
+    }
+}
+
+void GameState::ResetRandomStreams()
+{
+    const auto& state = scenario_rand_state();
+    SeedRandomStreams((static_cast<uint64_t>(state.s0) << 32) | state.s1);
+}
+
+Random::Rct2::Engine GameState::SplitRandomStream(RandomStream stream, uint32_t key) const
+{
+    // Key 0 gives the same sequence as the stream itself, so the keys are offset.
+    return Random::Rct2::Split(_randomSeed, static_cast<uint32_t>(stream), key + 1);
+}
+
 /**
  * Function will be called every GAME_UPDATE_TIME_MS.
  * It has its own loop which might run multiple updates per call such as
@@ -119,8 +150,9 @@ void GameState::Update()
     gCash = 1000000;
     int x_tiles = gMapSizeUnits;
     int y_tiles = gMapSizeUnits;
-    int ax = rand() % x_tiles;
-    int ay = rand() % y_tiles;
+    auto& agentRand = GetRandomStream(RandomStream::AgentTesting);
+    int ax = agentRand() % x_tiles;
+    int ay = agentRand() % y_tiles;
     // The default height
   //int az = 115;
   //GetContext()->WriteLine(std::to_string(ax));
@@ -129,7 +161,7 @@ void GameState::Update()
   //int32_t selectedType;
   //selectedType = (gFootpathSelectedType << 7) + (gFootpathSelectedId & 0xFF);
 
-    int az = rand() % MAXIMUM_LAND_HEIGHT + MINIMUM_LAND_HEIGHT;
+    int az = agentRand() % MAXIMUM_LAND_HEIGHT + MINIMUM_LAND_HEIGHT;
   //if (act_i == 0) {
   //    auto landSetHeightAction = LandSetHeightAction({ax, ay}, az, 0);
   //  //auto result_height = GameActions::Execute(&landSetHeightAction);
@@ -440,6 +472,7 @@ void GameState::CreateStateSnapshot()
 {
     IGameStateSnapshots* snapshots = GetContext()->GetGameStateSnapshots();
 
+    peep_catch_up_all();
     auto& snapshot = snapshots->CreateSnapshot();
     snapshots->Capture(snapshot);
     snapshots->LinkSnapshot(snapshot, gCurrentTicks, scenario_rand_state().s0);
@@ -10,13 +10,26 @@
 #pragma once
 
 #include "Date.h"
+#include "core/Random.hpp"
 
+#include <array>
 #include <memory>
 
 namespace OpenRCT2
 {
     class Park;
 
+    /**
+     * Random number streams for what is not part of the scenario random sequence, which has to stay the same for saved
+     * games and network play.
+     */
+    enum class RandomStream : uint8_t
+    {
+        EnvActions,
+        AgentTesting,
+        Count,
+    };
+
     /**
      * Class to update the state of the map and park.
      */
@@ -25,6 +38,8 @@ namespace OpenRCT2
     private:
         std::unique_ptr<Park> _park;
         Date _date;
+        uint64_t _randomSeed = 0;
+        std::array<Random::Rct2::Engine, static_cast<size_t>(RandomStream::Count)> _randomStreams;
 
     public:
         GameState();
@@ -39,6 +54,28 @@ namespace OpenRCT2
             return *_park;
         }
 
+        Random::Rct2::Engine& GetRandomStream(RandomStream stream)
+        {
+            return _randomStreams[static_cast<size_t>(stream)];
+        }
+
+        /**
+         * Starts every stream again from the seed.
+         */
+        void SeedRandomStreams(uint64_t seed);
+
+        /**
+         * Seeds the streams from the scenario random state, so every copy of a park draws the same numbers after it is
+         * loaded.
+         */
+        void ResetRandomStreams();
+
+        /**
+         * An engine that only depends on the seed, the stream and the key, for updates that draw numbers in no fixed
+         * order, such as one engine for each sprite index.
+         */
+        Random::Rct2::Engine SplitRandomStream(RandomStream stream, uint32_t key) const;
+
         void InitAll(int32_t mapSize);
         void Update();
         void UpdateLogic();
@@ -2,17 +2,186 @@
 
 #include "core/CircularBuffer.h"
 #include "peep/Peep.h"
+#include "ride/Ride.h"
+#include "world/Map.h"
 #include "world/Sprite.h"
 
+#include <cstring>
+
 static constexpr size_t MaximumGameStateSnapshots = 32;
 static constexpr uint32_t InvalidTick = 0xFFFFFFFF;
 
+// Tile elements are only stored as a hash of each region of tiles.
+static constexpr int32_t TileRegionSize = 16;
+
+/**
+ * Size of the sprite data stored in a snapshot, 0 if only the identifiers of the sprite are stored.
+ */
+static size_t GetStoredSpriteSize(uint8_t spriteIdentifier, uint8_t type)
+{
+    switch (spriteIdentifier)
+    {
+        case SPRITE_IDENTIFIER_VEHICLE:
+            return sizeof(Vehicle);
+        case SPRITE_IDENTIFIER_PEEP:
+            return sizeof(Peep);
+        case SPRITE_IDENTIFIER_LITTER:
+            return sizeof(Litter);
+        case SPRITE_IDENTIFIER_MISC:
+            switch (type)
+            {
+                case SPRITE_MISC_MONEY_EFFECT:
+                    return sizeof(MoneyEffect);
+                case SPRITE_MISC_BALLOON:
+                    return sizeof(Balloon);
+                case SPRITE_MISC_DUCK:
+                    return sizeof(Duck);
+                case SPRITE_MISC_JUMPING_FOUNTAIN_WATER:
+                    return sizeof(JumpingFountain);
+                case SPRITE_MISC_STEAM_PARTICLE:
+                    return sizeof(SteamParticle);
+            }
+            break;
+    }
+    return 0;
+}
+
+/**
+ * Raw data is stored the same way as a byte array, the length followed by the bytes.
+ */
+static void SerialiseRawData(DataSerialiser& ds, void* data, size_t size)
+{
+    uint16_t length = (uint16_t)size;
+    ds << length;
+    if (ds.IsSaving())
+    {
+        ds.GetStream().Write(data, size);
+    }
+    else
+    {
+        if (length != size)
+            throw std::runtime_error("Invalid size, can't decode");
+        ds.GetStream().Read(data, size);
+    }
+}
+
+/**
+ * Skips over raw data in a memory stream, returning where it is stored.
+ */
+static const uint8_t* SkipRawData(DataSerialiser& ds, MemoryStream& stream, size_t& size)
+{
+    uint16_t length = 0;
+    ds << length;
+    auto position = stream.GetPosition();
+    if (position + length > stream.GetLength())
+        throw std::runtime_error("Invalid size, can't decode");
+    stream.SetPosition(position + length);
+    size = length;
+    return static_cast<const uint8_t*>(stream.GetData()) + position;
+}
+
+/**
+ * Visits the ride fields stored in snapshots, only the ones that are part of the simulation.
+ */
+template<typename TVisitor> static void VisitRideFields(const Ride& ride, TVisitor&& visit)
+{
+#define VISIT_RIDE_FIELD(field) visit(#field, &ride.field, sizeof(ride.field))
+    VISIT_RIDE_FIELD(type);
+    VISIT_RIDE_FIELD(subtype);
+    VISIT_RIDE_FIELD(mode);
+    VISIT_RIDE_FIELD(status);
+    for (int i = 0; i < MAX_VEHICLES_PER_RIDE + 1; i++)
+    {
+        VISIT_RIDE_FIELD(vehicles[i]);
+    }
+    VISIT_RIDE_FIELD(depart_flags);
+    VISIT_RIDE_FIELD(num_stations);
+    VISIT_RIDE_FIELD(num_vehicles);
+    VISIT_RIDE_FIELD(num_cars_per_train);
+    VISIT_RIDE_FIELD(max_trains);
+    VISIT_RIDE_FIELD(min_waiting_time);
+    VISIT_RIDE_FIELD(max_waiting_time);
+    VISIT_RIDE_FIELD(operation_option);
+    VISIT_RIDE_FIELD(max_speed);
+    VISIT_RIDE_FIELD(average_speed);
+    VISIT_RIDE_FIELD(current_test_segment);
+    VISIT_RIDE_FIELD(testing_flags);
+    VISIT_RIDE_FIELD(cur_num_customers);
+    VISIT_RIDE_FIELD(num_customers_timeout);
+    VISIT_RIDE_FIELD(price);
+    VISIT_RIDE_FIELD(excitement);
+    VISIT_RIDE_FIELD(intensity);
+    VISIT_RIDE_FIELD(nausea);
+    VISIT_RIDE_FIELD(value);
+    VISIT_RIDE_FIELD(satisfaction);
+    VISIT_RIDE_FIELD(total_customers);
+    VISIT_RIDE_FIELD(total_profit);
+    VISIT_RIDE_FIELD(popularity);
+    VISIT_RIDE_FIELD(num_riders);
+    VISIT_RIDE_FIELD(slide_in_use);
+    VISIT_RIDE_FIELD(slide_peep);
+    VISIT_RIDE_FIELD(spiral_slide_progress);
+    VISIT_RIDE_FIELD(race_winner);
+    VISIT_RIDE_FIELD(breakdown_reason_pending);
+    VISIT_RIDE_FIELD(mechanic_status);
+    VISIT_RIDE_FIELD(mechanic);
+    VISIT_RIDE_FIELD(inspection_station);
+    VISIT_RIDE_FIELD(broken_vehicle);
+    VISIT_RIDE_FIELD(broken_car);
+    VISIT_RIDE_FIELD(breakdown_reason);
+    VISIT_RIDE_FIELD(price_secondary);
+    VISIT_RIDE_FIELD(reliability);
+    VISIT_RIDE_FIELD(downtime);
+    VISIT_RIDE_FIELD(last_inspection);
+    VISIT_RIDE_FIELD(no_primary_items_sold);
+    VISIT_RIDE_FIELD(no_secondary_items_sold);
+    VISIT_RIDE_FIELD(income_per_hour);
+    VISIT_RIDE_FIELD(profit);
+    VISIT_RIDE_FIELD(guests_favourite);
+    VISIT_RIDE_FIELD(lifecycle_flags);
+    VISIT_RIDE_FIELD(cable_lift);
+    for (int i = 0; i < MAX_STATIONS; i++)
+    {
+        VISIT_RIDE_FIELD(stations[i].Depart);
+        VISIT_RIDE_FIELD(stations[i].TrainAtStation);
+        VISIT_RIDE_FIELD(stations[i].QueueTime);
+        VISIT_RIDE_FIELD(stations[i].QueueLength);
+        VISIT_RIDE_FIELD(stations[i].LastPeepInQueue);
+    }
+#undef VISIT_RIDE_FIELD
+}
+
+/**
+ * Mixes a tile element into a hash, ignoring the ghosts placed by the local player.
+ */
+static uint64_t HashTileElement(uint64_t hash, const TileElement& element)
+{
+    constexpr uint64_t PRIME = 0x9E3779B97F4A7C15ULL;
+    if (element.IsGhost())
+        return hash;
+
+    // Removing a ghost moves the last element flag, so it is left out.
+    TileElement copy = element;
+    copy.SetLastForTile(false);
+
+    uint64_t words[sizeof(TileElement) / sizeof(uint64_t)];
+    std::memcpy(words, &copy, sizeof(words));
+    for (auto word : words)
+    {
+        hash = (hash ^ word) * PRIME;
+        hash ^= hash >> 29;
+    }
+    return hash;
+}
+
 struct GameStateSnapshot_t
 {
     GameStateSnapshot_t& operator=(GameStateSnapshot_t&& mv) noexcept
     {
         tick = mv.tick;
         storedSprites = std::move(mv.storedSprites);
+        storedRides = std::move(mv.storedRides);
+        tileRegionHashes = std::move(mv.tileRegionHashes);
         return *this;
     }
 
@@ -21,6 +190,8 @@ struct GameStateSnapshot_t
 
     MemoryStream storedSprites;
     MemoryStream parkParameters;
+    MemoryStream storedRides;
+    std::vector<uint64_t> tileRegionHashes;
 
     void SerialiseSprites(rct_sprite* sprites, const size_t numSprites, bool saving)
     {
@@ -60,46 +231,129 @@ struct GameStateSnapshot_t
             rct_sprite& sprite = sprites[spriteIdx];
 
             ds << sprite.generic.sprite_identifier;
+            if (sprite.generic.sprite_identifier == SPRITE_IDENTIFIER_MISC)
+            {
+                ds << sprite.generic.type;
+            }
 
-            switch (sprite.generic.sprite_identifier)
+            auto size = GetStoredSpriteSize(sprite.generic.sprite_identifier, sprite.generic.type);
+            if (size != 0)
             {
-                case SPRITE_IDENTIFIER_VEHICLE:
-                    ds << reinterpret_cast<uint8_t(&)[sizeof(Vehicle)]>(sprite.vehicle);
-                    break;
-                case SPRITE_IDENTIFIER_PEEP:
-                    ds << reinterpret_cast<uint8_t(&)[sizeof(Peep)]>(sprite.peep);
-                    break;
-                case SPRITE_IDENTIFIER_LITTER:
-                    ds << reinterpret_cast<uint8_t(&)[sizeof(Litter)]>(sprite.litter);
-                    break;
-                case SPRITE_IDENTIFIER_MISC:
+                SerialiseRawData(ds, &sprite, size);
+            }
+        }
+    }
+
+    void SaveRides()
+    {
+        storedRides.SetPosition(0);
+        DataSerialiser ds(true, storedRides);
+
+        auto rideManager = GetRideManager();
+        uint32_t numRides = (uint32_t)rideManager.size();
+        ds << numRides;
+
+        std::vector<uint8_t> fields;
+        for (const auto& ride : rideManager)
+        {
+            uint32_t rideIndex = ride.id;
+            ds << rideIndex;
+
+            fields.clear();
+            VisitRideFields(ride, [&fields](const char*, const void* field, size_t size) {
+                auto bytes = static_cast<const uint8_t*>(field);
+                fields.insert(fields.end(), bytes, bytes + size);
+            });
+            SerialiseRawData(ds, fields.data(), fields.size());
+        }
+    }
+
+    void SaveTileRegionHashes()
+    {
+        tileRegionHashes.clear();
+        for (int32_t regionY = 0; regionY < MAXIMUM_MAP_SIZE_TECHNICAL; regionY += TileRegionSize)
+        {
+            for (int32_t regionX = 0; regionX < MAXIMUM_MAP_SIZE_TECHNICAL; regionX += TileRegionSize)
+            {
+                uint64_t hash = 0;
+                for (int32_t y = regionY; y < regionY + TileRegionSize; y++)
                 {
-                    ds << sprite.generic.type;
-                    switch (sprite.generic.type)
+                    for (int32_t x = regionX; x < regionX + TileRegionSize; x++)
                     {
-                        case SPRITE_MISC_MONEY_EFFECT:
-                            ds << reinterpret_cast<uint8_t(&)[sizeof(MoneyEffect)]>(sprite.money_effect);
-                            break;
-                        case SPRITE_MISC_BALLOON:
-                            ds << reinterpret_cast<uint8_t(&)[sizeof(Balloon)]>(sprite.balloon);
-                            break;
-                        case SPRITE_MISC_DUCK:
-                            ds << reinterpret_cast<uint8_t(&)[sizeof(Duck)]>(sprite.duck);
-                            break;
-                        case SPRITE_MISC_JUMPING_FOUNTAIN_WATER:
-                            ds << reinterpret_cast<uint8_t(&)[sizeof(JumpingFountain)]>(sprite.jumping_fountain);
-                            break;
-                        case SPRITE_MISC_STEAM_PARTICLE:
-                            ds << reinterpret_cast<uint8_t(&)[sizeof(SteamParticle)]>(sprite.steam_particle);
-                            break;
+                        const TileElement* element = gTileElementTilePointers[x + y * MAXIMUM_MAP_SIZE_TECHNICAL];
+                        if (element != nullptr)
+                        {
+                            do
+                            {
+                                hash = HashTileElement(hash, *element);
+                            } while (!(element++)->IsLastForTile());
+                        }
+                        // Keep elements from being attributed to the neighbouring tile.
+                        hash = (hash ^ (uint64_t)x) * 0x9E3779B97F4A7C15ULL;
                     }
                 }
-                break;
+                tileRegionHashes.push_back(hash);
             }
         }
     }
 };
 
+/**
+ * Sprite or ride stored in a snapshot, the data is not decoded until it differs.
+ */
+struct GameStateStoredEntry_t
+{
+    uint32_t index;
+    uint8_t spriteIdentifier;
+    uint8_t type;
+    const uint8_t* data;
+    size_t size;
+
+    bool HasSameData(const GameStateStoredEntry_t& other) const
+    {
+        return spriteIdentifier == other.spriteIdentifier && type == other.type && size == other.size
+            && std::memcmp(data, other.data, size) == 0;
+    }
+};
+
+static bool IsSameStream(const MemoryStream& a, const MemoryStream& b)
+{
+    return a.GetLength() == b.GetLength() && std::memcmp(a.GetData(), b.GetData(), a.GetLength()) == 0;
+}
+
+/**
+ * Walks two lists of entries ordered by index, reporting entries only in the first list, only in the second list and
+ * entries in both lists that differ.
+ */
+template<typename TRemoved, typename TAdded, typename TDiffers>
+static void MergeStoredEntries(
+    const std::vector<GameStateStoredEntry_t>& base, const std::vector<GameStateStoredEntry_t>& cmp, TRemoved&& removed,
+    TAdded&& added, TDiffers&& differs)
+{
+    size_t i = 0;
+    size_t j = 0;
+    while (i < base.size() || j < cmp.size())
+    {
+        if (j == cmp.size() || (i < base.size() && base[i].index < cmp[j].index))
+        {
+            removed(base[i++]);
+        }
+        else if (i == base.size() || cmp[j].index < base[i].index)
+        {
+            added(cmp[j++]);
+        }
+        else
+        {
+            if (!base[i].HasSameData(cmp[j]))
+            {
+                differs(base[i], cmp[j]);
+            }
+            i++;
+            j++;
+        }
+    }
+}
+
 struct GameStateSnapshots : public IGameStateSnapshots
 {
     virtual void Reset() override final
@@ -124,6 +378,8 @@ struct GameStateSnapshots : public IGameStateSnapshots
     virtual void Capture(GameStateSnapshot_t& snapshot) override final
     {
         snapshot.SerialiseSprites(get_sprite(0), MAX_SPRITES, true);
+        snapshot.SaveRides();
+        snapshot.SaveTileRegionHashes();
 
         // log_info("Snapshot size: %u bytes", (uint32_t)snapshot.storedSprites.GetLength());
     }
@@ -144,22 +400,76 @@ struct GameStateSnapshots : public IGameStateSnapshots
         ds << snapshot.srand0;
         ds << snapshot.storedSprites;
         ds << snapshot.parkParameters;
+
+        // Snapshots from older replays end here.
+        if (ds.IsSaving() || ds.GetStream().GetPosition() < ds.GetStream().GetLength())
+        {
+            ds << snapshot.storedRides;
+            ds << snapshot.tileRegionHashes;
+        }
     }
 
-    std::vector<rct_sprite> BuildSpriteList(GameStateSnapshot_t& snapshot) const
+    static std::vector<GameStateStoredEntry_t> IndexStoredSprites(MemoryStream& stream)
     {
-        std::vector<rct_sprite> spriteList;
-        spriteList.resize(MAX_SPRITES);
+        std::vector<GameStateStoredEntry_t> entries;
+        if (stream.GetLength() == 0)
+            return entries;
+
+        stream.SetPosition(0);
+        DataSerialiser ds(false, stream);
 
-        for (auto& sprite : spriteList)
+        uint32_t numSprites = 0;
+        ds << numSprites;
+        for (uint32_t i = 0; i < numSprites; i++)
         {
-            // By default they don't exist.
-            sprite.generic.sprite_identifier = SPRITE_IDENTIFIER_NULL;
+            GameStateStoredEntry_t entry{};
+            ds << entry.index;
+            ds << entry.spriteIdentifier;
+            if (entry.spriteIdentifier == SPRITE_IDENTIFIER_MISC)
+            {
+                ds << entry.type;
+            }
+
+            auto expectedSize = GetStoredSpriteSize(entry.spriteIdentifier, entry.type);
+            if (expectedSize != 0)
+            {
+                entry.data = SkipRawData(ds, stream, entry.size);
+                if (entry.size != expectedSize)
+                    throw std::runtime_error("Invalid size, can't decode");
+            }
+            entries.push_back(entry);
         }
+        return entries;
+    }
 
-        snapshot.SerialiseSprites(spriteList.data(), MAX_SPRITES, false);
+    static std::vector<GameStateStoredEntry_t> IndexStoredRides(MemoryStream& stream)
+    {
+        std::vector<GameStateStoredEntry_t> entries;
+        if (stream.GetLength() == 0)
+            return entries;
+
+        stream.SetPosition(0);
+        DataSerialiser ds(false, stream);
 
-        return spriteList;
+        uint32_t numRides = 0;
+        ds << numRides;
+        for (uint32_t i = 0; i < numRides; i++)
+        {
+            GameStateStoredEntry_t entry{};
+            ds << entry.index;
+            entry.data = SkipRawData(ds, stream, entry.size);
+            entries.push_back(entry);
+        }
+        return entries;
+    }
+
+    static rct_sprite DecodeStoredSprite(const GameStateStoredEntry_t& entry)
+    {
+        rct_sprite sprite{};
+        sprite.generic.sprite_identifier = entry.spriteIdentifier;
+        sprite.generic.type = entry.type;
+        std::memcpy(&sprite, entry.data, entry.size);
+        return sprite;
     }
 
 #define COMPARE_FIELD(struc, field)                                                                                            \
@@ -507,64 +817,113 @@ struct GameStateSnapshots : public IGameStateSnapshots
         }
     }
 
-    virtual GameStateCompareData_t Compare(const GameStateSnapshot_t& base, const GameStateSnapshot_t& cmp) const override final
+    void CompareRideData(
+        const GameStateStoredEntry_t& rideBase, const GameStateStoredEntry_t& rideCmp, GameStateRideChange_t& changeData) const
     {
-        GameStateCompareData_t res;
-        res.tick = base.tick;
-        res.srand0Left = base.srand0;
-        res.srand0Right = cmp.srand0;
+        Ride layout;
+        size_t offset = 0;
+        VisitRideFields(layout, [&](const char* fieldName, const void*, size_t size) {
+            if (offset + size <= rideBase.size && offset + size <= rideCmp.size
+                && std::memcmp(rideBase.data + offset, rideCmp.data + offset, size) != 0)
+            {
+                uint64_t valA = 0;
+                uint64_t valB = 0;
+                std::memcpy(&valA, rideBase.data + offset, std::min(size, sizeof(valA)));
+                std::memcpy(&valB, rideCmp.data + offset, std::min(size, sizeof(valB)));
+                changeData.diffs.push_back(GameStateSpriteChange_t::Diff_t{ offset, size, "Ride", fieldName, valA, valB });
+            }
+            offset += size;
+        });
+    }
 
-        std::vector<rct_sprite> spritesBase = BuildSpriteList(const_cast<GameStateSnapshot_t&>(base));
-        std::vector<rct_sprite> spritesCmp = BuildSpriteList(const_cast<GameStateSnapshot_t&>(cmp));
+    void CompareSprites(GameStateSnapshot_t& base, GameStateSnapshot_t& cmp, GameStateCompareData_t& res) const
+    {
+        if (IsSameStream(base.storedSprites, cmp.storedSprites))
+            return;
 
-        for (uint32_t i = 0; i < (uint32_t)spritesBase.size(); i++)
-        {
+        auto spritesBase = IndexStoredSprites(base.storedSprites);
+        auto spritesCmp = IndexStoredSprites(cmp.storedSprites);
+        auto report = [&res](uint8_t changeType, const GameStateStoredEntry_t& sprite) {
             GameStateSpriteChange_t changeData;
-            changeData.spriteIndex = i;
+            changeData.changeType = changeType;
+            changeData.spriteIdentifier = sprite.spriteIdentifier;
+            changeData.miscIdentifier = sprite.type;
+            changeData.spriteIndex = sprite.index;
+            res.spriteChanges.push_back(changeData);
+        };
+        MergeStoredEntries(
+            spritesBase, spritesCmp, [&](const auto& sprite) { report(GameStateSpriteChange_t::REMOVED, sprite); },
+            [&](const auto& sprite) { report(GameStateSpriteChange_t::ADDED, sprite); },
+            [&](const auto& spriteBase, const auto& spriteCmp) {
+                GameStateSpriteChange_t changeData;
+                changeData.changeType = GameStateSpriteChange_t::MODIFIED;
+                changeData.spriteIdentifier = spriteBase.spriteIdentifier;
+                changeData.miscIdentifier = spriteBase.type;
+                changeData.spriteIndex = spriteBase.index;
 
-            const rct_sprite& spriteBase = spritesBase[i];
-            const rct_sprite& spriteCmp = spritesCmp[i];
+                // Fields that are irrelevant to the game state can make the raw data differ.
+                CompareSpriteData(DecodeStoredSprite(spriteBase), DecodeStoredSprite(spriteCmp), changeData);
+                if (!changeData.diffs.empty())
+                {
+                    res.spriteChanges.push_back(std::move(changeData));
+                }
+            });
+    }
 
-            changeData.spriteIdentifier = spriteBase.generic.sprite_identifier;
-            changeData.miscIdentifier = spriteBase.generic.type;
+    void CompareRides(GameStateSnapshot_t& base, GameStateSnapshot_t& cmp, GameStateCompareData_t& res) const
+    {
+        if (IsSameStream(base.storedRides, cmp.storedRides))
+            return;
 
-            if (spriteBase.generic.sprite_identifier == SPRITE_IDENTIFIER_NULL
-                && spriteCmp.generic.sprite_identifier != SPRITE_IDENTIFIER_NULL)
-            {
-                // Sprite was added.
-                changeData.changeType = GameStateSpriteChange_t::ADDED;
-                changeData.spriteIdentifier = spriteCmp.generic.sprite_identifier;
-            }
-            else if (
-                spriteBase.generic.sprite_identifier != SPRITE_IDENTIFIER_NULL
-                && spriteCmp.generic.sprite_identifier == SPRITE_IDENTIFIER_NULL)
-            {
-                // Sprite was removed.
-                changeData.changeType = GameStateSpriteChange_t::REMOVED;
-                changeData.spriteIdentifier = spriteBase.generic.sprite_identifier;
-            }
-            else if (
-                spriteBase.generic.sprite_identifier == SPRITE_IDENTIFIER_NULL
-                && spriteCmp.generic.sprite_identifier == SPRITE_IDENTIFIER_NULL)
+        auto ridesBase = IndexStoredRides(base.storedRides);
+        auto ridesCmp = IndexStoredRides(cmp.storedRides);
+        auto report = [&res](uint8_t changeType, const GameStateStoredEntry_t& ride) {
+            res.rideChanges.push_back(GameStateRideChange_t{ changeType, ride.index, {} });
+        };
+        MergeStoredEntries(
+            ridesBase, ridesCmp, [&](const auto& ride) { report(GameStateSpriteChange_t::REMOVED, ride); },
+            [&](const auto& ride) { report(GameStateSpriteChange_t::ADDED, ride); },
+            [&](const auto& rideBase, const auto& rideCmp) {
+                GameStateRideChange_t changeData{ GameStateSpriteChange_t::MODIFIED, rideBase.index, {} };
+                CompareRideData(rideBase, rideCmp, changeData);
+                res.rideChanges.push_back(std::move(changeData));
+            });
+    }
+
+    void CompareTileElements(
+        const GameStateSnapshot_t& base, const GameStateSnapshot_t& cmp, GameStateCompareData_t& res) const
+    {
+        // Older snapshots do not have any tile hashes.
+        if (base.tileRegionHashes.size() != cmp.tileRegionHashes.size()
+            || std::memcmp(
+                   base.tileRegionHashes.data(), cmp.tileRegionHashes.data(), base.tileRegionHashes.size() * sizeof(uint64_t))
+                == 0)
+        {
+            return;
+        }
+
+        constexpr int32_t regionsPerRow = MAXIMUM_MAP_SIZE_TECHNICAL / TileRegionSize;
+        for (int32_t i = 0; i < (int32_t)base.tileRegionHashes.size(); i++)
+        {
+            if (base.tileRegionHashes[i] != cmp.tileRegionHashes[i])
             {
-                // Do nothing.
-                changeData.changeType = GameStateSpriteChange_t::EQUAL;
+                res.tileChanges.push_back(GameStateTileChange_t{
+                    (i % regionsPerRow) * TileRegionSize, (i / regionsPerRow) * TileRegionSize, TileRegionSize });
             }
-            else
-            {
-                CompareSpriteData(spriteBase, spriteCmp, changeData);
-                if (changeData.diffs.size() == 0)
-                {
-                    changeData.changeType = GameStateSpriteChange_t::EQUAL;
-                }
-                else
-                {
-                    changeData.changeType = GameStateSpriteChange_t::MODIFIED;
-                }
-            }
-
-            res.spriteChanges.push_back(changeData);
         }
+    }
+
+    virtual GameStateCompareData_t Compare(const GameStateSnapshot_t& base, const GameStateSnapshot_t& cmp) const override final
+    {
+        GameStateCompareData_t res;
+        res.tick = base.tick;
+        res.srand0Left = base.srand0;
+        res.srand0Right = cmp.srand0;
+
+        // Indexing the stored data moves the stream positions.
+        CompareSprites(const_cast<GameStateSnapshot_t&>(base), const_cast<GameStateSnapshot_t&>(cmp), res);
+        CompareRides(const_cast<GameStateSnapshot_t&>(base), const_cast<GameStateSnapshot_t&>(cmp), res);
+        CompareTileElements(base, cmp, res);
 
         return res;
     }
@@ -610,7 +969,7 @@ struct GameStateSnapshots : public IGameStateSnapshots
         return "Unknown";
     }
 
-    virtual bool LogCompareDataToFile(const std::string& fileName, const GameStateCompareData_t& cmpData) const override
+    virtual std::string GetCompareDataText(const GameStateCompareData_t& cmpData) const override
     {
         std::string outputBuffer;
         char tempBuffer[1024] = {};
@@ -657,6 +1016,48 @@ struct GameStateSnapshots : public IGameStateSnapshots
             }
         }
 
+        for (auto& change : cmpData.rideChanges)
+        {
+            if (change.changeType == GameStateSpriteChange_t::ADDED)
+            {
+                snprintf(tempBuffer, sizeof(tempBuffer), "Ride added, index: %u\n", change.rideIndex);
+                outputBuffer += tempBuffer;
+            }
+            else if (change.changeType == GameStateSpriteChange_t::REMOVED)
+            {
+                snprintf(tempBuffer, sizeof(tempBuffer), "Ride removed, index: %u\n", change.rideIndex);
+                outputBuffer += tempBuffer;
+            }
+            else if (change.changeType == GameStateSpriteChange_t::MODIFIED)
+            {
+                snprintf(tempBuffer, sizeof(tempBuffer), "Ride modifications, index: %u\n", change.rideIndex);
+                outputBuffer += tempBuffer;
+                for (auto& diff : change.diffs)
+                {
+                    snprintf(
+                        tempBuffer, sizeof(tempBuffer), "  %s::%s, len = %u, left = 0x%.16llX, right = 0x%.16llX\n",
+                        diff.structname, diff.fieldname, (uint32_t)diff.length, (unsigned long long)diff.valueA,
+                        (unsigned long long)diff.valueB);
+                    outputBuffer += tempBuffer;
+                }
+            }
+        }
+
+        for (auto& change : cmpData.tileChanges)
+        {
+            snprintf(
+                tempBuffer, sizeof(tempBuffer), "Tile elements modified, tiles: %d, %d to %d, %d\n", change.x, change.y,
+                change.x + change.size - 1, change.y + change.size - 1);
+            outputBuffer += tempBuffer;
+        }
+
+        return outputBuffer;
+    }
+
+    virtual bool LogCompareDataToFile(const std::string& fileName, const GameStateCompareData_t& cmpData) const override
+    {
+        std::string outputBuffer = GetCompareDataText(cmpData);
+
         FILE* fp = fopen(fileName.c_str(), "wt");
         if (!fp)
             return false;
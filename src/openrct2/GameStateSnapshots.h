@@ -15,6 +15,7 @@
 #include <memory>
 #include <set>
 #include <string>
+#include <vector>
 
 struct GameStateSnapshot_t;
 
@@ -46,12 +47,37 @@ struct GameStateSpriteChange_t
     std::vector<Diff_t> diffs;
 };
 
+struct GameStateRideChange_t
+{
+    uint8_t changeType; // Same values as GameStateSpriteChange_t.
+    uint32_t rideIndex;
+
+    std::vector<GameStateSpriteChange_t::Diff_t> diffs;
+};
+
+struct GameStateTileChange_t
+{
+    // Snapshots only store a hash per region, so this is the region of tiles that contains the difference.
+    int32_t x;
+    int32_t y;
+    int32_t size;
+};
+
 struct GameStateCompareData_t
 {
     uint32_t tick;
     uint32_t srand0Left;
     uint32_t srand0Right;
+
+    // Only entries that differ are listed.
     std::vector<GameStateSpriteChange_t> spriteChanges;
+    std::vector<GameStateRideChange_t> rideChanges;
+    std::vector<GameStateTileChange_t> tileChanges;
+
+    bool HasDifferences() const
+    {
+        return !spriteChanges.empty() || !rideChanges.empty() || !tileChanges.empty();
+    }
 };
 
 /*
@@ -95,10 +121,16 @@ interface IGameStateSnapshots
     virtual void SerialiseSnapshot(GameStateSnapshot_t & snapshot, DataSerialiser & serialiser) const = 0;
 
     /*
-     * Compares two states resulting GameStateCompareData_t with all mismatches stored.
+     * Compares two states resulting GameStateCompareData_t with all mismatches stored. Sprites, rides and tile regions are
+     * compared as raw bytes first, only the ones that differ are compared field by field.
      */
     virtual GameStateCompareData_t Compare(const GameStateSnapshot_t& base, const GameStateSnapshot_t& cmp) const = 0;
 
+    /*
+     * Formats the GameStateCompareData_t as readable text.
+     */
+    virtual std::string GetCompareDataText(const GameStateCompareData_t& cmpData) const = 0;
+
     /*
      * Writes the GameStateCompareData_t into the specified file as readable text.
      */
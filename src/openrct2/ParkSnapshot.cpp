@@ -0,0 +1,222 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "ParkSnapshot.h"
+
+#include "core/IStream.hpp"
+#include "core/MemoryMappedFile.h"
+#include "core/String.hpp"
+#include "scenario/Scenario.h"
+#include "world/Sprite.h"
+#include "world/TileElement.h"
+
+#include <algorithm>
+#include <cstring>
+
+using namespace ParkSnapshot;
+
+namespace ParkSnapshot
+{
+    std::array<S6Range, 3> GetS6Ranges(rct_s6_data& s6)
+    {
+        auto head = reinterpret_cast<uint8_t*>(&s6);
+        auto tileElements = reinterpret_cast<uint8_t*>(&s6.tile_elements);
+        auto middle = reinterpret_cast<uint8_t*>(&s6.next_free_tile_element_pointer_index);
+        auto sprites = reinterpret_cast<uint8_t*>(&s6.sprites);
+        auto tail = reinterpret_cast<uint8_t*>(&s6.sprite_lists_head);
+        auto end = head + sizeof(rct_s6_data);
+        return { {
+            { SectionId::S6Head, head, static_cast<size_t>(tileElements - head) },
+            { SectionId::S6Middle, middle, static_cast<size_t>(sprites - middle) },
+            { SectionId::S6Tail, tail, static_cast<size_t>(end - tail) },
+        } };
+    }
+
+    /**
+     * Not a cryptographic hash, only meant to catch truncated or damaged files. Four independent lanes keep it close
+     * to memory bandwidth so validation does not cost more than faulting the pages in.
+     */
+    uint64_t Checksum(const void* data, size_t length)
+    {
+        constexpr uint64_t PRIME = 0x9E3779B97F4A7C15ULL;
+        uint64_t lanes[4] = { PRIME, PRIME * 3, PRIME * 5, PRIME * 7 };
+
+        auto src = static_cast<const uint8_t*>(data);
+        size_t i = 0;
+        for (; i + 32 <= length; i += 32)
+        {
+            for (size_t lane = 0; lane < 4; lane++)
+            {
+                uint64_t word;
+                std::memcpy(&word, src + i + lane * 8, sizeof(word));
+                lanes[lane] = (lanes[lane] ^ word) * PRIME;
+                lanes[lane] ^= lanes[lane] >> 29;
+            }
+        }
+
+        uint64_t result = length;
+        for (auto lane : lanes)
+        {
+            result = (result ^ lane) * PRIME;
+        }
+        for (; i < length; i++)
+        {
+            result = (result ^ src[i]) * PRIME;
+        }
+        return result ^ (result >> 32);
+    }
+
+    bool IsSnapshot(IStream* stream)
+    {
+        auto originalPosition = stream->GetPosition();
+        Header header{};
+        bool isSnapshot = stream->TryRead(&header, sizeof(header)) == sizeof(header) && header.Magic == MAGIC;
+        stream->SetPosition(originalPosition);
+        return isSnapshot;
+    }
+} // namespace ParkSnapshot
+
+static uint64_t AlignSectionOffset(uint64_t offset)
+{
+    return (offset + SECTION_ALIGNMENT - 1) & ~(SECTION_ALIGNMENT - 1);
+}
+
+void ParkSnapshotWriter::AddSection(SectionId id, const void* data, size_t elementSize, size_t count)
+{
+    _sections.push_back({ id, data, elementSize, elementSize * count });
+}
+
+void ParkSnapshotWriter::Write(IStream* stream) const
+{
+    std::vector<Section> table;
+    uint64_t offset = AlignSectionOffset(sizeof(Header) + _sections.size() * sizeof(Section));
+    for (const auto& pending : _sections)
+    {
+        Section section{};
+        section.Id = static_cast<uint32_t>(pending.Id);
+        section.ElementSize = static_cast<uint32_t>(pending.ElementSize);
+        section.Offset = offset;
+        section.Length = pending.Length;
+        section.Checksum = Checksum(pending.Data, pending.Length);
+        table.push_back(section);
+        offset = AlignSectionOffset(offset + pending.Length);
+    }
+
+    Header header{};
+    header.Magic = MAGIC;
+    header.Version = VERSION;
+    header.SectionCount = static_cast<uint16_t>(table.size());
+    header.FileSize = table.empty() ? offset : table.back().Offset + table.back().Length;
+    header.TileElementSize = sizeof(TileElement);
+    header.SpriteSize = sizeof(rct_sprite);
+    header.TableChecksum = Checksum(table.data(), table.size() * sizeof(Section));
+
+    auto start = stream->GetPosition();
+    stream->Write(&header);
+    stream->Write(table.data(), table.size() * sizeof(Section));
+
+    static constexpr uint8_t padding[SECTION_ALIGNMENT] = {};
+    for (size_t i = 0; i < table.size(); i++)
+    {
+        auto position = stream->GetPosition() - start;
+        stream->Write(padding, table[i].Offset - position);
+        if (_sections[i].Length != 0)
+        {
+            stream->Write(_sections[i].Data, _sections[i].Length);
+        }
+    }
+}
+
+ParkSnapshotReader::ParkSnapshotReader(const std::string& path)
+    : _file(std::make_unique<MemoryMappedFile>(path))
+{
+    _data = _file->GetData();
+    _length = _file->GetLength();
+    Validate();
+}
+
+ParkSnapshotReader::ParkSnapshotReader(IStream* stream)
+{
+    _buffer.resize(stream->GetLength() - stream->GetPosition());
+    stream->Read(_buffer.data(), _buffer.size());
+    _data = _buffer.data();
+    _length = _buffer.size();
+    Validate();
+}
+
+ParkSnapshotReader::~ParkSnapshotReader() = default;
+
+void ParkSnapshotReader::Validate()
+{
+    Header header;
+    if (_length < sizeof(header))
+    {
+        throw IOException("Park snapshot is truncated.");
+    }
+    std::memcpy(&header, _data, sizeof(header));
+    if (header.Magic != MAGIC)
+    {
+        throw IOException("Not a park snapshot.");
+    }
+    if (header.Version != VERSION || header.TileElementSize != sizeof(TileElement) || header.SpriteSize != sizeof(rct_sprite))
+    {
+        throw IOException("Park snapshot was written by an incompatible version.");
+    }
+    if (header.FileSize > _length || sizeof(Header) + header.SectionCount * sizeof(Section) > _length)
+    {
+        throw IOException("Park snapshot is truncated.");
+    }
+
+    _sections.resize(header.SectionCount);
+    std::memcpy(_sections.data(), _data + sizeof(Header), _sections.size() * sizeof(Section));
+    if (Checksum(_sections.data(), _sections.size() * sizeof(Section)) != header.TableChecksum)
+    {
+        throw IOException("Park snapshot section table is corrupt.");
+    }
+
+    for (const auto& section : _sections)
+    {
+        if (section.Offset > header.FileSize || section.Length > header.FileSize - section.Offset
+            || section.ElementSize == 0 || section.Length % section.ElementSize != 0)
+        {
+            throw IOException("Park snapshot section table is corrupt.");
+        }
+        if (Checksum(_data + section.Offset, static_cast<size_t>(section.Length)) != section.Checksum)
+        {
+            throw IOException(String::StdFormat("Park snapshot section %u is corrupt.", section.Id));
+        }
+    }
+}
+
+const Section* ParkSnapshotReader::FindSection(SectionId id) const
+{
+    auto it = std::find_if(
+        _sections.begin(), _sections.end(), [id](const Section& section) { return section.Id == static_cast<uint32_t>(id); });
+    return it != _sections.end() ? &*it : nullptr;
+}
+
+bool ParkSnapshotReader::HasSection(SectionId id) const
+{
+    return FindSection(id) != nullptr;
+}
+
+const void* ParkSnapshotReader::GetSection(SectionId id, size_t elementSize, size_t* count) const
+{
+    auto section = FindSection(id);
+    if (section == nullptr)
+    {
+        throw IOException(String::StdFormat("Park snapshot is missing section %u.", static_cast<uint32_t>(id)));
+    }
+    if (section->ElementSize != elementSize)
+    {
+        throw IOException(String::StdFormat("Park snapshot section %u has an unexpected layout.", section->Id));
+    }
+    *count = static_cast<size_t>(section->Length / elementSize);
+    return _data + section->Offset;
+}
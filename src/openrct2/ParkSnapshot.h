@@ -0,0 +1,144 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "common.h"
+
+#include <array>
+#include <memory>
+#include <string>
+#include <vector>
+
+interface IStream;
+class MemoryMappedFile;
+struct rct_s6_data;
+
+/**
+ * Park snapshots are an internal checkpoint format which stores the in-memory game state arrays as they are, so that
+ * loading one is mostly a matter of mapping the file and copying whole sections. They are only valid for the build
+ * that wrote them, which is enforced by the version and the element sizes recorded in the header.
+ *
+ * Layout: a header, the section table and then every section aligned to a page boundary.
+ */
+namespace ParkSnapshot
+{
+    constexpr uint32_t MAGIC = 0x50534B50; // "PKSP"
+    constexpr uint16_t VERSION = 1;
+    constexpr uint64_t SECTION_ALIGNMENT = 4096;
+
+    enum class SectionId : uint32_t
+    {
+        // Park state that has no native array is kept in the S6 layout, split around the map and sprites
+        S6Head,
+        S6Middle,
+        S6Tail,
+        TileElements,
+        Sprites,
+        SpriteLists,
+        PeepNames,
+    };
+
+#pragma pack(push, 1)
+    struct Header
+    {
+        uint32_t Magic;
+        uint16_t Version;
+        uint16_t SectionCount;
+        uint64_t FileSize;
+        uint32_t TileElementSize;
+        uint32_t SpriteSize;
+        uint64_t TableChecksum;
+    };
+    assert_struct_size(Header, 32);
+
+    struct Section
+    {
+        uint32_t Id;
+        uint32_t ElementSize;
+        uint64_t Offset;
+        uint64_t Length;
+        uint64_t Checksum;
+    };
+    assert_struct_size(Section, 32);
+#pragma pack(pop)
+
+    struct S6Range
+    {
+        SectionId Id;
+        uint8_t* Data;
+        size_t Length;
+    };
+
+    /**
+     * Returns the parts of the given S6 data that are stored as they are, everything except the map and the sprites.
+     */
+    std::array<S6Range, 3> GetS6Ranges(rct_s6_data& s6);
+
+    uint64_t Checksum(const void* data, size_t length);
+    bool IsSnapshot(IStream* stream);
+} // namespace ParkSnapshot
+
+/**
+ * Collects sections and writes them as a park snapshot. The data of each section is only referenced, so it has to stay
+ * alive until Write returns.
+ */
+class ParkSnapshotWriter final
+{
+private:
+    struct PendingSection
+    {
+        ParkSnapshot::SectionId Id;
+        const void* Data;
+        size_t ElementSize;
+        size_t Length;
+    };
+
+    std::vector<PendingSection> _sections;
+
+public:
+    void AddSection(ParkSnapshot::SectionId id, const void* data, size_t elementSize, size_t count);
+    void Write(IStream* stream) const;
+};
+
+/**
+ * Validates a park snapshot and gives access to its sections without copying them. Snapshots read from a path are
+ * mapped into memory, snapshots read from a stream are read into a buffer owned by the reader.
+ */
+class ParkSnapshotReader final
+{
+private:
+    std::unique_ptr<MemoryMappedFile> _file;
+    std::vector<uint8_t> _buffer;
+    const uint8_t* _data = nullptr;
+    size_t _length = 0;
+    std::vector<ParkSnapshot::Section> _sections;
+
+public:
+    explicit ParkSnapshotReader(const std::string& path);
+    explicit ParkSnapshotReader(IStream* stream);
+    ~ParkSnapshotReader();
+
+    bool HasSection(ParkSnapshot::SectionId id) const;
+
+    /**
+     * Returns the data of a section and its number of elements. Throws if the section is missing or was written with
+     * a different element size.
+     */
+    const void* GetSection(ParkSnapshot::SectionId id, size_t elementSize, size_t* count) const;
+
+    template<typename T> const T* GetSection(ParkSnapshot::SectionId id, size_t* count) const
+    {
+        return static_cast<const T*>(GetSection(id, sizeof(T), count));
+    }
+
+private:
+    void Validate();
+    const ParkSnapshot::Section* FindSection(ParkSnapshot::SectionId id) const;
+};
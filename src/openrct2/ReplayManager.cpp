@@ -15,6 +15,7 @@
 #include "OpenRCT2.h"
 #include "ParkImporter.h"
 #include "PlatformEnvironment.h"
+#include "TrajectoryFile.h"
 #include "actions/FootpathPlaceAction.hpp"
 #include "actions/GameAction.h"
 #include "actions/RideEntranceExitPlaceAction.hpp"
@@ -24,6 +25,7 @@
 #include "actions/TrackPlaceAction.hpp"
 #include "config/Config.h"
 #include "core/DataSerialiser.h"
+#include "core/FileStream.hpp"
 #include "core/Path.hpp"
 #include "management/NewsItem.h"
 #include "object/ObjectManager.h"
@@ -32,6 +34,7 @@
 #include "world/Park.h"
 #include "zlib.h"
 
+#include <algorithm>
 #include <chrono>
 #include <memory>
 #include <vector>
@@ -67,6 +70,42 @@ namespace OpenRCT2
         }
     };
 
+    struct ReplayKeyframe
+    {
+        uint32_t tick = 0;
+        uint32_t commandIndex = 0; // First command that is not yet part of the state.
+        uint64_t uncompressedSize = 0;
+        MemoryStream parkData; // Compressed park snapshot.
+        MemoryStream parkParams;
+        MemoryStream cheatData;
+    };
+
+    struct TrajectoryRecording
+    {
+        std::unique_ptr<FileStream> stream;
+        std::unique_ptr<TrajectoryWriter> writer;
+        uint32_t keyframeSteps = 0;
+        uint64_t step = 0;
+        uint32_t actionIndex = 0;
+        // Steps not yet written, they are compressed together once there are enough of them.
+        MemoryStream pendingSteps;
+        uint32_t pendingStepCount = 0;
+        // Actions executed since the last step.
+        MemoryStream stepActions;
+        uint32_t stepActionCount = 0;
+    };
+
+    struct TrajectoryPlayback
+    {
+        std::unique_ptr<FileStream> stream;
+        std::unique_ptr<TrajectoryReader> reader;
+        size_t nextChunk = 0;
+        std::vector<uint8_t> chunkData;
+        std::unique_ptr<MemoryStream> chunkStream;
+        uint32_t chunkStepsLeft = 0;
+        uint64_t step = 0;
+    };
+
     struct ReplayRecordFile
     {
         uint32_t magic;
@@ -89,16 +128,25 @@ namespace OpenRCT2
         uint32_t tickStart;    // First tick of replay.
         uint32_t tickEnd;      // Last tick of replay.
         std::multiset<ReplayCommand> commands;
+        std::multiset<ReplayCommand>::iterator nextCommand;
         std::vector<std::pair<uint32_t, rct_sprite_checksum>> checksums;
         uint32_t checksumIndex;
         MemoryStream gameStateSnapshots;
+        std::vector<ReplayKeyframe> keyframes;
     };
 
     class ReplayManager final : public IReplayManager
     {
-        static constexpr uint16_t ReplayVersion = 4;
+        static constexpr uint16_t ReplayVersion = 5;
+        static constexpr uint16_t ReplayVersionWithoutKeyframes = 4;
         static constexpr uint32_t ReplayMagic = 0x5243524F; // ORCR.
         static constexpr int ReplayCompressionLevel = 9;
+        // Keyframes are taken while the game is running, so favour speed. They shrink further when the file is compressed.
+        static constexpr int KeyframeCompressionLevel = 1;
+        // Deflate does not shrink data by more than this, a keyframe claiming to be larger comes from a corrupt file.
+        static constexpr uint64_t KeyframeMaxCompressionRatio = 1032;
+        static constexpr uint32_t TrajectoryStepsPerChunk = 4096;
+        static constexpr int TrajectoryStepsCompressionLevel = 6;
         static constexpr int NormalRecordingChecksumTicks = 1;
         static constexpr int SilentRecordingChecksumTicks = 40; // Same as network server
 
@@ -113,6 +161,7 @@ namespace OpenRCT2
     public:
         virtual ~ReplayManager()
         {
+            StopTrajectoryRecording();
         }
 
         virtual bool IsReplaying() const override
@@ -137,6 +186,9 @@ namespace OpenRCT2
 
         virtual void AddGameAction(uint32_t tick, const GameAction* action) override
         {
+            if (_trajectoryRecording != nullptr)
+                AddTrajectoryAction(action);
+
             if (_currentRecording == nullptr)
                 return;
 
@@ -164,6 +216,14 @@ namespace OpenRCT2
                 _nextChecksumTick = gCurrentTicks + ChecksumTicksDelta();
             }
 
+            if ((_mode == ReplayMode::RECORDING || _mode == ReplayMode::NORMALISATION) && _keyframeTicks != 0
+                && gCurrentTicks == _nextKeyframeTick)
+            {
+                AddKeyframe();
+
+                _nextKeyframeTick = gCurrentTicks + _keyframeTicks;
+            }
+
             if (_mode == ReplayMode::RECORDING)
             {
                 if (gCurrentTicks >= _currentRecording->tickEnd)
@@ -193,7 +253,7 @@ namespace OpenRCT2
                 ReplayCommands();
 
                 // If we run out of commands we can just stop
-                if (_currentReplay->commands.empty())
+                if (_currentReplay->nextCommand == _currentReplay->commands.end())
                 {
                     StopPlayback();
                     StopRecording();
@@ -217,7 +277,8 @@ namespace OpenRCT2
         }
 
         virtual bool StartRecording(
-            const std::string& name, uint32_t maxTicks /*= k_MaxReplayTicks*/, RecordType rt /*= RecordType::NORMAL*/) override
+            const std::string& name, uint32_t maxTicks /*= k_MaxReplayTicks*/, RecordType rt /*= RecordType::NORMAL*/,
+            uint32_t keyframeTicks /*= k_DefaultReplayKeyframeTicks*/) override
         {
             // If using silent recording, discard whatever recording there is going on, even if a new silent recording is to be
             // started.
@@ -265,6 +326,8 @@ namespace OpenRCT2
             _currentRecording = std::move(replayData);
             _recordType = rt;
             _nextChecksumTick = gCurrentTicks + 1;
+            _keyframeTicks = keyframeTicks;
+            _nextKeyframeTick = gCurrentTicks + keyframeTicks;
 
             return true;
         }
@@ -369,6 +432,7 @@ namespace OpenRCT2
                 info.Ticks = data->tickEnd - data->tickStart;
             info.NumCommands = (uint32_t)data->commands.size();
             info.NumChecksums = (uint32_t)data->checksums.size();
+            info.NumKeyframes = (uint32_t)data->keyframes.size();
 
             return true;
         }
@@ -389,14 +453,16 @@ namespace OpenRCT2
             {
                 GameStateCompareData_t cmpData = snapshots->Compare(replaySnapshot, localSnapshot);
 
-                // Find out if there are any differences between the two states
-                auto res = std::find_if(
-                    cmpData.spriteChanges.begin(), cmpData.spriteChanges.end(),
-                    [](const GameStateSpriteChange_t& diff) { return diff.changeType != GameStateSpriteChange_t::EQUAL; });
-
                 // If there are difference write a log to the desyncs folder
-                if (res != cmpData.spriteChanges.end())
+                if (cmpData.HasDifferences())
                 {
+                    // Keep the first differences, later ones are most likely caused by them.
+                    _snapshotMismatch = true;
+                    if (_snapshotCompareText.empty())
+                    {
+                        _snapshotCompareText = snapshots->GetCompareDataText(cmpData);
+                    }
+
                     std::string outputPath = GetContext()->GetPlatformEnvironment()->GetDirectoryPath(
                         DIRBASE::USER, DIRID::LOG_DESYNCS);
                     char uniqueFileName[128] = {};
@@ -412,7 +478,7 @@ namespace OpenRCT2
             }
         }
 
-        virtual bool StartPlayback(const std::string& file) override
+        virtual bool StartPlayback(const std::string& file, uint32_t replayTick /*= 0*/) override
         {
             if (_mode != ReplayMode::NONE && _mode != ReplayMode::NORMALISATION)
                 return false;
@@ -433,9 +499,12 @@ namespace OpenRCT2
 
             gCurrentTicks = replayData->tickStart;
 
+            _snapshotMismatch = false;
+            _snapshotCompareText.clear();
             LoadAndCompareSnapshot(replayData->gameStateSnapshots);
 
             _currentReplay = std::move(replayData);
+            _currentReplay->nextCommand = _currentReplay->commands.begin();
             _currentReplay->checksumIndex = 0;
             _faultyChecksumIndex = -1;
 
@@ -445,6 +514,64 @@ namespace OpenRCT2
             if (_mode != ReplayMode::NORMALISATION)
                 _mode = ReplayMode::PLAYING;
 
+            if (replayTick != 0)
+            {
+                return SeekPlayback(replayTick);
+            }
+
+            return true;
+        }
+
+        virtual bool SeekPlayback(uint32_t replayTick) override
+        {
+            if (_mode != ReplayMode::PLAYING)
+                return false;
+
+            uint32_t replayLength = _currentReplay->tickEnd - _currentReplay->tickStart;
+            uint32_t targetTick = _currentReplay->tickStart + std::min(replayTick, replayLength);
+
+            // Nearest keyframe at or before the target, the recorded keyframes are in tick order.
+            auto& keyframes = _currentReplay->keyframes;
+            auto keyframe = std::upper_bound(
+                keyframes.begin(), keyframes.end(), targetTick,
+                [](uint32_t tick, const ReplayKeyframe& kf) { return tick < kf.tick; });
+            ReplayKeyframe* nearest = keyframe != keyframes.begin() ? &*std::prev(keyframe) : nullptr;
+
+            // Simulating forward from the current tick is cheaper when no keyframe lies in between.
+            uint32_t nearestTick = nearest != nullptr ? nearest->tick : _currentReplay->tickStart;
+            if (targetTick < gCurrentTicks || nearestTick > gCurrentTicks)
+            {
+                uint32_t commandIndex = 0;
+                if (nearest != nullptr)
+                {
+                    if (!LoadKeyframe(*nearest))
+                    {
+                        log_error("Unable to load replay keyframe at tick %u.", nearest->tick);
+                        return false;
+                    }
+                    commandIndex = nearest->commandIndex;
+                }
+                else if (!LoadReplayDataMap(*_currentReplay))
+                {
+                    log_error("Unable to load map.");
+                    return false;
+                }
+                gCurrentTicks = nearestTick;
+                SkipCommandsBefore(nearestTick, commandIndex);
+
+                auto checksum = std::find_if(
+                    _currentReplay->checksums.begin(), _currentReplay->checksums.end(),
+                    [nearestTick](const std::pair<uint32_t, rct_sprite_checksum>& c) { return c.first >= nearestTick; });
+                _currentReplay->checksumIndex = (uint32_t)(checksum - _currentReplay->checksums.begin());
+                _faultyChecksumIndex = -1;
+            }
+
+            auto gameState = GetContext()->GetGameState();
+            while (_mode == ReplayMode::PLAYING && gCurrentTicks < targetTick)
+            {
+                gameState->UpdateLogic();
+            }
+
             return true;
         }
 
@@ -482,16 +609,263 @@ namespace OpenRCT2
             return true;
         }
 
+        virtual bool StartTrajectoryRecording(
+            const std::string& file, uint32_t keyframeSteps /*= k_DefaultTrajectoryKeyframeSteps*/) override
+        {
+            if (_trajectoryRecording != nullptr)
+                return false;
+
+            auto recording = std::make_unique<TrajectoryRecording>();
+            try
+            {
+                recording->stream = std::make_unique<FileStream>(file, FILE_MODE_WRITE);
+                recording->writer = std::make_unique<TrajectoryWriter>(recording->stream.get());
+            }
+            catch (const std::exception& e)
+            {
+                log_error("Unable to create trajectory '%s': %s", file.c_str(), e.what());
+                return false;
+            }
+            recording->keyframeSteps = keyframeSteps;
+
+            _trajectoryRecording = std::move(recording);
+
+            // Re-simulation has to start from somewhere.
+            WriteTrajectoryKeyframe();
+            return true;
+        }
+
+        virtual bool AddTrajectoryStep(float reward, bool done) override
+        {
+            if (_trajectoryRecording == nullptr)
+                return false;
+
+            auto& recording = *_trajectoryRecording;
+
+            DataSerialiser ds(true, recording.pendingSteps);
+            ds << gCurrentTicks;
+            ds << reward;
+            ds << done;
+            ds << recording.stepActionCount;
+            if (recording.stepActionCount != 0)
+            {
+                recording.pendingSteps.Write(recording.stepActions.GetData(), recording.stepActions.GetLength());
+            }
+            recording.pendingStepCount++;
+            recording.step++;
+
+            recording.stepActions = MemoryStream();
+            recording.stepActionCount = 0;
+
+            if (recording.pendingStepCount == TrajectoryStepsPerChunk)
+            {
+                FlushTrajectorySteps();
+            }
+            if (recording.keyframeSteps != 0 && recording.step % recording.keyframeSteps == 0)
+            {
+                WriteTrajectoryKeyframe();
+            }
+            return true;
+        }
+
+        virtual bool StopTrajectoryRecording() override
+        {
+            if (_trajectoryRecording == nullptr)
+                return false;
+
+            // Actions that were executed after the last step are not part of the trajectory.
+            FlushTrajectorySteps();
+            _trajectoryRecording.reset();
+            return true;
+        }
+
+        virtual bool IsRecordingTrajectory() const override
+        {
+            return _trajectoryRecording != nullptr;
+        }
+
+        virtual bool StartTrajectoryPlayback(const std::string& file, uint64_t step /*= 0*/) override
+        {
+            auto playback = std::make_unique<TrajectoryPlayback>();
+            try
+            {
+                playback->stream = std::make_unique<FileStream>(file, FILE_MODE_OPEN);
+                playback->reader = std::make_unique<TrajectoryReader>(playback->stream.get());
+                if (playback->reader->IsTruncated())
+                {
+                    log_warning(
+                        "Trajectory '%s' is incomplete, it ends at step %llu.", file.c_str(),
+                        (unsigned long long)playback->reader->GetStepCount());
+                }
+
+                auto keyframeIndex = playback->reader->FindKeyframe(step);
+                if (keyframeIndex == -1)
+                {
+                    log_error("Trajectory '%s' has no keyframe.", file.c_str());
+                    return false;
+                }
+                if (!LoadTrajectoryKeyframe(*playback, keyframeIndex))
+                {
+                    return false;
+                }
+            }
+            catch (const std::exception& e)
+            {
+                log_error("Unable to read trajectory '%s': %s", file.c_str(), e.what());
+                return false;
+            }
+
+            _trajectoryPlayback = std::move(playback);
+
+            TrajectoryStep skipped;
+            while (_trajectoryPlayback->step < step)
+            {
+                if (!PlayTrajectoryStep(skipped))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        virtual bool PlayTrajectoryStep(TrajectoryStep& result) override
+        {
+            if (_trajectoryPlayback == nullptr)
+                return false;
+
+            auto& playback = *_trajectoryPlayback;
+            try
+            {
+                if (playback.chunkStepsLeft == 0 && !ReadTrajectoryStepsChunk(playback))
+                {
+                    return false;
+                }
+
+                DataSerialiser ds(false, *playback.chunkStream);
+                uint32_t endTick = 0;
+                uint32_t actionCount = 0;
+                ds << endTick;
+                ds << result.Reward;
+                ds << result.Done;
+                ds << actionCount;
+
+                // Actions run between ticks, the same way they did while recording.
+                auto gameState = GetContext()->GetGameState();
+                for (uint32_t i = 0; i < actionCount; i++)
+                {
+                    ReplayCommand command;
+                    SerialiseCommand(ds, command);
+                    while (gCurrentTicks < command.tick)
+                    {
+                        gameState->UpdateLogic();
+                    }
+                    GameActions::Execute(command.action.get());
+                }
+                while (gCurrentTicks < endTick)
+                {
+                    gameState->UpdateLogic();
+                }
+
+                result.Step = playback.step;
+                result.Tick = gCurrentTicks;
+                result.NumActions = actionCount;
+            }
+            catch (const std::exception& e)
+            {
+                log_error("Unable to read trajectory step %llu: %s", (unsigned long long)playback.step, e.what());
+                return false;
+            }
+
+            playback.chunkStepsLeft--;
+            playback.step++;
+            return true;
+        }
+
+        virtual bool StopTrajectoryPlayback() override
+        {
+            if (_trajectoryPlayback == nullptr)
+                return false;
+
+            _trajectoryPlayback.reset();
+            return true;
+        }
+
+        virtual bool IsPlayingTrajectory() const override
+        {
+            return _trajectoryPlayback != nullptr;
+        }
+
+        virtual bool VerifyReplay(const std::string& file, ReplayVerifyResult& result) override
+        {
+            if (!StartPlayback(file, 0))
+            {
+                return false;
+            }
+
+            uint32_t tickStart = _currentReplay->tickStart;
+            uint32_t tickEnd = _currentReplay->tickEnd;
+            bool startMismatch = _snapshotMismatch;
+
+            // A checksum only tells that the state differs, the first keyframe after the mismatch tells how.
+            ReplayKeyframe* compareKeyframe = nullptr;
+
+            auto gameState = GetContext()->GetGameState();
+            auto startTime = std::chrono::high_resolution_clock::now();
+            while (_mode == ReplayMode::PLAYING)
+            {
+                if (compareKeyframe != nullptr && compareKeyframe->tick == gCurrentTicks)
+                {
+                    CompareWithKeyframe(*compareKeyframe);
+                    compareKeyframe = nullptr;
+                }
+
+                bool mismatching = _faultyChecksumIndex != -1;
+                gameState->UpdateLogic();
+
+                if (!mismatching && _faultyChecksumIndex != -1 && _mode == ReplayMode::PLAYING)
+                {
+                    auto& keyframes = _currentReplay->keyframes;
+                    auto keyframe = std::find_if(keyframes.begin(), keyframes.end(), [](const ReplayKeyframe& kf) {
+                        return kf.tick >= gCurrentTicks;
+                    });
+                    if (keyframe != keyframes.end())
+                    {
+                        compareKeyframe = &*keyframe;
+                    }
+                }
+            }
+            std::chrono::duration<double> duration = std::chrono::high_resolution_clock::now() - startTime;
+
+            result.Ticks = tickEnd - tickStart;
+            result.TicksPerSecond = duration.count() > 0 ? result.Ticks / duration.count() : 0;
+            result.Mismatch = _faultyChecksumIndex != -1 || _snapshotMismatch;
+            if (startMismatch)
+            {
+                result.FirstMismatchTick = 0;
+            }
+            else if (_faultyChecksumIndex != -1)
+            {
+                result.FirstMismatchTick = _firstMismatchTick;
+            }
+            else
+            {
+                result.FirstMismatchTick = result.Ticks;
+            }
+            result.CompareText = _snapshotCompareText;
+
+            return true;
+        }
+
         virtual bool NormaliseReplay(const std::string& file, const std::string& outFile) override
         {
             _mode = ReplayMode::NORMALISATION;
 
-            if (!StartPlayback(file))
+            if (!StartPlayback(file, 0))
             {
                 return false;
             }
 
-            if (!StartRecording(outFile, k_MaxReplayTicks, RecordType::NORMAL))
+            if (!StartRecording(outFile, k_MaxReplayTicks, RecordType::NORMAL, k_DefaultReplayKeyframeTicks))
             {
                 StopPlayback();
                 return false;
@@ -516,30 +890,91 @@ namespace OpenRCT2
         }
 
         bool LoadReplayDataMap(ReplayRecordData& data)
+        {
+            auto context = GetContext();
+            auto importer = ParkImporter::CreateS6(context->GetObjectRepository());
+            return LoadReplayState(*importer, data.parkData, data.parkParams, data.cheatData);
+        }
+
+        // Commands recorded before the state was captured are already part of it.
+        void SkipCommandsBefore(uint32_t tick, uint32_t commandIndex)
+        {
+            ReplayCommand firstCommand;
+            firstCommand.tick = tick;
+            firstCommand.commandIndex = commandIndex;
+            _currentReplay->nextCommand = _currentReplay->commands.lower_bound(firstCommand);
+        }
+
+        /**
+         * Compares the simulated game state with the recorded keyframe and continues playback from the recorded state. The
+         * differences are kept for VerifyReplay.
+         */
+        void CompareWithKeyframe(ReplayKeyframe& keyframe)
+        {
+            IGameStateSnapshots* snapshots = GetContext()->GetGameStateSnapshots();
+
+            auto& localSnapshot = snapshots->CreateSnapshot();
+            snapshots->Capture(localSnapshot);
+            snapshots->LinkSnapshot(localSnapshot, gCurrentTicks, scenario_rand_state().s0);
+
+            if (!LoadKeyframe(keyframe))
+            {
+                log_error("Unable to load replay keyframe at tick %u.", keyframe.tick);
+                return;
+            }
+            gCurrentTicks = keyframe.tick;
+            SkipCommandsBefore(keyframe.tick, keyframe.commandIndex);
+
+            auto& recordedSnapshot = snapshots->CreateSnapshot();
+            snapshots->Capture(recordedSnapshot);
+            snapshots->LinkSnapshot(recordedSnapshot, gCurrentTicks, scenario_rand_state().s0);
+
+            GameStateCompareData_t cmpData = snapshots->Compare(recordedSnapshot, localSnapshot);
+            if (cmpData.HasDifferences() && _snapshotCompareText.empty())
+            {
+                _snapshotCompareText = snapshots->GetCompareDataText(cmpData);
+            }
+        }
+
+        bool LoadKeyframe(ReplayKeyframe& keyframe)
+        {
+            auto parkData = Decompress(keyframe.parkData, keyframe.uncompressedSize);
+            if (parkData == nullptr)
+            {
+                return false;
+            }
+
+            auto context = GetContext();
+            auto importer = ParkImporter::CreateParkSnapshot(context->GetObjectRepository());
+            return LoadReplayState(*importer, *parkData, keyframe.parkParams, keyframe.cheatData);
+        }
+
+        bool LoadReplayState(IParkImporter& importer, MemoryStream& parkData, MemoryStream& parkParams, MemoryStream& cheatData)
         {
             try
             {
-                data.parkData.SetPosition(0);
+                parkData.SetPosition(0);
+                parkParams.SetPosition(0);
+                cheatData.SetPosition(0);
 
                 auto context = GetContext();
                 auto& objManager = context->GetObjectManager();
-                auto importer = ParkImporter::CreateS6(context->GetObjectRepository());
 
-                auto loadResult = importer->LoadFromStream(&data.parkData, false);
+                auto loadResult = importer.LoadFromStream(&parkData, false);
                 objManager.LoadObjects(loadResult.RequiredObjects.data(), loadResult.RequiredObjects.size());
 
-                importer->Import();
+                importer.Import();
 
                 sprite_position_tween_reset();
 
                 // Load all map global variables.
-                DataSerialiser parkParamsDs(false, data.parkParams);
+                DataSerialiser parkParamsDs(false, parkParams);
                 SerialiseParkParameters(parkParamsDs);
 
                 // New cheats might not be serialised, make sure they are using their defaults.
                 CheatsReset();
 
-                DataSerialiser cheatDataDs(false, data.cheatData);
+                DataSerialiser cheatDataDs(false, cheatData);
                 SerialiseCheats(cheatDataDs);
 
                 game_load_init();
@@ -553,6 +988,165 @@ namespace OpenRCT2
             return true;
         }
 
+        void AddKeyframe()
+        {
+            ReplayKeyframe keyframe;
+            keyframe.tick = gCurrentTicks;
+            keyframe.commandIndex = _commandId;
+
+            MemoryStream parkData;
+            CaptureState(parkData, keyframe.parkParams, keyframe.cheatData);
+            keyframe.uncompressedSize = parkData.GetLength();
+            if (!Compress(parkData, keyframe.parkData, KeyframeCompressionLevel))
+            {
+                log_error("Unable to compress replay keyframe at tick %u.", keyframe.tick);
+                return;
+            }
+
+            _currentRecording->keyframes.push_back(std::move(keyframe));
+        }
+
+        void CaptureState(MemoryStream& parkData, MemoryStream& parkParams, MemoryStream& cheatData)
+        {
+            auto exporter = std::make_unique<S6Exporter>();
+            exporter->ExportSnapshot();
+            exporter->SaveSnapshot(&parkData);
+
+            DataSerialiser parkParamsDs(true, parkParams);
+            SerialiseParkParameters(parkParamsDs);
+
+            DataSerialiser cheatDataDs(true, cheatData);
+            SerialiseCheats(cheatDataDs);
+        }
+
+        static bool Compress(const MemoryStream& input, MemoryStream& output, int level)
+        {
+            unsigned long compressLength = compressBound(static_cast<unsigned long>(input.GetLength()));
+            auto compressBuf = std::make_unique<unsigned char[]>(compressLength);
+            if (compress2(
+                    compressBuf.get(), &compressLength, (const unsigned char*)input.GetData(),
+                    static_cast<unsigned long>(input.GetLength()), level)
+                != Z_OK)
+            {
+                return false;
+            }
+            output.Write(compressBuf.get(), compressLength);
+            return true;
+        }
+
+        static std::unique_ptr<MemoryStream> Decompress(const MemoryStream& input, uint64_t uncompressedSize)
+        {
+            // The size comes from the file, check it before allocating for it.
+            if (uncompressedSize == 0 || uncompressedSize > input.GetLength() * KeyframeMaxCompressionRatio)
+            {
+                return nullptr;
+            }
+
+            auto buff = std::make_unique<unsigned char[]>(uncompressedSize);
+            unsigned long outSize = static_cast<unsigned long>(uncompressedSize);
+            if (uncompress(buff.get(), &outSize, (const unsigned char*)input.GetData(), input.GetLength()) != Z_OK
+                || outSize != uncompressedSize)
+            {
+                return nullptr;
+            }
+            return std::make_unique<MemoryStream>(buff.get(), outSize);
+        }
+
+        void AddTrajectoryAction(const GameAction* action)
+        {
+            auto& recording = *_trajectoryRecording;
+
+            ReplayCommand command(gCurrentTicks, GameActions::Clone(action), recording.actionIndex++);
+            DataSerialiser ds(true, recording.stepActions);
+            SerialiseCommand(ds, command);
+            recording.stepActionCount++;
+        }
+
+        void FlushTrajectorySteps()
+        {
+            auto& recording = *_trajectoryRecording;
+            if (recording.pendingStepCount == 0)
+                return;
+
+            recording.writer->WriteChunk(
+                Trajectory::ChunkType::Steps, recording.step - recording.pendingStepCount, recording.pendingStepCount,
+                recording.pendingSteps.GetData(), recording.pendingSteps.GetLength(), TrajectoryStepsCompressionLevel);
+            recording.pendingSteps = MemoryStream();
+            recording.pendingStepCount = 0;
+        }
+
+        void WriteTrajectoryKeyframe()
+        {
+            auto& recording = *_trajectoryRecording;
+
+            // Steps before the keyframe have to come first so playback can continue with the chunk after it.
+            FlushTrajectorySteps();
+
+            MemoryStream parkData;
+            MemoryStream parkParams;
+            MemoryStream cheatData;
+            CaptureState(parkData, parkParams, cheatData);
+
+            MemoryStream keyframe;
+            DataSerialiser ds(true, keyframe);
+            ds << gCurrentTicks;
+            ds << parkData;
+            ds << parkParams;
+            ds << cheatData;
+
+            recording.writer->WriteChunk(
+                Trajectory::ChunkType::Keyframe, recording.step, 0, keyframe.GetData(), keyframe.GetLength(),
+                KeyframeCompressionLevel);
+        }
+
+        bool LoadTrajectoryKeyframe(TrajectoryPlayback& playback, int32_t chunkIndex)
+        {
+            auto data = playback.reader->ReadChunk(chunkIndex);
+            MemoryStream keyframe(data.data(), data.size());
+
+            uint32_t tick = 0;
+            MemoryStream parkData;
+            MemoryStream parkParams;
+            MemoryStream cheatData;
+            DataSerialiser ds(false, keyframe);
+            ds << tick;
+            ds << parkData;
+            ds << parkParams;
+            ds << cheatData;
+
+            auto context = GetContext();
+            auto importer = ParkImporter::CreateParkSnapshot(context->GetObjectRepository());
+            if (!LoadReplayState(*importer, parkData, parkParams, cheatData))
+            {
+                log_error("Unable to load trajectory keyframe.");
+                return false;
+            }
+            gCurrentTicks = tick;
+
+            playback.step = playback.reader->GetChunks()[chunkIndex].FirstStep;
+            playback.nextChunk = chunkIndex + 1;
+            playback.chunkStepsLeft = 0;
+            return true;
+        }
+
+        bool ReadTrajectoryStepsChunk(TrajectoryPlayback& playback)
+        {
+            const auto& chunks = playback.reader->GetChunks();
+            while (playback.nextChunk < chunks.size())
+            {
+                const auto& chunk = chunks[playback.nextChunk++];
+                if (chunk.Type != Trajectory::ChunkType::Steps || chunk.StepCount == 0)
+                    continue;
+
+                playback.chunkData = playback.reader->ReadChunk(playback.nextChunk - 1);
+                playback.chunkStream = std::make_unique<MemoryStream>(
+                    playback.chunkData.data(), playback.chunkData.size(), MEMORY_ACCESS::READ);
+                playback.chunkStepsLeft = chunk.StepCount;
+                return true;
+            }
+            return false;
+        }
+
         bool ReadReplayFromFile(const std::string& file, MemoryStream& stream)
         {
             FILE* fp = fopen(file.c_str(), "rb");
@@ -647,6 +1241,7 @@ namespace OpenRCT2
             data.parkParams.SetPosition(0);
             data.cheatData.SetPosition(0);
             data.gameStateSnapshots.SetPosition(0);
+            data.nextCommand = data.commands.begin();
 
             return true;
         }
@@ -707,7 +1302,7 @@ namespace OpenRCT2
 
         bool Compatible(ReplayRecordData& data)
         {
-            return data.version == ReplayVersion;
+            return data.version == ReplayVersion || data.version == ReplayVersionWithoutKeyframes;
         }
 
         bool Serialise(DataSerialiser& serialiser, ReplayRecordData& data)
@@ -780,9 +1375,39 @@ namespace OpenRCT2
             }
 
             serialiser << data.gameStateSnapshots;
+
+            if (data.version >= ReplayVersion)
+            {
+                SerialiseKeyframes(serialiser, data);
+            }
             return true;
         }
 
+        void SerialiseKeyframes(DataSerialiser& serialiser, ReplayRecordData& data)
+        {
+            uint32_t countKeyframes = (uint32_t)data.keyframes.size();
+            serialiser << countKeyframes;
+
+            if (serialiser.IsLoading())
+            {
+                data.keyframes.resize(countKeyframes);
+            }
+
+            // The index comes first so the keyframes can be picked before any of them is decompressed.
+            for (auto& keyframe : data.keyframes)
+            {
+                serialiser << keyframe.tick;
+                serialiser << keyframe.commandIndex;
+                serialiser << keyframe.uncompressedSize;
+            }
+            for (auto& keyframe : data.keyframes)
+            {
+                serialiser << keyframe.parkData;
+                serialiser << keyframe.parkParams;
+                serialiser << keyframe.cheatData;
+            }
+        }
+
 #ifndef DISABLE_NETWORK
         void CheckState()
         {
@@ -804,7 +1429,12 @@ namespace OpenRCT2
                         "Different sprite checksum at tick %u (Replay Tick: %u) ; Saved: %s, Current: %s", gCurrentTicks,
                         replayTick, savedChecksum.second.ToString().c_str(), checksum.ToString().c_str());
 
-                    _faultyChecksumIndex = checksumIndex;
+                    // Keep the first mismatch, later ones are most likely caused by it.
+                    if (_faultyChecksumIndex == -1)
+                    {
+                        _faultyChecksumIndex = checksumIndex;
+                        _firstMismatchTick = replayTick;
+                    }
                 }
                 else
                 {
@@ -820,11 +1450,12 @@ namespace OpenRCT2
 
         void ReplayCommands()
         {
-            auto& replayQueue = _currentReplay->commands;
+            // Commands stay in the replay so that playback can seek backwards.
+            auto& nextCommand = _currentReplay->nextCommand;
 
-            while (replayQueue.begin() != replayQueue.end())
+            while (nextCommand != _currentReplay->commands.end())
             {
-                const ReplayCommand& command = (*replayQueue.begin());
+                const ReplayCommand& command = *nextCommand;
 
                 if (_mode == ReplayMode::PLAYING)
                 {
@@ -860,7 +1491,7 @@ namespace OpenRCT2
                         window_scroll_to_location(mainWindow, result->Position.x, result->Position.y, result->Position.z);
                 }
 
-                replayQueue.erase(replayQueue.begin());
+                ++nextCommand;
             }
         }
 
@@ -872,6 +1503,13 @@ namespace OpenRCT2
         uint32_t _commandId = 0;
         uint32_t _nextChecksumTick = 0;
         uint32_t _nextReplayTick = 0;
+        std::unique_ptr<TrajectoryRecording> _trajectoryRecording;
+        std::unique_ptr<TrajectoryPlayback> _trajectoryPlayback;
+        uint32_t _firstMismatchTick = 0;
+        bool _snapshotMismatch = false;
+        std::string _snapshotCompareText;
+        uint32_t _keyframeTicks = 0;
+        uint32_t _nextKeyframeTick = 0;
         RecordType _recordType = RecordType::NORMAL;
     };
 
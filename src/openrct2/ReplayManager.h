@@ -21,6 +21,12 @@ namespace OpenRCT2
 {
     static constexpr uint32_t k_MaxReplayTicks = 0xFFFFFFFF;
 
+    // Interval at which recordings store a full game state that playback can seek to, 0 disables keyframes.
+    static constexpr uint32_t k_DefaultReplayKeyframeTicks = 4000;
+
+    // Interval at which trajectories store a full game state that playback can start from, 0 only stores the first one.
+    static constexpr uint32_t k_DefaultTrajectoryKeyframeSteps = 10000;
+
     struct ReplayRecordInfo
     {
         uint16_t Version;
@@ -28,10 +34,29 @@ namespace OpenRCT2
         uint64_t TimeRecorded;
         uint32_t NumCommands;
         uint32_t NumChecksums;
+        uint32_t NumKeyframes;
         std::string Name;
         std::string FilePath;
     };
 
+    struct ReplayVerifyResult
+    {
+        uint32_t Ticks;
+        double TicksPerSecond;
+        bool Mismatch;
+        uint32_t FirstMismatchTick; // Relative to the start of the replay.
+        std::string CompareText;    // First differences found, at the start, the first keyframe after a mismatch or the end.
+    };
+
+    struct TrajectoryStep
+    {
+        uint64_t Step;
+        uint32_t Tick; // Tick at the end of the step.
+        float Reward;
+        bool Done;
+        uint32_t NumActions;
+    };
+
     interface IReplayManager
     {
     public:
@@ -53,16 +78,48 @@ namespace OpenRCT2
         virtual void AddGameAction(uint32_t tick, const GameAction* action) = 0;
 
         virtual bool StartRecording(
-            const std::string& name, uint32_t maxTicks = k_MaxReplayTicks, RecordType rt = RecordType::NORMAL)
+            const std::string& name, uint32_t maxTicks = k_MaxReplayTicks, RecordType rt = RecordType::NORMAL,
+            uint32_t keyframeTicks = k_DefaultReplayKeyframeTicks)
             = 0;
         virtual bool StopRecording(bool discard = false) = 0;
         virtual bool GetCurrentReplayInfo(ReplayRecordInfo & info) const = 0;
 
-        virtual bool StartPlayback(const std::string& file) = 0;
+        virtual bool StartPlayback(const std::string& file, uint32_t replayTick = 0) = 0;
+        /**
+         * Moves playback to the given tick, relative to the start of the replay, by restoring the nearest keyframe at or
+         * before it and simulating the remaining ticks. Must not be called from within a game tick.
+         */
+        virtual bool SeekPlayback(uint32_t replayTick) = 0;
         virtual bool IsPlaybackStateMismatching() const = 0;
         virtual bool StopPlayback() = 0;
 
         virtual bool NormaliseReplay(const std::string& inputFile, const std::string& outputFile) = 0;
+        /**
+         * Plays the whole replay as fast as possible and reports whether the simulation matched the recording. After the
+         * first checksum mismatch the state is compared with the next keyframe, playback continues from the recorded state.
+         */
+        virtual bool VerifyReplay(const std::string& file, ReplayVerifyResult & result) = 0;
+
+        /**
+         * Trajectories record the game actions executed between steps together with the reward and whether the episode
+         * ended, plus periodic keyframes. Observations are not stored, they can be regenerated by playing the trajectory
+         * back which simulates the same ticks again.
+         */
+        virtual bool StartTrajectoryRecording(
+            const std::string& file, uint32_t keyframeSteps = k_DefaultTrajectoryKeyframeSteps)
+            = 0;
+        virtual bool AddTrajectoryStep(float reward, bool done) = 0;
+        virtual bool StopTrajectoryRecording() = 0;
+        virtual bool IsRecordingTrajectory() const = 0;
+
+        /**
+         * Restores the nearest keyframe at or before the given step and simulates up to it. Each call to
+         * PlayTrajectoryStep then simulates one more step, it returns false at the end of the trajectory.
+         */
+        virtual bool StartTrajectoryPlayback(const std::string& file, uint64_t step = 0) = 0;
+        virtual bool PlayTrajectoryStep(TrajectoryStep & step) = 0;
+        virtual bool StopTrajectoryPlayback() = 0;
+        virtual bool IsPlayingTrajectory() const = 0;
     };
 
     std::unique_ptr<IReplayManager> CreateReplayManager();
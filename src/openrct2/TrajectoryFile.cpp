@@ -0,0 +1,143 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "TrajectoryFile.h"
+
+#include "core/IStream.hpp"
+#include "core/String.hpp"
+#include "zlib.h"
+
+#include <cstddef>
+#include <memory>
+
+using namespace Trajectory;
+
+static uint32_t GetHeaderCrc(const ChunkHeader& header)
+{
+    return crc32(0, reinterpret_cast<const Bytef*>(&header), offsetof(ChunkHeader, HeaderCrc));
+}
+
+TrajectoryWriter::TrajectoryWriter(IStream* stream)
+    : _stream(stream)
+{
+    FileHeader header{};
+    header.Magic = MAGIC;
+    header.Version = VERSION;
+    _stream->Write(&header);
+}
+
+void TrajectoryWriter::WriteChunk(
+    ChunkType type, uint64_t firstStep, uint32_t stepCount, const void* data, size_t length, int compressionLevel)
+{
+    uLongf compressedLength = compressBound(static_cast<uLong>(length));
+    auto compressed = std::make_unique<Bytef[]>(compressedLength);
+    auto result = compress2(
+        compressed.get(), &compressedLength, static_cast<const Bytef*>(data), static_cast<uLong>(length), compressionLevel);
+    if (result != Z_OK)
+    {
+        throw IOException("Unable to compress trajectory chunk.");
+    }
+
+    ChunkHeader header{};
+    header.Type = static_cast<uint8_t>(type);
+    header.StepCount = stepCount;
+    header.FirstStep = firstStep;
+    header.Length = static_cast<uint32_t>(length);
+    header.CompressedLength = static_cast<uint32_t>(compressedLength);
+    header.PayloadCrc = crc32(0, compressed.get(), static_cast<uInt>(compressedLength));
+    header.HeaderCrc = GetHeaderCrc(header);
+
+    _stream->Write(&header);
+    _stream->Write(compressed.get(), compressedLength);
+}
+
+TrajectoryReader::TrajectoryReader(IStream* stream)
+    : _stream(stream)
+{
+    FileHeader fileHeader{};
+    if (_stream->TryRead(&fileHeader, sizeof(fileHeader)) != sizeof(fileHeader) || fileHeader.Magic != MAGIC)
+    {
+        throw IOException("Not a trajectory file.");
+    }
+    if (fileHeader.Version != VERSION)
+    {
+        throw IOException(String::StdFormat("Unsupported trajectory version %u.", fileHeader.Version));
+    }
+
+    auto length = _stream->GetLength();
+    while (_stream->GetPosition() < length)
+    {
+        ChunkHeader header{};
+        if (_stream->TryRead(&header, sizeof(header)) != sizeof(header) || header.HeaderCrc != GetHeaderCrc(header)
+            || header.CompressedLength > length - _stream->GetPosition())
+        {
+            _truncated = true;
+            break;
+        }
+
+        ChunkInfo chunk{};
+        chunk.Type = static_cast<ChunkType>(header.Type);
+        chunk.StepCount = header.StepCount;
+        chunk.FirstStep = header.FirstStep;
+        chunk.Offset = _stream->GetPosition();
+        chunk.Length = header.Length;
+        chunk.CompressedLength = header.CompressedLength;
+        chunk.PayloadCrc = header.PayloadCrc;
+        _chunks.push_back(chunk);
+
+        _stream->SetPosition(chunk.Offset + chunk.CompressedLength);
+    }
+}
+
+uint64_t TrajectoryReader::GetStepCount() const
+{
+    for (auto it = _chunks.rbegin(); it != _chunks.rend(); it++)
+    {
+        if (it->Type == ChunkType::Steps)
+        {
+            return it->FirstStep + it->StepCount;
+        }
+    }
+    return 0;
+}
+
+int32_t TrajectoryReader::FindKeyframe(uint64_t step) const
+{
+    int32_t result = -1;
+    for (size_t i = 0; i < _chunks.size(); i++)
+    {
+        if (_chunks[i].Type == ChunkType::Keyframe && _chunks[i].FirstStep <= step)
+        {
+            result = static_cast<int32_t>(i);
+        }
+    }
+    return result;
+}
+
+std::vector<uint8_t> TrajectoryReader::ReadChunk(size_t index) const
+{
+    const auto& chunk = _chunks.at(index);
+
+    std::vector<uint8_t> compressed(chunk.CompressedLength);
+    _stream->SetPosition(chunk.Offset);
+    _stream->Read(compressed.data(), compressed.size());
+    if (crc32(0, compressed.data(), static_cast<uInt>(compressed.size())) != chunk.PayloadCrc)
+    {
+        throw IOException(String::StdFormat("Trajectory chunk %u is corrupt.", static_cast<uint32_t>(index)));
+    }
+
+    std::vector<uint8_t> result(chunk.Length);
+    uLongf resultLength = static_cast<uLongf>(result.size());
+    if (uncompress(result.data(), &resultLength, compressed.data(), static_cast<uLong>(compressed.size())) != Z_OK
+        || resultLength != result.size())
+    {
+        throw IOException(String::StdFormat("Trajectory chunk %u is corrupt.", static_cast<uint32_t>(index)));
+    }
+    return result;
+}
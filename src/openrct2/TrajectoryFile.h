@@ -0,0 +1,125 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "common.h"
+
+#include <vector>
+
+interface IStream;
+
+/**
+ * Trajectory files store what happened during a session as a sequence of independently compressed chunks which are only
+ * ever appended. A chunk either holds a run of steps or a keyframe of the whole game state, so a file that was cut off
+ * while writing is still readable up to the last complete chunk.
+ *
+ * Layout: a file header, then chunks of a chunk header followed by the zlib compressed payload.
+ */
+namespace Trajectory
+{
+    constexpr uint32_t MAGIC = 0x4A54524F; // "ORTJ"
+    constexpr uint16_t VERSION = 1;
+
+    enum class ChunkType : uint8_t
+    {
+        Steps,
+        Keyframe,
+    };
+
+#pragma pack(push, 1)
+    struct FileHeader
+    {
+        uint32_t Magic;
+        uint16_t Version;
+        uint16_t Reserved;
+    };
+    assert_struct_size(FileHeader, 8);
+
+    struct ChunkHeader
+    {
+        uint8_t Type;
+        uint8_t Reserved[3];
+        uint32_t StepCount; // Number of steps in a steps chunk, 0 for keyframes.
+        uint64_t FirstStep; // Index of the first step, for keyframes the number of steps taken before the state.
+        uint32_t Length;
+        uint32_t CompressedLength;
+        uint32_t PayloadCrc;
+        uint32_t HeaderCrc; // Covers every field above.
+    };
+    assert_struct_size(ChunkHeader, 32);
+#pragma pack(pop)
+
+    struct ChunkInfo
+    {
+        ChunkType Type;
+        uint32_t StepCount;
+        uint64_t FirstStep;
+        uint64_t Offset; // Position of the payload in the stream.
+        uint32_t Length;
+        uint32_t CompressedLength;
+        uint32_t PayloadCrc;
+    };
+} // namespace Trajectory
+
+/**
+ * Appends chunks to a trajectory stream, the file header is written on construction.
+ */
+class TrajectoryWriter final
+{
+private:
+    IStream* _stream;
+
+public:
+    explicit TrajectoryWriter(IStream* stream);
+
+    void WriteChunk(
+        Trajectory::ChunkType type, uint64_t firstStep, uint32_t stepCount, const void* data, size_t length,
+        int compressionLevel);
+};
+
+/**
+ * Indexes the chunks of a trajectory stream by reading their headers only, payloads are decompressed on demand. An
+ * incomplete or damaged chunk ends the trajectory, everything before it is still available.
+ */
+class TrajectoryReader final
+{
+private:
+    IStream* _stream;
+    std::vector<Trajectory::ChunkInfo> _chunks;
+    bool _truncated = false;
+
+public:
+    explicit TrajectoryReader(IStream* stream);
+
+    const std::vector<Trajectory::ChunkInfo>& GetChunks() const
+    {
+        return _chunks;
+    }
+
+    /**
+     * Whether the stream ends with an incomplete or damaged chunk.
+     */
+    bool IsTruncated() const
+    {
+        return _truncated;
+    }
+
+    uint64_t GetStepCount() const;
+
+    /**
+     * Returns the index of the last keyframe taken at or before the given step, -1 if there is none.
+     */
+    int32_t FindKeyframe(uint64_t step) const;
+
+    /**
+     * Decompresses the payload of a chunk. Throws if it does not match its checksum.
+     */
+    std::vector<uint8_t> ReadChunk(size_t index) const;
+};
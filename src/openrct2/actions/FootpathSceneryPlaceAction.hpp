@@ -15,6 +15,7 @@
 #include "../interface/Window.h"
 #include "../localisation/StringIds.h"
 #include "../management/Finance.h"
+#include "../world/ActiveTiles.h"
 #include "../world/Footpath.h"
 #include "../world/Location.hpp"
 #include "../world/Park.h"
@@ -191,6 +192,7 @@ public:
         }
 
         pathElement->SetAddition(_pathItemType);
+        ActiveTiles::MarkActive(_loc);
         pathElement->SetIsBroken(false);
         if (_pathItemType != 0)
         {
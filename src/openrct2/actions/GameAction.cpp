@@ -17,6 +17,8 @@
 #include "../localisation/Localisation.h"
 #include "../network/network.h"
 #include "../platform/platform.h"
+#include "../ride/StationQueues.h"
+#include "../ride/Vehicle.h"
 #include "../scenario/Scenario.h"
 #include "../world/Park.h"
 #include "../world/Scenery.h"
@@ -403,6 +405,10 @@ namespace GameActions
             // Execute the action, changing the game state
             result = action->Execute();
 
+            // The action may have changed the queue paths leading to ride entrances or what sleeping trains wait for.
+            StationQueues::InvalidateQueueEnds();
+            vehicle_wake_all();
+
             LogActionFinish(logContext, action, result);
 
             // If not top level just give away the result.
@@ -447,6 +453,8 @@ namespace GameActions
                             recordAction = true;
                         else if (replayManager->IsNormalising() && (flags & GAME_COMMAND_FLAG_REPLAY) != 0)
                             recordAction = true; // In normalisation we only feed back actions issued by the replay manager.
+                        else if (replayManager->IsRecordingTrajectory() && commandExecutes)
+                            recordAction = true;
                     }
                     if (recordAction)
                     {
@@ -18,6 +18,7 @@
 #include "../localisation/StringIds.h"
 #include "../windows/Intent.h"
 #include "../world/Park.h"
+#include "../world/ParkStatistics.h"
 #include "../world/Sprite.h"
 #include "GameAction.h"
 
@@ -92,6 +93,7 @@ public:
         if (guest != nullptr)
         {
             guest->HandleEasterEggName();
+            ParkStatistics::UpdateGuest(guest);
         }
 
         gfx_invalidate_screen();
@@ -29,6 +29,7 @@
 #include "../world/Location.hpp"
 #include "../world/Map.h"
 #include "../world/Park.h"
+#include "../world/ParkStatistics.h"
 #include "../world/Scenery.h"
 #include "../world/Sprite.h"
 #include "../world/Surface.h"
@@ -237,6 +238,9 @@ public:
             case CheatType::RemoveDucks:
                 duck_remove_all();
                 break;
+            case CheatType::SetGuestCount:
+                SetGuestCount(_param1);
+                break;
             default:
             {
                 log_error("Unabled cheat: %d", _cheatType.id);
@@ -352,6 +356,8 @@ private:
                 return { { 0, 999 }, { 0, 0 } };
             case CheatType::CreateDucks:
                 return { { 0, 100 }, { 0, 0 } };
+            case CheatType::SetGuestCount:
+                return { { 0, MAX_SPRITES }, { 0, 0 } };
             default:
                 return { { 0, 0 }, { 0, 0 } };
         }
@@ -561,6 +567,13 @@ private:
         window_invalidate_by_class(WC_BOTTOM_TOOLBAR);
     }
 
+    void SetGuestCount(int32_t count) const
+    {
+        auto& park = OpenRCT2::GetContext()->GetGameState()->GetPark();
+        park.SetGuestCount(count);
+        window_invalidate_by_class(WC_BOTTOM_TOOLBAR);
+    }
+
     void SetGuestParameter(int32_t parameter, int32_t value) const
     {
         int32_t spriteIndex;
@@ -606,6 +619,7 @@ private:
                     break;
             }
             peep->UpdateSpriteType();
+            ParkStatistics::UpdateGuest(peep);
         }
     }
 
@@ -15,6 +15,7 @@
 #include "../object/ObjectManager.h"
 #include "../object/TerrainEdgeObject.h"
 #include "../object/TerrainSurfaceObject.h"
+#include "../world/ActiveTiles.h"
 #include "../world/Park.h"
 #include "../world/Surface.h"
 #include "../world/TileElement.h"
@@ -217,6 +218,7 @@ public:
                             surfaceCost += surfaceObject->Price;
 
                             surfaceElement->SetSurfaceStyle(_surfaceStyle);
+                            ActiveTiles::MarkActive(coords);
 
                             map_invalidate_tile_full(coords);
                             footpath_remove_litter({ coords, tile_element_height(coords) });
@@ -0,0 +1,218 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "CommandLine.hpp"
+
+#if defined(USE_BENCHMARK) && !defined(DISABLE_NETWORK)
+
+#    include "../network/Socket.h"
+#    include "../platform/platform.h"
+
+#    include <benchmark/benchmark.h>
+#    include <cstdint>
+#    include <memory>
+#    include <string>
+#    include <vector>
+
+constexpr uint16_t BENCH_NETWORK_PORT = 11799;
+constexpr size_t BENCH_NETWORK_MESSAGE_SIZE = 64;
+
+// Number of clients sending something each frame, like a server where most players are idle.
+constexpr size_t BENCH_NETWORK_ACTIVE_CLIENTS = 8;
+
+/**
+ * A listening socket with loopback clients connected to it, both ends of every connection are kept.
+ */
+struct LoopbackServer
+{
+    std::unique_ptr<ITcpSocket> Listener;
+    std::vector<std::unique_ptr<ITcpSocket>> Clients;
+    std::vector<std::unique_ptr<ITcpSocket>> Connections;
+
+    bool Open(size_t numClients, std::string& error)
+    {
+        try
+        {
+            Listener = CreateTcpSocket();
+            Listener->Listen("127.0.0.1", BENCH_NETWORK_PORT);
+            for (size_t i = 0; i < numClients; i++)
+            {
+                auto client = CreateTcpSocket();
+                client->Connect("127.0.0.1", BENCH_NETWORK_PORT);
+                Clients.push_back(std::move(client));
+
+                std::unique_ptr<ITcpSocket> connection;
+                for (int32_t attempt = 0; connection == nullptr && attempt < 100; attempt++)
+                {
+                    connection = Listener->Accept();
+                    if (connection == nullptr)
+                    {
+                        platform_sleep(1);
+                    }
+                }
+                if (connection == nullptr)
+                {
+                    error = "Unable to accept loopback client.";
+                    return false;
+                }
+                Connections.push_back(std::move(connection));
+            }
+            return true;
+        }
+        catch (const std::exception& e)
+        {
+            error = e.what();
+            return false;
+        }
+    }
+
+    void SendFromActiveClients(size_t frame)
+    {
+        uint8_t message[BENCH_NETWORK_MESSAGE_SIZE]{};
+        for (size_t i = 0; i < BENCH_NETWORK_ACTIVE_CLIENTS && i < Clients.size(); i++)
+        {
+            Clients[(frame * BENCH_NETWORK_ACTIVE_CLIENTS + i) % Clients.size()]->SendData(message, sizeof(message));
+        }
+    }
+};
+
+static size_t drain_connection(ITcpSocket& connection)
+{
+    uint8_t buffer[4096];
+    size_t total = 0;
+    size_t received;
+    while (connection.ReceiveData(buffer, sizeof(buffer), &received) == NETWORK_READPACKET_SUCCESS)
+    {
+        total += received;
+    }
+    return total;
+}
+
+/**
+ * What the server loop did before the poller, try to read from every connection each frame.
+ */
+static void BM_network_frame_scan(benchmark::State& state)
+{
+    LoopbackServer server;
+    std::string error;
+    if (!server.Open(state.range(0), error))
+    {
+        state.SkipWithError(error.c_str());
+        return;
+    }
+
+    size_t frame = 0;
+    size_t received = 0;
+    for (auto _ : state)
+    {
+        server.SendFromActiveClients(frame++);
+        for (auto& connection : server.Connections)
+        {
+            received += drain_connection(*connection);
+        }
+    }
+    state.SetBytesProcessed(received);
+}
+
+/**
+ * Only read from the connections the poller reports as readable.
+ */
+static void BM_network_frame_poll(benchmark::State& state)
+{
+    LoopbackServer server;
+    std::string error;
+    if (!server.Open(state.range(0), error))
+    {
+        state.SkipWithError(error.c_str());
+        return;
+    }
+
+    auto poller = CreateSocketPoller();
+    for (auto& connection : server.Connections)
+    {
+        poller->Add(connection.get(), connection.get());
+    }
+
+    size_t frame = 0;
+    size_t received = 0;
+    for (auto _ : state)
+    {
+        server.SendFromActiveClients(frame++);
+        for (const auto& event : poller->Wait(0))
+        {
+            if (event.Readable)
+            {
+                received += drain_connection(*static_cast<ITcpSocket*>(event.UserData));
+            }
+        }
+    }
+    state.SetBytesProcessed(received);
+}
+
+static int cmdline_for_bench_network(int argc, const char** argv)
+{
+    // Google benchmark does stuff to argv. It doesn't modify the pointees,
+    // but it wants to reorder the pointers, so present a copy of them.
+    std::vector<char*> argv_for_benchmark;
+
+    // argv[0] is expected to contain the binary name. It's only for logging purposes, don't bother.
+    argv_for_benchmark.push_back(nullptr);
+    for (int i = 0; i < argc; i++)
+    {
+        argv_for_benchmark.push_back((char*)argv[i]);
+    }
+    argc = (int)argv_for_benchmark.size();
+
+    if (!InitialiseWSA())
+    {
+        return -1;
+    }
+    benchmark::RegisterBenchmark("network/frame:scan", BM_network_frame_scan)->Arg(16)->Arg(128)->Arg(512);
+    benchmark::RegisterBenchmark("network/frame:poll", BM_network_frame_poll)->Arg(16)->Arg(128)->Arg(512);
+    ::benchmark::Initialize(&argc, &argv_for_benchmark[0]);
+    if (::benchmark::ReportUnrecognizedArguments(argc, &argv_for_benchmark[0]))
+        return -1;
+    ::benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
+
+static exitcode_t HandleBenchNetwork(CommandLineArgEnumerator* argEnumerator)
+{
+    const char** argv = (const char**)argEnumerator->GetArguments() + argEnumerator->GetIndex();
+    int32_t argc = argEnumerator->GetCount() - argEnumerator->GetIndex();
+    int32_t result = cmdline_for_bench_network(argc, argv);
+    if (result < 0)
+    {
+        return EXITCODE_FAIL;
+    }
+    return EXITCODE_OK;
+}
+
+#else
+static exitcode_t HandleBenchNetwork(CommandLineArgEnumerator* argEnumerator)
+{
+    log_error("Sorry, Google benchmark not enabled in this build");
+    return EXITCODE_FAIL;
+}
+#endif // USE_BENCHMARK && !DISABLE_NETWORK
+
+const CommandLineCommand CommandLine::BenchNetworkCommands[]{
+#if defined(USE_BENCHMARK) && !defined(DISABLE_NETWORK)
+    DefineCommand(
+        "",
+        "[--benchmark_list_tests={true|false}] [--benchmark_filter=<regex>] [--benchmark_min_time=<min_time>] "
+        "[--benchmark_repetitions=<num_repetitions>] [--benchmark_report_aggregates_only={true|false}] "
+        "[--benchmark_format=<console|json|csv>] [--benchmark_out=<filename>] [--benchmark_out_format=<json|console|csv>] "
+        "[--benchmark_color={auto|true|false}] [--benchmark_counters_tabular={true|false}] [--v=<verbosity>]",
+        nullptr, HandleBenchNetwork),
+    CommandTableEnd
+#else
+    DefineCommand("", "*** SORRY NOT ENABLED IN THIS BUILD ***", nullptr, HandleBenchNetwork), CommandTableEnd
+#endif // USE_BENCHMARK && !DISABLE_NETWORK
+};
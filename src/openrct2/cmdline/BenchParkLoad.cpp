@@ -0,0 +1,191 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "CommandLine.hpp"
+
+#ifdef USE_BENCHMARK
+
+#    include "../core/File.h"
+#    include "../core/MemoryStream.h"
+#    include "../core/Path.hpp"
+#    include "../platform/platform.h"
+#    include "../rct12/SawyerChunkReader.h"
+#    include "../util/SawyerCoding.h"
+
+#    include <benchmark/benchmark.h>
+#    include <cstdint>
+#    include <memory>
+#    include <string>
+#    include <vector>
+
+// Saved games and scenarios end with a checksum that is not part of any chunk
+constexpr size_t PARK_CHECKSUM_SIZE = 4;
+
+struct BenchPark
+{
+    std::vector<uint8_t> Data;
+    std::vector<std::shared_ptr<SawyerChunk>> Chunks;
+};
+
+static bool load_bench_park(const std::string& path, BenchPark& park)
+{
+    try
+    {
+        park.Data = File::ReadAllBytes(path);
+
+        MemoryStream ms(park.Data.data(), park.Data.size());
+        SawyerChunkReader reader(&ms);
+        while (ms.GetPosition() + PARK_CHECKSUM_SIZE < ms.GetLength())
+        {
+            park.Chunks.push_back(reader.ReadChunk());
+        }
+        return !park.Chunks.empty();
+    }
+    catch (const std::exception& e)
+    {
+        log_error("Unable to read chunks of '%s': %s", path.c_str(), e.what());
+        return false;
+    }
+}
+
+static void BM_park_decode_sequential(benchmark::State& state, const BenchPark& park)
+{
+    for (auto _ : state)
+    {
+        MemoryStream ms(park.Data.data(), park.Data.size());
+        SawyerChunkReader reader(&ms);
+        for (size_t i = 0; i < park.Chunks.size(); i++)
+        {
+            benchmark::DoNotOptimize(reader.ReadChunk());
+        }
+    }
+    state.SetBytesProcessed(state.iterations() * park.Data.size());
+}
+
+static void BM_park_decode_concurrent(benchmark::State& state, const BenchPark& park)
+{
+    std::vector<std::vector<uint8_t>> buffers;
+    std::vector<std::pair<void*, size_t>> destinations;
+    for (const auto& chunk : park.Chunks)
+    {
+        buffers.emplace_back(chunk->GetLength());
+        destinations.emplace_back(buffers.back().data(), buffers.back().size());
+    }
+
+    for (auto _ : state)
+    {
+        MemoryStream ms(park.Data.data(), park.Data.size());
+        SawyerChunkReader reader(&ms);
+        reader.ReadChunks(destinations);
+        benchmark::DoNotOptimize(buffers.data());
+    }
+    state.SetBytesProcessed(state.iterations() * park.Data.size());
+}
+
+static void BM_park_encode(benchmark::State& state, const BenchPark& park)
+{
+    // Large enough for any chunk, same as the chunk writer
+    std::vector<uint8_t> buffer(16 * 1024 * 1024);
+    size_t uncompressedSize = 0;
+    for (const auto& chunk : park.Chunks)
+    {
+        uncompressedSize += chunk->GetLength();
+    }
+
+    for (auto _ : state)
+    {
+        for (const auto& chunk : park.Chunks)
+        {
+            sawyercoding_chunk_header header;
+            header.encoding = static_cast<uint8_t>(chunk->GetEncoding());
+            header.length = static_cast<uint32_t>(chunk->GetLength());
+            benchmark::DoNotOptimize(
+                sawyercoding_write_chunk_buffer(buffer.data(), static_cast<const uint8_t*>(chunk->GetData()), header));
+        }
+    }
+    state.SetBytesProcessed(state.iterations() * uncompressedSize);
+}
+
+static int cmdline_for_bench_park_load(int argc, const char** argv)
+{
+    // Parks have to outlive the registered benchmarks
+    std::vector<std::unique_ptr<BenchPark>> parks;
+
+    // Google benchmark does stuff to argv. It doesn't modify the pointees,
+    // but it wants to reorder the pointers, so present a copy of them.
+    std::vector<char*> argv_for_benchmark;
+
+    // argv[0] is expected to contain the binary name. It's only for logging purposes, don't bother.
+    argv_for_benchmark.push_back(nullptr);
+
+    // Extract file names from argument list. If there is no such file, consider it benchmark option.
+    for (int i = 0; i < argc; i++)
+    {
+        if (platform_file_exists(argv[i]))
+        {
+            auto park = std::make_unique<BenchPark>();
+            if (load_bench_park(argv[i], *park))
+            {
+                auto name = std::string("park/") + Path::GetFileName(argv[i]);
+                benchmark::RegisterBenchmark(
+                    (name + "/decode:sequential").c_str(), BM_park_decode_sequential, std::cref(*park));
+                benchmark::RegisterBenchmark(
+                    (name + "/decode:concurrent").c_str(), BM_park_decode_concurrent, std::cref(*park));
+                benchmark::RegisterBenchmark((name + "/encode").c_str(), BM_park_encode, std::cref(*park));
+                parks.push_back(std::move(park));
+            }
+        }
+        else
+        {
+            argv_for_benchmark.push_back((char*)argv[i]);
+        }
+    }
+    // Update argc with all the changes made
+    argc = (int)argv_for_benchmark.size();
+    ::benchmark::Initialize(&argc, &argv_for_benchmark[0]);
+    if (::benchmark::ReportUnrecognizedArguments(argc, &argv_for_benchmark[0]))
+        return -1;
+    ::benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
+
+static exitcode_t HandleBenchParkLoad(CommandLineArgEnumerator* argEnumerator)
+{
+    const char** argv = (const char**)argEnumerator->GetArguments() + argEnumerator->GetIndex();
+    int32_t argc = argEnumerator->GetCount() - argEnumerator->GetIndex();
+    int32_t result = cmdline_for_bench_park_load(argc, argv);
+    if (result < 0)
+    {
+        return EXITCODE_FAIL;
+    }
+    return EXITCODE_OK;
+}
+
+#else
+static exitcode_t HandleBenchParkLoad(CommandLineArgEnumerator* argEnumerator)
+{
+    log_error("Sorry, Google benchmark not enabled in this build");
+    return EXITCODE_FAIL;
+}
+#endif // USE_BENCHMARK
+
+const CommandLineCommand CommandLine::BenchParkLoadCommands[]{
+#ifdef USE_BENCHMARK
+    DefineCommand(
+        "",
+        "[<file>]... [--benchmark_list_tests={true|false}] [--benchmark_filter=<regex>] [--benchmark_min_time=<min_time>] "
+        "[--benchmark_repetitions=<num_repetitions>] [--benchmark_report_aggregates_only={true|false}] "
+        "[--benchmark_format=<console|json|csv>] [--benchmark_out=<filename>] [--benchmark_out_format=<json|console|csv>] "
+        "[--benchmark_color={auto|true|false}] [--benchmark_counters_tabular={true|false}] [--v=<verbosity>]",
+        nullptr, HandleBenchParkLoad),
+    CommandTableEnd
+#else
+    DefineCommand("", "*** SORRY NOT ENABLED IN THIS BUILD ***", nullptr, HandleBenchParkLoad), CommandTableEnd
+#endif // USE_BENCHMARK
+};
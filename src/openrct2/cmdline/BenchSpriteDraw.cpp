@@ -0,0 +1,188 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "CommandLine.hpp"
+
+#ifdef USE_BENCHMARK
+
+#    include "../drawing/Drawing.h"
+#    include "../util/Util.h"
+
+#    include <benchmark/benchmark.h>
+#    include <cstdint>
+#    include <random>
+#    include <string>
+#    include <vector>
+
+using RLERunFunc = decltype(rle_run_fn);
+
+constexpr int32_t BENCH_SPRITE_WIDTH = 256;
+constexpr int32_t BENCH_SPRITE_HEIGHT = 128;
+
+struct BenchSprite
+{
+    std::vector<uint8_t> Data;
+    std::vector<uint8_t> Palette;
+};
+
+// Builds an RLE sprite shaped like typical terrain and track pieces: a few long runs per line.
+static BenchSprite create_bench_sprite()
+{
+    std::mt19937 prng(0x5EED);
+    BenchSprite sprite;
+    sprite.Data.resize(BENCH_SPRITE_HEIGHT * 2);
+    for (int32_t y = 0; y < BENCH_SPRITE_HEIGHT; y++)
+    {
+        sprite.Data[y * 2] = sprite.Data.size() & 0xFF;
+        sprite.Data[y * 2 + 1] = (sprite.Data.size() >> 8) & 0xFF;
+
+        int32_t x = prng() % 4;
+        while (true)
+        {
+            int32_t runLength = std::min<int32_t>(32 + (prng() % 96), BENCH_SPRITE_WIDTH - x);
+            int32_t nextX = x + runLength + 1 + (prng() % 4);
+            bool isLast = nextX >= BENCH_SPRITE_WIDTH - 1;
+
+            sprite.Data.push_back(static_cast<uint8_t>(runLength | (isLast ? 0x80 : 0)));
+            sprite.Data.push_back(static_cast<uint8_t>(x));
+            for (int32_t i = 0; i < runLength; i++)
+            {
+                sprite.Data.push_back(static_cast<uint8_t>(1 + (prng() % 255)));
+            }
+
+            if (isLast)
+            {
+                break;
+            }
+            x = nextX;
+        }
+    }
+
+    sprite.Palette.resize(256 * 256);
+    for (auto& entry : sprite.Palette)
+    {
+        entry = static_cast<uint8_t>(prng());
+    }
+    return sprite;
+}
+
+static void BM_rle_sprite_draw(
+    benchmark::State& state, const BenchSprite& sprite, RLERunFunc runFn, uint32_t imageType, int32_t zoomLevel)
+{
+    auto previousFn = rle_run_fn;
+    rle_run_fn = runFn;
+
+    std::vector<uint8_t> bits(BENCH_SPRITE_WIDTH * (BENCH_SPRITE_HEIGHT + 1));
+    rct_drawpixelinfo dpi{};
+    dpi.bits = bits.data();
+    dpi.width = BENCH_SPRITE_WIDTH;
+    dpi.height = BENCH_SPRITE_HEIGHT;
+    dpi.pitch = BENCH_SPRITE_WIDTH - (BENCH_SPRITE_WIDTH >> zoomLevel);
+    dpi.zoom_level = zoomLevel;
+
+    const auto imageId = ImageId::FromUInt32(imageType);
+    for (auto _ : state)
+    {
+        gfx_rle_sprite_to_buffer(
+            sprite.Data.data(), bits.data(), sprite.Palette.data(), &dpi, imageId, 0, BENCH_SPRITE_HEIGHT, 0,
+            BENCH_SPRITE_WIDTH);
+        benchmark::DoNotOptimize(bits.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * (BENCH_SPRITE_WIDTH >> zoomLevel) * (BENCH_SPRITE_HEIGHT >> zoomLevel));
+
+    rle_run_fn = previousFn;
+}
+
+static int cmdline_for_bench_sprite_draw(int argc, const char** argv)
+{
+    static const BenchSprite sprite = create_bench_sprite();
+
+    std::vector<std::pair<std::string, RLERunFunc>> kernels = { { "scalar", rle_run_scalar } };
+    if (sse41_available())
+    {
+        kernels.emplace_back("sse4_1", rle_run_sse4_1);
+    }
+    if (avx2_available())
+    {
+        kernels.emplace_back("avx2", rle_run_avx2);
+    }
+
+    const std::pair<const char*, uint32_t> imageTypes[] = {
+        { "opaque", IMAGE_TYPE_DEFAULT },
+        { "remap", IMAGE_TYPE_REMAP },
+        { "transparent", IMAGE_TYPE_TRANSPARENT },
+        { "remap_transparent", IMAGE_TYPE_REMAP | IMAGE_TYPE_TRANSPARENT },
+    };
+
+    for (const auto& [kernelName, runFn] : kernels)
+    {
+        for (const auto& [typeName, imageType] : imageTypes)
+        {
+            for (int32_t zoomLevel = 0; zoomLevel <= 3; zoomLevel++)
+            {
+                auto name = "rle/" + kernelName + "/" + typeName + "/zoom:" + std::to_string(zoomLevel);
+                benchmark::RegisterBenchmark(
+                    name.c_str(), BM_rle_sprite_draw, std::cref(sprite), runFn, imageType, zoomLevel);
+            }
+        }
+    }
+
+    // Google benchmark does stuff to argv. It doesn't modify the pointees,
+    // but it wants to reorder the pointers, so present a copy of them.
+    std::vector<char*> argv_for_benchmark;
+
+    // argv[0] is expected to contain the binary name. It's only for logging purposes, don't bother.
+    argv_for_benchmark.push_back(nullptr);
+    for (int i = 0; i < argc; i++)
+    {
+        argv_for_benchmark.push_back((char*)argv[i]);
+    }
+    argc = (int)argv_for_benchmark.size();
+    ::benchmark::Initialize(&argc, &argv_for_benchmark[0]);
+    if (::benchmark::ReportUnrecognizedArguments(argc, &argv_for_benchmark[0]))
+        return -1;
+    ::benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
+
+static exitcode_t HandleBenchSpriteDraw(CommandLineArgEnumerator* argEnumerator)
+{
+    const char** argv = (const char**)argEnumerator->GetArguments() + argEnumerator->GetIndex();
+    int32_t argc = argEnumerator->GetCount() - argEnumerator->GetIndex();
+    int32_t result = cmdline_for_bench_sprite_draw(argc, argv);
+    if (result < 0)
+    {
+        return EXITCODE_FAIL;
+    }
+    return EXITCODE_OK;
+}
+
+#else
+static exitcode_t HandleBenchSpriteDraw(CommandLineArgEnumerator* argEnumerator)
+{
+    log_error("Sorry, Google benchmark not enabled in this build");
+    return EXITCODE_FAIL;
+}
+#endif // USE_BENCHMARK
+
+const CommandLineCommand CommandLine::BenchSpriteDrawCommands[]{
+#ifdef USE_BENCHMARK
+    DefineCommand(
+        "",
+        "[--benchmark_list_tests={true|false}] [--benchmark_filter=<regex>] [--benchmark_min_time=<min_time>] "
+        "[--benchmark_repetitions=<num_repetitions>] [--benchmark_report_aggregates_only={true|false}] "
+        "[--benchmark_format=<console|json|csv>] [--benchmark_out=<filename>] [--benchmark_out_format=<json|console|csv>] "
+        "[--benchmark_color={auto|true|false}] [--benchmark_counters_tabular={true|false}] [--v=<verbosity>]",
+        nullptr, HandleBenchSpriteDraw),
+    CommandTableEnd
+#else
+    DefineCommand("", "*** SORRY NOT ENABLED IN THIS BUILD ***", nullptr, HandleBenchSpriteDraw), CommandTableEnd
+#endif // USE_BENCHMARK
+};
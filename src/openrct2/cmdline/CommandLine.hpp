@@ -118,7 +118,11 @@ namespace CommandLine
     extern const CommandLineCommand SpriteCommands[];
     extern const CommandLineCommand BenchGfxCommands[];
     extern const CommandLineCommand BenchSpriteSortCommands[];
+    extern const CommandLineCommand BenchSpriteDrawCommands[];
+    extern const CommandLineCommand BenchParkLoadCommands[];
+    extern const CommandLineCommand BenchNetworkCommands[];
     extern const CommandLineCommand SimulateCommands[];
+    extern const CommandLineCommand VerifyReplaysCommands[];
 
     extern const CommandLineExample RootExamples[];
 
@@ -20,6 +20,7 @@
 #include "../localisation/Language.h"
 #include "../network/network.h"
 #include "../object/ObjectRepository.h"
+#include "../peep/Peep.h"
 #include "../platform/Crash.h"
 #include "../platform/platform.h"
 #include "CommandLine.hpp"
@@ -52,6 +53,7 @@ static bool _all = false;
 static bool _about = false;
 static bool _verbose = false;
 static bool _headless = false;
+static bool _guestLod = false;
 static utf8* _password = nullptr;
 static utf8* _userDataPath = nullptr;
 static utf8* _openrctDataPath = nullptr;
@@ -69,6 +71,7 @@ static constexpr const CommandLineOptionDefinition StandardOptions[]
     { CMDLINE_TYPE_SWITCH,  &_about,           NAC, "about",             "show information about " OPENRCT2_NAME                      },
     { CMDLINE_TYPE_SWITCH,  &_verbose,         NAC, "verbose",           "log verbose messages"                                       },
     { CMDLINE_TYPE_SWITCH,  &_headless,        NAC, "headless",          "run " OPENRCT2_NAME " headless" IMPLIES_SILENT_BREAKPAD     },
+    { CMDLINE_TYPE_SWITCH,  &_guestLod,        NAC, "guest-lod",         "update guests less often when running headless"             },
 #ifndef DISABLE_NETWORK
     { CMDLINE_TYPE_INTEGER, &_port,            NAC, "port",              "port to use for hosting or joining a server"                },
     { CMDLINE_TYPE_STRING,  &_address,         NAC, "address",           "address to listen on when hosting a server"                 },
@@ -140,7 +143,11 @@ const CommandLineCommand CommandLine::RootCommands[]
     DefineSubCommand("sprite",          CommandLine::SpriteCommands           ),
     DefineSubCommand("benchgfx",        CommandLine::BenchGfxCommands         ),
     DefineSubCommand("benchspritesort", CommandLine::BenchSpriteSortCommands  ),
+    DefineSubCommand("benchspritedraw", CommandLine::BenchSpriteDrawCommands  ),
+    DefineSubCommand("benchparkload",   CommandLine::BenchParkLoadCommands    ),
+    DefineSubCommand("benchnetwork",    CommandLine::BenchNetworkCommands     ),
     DefineSubCommand("simulate",        CommandLine::SimulateCommands         ),
+    DefineSubCommand("verifyreplays",   CommandLine::VerifyReplaysCommands    ),
     CommandTableEnd
 };
 
@@ -195,6 +202,7 @@ exitcode_t CommandLine::HandleCommandDefault()
     gOpenRCT2Headless = _headless;
     gOpenRCT2NoGraphics = _headless;
     gOpenRCT2SilentBreakpad = _silentBreakpad || _headless;
+    gGuestLevelOfDetail = _guestLod;
 
     if (_userDataPath != nullptr)
     {
@@ -0,0 +1,213 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "../Context.h"
+#include "../OpenRCT2.h"
+#include "../ReplayManager.h"
+#include "../core/Console.hpp"
+#include "../core/FileScanner.h"
+#include "../core/Path.hpp"
+#include "../core/String.hpp"
+#include "../platform/Platform2.h"
+#include "../platform/platform.h"
+#include "CommandLine.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifndef _WIN32
+#    include <sys/wait.h>
+#endif
+
+using namespace OpenRCT2;
+
+static exitcode_t HandleVerifyReplays(CommandLineArgEnumerator* argEnumerator);
+
+const CommandLineCommand CommandLine::VerifyReplaysCommands[]{
+    // Main commands
+    DefineCommand("", "<replay-file|directory> [<jobs>]", nullptr, HandleVerifyReplays), CommandTableEnd
+};
+
+/**
+ * Plays a single replay in this process and prints the result, the exit code tells whether it matched.
+ */
+static exitcode_t VerifyReplay(const std::string& path)
+{
+    core_init();
+
+    gOpenRCT2Headless = true;
+    gOpenRCT2NoGraphics = true;
+
+    std::unique_ptr<IContext> context(CreateContext());
+    if (!context->Initialise())
+    {
+        Console::Error::WriteLine("Context initialization failed.");
+        return EXITCODE_FAIL;
+    }
+
+    ReplayVerifyResult result{};
+    if (!context->GetReplayManager()->VerifyReplay(path, result))
+    {
+        Console::WriteLine("%s: FAILED, unable to load replay", path.c_str());
+        return EXITCODE_FAIL;
+    }
+
+    if (!result.Mismatch)
+    {
+        Console::WriteLine("%s: OK, %u ticks, %.1f ticks/s", path.c_str(), result.Ticks, result.TicksPerSecond);
+        return EXITCODE_OK;
+    }
+
+    Console::WriteLine(
+        "%s: MISMATCH at tick %u, %u ticks, %.1f ticks/s", path.c_str(), result.FirstMismatchTick, result.Ticks,
+        result.TicksPerSecond);
+    if (!result.CompareText.empty())
+    {
+        Console::WriteLine("%s", result.CompareText.c_str());
+    }
+    return EXITCODE_FAIL;
+}
+
+static std::string QuoteArgument(const std::string& argument)
+{
+#ifdef _WIN32
+    return "\"" + argument + "\"";
+#else
+    std::string result = "'";
+    for (char c : argument)
+    {
+        if (c == '\'')
+            result += "'\\''";
+        else
+            result += c;
+    }
+    return result + "'";
+#endif
+}
+
+/**
+ * Verifies a replay in a child process, the game state is global so every simulation needs its own process. This also
+ * keeps a crashing replay from taking down the whole run.
+ */
+static bool VerifyReplayInChildProcess(const std::string& exePath, const std::string& path, std::string& output)
+{
+    auto command = QuoteArgument(exePath) + " verifyreplays " + QuoteArgument(path) + " 2>&1";
+#ifdef _WIN32
+    // cmd.exe strips the outer quotes of the command.
+    command = "\"" + command + "\"";
+    FILE* pipe = _popen(command.c_str(), "r");
+#else
+    FILE* pipe = popen(command.c_str(), "r");
+#endif
+    if (pipe == nullptr)
+    {
+        output = path + ": FAILED, unable to start process\n";
+        return false;
+    }
+
+    char buffer[1024];
+    size_t bytesRead;
+    while ((bytesRead = fread(buffer, 1, sizeof(buffer), pipe)) != 0)
+    {
+        output.append(buffer, bytesRead);
+    }
+
+#ifdef _WIN32
+    int status = _pclose(pipe);
+    bool success = status == 0;
+#else
+    int status = pclose(pipe);
+    bool success = status != -1 && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+#endif
+    if (!success && output.find(path) == std::string::npos)
+    {
+        // The child did not get as far as reporting, most likely it crashed.
+        output += path + ": FAILED, process exited with status " + std::to_string(status) + "\n";
+    }
+    return success;
+}
+
+static exitcode_t HandleVerifyReplays(CommandLineArgEnumerator* argEnumerator)
+{
+    const char** argv = (const char**)argEnumerator->GetArguments() + argEnumerator->GetIndex();
+    int32_t argc = argEnumerator->GetCount() - argEnumerator->GetIndex();
+
+    if (argc < 1)
+    {
+        Console::Error::WriteLine("Missing arguments <replay-file|directory> [<jobs>].");
+        return EXITCODE_FAIL;
+    }
+
+    std::string inputPath = argv[0];
+    if (!platform_directory_exists(inputPath.c_str()))
+    {
+        return VerifyReplay(inputPath);
+    }
+
+    size_t jobs = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+    if (argc >= 2)
+    {
+        jobs = std::max(atoi(argv[1]), 1);
+    }
+
+    std::vector<std::string> files;
+    auto scanner = std::unique_ptr<IFileScanner>(Path::ScanDirectory(Path::Combine(inputPath, "*.sv6r"), true));
+    while (scanner->Next())
+    {
+        files.push_back(scanner->GetPath());
+    }
+    std::sort(files.begin(), files.end());
+
+    if (files.empty())
+    {
+        Console::Error::WriteLine("No replays found in '%s'.", inputPath.c_str());
+        return EXITCODE_FAIL;
+    }
+
+    Console::WriteLine("Verifying %zu replays with %zu jobs...", files.size(), std::min(jobs, files.size()));
+
+    auto exePath = Platform::GetCurrentExecutablePath();
+    std::atomic<size_t> nextFile{ 0 };
+    std::atomic<size_t> failed{ 0 };
+    std::mutex outputMutex;
+
+    std::vector<std::thread> workers;
+    for (size_t i = 0; i < std::min(jobs, files.size()); i++)
+    {
+        workers.emplace_back([&]() {
+            size_t index;
+            while ((index = nextFile++) < files.size())
+            {
+                std::string output;
+                if (!VerifyReplayInChildProcess(exePath, files[index], output))
+                {
+                    failed++;
+                }
+
+                // Print the whole report at once so that the output of different replays does not interleave.
+                std::lock_guard<std::mutex> lock(outputMutex);
+                Console::Write(output.c_str());
+            }
+        });
+    }
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+
+    Console::WriteLine("Verified %zu replays, %zu failed.", files.size(), failed.load());
+    return failed == 0 ? EXITCODE_OK : EXITCODE_FAIL;
+}
@@ -23,6 +23,7 @@
 #include "MemoryStream.h"
 
 #include <cstdio>
+#include <cstring>
 #include <iomanip>
 #include <iostream>
 #include <sstream>
@@ -109,6 +110,30 @@ template<> struct DataSerializerTraits<int64_t> : public DataSerializerTraitsInt
 {
 };
 
+template<> struct DataSerializerTraits<float>
+{
+    static void encode(IStream* stream, const float& val)
+    {
+        uint32_t temp;
+        std::memcpy(&temp, &val, sizeof(temp));
+        DataSerializerTraits<uint32_t>::encode(stream, temp);
+    }
+    static void decode(IStream* stream, float& val)
+    {
+        uint32_t temp;
+        DataSerializerTraits<uint32_t>::decode(stream, temp);
+        std::memcpy(&val, &temp, sizeof(val));
+    }
+    static void log(IStream* stream, const float& val)
+    {
+        std::stringstream ss;
+        ss << val;
+
+        std::string str = ss.str();
+        stream->Write(str.c_str(), str.size());
+    }
+};
+
 template<> struct DataSerializerTraits<std::string>
 {
     static void encode(IStream* stream, const std::string& str)
@@ -161,89 +161,175 @@ namespace Imaging
         }
     }
 
-    static void WritePng(std::ostream& ostream, const Image& image)
+    struct PngStreamWriter::State
     {
-        png_structp png_ptr = nullptr;
-        png_colorp png_palette = nullptr;
-        try
+        std::ofstream File;
+        png_structp Png{};
+        png_infop Info{};
+        png_colorp Palette{};
+        uint32_t Height{};
+        uint32_t RowsWritten{};
+        bool Finished{};
+
+        ~State()
         {
-            png_ptr = png_create_write_struct(PNG_LIBPNG_VER_STRING, nullptr, PngError, PngWarning);
-            if (png_ptr == nullptr)
-            {
-                throw std::runtime_error("png_create_write_struct failed.");
-            }
+            png_destroy_info_struct(Png, &Info);
+            png_free(Png, Palette);
+            png_destroy_write_struct(&Png, nullptr);
+        }
+    };
 
-            auto info_ptr = png_create_info_struct(png_ptr);
-            if (info_ptr == nullptr)
-            {
-                throw std::runtime_error("png_create_info_struct failed.");
-            }
+    static void PngWriteHeader(
+        png_structp png_ptr, png_infop info_ptr, png_colorp png_palette, std::ostream& ostream, uint32_t width,
+        uint32_t height, uint32_t depth)
+    {
+        if (png_palette != nullptr)
+        {
+            png_set_PLTE(png_ptr, info_ptr, png_palette, PNG_MAX_PALETTE_LENGTH);
+        }
 
-            if (image.Depth == 8)
-            {
-                if (image.Palette == nullptr)
-                {
-                    throw std::runtime_error("Expected a palette for 8-bit image.");
-                }
+        png_set_write_fn(png_ptr, &ostream, PngWriteData, PngFlush);
 
-                // Set the palette
-                png_palette = (png_colorp)png_malloc(png_ptr, PNG_MAX_PALETTE_LENGTH * sizeof(png_color));
-                if (png_palette == nullptr)
-                {
-                    throw std::runtime_error("png_malloc failed.");
-                }
-                for (size_t i = 0; i < PNG_MAX_PALETTE_LENGTH; i++)
-                {
-                    const auto entry = &image.Palette->entries[i];
-                    png_palette[i].blue = entry->blue;
-                    png_palette[i].green = entry->green;
-                    png_palette[i].red = entry->red;
-                }
-                png_set_PLTE(png_ptr, info_ptr, png_palette, PNG_MAX_PALETTE_LENGTH);
-            }
+        // Set error handler
+        if (setjmp(png_jmpbuf(png_ptr)))
+        {
+            throw std::runtime_error("PNG ERROR");
+        }
 
-            png_set_write_fn(png_ptr, &ostream, PngWriteData, PngFlush);
+        // Write header
+        auto colourType = PNG_COLOR_TYPE_RGB_ALPHA;
+        if (depth == 8)
+        {
+            png_byte transparentIndex = 0;
+            png_set_tRNS(png_ptr, info_ptr, &transparentIndex, 1, nullptr);
+            colourType = PNG_COLOR_TYPE_PALETTE;
+        }
+        png_set_IHDR(
+            png_ptr, info_ptr, width, height, 8, colourType, PNG_INTERLACE_NONE, PNG_COMPRESSION_TYPE_DEFAULT,
+            PNG_FILTER_TYPE_DEFAULT);
+        png_write_info(png_ptr, info_ptr);
+    }
 
-            // Set error handler
-            if (setjmp(png_jmpbuf(png_ptr)))
+    static void PngWriteRows(png_structp png_ptr, const uint8_t* pixels, uint32_t rowCount, uint32_t stride)
+    {
+        if (setjmp(png_jmpbuf(png_ptr)))
+        {
+            throw std::runtime_error("PNG ERROR");
+        }
+
+        for (uint32_t y = 0; y < rowCount; y++)
+        {
+            png_write_row(png_ptr, (png_const_bytep)pixels);
+            pixels += stride;
+        }
+    }
+
+    static void PngWriteEnd(png_structp png_ptr)
+    {
+        if (setjmp(png_jmpbuf(png_ptr)))
+        {
+            throw std::runtime_error("PNG ERROR");
+        }
+        png_write_end(png_ptr, nullptr);
+    }
+
+    PngStreamWriter::PngStreamWriter(
+        const std::string_view& path, uint32_t width, uint32_t height, uint32_t depth, const rct_palette* palette)
+        : _state(std::make_unique<State>())
+    {
+#if defined(_WIN32) && !defined(__MINGW32__)
+        auto pathW = String::ToWideChar(path);
+        _state->File.open(pathW, std::ios::binary);
+#else
+        _state->File.open(std::string(path), std::ios::binary);
+#endif
+        if (!_state->File.is_open())
+        {
+            throw std::runtime_error("Unable to open file for writing.");
+        }
+        Initialise(_state->File, width, height, depth, palette);
+    }
+
+    PngStreamWriter::PngStreamWriter(
+        std::ostream& ostream, uint32_t width, uint32_t height, uint32_t depth, const rct_palette* palette)
+        : _state(std::make_unique<State>())
+    {
+        Initialise(ostream, width, height, depth, palette);
+    }
+
+    PngStreamWriter::~PngStreamWriter() = default;
+
+    void PngStreamWriter::Initialise(
+        std::ostream& ostream, uint32_t width, uint32_t height, uint32_t depth, const rct_palette* palette)
+    {
+        _state->Height = height;
+        _state->Png = png_create_write_struct(PNG_LIBPNG_VER_STRING, nullptr, PngError, PngWarning);
+        if (_state->Png == nullptr)
+        {
+            throw std::runtime_error("png_create_write_struct failed.");
+        }
+
+        _state->Info = png_create_info_struct(_state->Png);
+        if (_state->Info == nullptr)
+        {
+            throw std::runtime_error("png_create_info_struct failed.");
+        }
+
+        if (depth == 8)
+        {
+            if (palette == nullptr)
             {
-                throw std::runtime_error("PNG ERROR");
+                throw std::runtime_error("Expected a palette for 8-bit image.");
             }
 
-            // Write header
-            auto colourType = PNG_COLOR_TYPE_RGB_ALPHA;
-            if (image.Depth == 8)
+            // Set the palette
+            _state->Palette = (png_colorp)png_malloc(_state->Png, PNG_MAX_PALETTE_LENGTH * sizeof(png_color));
+            if (_state->Palette == nullptr)
             {
-                png_byte transparentIndex = 0;
-                png_set_tRNS(png_ptr, info_ptr, &transparentIndex, 1, nullptr);
-                colourType = PNG_COLOR_TYPE_PALETTE;
+                throw std::runtime_error("png_malloc failed.");
             }
-            png_set_IHDR(
-                png_ptr, info_ptr, image.Width, image.Height, 8, colourType, PNG_INTERLACE_NONE, PNG_COMPRESSION_TYPE_DEFAULT,
-                PNG_FILTER_TYPE_DEFAULT);
-            png_write_info(png_ptr, info_ptr);
-
-            // Write pixels
-            auto pixels = image.Pixels.data();
-            for (uint32_t y = 0; y < image.Height; y++)
+            for (size_t i = 0; i < PNG_MAX_PALETTE_LENGTH; i++)
             {
-                png_write_row(png_ptr, (png_byte*)pixels);
-                pixels += image.Stride;
+                const auto entry = &palette->entries[i];
+                _state->Palette[i].blue = entry->blue;
+                _state->Palette[i].green = entry->green;
+                _state->Palette[i].red = entry->red;
             }
+        }
+
+        PngWriteHeader(_state->Png, _state->Info, _state->Palette, ostream, width, height, depth);
+    }
 
-            png_write_end(png_ptr, nullptr);
-            png_destroy_info_struct(png_ptr, &info_ptr);
-            png_free(png_ptr, png_palette);
-            png_destroy_write_struct(&png_ptr, nullptr);
+    void PngStreamWriter::WriteRows(const uint8_t* pixels, uint32_t rowCount, uint32_t stride)
+    {
+        if (_state->Finished || rowCount > _state->Height - _state->RowsWritten)
+        {
+            throw std::runtime_error("Too many rows written to PNG.");
         }
-        catch (const std::exception&)
+        PngWriteRows(_state->Png, pixels, rowCount, stride);
+        _state->RowsWritten += rowCount;
+    }
+
+    void PngStreamWriter::Finish()
+    {
+        if (_state->RowsWritten != _state->Height)
         {
-            png_free(png_ptr, png_palette);
-            png_destroy_write_struct(&png_ptr, nullptr);
-            throw;
+            throw std::runtime_error("Not all rows have been written to PNG.");
+        }
+        if (!_state->Finished)
+        {
+            PngWriteEnd(_state->Png);
+            _state->Finished = true;
         }
     }
 
+    static void WritePng(std::ostream& ostream, const Image& image)
+    {
+        PngStreamWriter writer(ostream, image.Width, image.Height, image.Depth, image.Palette.get());
+        writer.WriteRows(image.Pixels.data(), image.Height, image.Stride);
+        writer.Finish();
+    }
+
     IMAGE_FORMAT GetImageFormatFromPath(const std::string_view& path)
     {
         if (String::EndsWith(path, ".png", true))
@@ -14,6 +14,7 @@
 
 #include <functional>
 #include <istream>
+#include <ostream>
 #include <memory>
 #include <string_view>
 #include <vector>
@@ -61,4 +62,27 @@ namespace Imaging
     void WriteToFile(const std::string_view& path, const Image& image, IMAGE_FORMAT format = IMAGE_FORMAT::AUTOMATIC);
 
     void SetReader(IMAGE_FORMAT format, ImageReaderFunc impl);
+
+    /**
+     * Writes a PNG a few rows at a time so the whole image never has to be held in memory.
+     * Rows must be written top to bottom, Finish has to be called once all rows are written.
+     */
+    class PngStreamWriter
+    {
+    private:
+        struct State;
+        std::unique_ptr<State> _state;
+
+    public:
+        PngStreamWriter(
+            const std::string_view& path, uint32_t width, uint32_t height, uint32_t depth, const rct_palette* palette);
+        PngStreamWriter(std::ostream& ostream, uint32_t width, uint32_t height, uint32_t depth, const rct_palette* palette);
+        ~PngStreamWriter();
+
+        void WriteRows(const uint8_t* pixels, uint32_t rowCount, uint32_t stride);
+        void Finish();
+
+    private:
+        void Initialise(std::ostream& ostream, uint32_t width, uint32_t height, uint32_t depth, const rct_palette* palette);
+    };
 } // namespace Imaging
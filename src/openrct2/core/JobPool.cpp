@@ -0,0 +1,419 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "JobPool.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+
+thread_local JobScheduler* JobScheduler::_currentScheduler = nullptr;
+thread_local JobScheduler::Worker* JobScheduler::_currentWorker = nullptr;
+
+#pragma region JobDeque
+
+bool JobDeque::Push(Job* job)
+{
+    int64_t b = _bottom.load(std::memory_order_relaxed);
+    int64_t t = _top.load(std::memory_order_acquire);
+    if (b - t >= Capacity)
+    {
+        return false;
+    }
+    _buffer[b & Mask].store(job, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    _bottom.store(b + 1, std::memory_order_relaxed);
+    return true;
+}
+
+Job* JobDeque::Pop()
+{
+    int64_t b = _bottom.load(std::memory_order_relaxed) - 1;
+    _bottom.store(b, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t t = _top.load(std::memory_order_relaxed);
+
+    Job* job = nullptr;
+    if (t <= b)
+    {
+        job = _buffer[b & Mask].load(std::memory_order_relaxed);
+        if (t == b)
+        {
+            // Last element, race against thieves.
+            if (!_top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+            {
+                job = nullptr;
+            }
+            _bottom.store(b + 1, std::memory_order_relaxed);
+        }
+    }
+    else
+    {
+        _bottom.store(b + 1, std::memory_order_relaxed);
+    }
+    return job;
+}
+
+Job* JobDeque::Steal()
+{
+    int64_t t = _top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t b = _bottom.load(std::memory_order_acquire);
+    if (t >= b)
+    {
+        return nullptr;
+    }
+
+    Job* job = _buffer[t & Mask].load(std::memory_order_relaxed);
+    if (!_top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+    {
+        return nullptr;
+    }
+    return job;
+}
+
+#pragma endregion
+
+#pragma region JobScheduler
+
+JobScheduler::JobScheduler(size_t workerCount)
+{
+    workerCount = std::max<size_t>(workerCount, 1);
+    for (size_t n = 0; n < workerCount; n++)
+    {
+        _workers.push_back(std::make_unique<Worker>());
+    }
+    for (size_t n = 0; n < workerCount; n++)
+    {
+        _workers[n]->Thread = std::thread(&JobScheduler::ProcessQueue, this, n);
+    }
+}
+
+JobScheduler::~JobScheduler()
+{
+    {
+        unique_lock lock(_sleepMutex);
+        _shouldStop = true;
+        _condWork.notify_all();
+    }
+
+    for (auto&& worker : _workers)
+    {
+        assert(worker->Thread.joinable() != false);
+        worker->Thread.join();
+    }
+}
+
+JobScheduler& JobScheduler::Get()
+{
+    static JobScheduler scheduler(std::max<size_t>(std::thread::hardware_concurrency(), 2) - 1);
+    return scheduler;
+}
+
+void JobScheduler::Submit(Job* const* jobs, size_t count)
+{
+    if (count == 0)
+    {
+        return;
+    }
+
+    // Account for the jobs before publishing them so the counter can not underflow.
+    _queued.fetch_add(count);
+
+    size_t index = 0;
+    if (_currentScheduler == this)
+    {
+        // Nested submission from one of our workers, keep it local so it can be stolen.
+        for (; index < count; index++)
+        {
+            if (!_currentWorker->Deque.Push(jobs[index]))
+            {
+                break;
+            }
+        }
+    }
+
+    if (index < count)
+    {
+        std::lock_guard<std::mutex> lock(_injectedMutex);
+        _injected.insert(_injected.end(), jobs + index, jobs + count);
+    }
+
+    WakeWorkers(count);
+}
+
+bool JobScheduler::RunPendingJob()
+{
+    auto job = FindJob(_currentScheduler == this ? _currentWorker : nullptr);
+    if (job == nullptr)
+    {
+        return false;
+    }
+    Run(job);
+    return true;
+}
+
+void JobScheduler::ProcessQueue(size_t workerIndex)
+{
+    auto self = _workers[workerIndex].get();
+    _currentScheduler = this;
+    _currentWorker = self;
+
+    while (!_shouldStop)
+    {
+        auto job = FindJob(self);
+        if (job != nullptr)
+        {
+            Run(job);
+            continue;
+        }
+
+        if (_queued.load() != 0)
+        {
+            // Work is in flight between queues, try again shortly.
+            std::this_thread::yield();
+            continue;
+        }
+
+        unique_lock lock(_sleepMutex);
+        _sleeping.fetch_add(1);
+        _condWork.wait(lock, [this]() { return _shouldStop || _queued.load() != 0; });
+        _sleeping.fetch_sub(1);
+    }
+}
+
+Job* JobScheduler::FindJob(Worker* self)
+{
+    Job* job = nullptr;
+    if (self != nullptr)
+    {
+        job = self->Deque.Pop();
+    }
+    if (job == nullptr)
+    {
+        job = TakeInjected(self);
+    }
+    if (job == nullptr)
+    {
+        // Steal from the other workers, start at a different victim per thief.
+        const size_t numWorkers = _workers.size();
+        const size_t start = std::hash<std::thread::id>()(std::this_thread::get_id()) % numWorkers;
+        for (size_t i = 0; i < numWorkers && job == nullptr; i++)
+        {
+            auto victim = _workers[(start + i) % numWorkers].get();
+            if (victim != self)
+            {
+                job = victim->Deque.Steal();
+            }
+        }
+    }
+    if (job != nullptr)
+    {
+        _queued.fetch_sub(1);
+    }
+    return job;
+}
+
+Job* JobScheduler::TakeInjected(Worker* self)
+{
+    std::lock_guard<std::mutex> lock(_injectedMutex);
+    size_t available = _injected.size() - _injectedHead;
+    if (available == 0)
+    {
+        return nullptr;
+    }
+
+    auto job = _injected[_injectedHead++];
+    if (self != nullptr)
+    {
+        // Move a fair share of the remaining batch onto our own deque so others can steal it
+        // without contending on the injection queue.
+        size_t share = (available - 1) / _workers.size();
+        for (; share > 0; share--)
+        {
+            if (!self->Deque.Push(_injected[_injectedHead]))
+            {
+                break;
+            }
+            _injectedHead++;
+        }
+    }
+
+    if (_injectedHead == _injected.size())
+    {
+        _injected.clear();
+        _injectedHead = 0;
+    }
+    return job;
+}
+
+void JobScheduler::Run(Job* job)
+{
+    auto group = job->Group;
+    job->Invoke(job->Storage);
+    group->OnJobFinished();
+}
+
+void JobScheduler::WakeWorkers(size_t count)
+{
+    if (_sleeping.load() == 0)
+    {
+        return;
+    }
+
+    unique_lock lock(_sleepMutex);
+    if (count >= _workers.size())
+    {
+        _condWork.notify_all();
+    }
+    else
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            _condWork.notify_one();
+        }
+    }
+}
+
+#pragma endregion
+
+#pragma region JobPool
+
+void JobPool::Join(std::function<void()> reportFn)
+{
+    Flush();
+
+    unique_lock lock(_mutex);
+    while (true)
+    {
+        // Help out instead of idling, this also keeps nested joins on workers from deadlocking.
+        while (_processing != 0 && _completed.empty())
+        {
+            lock.unlock();
+            bool ranJob = _scheduler.RunPendingJob();
+            lock.lock();
+            if (!ranJob)
+            {
+                break;
+            }
+        }
+
+        // Wait for the group to become empty or having completed tasks.
+        if (reportFn)
+        {
+            _condComplete.wait_for(
+                lock, std::chrono::milliseconds(50), [this]() { return _processing == 0 || !_completed.empty(); });
+        }
+        else
+        {
+            _condComplete.wait(lock, [this]() { return _processing == 0 || !_completed.empty(); });
+        }
+
+        // Dispatch all completion callbacks if there are any.
+        if (!_completed.empty())
+        {
+            auto completed = std::move(_completed);
+            _completed.clear();
+
+            lock.unlock();
+
+            for (auto&& completionFn : completed)
+            {
+                completionFn();
+            }
+
+            lock.lock();
+        }
+
+        if (reportFn)
+        {
+            lock.unlock();
+
+            reportFn();
+
+            lock.lock();
+        }
+
+        // If everything is empty and no more work has to be done we can stop waiting.
+        if (_completed.empty() && _processing == 0)
+        {
+            break;
+        }
+    }
+
+    // Every job has finished, their storage can be reused.
+    _jobsUsed = 0;
+}
+
+Job* JobPool::AllocateJob()
+{
+    // The job storage and the batch are not locked, they belong to the thread adding the tasks.
+    auto currentThread = std::this_thread::get_id();
+    if (_jobsUsed == 0)
+    {
+        _producer = currentThread;
+    }
+    assert(_producer == currentThread);
+
+    size_t chunkIndex = _jobsUsed / JobChunkSize;
+    if (chunkIndex == _jobChunks.size())
+    {
+        _jobChunks.push_back(std::make_unique<Job[]>(JobChunkSize));
+    }
+
+    auto job = &_jobChunks[chunkIndex][_jobsUsed % JobChunkSize];
+    job->Group = this;
+    _jobsUsed++;
+    return job;
+}
+
+void JobPool::Enqueue(Job* job)
+{
+    _batch.push_back(job);
+    if (_batch.size() >= BatchSize)
+    {
+        Flush();
+    }
+}
+
+void JobPool::Flush()
+{
+    if (_batch.empty())
+    {
+        return;
+    }
+
+    {
+        unique_lock lock(_mutex);
+        _processing += _batch.size();
+    }
+    _scheduler.Submit(_batch.data(), _batch.size());
+    _batch.clear();
+}
+
+void JobPool::PostCompletion(const std::function<void()>& completionFn)
+{
+    unique_lock lock(_mutex);
+    _completed.push_back(completionFn);
+    _condComplete.notify_one();
+}
+
+void JobPool::OnJobFinished()
+{
+    // Decrement and notify while holding the lock, Join can only observe the pool as idle once
+    // the last job released it so the pool may be destroyed right after.
+    unique_lock lock(_mutex);
+    _processing--;
+    if (_processing == 0)
+    {
+        _condComplete.notify_all();
+    }
+}
+
+#pragma endregion
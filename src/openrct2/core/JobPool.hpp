@@ -9,147 +9,216 @@
 
 #pragma once
 
-#include <algorithm>
+#include <array>
 #include <atomic>
-#include <cassert>
 #include <condition_variable>
-#include <deque>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
+#include <memory>
 #include <mutex>
+#include <new>
 #include <thread>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
-class JobPool
+class JobPool;
+
+/**
+ * A unit of work scheduled on the JobScheduler. The callable is stored inline so that
+ * submitting a task does not touch the allocator, jobs themselves are recycled by the
+ * owning JobPool once it has been joined.
+ */
+struct Job
+{
+    static constexpr size_t StorageSize = 96;
+
+    using InvokeFn = void (*)(void* storage);
+
+    InvokeFn Invoke = nullptr;
+    JobPool* Group = nullptr;
+    alignas(std::max_align_t) uint8_t Storage[StorageSize];
+};
+
+/**
+ * Bounded Chase-Lev work-stealing deque. The owning thread pushes and pops at the bottom,
+ * any other thread may steal from the top.
+ */
+class JobDeque
 {
 private:
-    struct TaskData
-    {
-        const std::function<void()> WorkFn;
-        const std::function<void()> CompletionFn;
+    static constexpr int64_t Capacity = 1024;
+    static constexpr int64_t Mask = Capacity - 1;
 
-        TaskData(std::function<void()> workFn, std::function<void()> completionFn)
-            : WorkFn(workFn)
-            , CompletionFn(completionFn)
-        {
-        }
+    std::atomic<int64_t> _top = { 0 };
+    std::atomic<int64_t> _bottom = { 0 };
+    std::array<std::atomic<Job*>, Capacity> _buffer{};
+
+public:
+    bool Push(Job* job);
+    Job* Pop();
+    Job* Steal();
+};
+
+/**
+ * Process-wide work-stealing scheduler. Every worker owns a JobDeque, tasks submitted from
+ * outside the workers are put on a shared injection queue in batches from which workers
+ * refill their deques. Idle workers steal from each other before going to sleep.
+ */
+class JobScheduler
+{
+private:
+    struct Worker
+    {
+        JobDeque Deque;
+        std::thread Thread;
     };
 
+    std::vector<std::unique_ptr<Worker>> _workers;
+    std::vector<Job*> _injected;
+    size_t _injectedHead = 0;
+    std::mutex _injectedMutex;
+
+    std::atomic<size_t> _queued = { 0 };
+    std::atomic<size_t> _sleeping = { 0 };
     std::atomic_bool _shouldStop = { false };
-    std::atomic<size_t> _processing = { 0 };
-    std::vector<std::thread> _threads;
-    std::deque<TaskData> _pending;
-    std::deque<TaskData> _completed;
-    std::condition_variable _condPending;
-    std::condition_variable _condComplete;
-    std::mutex _mutex;
+    std::mutex _sleepMutex;
+    std::condition_variable _condWork;
+
+    static thread_local JobScheduler* _currentScheduler;
+    static thread_local Worker* _currentWorker;
 
     using unique_lock = std::unique_lock<std::mutex>;
 
 public:
-    JobPool(size_t maxThreads = 255)
-    {
-        maxThreads = std::min<size_t>(maxThreads, std::thread::hardware_concurrency());
-        for (size_t n = 0; n < maxThreads; n++)
-        {
-            _threads.emplace_back(&JobPool::ProcessQueue, this);
-        }
-    }
+    explicit JobScheduler(size_t workerCount);
+    ~JobScheduler();
 
-    ~JobPool()
-    {
-        {
-            unique_lock lock(_mutex);
-            _shouldStop = true;
-            _condPending.notify_all();
-        }
+    JobScheduler(const JobScheduler&) = delete;
+    JobScheduler& operator=(const JobScheduler&) = delete;
 
-        for (auto&& th : _threads)
-        {
-            assert(th.joinable() != false);
-            th.join();
-        }
-    }
+    /**
+     * Returns the scheduler shared by the whole process, it is created on first use with
+     * one worker less than the amount of hardware threads as joining threads help out.
+     */
+    static JobScheduler& Get();
 
-    void AddTask(std::function<void()> workFn, std::function<void()> completionFn = nullptr)
+    size_t GetWorkerCount() const
     {
-        unique_lock lock(_mutex);
-        _pending.emplace_back(workFn, completionFn);
-        _condPending.notify_one();
+        return _workers.size();
     }
 
-    void Join(std::function<void()> reportFn = nullptr)
-    {
-        unique_lock lock(_mutex);
-        while (true)
-        {
-            // Wait for the queue to become empty or having completed tasks.
-            _condComplete.wait(lock, [this]() { return (_pending.empty() && _processing == 0) || !_completed.empty(); });
+    /**
+     * Submits a batch of jobs. Jobs submitted from a worker go onto that worker's own deque.
+     */
+    void Submit(Job* const* jobs, size_t count);
 
-            // Dispatch all completion callbacks if there are any.
-            while (!_completed.empty())
-            {
-                auto taskData = _completed.front();
-                _completed.pop_front();
+    /**
+     * Runs a single queued job on the calling thread if one can be found.
+     * @return true if a job was run.
+     */
+    bool RunPendingJob();
 
-                if (taskData.CompletionFn)
-                {
-                    lock.unlock();
+private:
+    void ProcessQueue(size_t workerIndex);
+    Job* FindJob(Worker* self);
+    Job* TakeInjected(Worker* self);
+    void Run(Job* job);
+    void WakeWorkers(size_t count);
+};
 
-                    taskData.CompletionFn();
+/**
+ * A group of tasks executed on the shared JobScheduler, Join waits for every task added
+ * to this group. Multiple pools may be used at the same time without creating additional
+ * threads. A pool has a single producer: tasks must be added and joined from one thread,
+ * which may change once the pool has been joined.
+ */
+class JobPool
+{
+    friend class JobScheduler;
 
-                    lock.lock();
-                }
-            }
+private:
+    static constexpr size_t JobChunkSize = 64;
+    static constexpr size_t BatchSize = 32;
 
-            if (reportFn)
-            {
-                lock.unlock();
+    JobScheduler& _scheduler;
+    std::vector<std::unique_ptr<Job[]>> _jobChunks;
+    size_t _jobsUsed = 0;
+    std::vector<Job*> _batch;
+    std::thread::id _producer;
 
-                reportFn();
+    size_t _processing = 0;
+    std::vector<std::function<void()>> _completed;
+    std::condition_variable _condComplete;
+    std::mutex _mutex;
 
-                lock.lock();
-            }
+    using unique_lock = std::unique_lock<std::mutex>;
 
-            // If everything is empty and no more work has to be done we can stop waiting.
-            if (_completed.empty() && _pending.empty() && _processing == 0)
-            {
-                break;
-            }
-        }
+public:
+    JobPool()
+        : _scheduler(JobScheduler::Get())
+    {
+        _batch.reserve(BatchSize);
     }
 
-    size_t CountPending()
+    ~JobPool()
     {
-        return _pending.size();
+        Join();
     }
 
-private:
-    void ProcessQueue()
+    JobPool(const JobPool&) = delete;
+    JobPool& operator=(const JobPool&) = delete;
+
+    template<typename TFn> void AddTask(TFn&& workFn)
     {
-        unique_lock lock(_mutex);
-        do
+        using TCallable = std::decay_t<TFn>;
+        if constexpr (sizeof(TCallable) <= Job::StorageSize && alignof(TCallable) <= alignof(std::max_align_t))
         {
-            // Wait for work or cancelation.
-            _condPending.wait(lock, [this]() { return _shouldStop || !_pending.empty(); });
-
-            if (!_pending.empty())
-            {
-                _processing++;
-
-                auto taskData = _pending.front();
-                _pending.pop_front();
-
-                lock.unlock();
+            auto job = AllocateJob();
+            new (job->Storage) TCallable(std::forward<TFn>(workFn));
+            job->Invoke = &InvokeAndDestroy<TCallable>;
+            Enqueue(job);
+        }
+        else
+        {
+            // Too large to be stored inline, box it.
+            AddTask([boxed = std::make_unique<TCallable>(std::forward<TFn>(workFn))]() { (*boxed)(); });
+        }
+    }
 
-                taskData.WorkFn();
+    void AddTask(std::function<void()> workFn, std::function<void()> completionFn)
+    {
+        if (completionFn == nullptr)
+        {
+            AddTask(std::move(workFn));
+            return;
+        }
+        AddTask([this, workFn = std::move(workFn), completionFn = std::move(completionFn)]() {
+            workFn();
+            PostCompletion(completionFn);
+        });
+    }
 
-                lock.lock();
+    void Join(std::function<void()> reportFn = nullptr);
 
-                _completed.push_back(taskData);
+    size_t CountPending()
+    {
+        unique_lock lock(_mutex);
+        return _processing + _batch.size();
+    }
 
-                _processing--;
-                _condComplete.notify_one();
-            }
-        } while (!_shouldStop);
+private:
+    template<typename TCallable> static void InvokeAndDestroy(void* storage)
+    {
+        auto fn = static_cast<TCallable*>(storage);
+        (*fn)();
+        fn->~TCallable();
     }
+
+    Job* AllocateJob();
+    void Enqueue(Job* job);
+    void Flush();
+    void PostCompletion(const std::function<void()>& completionFn);
+    void OnJobFinished();
 };
@@ -0,0 +1,131 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#ifdef _WIN32
+#    define WIN32_LEAN_AND_MEAN
+#    include <windows.h>
+#else
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+#include "IStream.hpp"
+#include "MemoryMappedFile.h"
+#include "String.hpp"
+
+#ifdef _WIN32
+
+MemoryMappedFile::MemoryMappedFile(const std::string& path)
+{
+    auto pathW = String::ToWideChar(path);
+    auto file = CreateFileW(
+        pathW.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        throw IOException(String::StdFormat("Unable to open '%s'", path.c_str()));
+    }
+    _fileHandle = file;
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize))
+    {
+        Close();
+        throw IOException(String::StdFormat("Unable to get size of '%s'", path.c_str()));
+    }
+    _length = static_cast<size_t>(fileSize.QuadPart);
+    if (_length == 0)
+    {
+        return;
+    }
+
+    _mappingHandle = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (_mappingHandle != nullptr)
+    {
+        _data = static_cast<const uint8_t*>(MapViewOfFile(_mappingHandle, FILE_MAP_READ, 0, 0, 0));
+    }
+    if (_data == nullptr)
+    {
+        Close();
+        throw IOException(String::StdFormat("Unable to map '%s'", path.c_str()));
+    }
+}
+
+void MemoryMappedFile::Close()
+{
+    if (_data != nullptr)
+    {
+        UnmapViewOfFile(_data);
+        _data = nullptr;
+    }
+    if (_mappingHandle != nullptr)
+    {
+        CloseHandle(_mappingHandle);
+        _mappingHandle = nullptr;
+    }
+    if (_fileHandle != nullptr)
+    {
+        CloseHandle(_fileHandle);
+        _fileHandle = nullptr;
+    }
+}
+
+#else
+
+MemoryMappedFile::MemoryMappedFile(const std::string& path)
+{
+    _fd = open(path.c_str(), O_RDONLY);
+    if (_fd == -1)
+    {
+        throw IOException(String::StdFormat("Unable to open '%s'", path.c_str()));
+    }
+
+    // Only allow regular files, same as FileStream
+    struct stat fileStat;
+    if (fstat(_fd, &fileStat) != 0 || !S_ISREG(fileStat.st_mode))
+    {
+        Close();
+        throw IOException(String::StdFormat("Unable to open '%s'", path.c_str()));
+    }
+    _length = static_cast<size_t>(fileStat.st_size);
+    if (_length == 0)
+    {
+        return;
+    }
+
+    void* data = mmap(nullptr, _length, PROT_READ, MAP_PRIVATE, _fd, 0);
+    if (data == MAP_FAILED)
+    {
+        Close();
+        throw IOException(String::StdFormat("Unable to map '%s'", path.c_str()));
+    }
+    _data = static_cast<const uint8_t*>(data);
+}
+
+void MemoryMappedFile::Close()
+{
+    if (_data != nullptr)
+    {
+        munmap(const_cast<uint8_t*>(_data), _length);
+        _data = nullptr;
+    }
+    if (_fd != -1)
+    {
+        close(_fd);
+        _fd = -1;
+    }
+}
+
+#endif
+
+MemoryMappedFile::~MemoryMappedFile()
+{
+    Close();
+}
@@ -79,6 +79,19 @@ namespace Random
         std::array<result_type, N> v;
     };
 
+    /**
+     * Advances state and returns the next number of the SplitMix64 sequence. Consecutive states give numbers that look
+     * unrelated, which makes it suitable for turning a seed and a stream number into the seed of an engine.
+     */
+    constexpr uint64_t SplitMix64(uint64_t& state)
+    {
+        state += 0x9E3779B97F4A7C15;
+        uint64_t z = state;
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EB;
+        return z ^ (z >> 31);
+    }
+
     template<typename _TUIntType> struct RotateEngineState
     {
         using value_type = _TUIntType;
@@ -123,12 +136,14 @@ namespace Random
             seed(seed_value);
         }
 
-        RotateEngine(RotateEngine& r)
+        RotateEngine(const RotateEngine& r)
         {
             s0 = r.s0;
             s1 = r.s1;
         }
 
+        RotateEngine& operator=(const RotateEngine&) = default;
+
         template<typename _TSseq, typename = typename std::enable_if<!std::is_same<_TSseq, RotateEngine>::value>::type>
         explicit RotateEngine(_TSseq& seed_seq)
         {
@@ -191,5 +206,19 @@ namespace Random
         using Engine = RotateEngine<uint32_t, 0x1234567F, 7, 3>;
         using Seed = FixedSeedSequence<2>;
         using State = Engine::state_type;
+
+        /**
+         * Creates an engine whose sequence only depends on the seed, the stream and the key. Streams split from the same
+         * seed are independent of each other, so they can be drawn from in any order or on any thread.
+         */
+        inline Engine Split(uint64_t seed, uint32_t stream, uint32_t key = 0)
+        {
+            uint64_t state = seed;
+            state = SplitMix64(state) ^ stream;
+            state = SplitMix64(state) ^ key;
+            uint64_t s = SplitMix64(state);
+            Seed seedSequence{ static_cast<uint32_t>(s >> 32), static_cast<uint32_t>(s) };
+            return Engine(seedSequence);
+        }
     } // namespace Rct2
 } // namespace Random
@@ -13,6 +13,7 @@
 
 #ifdef __AVX2__
 
+#    include <cstring>
 #    include <immintrin.h>
 
 void mask_avx2(
@@ -42,6 +43,148 @@ void mask_avx2(
     }
 }
 
+// Loads 32 pixels from every other source byte. Only zoom level 1 is handled, from zoom level 2 on a block would
+// need more source pixels than a run can hold.
+static inline __m256i rle_load_zoom1_avx2(const uint8_t* src)
+{
+    static_assert((RLE_RUN_BLOCK_SIZE * 2 << 1) <= RLE_RUN_MAX_LENGTH);
+    const __m256i keep = _mm256_set1_epi16(0xFF);
+    const __m256i a = _mm256_and_si256(_mm256_loadu_si256((const __m256i*)src), keep);
+    const __m256i b = _mm256_and_si256(_mm256_loadu_si256((const __m256i*)(src + 32)), keep);
+    // Packing works per 128 bit lane, restore the order of the 64 bit halves afterwards.
+    return _mm256_permute4x64_epi64(_mm256_packus_epi16(a, b), 0xD8);
+}
+
+// Looks up 32 indices in a 256 entry palette held as 16 rows of 16 entries. Only the row
+// matching the high nibble keeps its index below 0x80 after the saturating add, all other
+// rows are zeroed by the shuffle.
+static inline __m256i rle_palette_lookup_avx2(const __m256i* rows, __m256i indices)
+{
+    const __m256i bias = _mm256_set1_epi8(0x70);
+    __m256i result = _mm256_setzero_si256();
+    for (int32_t row = 0; row < 16; row++)
+    {
+        const __m256i local = _mm256_adds_epu8(_mm256_sub_epi8(indices, _mm256_set1_epi8((char)(row * 16))), bias);
+        result = _mm256_or_si256(result, _mm256_shuffle_epi8(rows[row], local));
+    }
+    return result;
+}
+
+void rle_run_avx2(
+    int32_t imageType, int32_t zoomLevel, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, const uint8_t* RESTRICT palette,
+    int32_t numPixels)
+{
+    constexpr int32_t blockSize = RLE_RUN_BLOCK_SIZE * 2;
+    if (imageType == IMAGE_TYPE_DEFAULT)
+    {
+        if (zoomLevel == 1)
+        {
+            constexpr int32_t srcStep = blockSize << 1;
+            for (; numPixels >= srcStep; numPixels -= srcStep, src += srcStep, dst += blockSize)
+            {
+                _mm256_storeu_si256((__m256i*)dst, rle_load_zoom1_avx2(src));
+            }
+        }
+        // Every AVX2 capable CPU has SSE4.1, let it take the remaining 16 pixel blocks.
+        rle_run_sse4_1(imageType, zoomLevel, src, dst, palette, numPixels);
+        return;
+    }
+
+    // Glass and ghosts look up the destination pixel, with a full line of them the shuffle based
+    // lookup beats the scalar one. Zoomed out runs are too short to make up for loading the rows.
+    if (imageType == IMAGE_TYPE_TRANSPARENT && zoomLevel == 0)
+    {
+        __m256i rows[16];
+        for (int32_t row = 0; row < 16; row++)
+        {
+            rows[row] = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)(palette + row * 16)));
+        }
+
+        for (; numPixels >= blockSize; numPixels -= blockSize, dst += blockSize)
+        {
+            const __m256i indices = _mm256_loadu_si256((const __m256i*)dst);
+            _mm256_storeu_si256((__m256i*)dst, rle_palette_lookup_avx2(rows, indices));
+        }
+    }
+    rle_run_scalar(imageType, zoomLevel, src, dst, palette, numPixels);
+}
+
+// Gathers the packed RGBA colours of eight palette indices, every step'th source pixel.
+static inline __m256i frame_gather_avx2(const uint8_t* src, int32_t step, const uint32_t* lut)
+{
+    __m256i indices;
+    if (step == 1)
+    {
+        indices = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)src));
+    }
+    else
+    {
+        indices = _mm256_setr_epi32(
+            src[0], src[step], src[2 * step], src[3 * step], src[4 * step], src[5 * step], src[6 * step], src[7 * step]);
+    }
+    return _mm256_i32gather_epi32((const int*)lut, indices, 4);
+}
+
+void frame_convert_row_avx2(
+    FrameFormat format, const uint8_t* RESTRICT src, int32_t srcStep, const uint32_t* RESTRICT lut, void* RESTRICT dst,
+    size_t planeSize, int32_t width)
+{
+    constexpr int32_t blockSize = 8;
+    const int32_t srcBlockStep = blockSize * srcStep;
+    int32_t x = 0;
+    switch (format)
+    {
+        case FrameFormat::RGB:
+        {
+            // Drop the alpha byte of every pixel, leaving 12 bytes at the bottom of each lane.
+            const __m256i packRGB = _mm256_setr_epi8(
+                0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1, 0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+            auto rgb = static_cast<uint8_t*>(dst);
+            for (; x + blockSize <= width; x += blockSize, src += srcBlockStep, rgb += blockSize * 3)
+            {
+                const __m256i packed = _mm256_shuffle_epi8(frame_gather_avx2(src, srcStep, lut), packRGB);
+                const __m128i high = _mm256_extracti128_si256(packed, 1);
+                // The low lane writes 4 bytes too many, which the high lane overwrites.
+                _mm_storeu_si128((__m128i*)rgb, _mm256_castsi256_si128(packed));
+                _mm_storel_epi64((__m128i*)(rgb + 12), high);
+                const int32_t last = _mm_extract_epi32(high, 2);
+                std::memcpy(rgb + 20, &last, sizeof(last));
+            }
+            dst = rgb;
+            break;
+        }
+        case FrameFormat::RGBA:
+        {
+            auto rgba = static_cast<uint8_t*>(dst);
+            for (; x + blockSize <= width; x += blockSize, src += srcBlockStep, rgba += blockSize * 4)
+            {
+                _mm256_storeu_si256((__m256i*)rgba, frame_gather_avx2(src, srcStep, lut));
+            }
+            dst = rgba;
+            break;
+        }
+        case FrameFormat::PlanarFloat:
+        {
+            const __m256i byteMask = _mm256_set1_epi32(0xFF);
+            const __m256 scale = _mm256_set1_ps(1.0f / 255.0f);
+            auto red = static_cast<float*>(dst);
+            for (; x + blockSize <= width; x += blockSize, src += srcBlockStep, red += blockSize)
+            {
+                const __m256i colours = frame_gather_avx2(src, srcStep, lut);
+                const __m256i r = _mm256_and_si256(colours, byteMask);
+                const __m256i g = _mm256_and_si256(_mm256_srli_epi32(colours, 8), byteMask);
+                const __m256i b = _mm256_and_si256(_mm256_srli_epi32(colours, 16), byteMask);
+                _mm256_storeu_ps(red, _mm256_mul_ps(_mm256_cvtepi32_ps(r), scale));
+                _mm256_storeu_ps(red + planeSize, _mm256_mul_ps(_mm256_cvtepi32_ps(g), scale));
+                _mm256_storeu_ps(red + 2 * planeSize, _mm256_mul_ps(_mm256_cvtepi32_ps(b), scale));
+            }
+            dst = red;
+            break;
+        }
+    }
+    frame_convert_row_scalar(format, src, srcStep, lut, dst, planeSize, width - x);
+}
+
 #else
 
 #    ifdef OPENRCT2_X86
@@ -55,4 +198,18 @@ void mask_avx2(
     openrct2_assert(false, "AVX2 function called on a CPU that doesn't support AVX2");
 }
 
+void rle_run_avx2(
+    int32_t imageType, int32_t zoomLevel, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, const uint8_t* RESTRICT palette,
+    int32_t numPixels)
+{
+    openrct2_assert(false, "AVX2 function called on a CPU that doesn't support AVX2");
+}
+
+void frame_convert_row_avx2(
+    FrameFormat format, const uint8_t* RESTRICT src, int32_t srcStep, const uint32_t* RESTRICT lut, void* RESTRICT dst,
+    size_t planeSize, int32_t width)
+{
+    openrct2_assert(false, "AVX2 function called on a CPU that doesn't support AVX2");
+}
+
 #endif // __AVX2__
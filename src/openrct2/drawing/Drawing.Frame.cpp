@@ -0,0 +1,123 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "Drawing.h"
+
+#include <array>
+
+static size_t frame_get_bytes_per_pixel(FrameFormat format)
+{
+    switch (format)
+    {
+        case FrameFormat::RGB:
+            return 3;
+        case FrameFormat::RGBA:
+            return 4;
+        case FrameFormat::PlanarFloat:
+        default:
+            return 3 * sizeof(float);
+    }
+}
+
+/**
+ * Converts one row of palette indices, reading every srcStep'th pixel. The lookup table holds the palette packed as
+ * little endian RGBA. Planar output writes the green and blue channels planeSize floats after the red one.
+ * Reference implementation for the vectorised kernels, which use it for their remainders.
+ */
+void frame_convert_row_scalar(
+    FrameFormat format, const uint8_t* RESTRICT src, int32_t srcStep, const uint32_t* RESTRICT lut, void* RESTRICT dst,
+    size_t planeSize, int32_t width)
+{
+    switch (format)
+    {
+        case FrameFormat::RGB:
+        {
+            auto rgb = static_cast<uint8_t*>(dst);
+            for (int32_t x = 0; x < width; x++, src += srcStep, rgb += 3)
+            {
+                const uint32_t colour = lut[*src];
+                rgb[0] = colour & 0xFF;
+                rgb[1] = (colour >> 8) & 0xFF;
+                rgb[2] = (colour >> 16) & 0xFF;
+            }
+            break;
+        }
+        case FrameFormat::RGBA:
+        {
+            auto rgba = static_cast<uint8_t*>(dst);
+            for (int32_t x = 0; x < width; x++, src += srcStep, rgba += 4)
+            {
+                const uint32_t colour = lut[*src];
+                rgba[0] = colour & 0xFF;
+                rgba[1] = (colour >> 8) & 0xFF;
+                rgba[2] = (colour >> 16) & 0xFF;
+                rgba[3] = colour >> 24;
+            }
+            break;
+        }
+        case FrameFormat::PlanarFloat:
+        {
+            auto red = static_cast<float*>(dst);
+            auto green = red + planeSize;
+            auto blue = green + planeSize;
+            for (int32_t x = 0; x < width; x++, src += srcStep)
+            {
+                const uint32_t colour = lut[*src];
+                red[x] = (colour & 0xFF) * (1.0f / 255.0f);
+                green[x] = ((colour >> 8) & 0xFF) * (1.0f / 255.0f);
+                blue[x] = ((colour >> 16) & 0xFF) * (1.0f / 255.0f);
+            }
+            break;
+        }
+    }
+}
+
+size_t gfx_frame_get_size(int32_t width, int32_t height, FrameFormat format, int32_t downsample)
+{
+    const size_t dstWidth = (width + downsample - 1) / downsample;
+    const size_t dstHeight = (height + downsample - 1) / downsample;
+    return dstWidth * dstHeight * frame_get_bytes_per_pixel(format);
+}
+
+/**
+ * Converts the palette indexed pixels of a dpi to true colour. With a downsample factor above one only every
+ * downsample'th pixel of every downsample'th row is taken, the output is ceil(width / downsample) pixels wide.
+ * @param dst At least gfx_frame_get_size bytes.
+ */
+void gfx_frame_convert(
+    const rct_drawpixelinfo* dpi, const rct_palette* palette, FrameFormat format, int32_t downsample, void* dst)
+{
+    std::array<uint32_t, 256> lut;
+    for (size_t i = 0; i < lut.size(); i++)
+    {
+        const auto& entry = palette->entries[i];
+        // Match the transparency of 8-bit screenshots, which mark index 0 as transparent.
+        const uint32_t alpha = i == PALETTE_INDEX_0 ? 0 : 0xFF;
+        lut[i] = entry.red | (entry.green << 8) | (entry.blue << 16) | (alpha << 24);
+    }
+
+    const int32_t srcStride = dpi->width + dpi->pitch;
+    const int32_t dstWidth = (dpi->width + downsample - 1) / downsample;
+    const int32_t dstHeight = (dpi->height + downsample - 1) / downsample;
+    const size_t planeSize = static_cast<size_t>(dstWidth) * dstHeight;
+    for (int32_t y = 0; y < dstHeight; y++)
+    {
+        const uint8_t* src = dpi->bits + static_cast<size_t>(y) * downsample * srcStride;
+        void* row;
+        if (format == FrameFormat::PlanarFloat)
+        {
+            row = static_cast<float*>(dst) + static_cast<size_t>(y) * dstWidth;
+        }
+        else
+        {
+            row = static_cast<uint8_t*>(dst) + static_cast<size_t>(y) * dstWidth * frame_get_bytes_per_pixel(format);
+        }
+        frame_convert_row_fn(format, src, downsample, lut.data(), row, planeSize, dstWidth);
+    }
+}
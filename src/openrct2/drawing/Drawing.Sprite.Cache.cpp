@@ -0,0 +1,328 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "../sprites.h"
+#include "Drawing.h"
+
+#include <algorithm>
+#include <atomic>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * A RLE sprite decoded for one zoom level and sampling phase. Pixel (x, y) holds the source pixel at
+ * (phaseX + x * zoom, phaseY + y * zoom) so drawing is a straight masked blit regardless of zoom.
+ */
+struct DecodedSprite
+{
+    const uint8_t* Source{};
+    int16_t SourceWidth{};
+    int16_t SourceHeight{};
+    int32_t Width{};
+    int32_t Height{};
+    std::vector<uint8_t> Pixels;
+    std::vector<uint8_t> Mask;
+
+    size_t GetMemoryUsage() const
+    {
+        return sizeof(DecodedSprite) + Pixels.size() + Mask.size();
+    }
+};
+
+class SpriteCacheShard
+{
+private:
+    using Entry = std::pair<uint64_t, std::shared_ptr<const DecodedSprite>>;
+
+    std::mutex _mutex;
+    std::list<Entry> _entries;
+    std::unordered_map<uint64_t, std::list<Entry>::iterator> _index;
+    size_t _memoryUsage = 0;
+
+public:
+    std::shared_ptr<const DecodedSprite> Get(uint64_t key)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto it = _index.find(key);
+        if (it == _index.end())
+        {
+            return nullptr;
+        }
+        // Move to the front, the back is evicted first.
+        _entries.splice(_entries.begin(), _entries, it->second);
+        return it->second->second;
+    }
+
+    void Add(uint64_t key, std::shared_ptr<const DecodedSprite> sprite, size_t budget)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto it = _index.find(key);
+        if (it != _index.end())
+        {
+            Erase(it);
+        }
+
+        _memoryUsage += sprite->GetMemoryUsage();
+        _entries.emplace_front(key, std::move(sprite));
+        _index[key] = _entries.begin();
+
+        while (_memoryUsage > budget && !_entries.empty())
+        {
+            Erase(_index.find(_entries.back().first));
+        }
+    }
+
+    void Remove(uint32_t imageIndex)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        for (auto it = _entries.begin(); it != _entries.end();)
+        {
+            auto next = std::next(it);
+            if ((it->first >> 8) == imageIndex)
+            {
+                Erase(_index.find(it->first));
+            }
+            it = next;
+        }
+    }
+
+    void Clear()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _entries.clear();
+        _index.clear();
+        _memoryUsage = 0;
+    }
+
+private:
+    void Erase(std::unordered_map<uint64_t, std::list<Entry>::iterator>::iterator it)
+    {
+        _memoryUsage -= it->second->second->GetMemoryUsage();
+        _entries.erase(it->second);
+        _index.erase(it);
+    }
+};
+
+// Sprites are painted from multiple threads, shard the cache by image to keep lock contention low.
+static constexpr size_t SPRITE_CACHE_SHARD_COUNT = 16;
+static SpriteCacheShard _spriteCacheShards[SPRITE_CACHE_SHARD_COUNT];
+static std::atomic<size_t> _spriteCacheBudget = { 16 * 1024 * 1024 };
+
+static SpriteCacheShard& sprite_cache_get_shard(uint32_t imageIndex)
+{
+    return _spriteCacheShards[imageIndex % SPRITE_CACHE_SHARD_COUNT];
+}
+
+static std::shared_ptr<const DecodedSprite> sprite_cache_decode(
+    const rct_g1_element* g1, int32_t zoomLevel, int32_t phaseX, int32_t phaseY)
+{
+    const int32_t zoomAmount = 1 << zoomLevel;
+
+    auto sprite = std::make_shared<DecodedSprite>();
+    sprite->Source = g1->offset;
+    sprite->SourceWidth = g1->width;
+    sprite->SourceHeight = g1->height;
+    sprite->Width = std::max(0, (g1->width - phaseX + zoomAmount - 1) >> zoomLevel);
+    sprite->Height = std::max(0, (g1->height - phaseY + zoomAmount - 1) >> zoomLevel);
+    sprite->Pixels.resize(sprite->Width * sprite->Height);
+    sprite->Mask.resize(sprite->Width * sprite->Height);
+
+    const uint8_t* source = g1->offset;
+    for (int32_t row = 0; row < sprite->Height; row++)
+    {
+        const int32_t y = phaseY + (row << zoomLevel);
+        const uint16_t lineOffset = source[y * 2] | (source[y * 2 + 1] << 8);
+        const uint8_t* lineData = source + lineOffset;
+        uint8_t* pixels = sprite->Pixels.data() + row * sprite->Width;
+        uint8_t* mask = sprite->Mask.data() + row * sprite->Width;
+
+        uint8_t isEndOfLine = 0;
+        while (!isEndOfLine)
+        {
+            uint8_t dataSize = *lineData++;
+            uint8_t firstPixelX = *lineData++;
+            isEndOfLine = dataSize & 0x80;
+            dataSize &= 0x7F;
+
+            // Only keep the pixels on the sampling grid of this phase.
+            for (int32_t x = firstPixelX; x < firstPixelX + dataSize; x++)
+            {
+                int32_t relativeX = x - phaseX;
+                if (relativeX >= 0 && (relativeX & (zoomAmount - 1)) == 0)
+                {
+                    int32_t column = relativeX >> zoomLevel;
+                    if (column < sprite->Width)
+                    {
+                        pixels[column] = lineData[x - firstPixelX];
+                        mask[column] = 0xFF;
+                    }
+                }
+            }
+            lineData += dataSize;
+        }
+    }
+    return sprite;
+}
+
+template<int32_t image_type>
+static void FASTCALL sprite_cache_blit_row(
+    const uint8_t* RESTRICT pixels, const uint8_t* RESTRICT mask, uint8_t* RESTRICT dst, const uint8_t* RESTRICT palette_pointer,
+    int32_t count)
+{
+    for (int32_t x = 0; x < count; x++)
+    {
+        if (image_type == IMAGE_TYPE_DEFAULT)
+        {
+            // Branch free select so the compiler can vectorise it.
+            dst[x] = (pixels[x] & mask[x]) | (dst[x] & ~mask[x]);
+        }
+        else if (mask[x])
+        {
+            if (image_type == (IMAGE_TYPE_REMAP | IMAGE_TYPE_TRANSPARENT))
+            {
+                uint16_t color = ((pixels[x] << 8) | dst[x]) - 0x100;
+                dst[x] = palette_pointer[color];
+            }
+            else if (image_type == IMAGE_TYPE_REMAP)
+            {
+                dst[x] = palette_pointer[pixels[x]];
+            }
+            else
+            {
+                dst[x] = palette_pointer[dst[x]];
+            }
+        }
+    }
+}
+
+template<int32_t image_type>
+static void FASTCALL sprite_cache_blit(
+    const DecodedSprite& sprite, int32_t firstRow, int32_t firstColumn, uint8_t* dest_bits_pointer,
+    const uint8_t* palette_pointer, int32_t lineWidth, int32_t rows, int32_t columns)
+{
+    for (int32_t row = 0; row < rows; row++)
+    {
+        int32_t sourceOffset = (firstRow + row) * sprite.Width + firstColumn;
+        sprite_cache_blit_row<image_type>(
+            sprite.Pixels.data() + sourceOffset, sprite.Mask.data() + sourceOffset, dest_bits_pointer + row * lineWidth,
+            palette_pointer, columns);
+    }
+}
+
+/**
+ * Draws a RLE sprite from its decoded copy, taking the same arguments as gfx_rle_sprite_to_buffer and
+ * producing the same pixels.
+ * @return false if the sprite can not be cached, the caller has to draw it directly.
+ */
+bool FASTCALL gfx_sprite_cache_draw(
+    uint32_t imageIndex, const rct_g1_element* g1, uint8_t* dest_bits_pointer, const uint8_t* palette_pointer,
+    const rct_drawpixelinfo* dpi, ImageId imageId, int32_t source_y_start, int32_t height, int32_t source_x_start,
+    int32_t width)
+{
+    const auto zoomLevel = static_cast<int8_t>(dpi->zoom_level);
+    const size_t budget = _spriteCacheBudget;
+    if (budget == 0 || zoomLevel < 0 || imageIndex == SPR_TEMP)
+    {
+        return false;
+    }
+    // Sprites that would take up a large part of the budget are not worth evicting everything else.
+    if (static_cast<size_t>(g1->width) * g1->height * 2 > budget / SPRITE_CACHE_SHARD_COUNT / 4)
+    {
+        return false;
+    }
+
+    const int32_t zoomAmount = 1 << zoomLevel;
+    const int32_t lineWidth = (dpi->width >> zoomLevel) + dpi->pitch;
+
+    // Same adjustment as the RLE path.
+    if (source_y_start < 0)
+    {
+        source_y_start += zoomAmount;
+        height -= zoomAmount;
+        dest_bits_pointer += lineWidth;
+    }
+
+    // The sampling phase is the source coordinate modulo the zoom, floor division keeps it positive.
+    const int32_t rowOffset = source_y_start >> zoomLevel;
+    const int32_t columnOffset = source_x_start >> zoomLevel;
+    const int32_t phaseY = source_y_start - rowOffset * zoomAmount;
+    const int32_t phaseX = source_x_start - columnOffset * zoomAmount;
+
+    const uint64_t key = (static_cast<uint64_t>(imageIndex) << 8) | (zoomLevel << 6) | (phaseX << 3) | phaseY;
+    auto& shard = sprite_cache_get_shard(imageIndex);
+    auto sprite = shard.Get(key);
+    if (sprite == nullptr || sprite->Source != g1->offset || sprite->SourceWidth != g1->width
+        || sprite->SourceHeight != g1->height)
+    {
+        sprite = sprite_cache_decode(g1, zoomLevel, phaseX, phaseY);
+        shard.Add(key, sprite, budget / SPRITE_CACHE_SHARD_COUNT);
+    }
+
+    // Clip the destination rectangle to the decoded sprite, destination row r shows decoded row r + rowOffset.
+    const int32_t destStartRow = std::max(0, -rowOffset);
+    const int32_t destStartColumn = std::max(0, -columnOffset);
+    const int32_t destEndRow = std::min((height + zoomAmount - 1) >> zoomLevel, sprite->Height - rowOffset);
+    const int32_t destEndColumn = std::min((width + zoomAmount - 1) >> zoomLevel, sprite->Width - columnOffset);
+    if (destEndRow <= destStartRow || destEndColumn <= destStartColumn)
+    {
+        return true;
+    }
+
+    uint8_t* dst = dest_bits_pointer + destStartRow * lineWidth + destStartColumn;
+    const int32_t firstRow = destStartRow + rowOffset;
+    const int32_t firstColumn = destStartColumn + columnOffset;
+    const int32_t rows = destEndRow - destStartRow;
+    const int32_t columns = destEndColumn - destStartColumn;
+    if (imageId.HasPrimary())
+    {
+        if (imageId.IsBlended())
+        {
+            sprite_cache_blit<IMAGE_TYPE_REMAP | IMAGE_TYPE_TRANSPARENT>(
+                *sprite, firstRow, firstColumn, dst, palette_pointer, lineWidth, rows, columns);
+        }
+        else
+        {
+            sprite_cache_blit<IMAGE_TYPE_REMAP>(*sprite, firstRow, firstColumn, dst, palette_pointer, lineWidth, rows, columns);
+        }
+    }
+    else if (imageId.IsBlended())
+    {
+        sprite_cache_blit<IMAGE_TYPE_TRANSPARENT>(*sprite, firstRow, firstColumn, dst, palette_pointer, lineWidth, rows, columns);
+    }
+    else
+    {
+        sprite_cache_blit<IMAGE_TYPE_DEFAULT>(*sprite, firstRow, firstColumn, dst, palette_pointer, lineWidth, rows, columns);
+    }
+    return true;
+}
+
+void gfx_sprite_cache_invalidate(uint32_t imageIndex)
+{
+    sprite_cache_get_shard(imageIndex).Remove(imageIndex);
+}
+
+void gfx_sprite_cache_clear()
+{
+    for (auto& shard : _spriteCacheShards)
+    {
+        shard.Clear();
+    }
+}
+
+/**
+ * Sets the amount of memory the decoded sprites may use, 0 disables the cache.
+ */
+void gfx_sprite_cache_set_budget(size_t bytes)
+{
+    _spriteCacheBudget = bytes;
+    gfx_sprite_cache_clear();
+}
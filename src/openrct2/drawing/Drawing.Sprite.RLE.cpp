@@ -13,6 +13,113 @@
 
 #include <cstring>
 
+template<int32_t image_type, int32_t zoom_level>
+static void FASTCALL DrawRLERun(
+    const uint8_t* RESTRICT copySrc, uint8_t* RESTRICT copyDest, const uint8_t* RESTRICT palette_pointer, int32_t numPixels)
+{
+    // If the image type is not a basic one we require to mix the pixels
+    if (image_type & IMAGE_TYPE_REMAP) // palette controlled images
+    {
+        for (int j = 0; j < numPixels; j += (1 << zoom_level), copySrc += (1 << zoom_level), copyDest++)
+        {
+            if (image_type & IMAGE_TYPE_TRANSPARENT)
+            {
+                uint16_t color = ((*copySrc << 8) | *copyDest) - 0x100;
+                *copyDest = palette_pointer[color];
+            }
+            else
+            {
+                *copyDest = palette_pointer[*copySrc];
+            }
+        }
+    }
+    else if (image_type & IMAGE_TYPE_TRANSPARENT) // single alpha blended color (used for glass)
+    {
+        for (int j = 0; j < numPixels; j += (1 << zoom_level), copyDest++)
+        {
+            uint8_t pixel = *copyDest;
+            pixel = palette_pointer[pixel];
+            *copyDest = pixel;
+        }
+    }
+    else // standard opaque image
+    {
+        if (zoom_level == 0)
+        {
+            // Since we're sampling each pixel at this zoom level, just do a straight std::memcpy
+            if (numPixels > 0)
+                std::memcpy(copyDest, copySrc, numPixels);
+        }
+        else
+        {
+            for (int j = 0; j < numPixels; j += (1 << zoom_level), copySrc += (1 << zoom_level), copyDest++)
+                *copyDest = *copySrc;
+        }
+    }
+}
+
+// Unzoomed opaque runs are already a memcpy and remapped runs look up a table per source pixel, which is
+// faster than any shuffle based lookup. What remains are strided copies and the unzoomed glass destination
+// lookup, only at zoom levels where a run is long enough to fill a block.
+template<int32_t image_type, int32_t zoom_level> static constexpr bool RLERunIsVectorisable()
+{
+    if constexpr (zoom_level < 0 || (RLE_RUN_BLOCK_SIZE << zoom_level) > RLE_RUN_MAX_LENGTH)
+        return false;
+    if (image_type == IMAGE_TYPE_DEFAULT)
+        return zoom_level != 0;
+    return image_type == IMAGE_TYPE_TRANSPARENT && zoom_level == 0;
+}
+
+template<int32_t image_type>
+static void FASTCALL DrawRLERunZoomed(
+    int32_t zoomLevel, const uint8_t* RESTRICT copySrc, uint8_t* RESTRICT copyDest, const uint8_t* RESTRICT palette_pointer,
+    int32_t numPixels)
+{
+    switch (zoomLevel)
+    {
+        case 0:
+            DrawRLERun<image_type, 0>(copySrc, copyDest, palette_pointer, numPixels);
+            break;
+        case 1:
+            DrawRLERun<image_type, 1>(copySrc, copyDest, palette_pointer, numPixels);
+            break;
+        case 2:
+            DrawRLERun<image_type, 2>(copySrc, copyDest, palette_pointer, numPixels);
+            break;
+        case 3:
+            DrawRLERun<image_type, 3>(copySrc, copyDest, palette_pointer, numPixels);
+            break;
+        default:
+            assert(false);
+            break;
+    }
+}
+
+/**
+ * Draws a single run of RLE pixels, every (1 << zoomLevel)th source pixel is written.
+ * Reference implementation for the vectorised kernels, which use it for their remainders.
+ */
+void rle_run_scalar(
+    int32_t imageType, int32_t zoomLevel, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, const uint8_t* RESTRICT palette,
+    int32_t numPixels)
+{
+    switch (imageType)
+    {
+        case IMAGE_TYPE_REMAP | IMAGE_TYPE_TRANSPARENT:
+            DrawRLERunZoomed<IMAGE_TYPE_REMAP | IMAGE_TYPE_TRANSPARENT>(zoomLevel, src, dst, palette, numPixels);
+            break;
+        case IMAGE_TYPE_REMAP:
+            DrawRLERunZoomed<IMAGE_TYPE_REMAP>(zoomLevel, src, dst, palette, numPixels);
+            break;
+        case IMAGE_TYPE_TRANSPARENT:
+            DrawRLERunZoomed<IMAGE_TYPE_TRANSPARENT>(zoomLevel, src, dst, palette, numPixels);
+            break;
+        default:
+            DrawRLERunZoomed<IMAGE_TYPE_DEFAULT>(zoomLevel, src, dst, palette, numPixels);
+            break;
+    }
+}
+
 template<int32_t image_type, int32_t zoom_level>
 static void FASTCALL DrawRLESprite2_Magnify(
     const uint8_t* RESTRICT source_bits_pointer, uint8_t* RESTRICT dest_bits_pointer, const uint8_t* RESTRICT palette_pointer,
@@ -102,45 +209,15 @@ static void FASTCALL DrawRLESprite2(
 
             uint8_t* copyDest = loop_dest_pointer + (x_start >> zoom_level);
 
-            // Finally after all those checks, copy the image onto the drawing surface
-            // If the image type is not a basic one we require to mix the pixels
-            if (image_type & IMAGE_TYPE_REMAP) // palette controlled images
-            {
-                for (int j = 0; j < numPixels; j += zoom_amount, copySrc += zoom_amount, copyDest++)
-                {
-                    if (image_type & IMAGE_TYPE_TRANSPARENT)
-                    {
-                        uint16_t color = ((*copySrc << 8) | *copyDest) - 0x100;
-                        *copyDest = palette_pointer[color];
-                    }
-                    else
-                    {
-                        *copyDest = palette_pointer[*copySrc];
-                    }
-                }
-            }
-            else if (image_type & IMAGE_TYPE_TRANSPARENT) // single alpha blended color (used for glass)
+            // Finally after all those checks, copy the image onto the drawing surface.
+            // Long runs are handed to the vectorised kernel, short ones are not worth the call.
+            if (RLERunIsVectorisable<image_type, zoom_level>() && numPixels >= (RLE_RUN_BLOCK_SIZE << zoom_level))
             {
-                for (int j = 0; j < numPixels; j += zoom_amount, copyDest++)
-                {
-                    uint8_t pixel = *copyDest;
-                    pixel = palette_pointer[pixel];
-                    *copyDest = pixel;
-                }
+                rle_run_fn(image_type, zoom_level, copySrc, copyDest, palette_pointer, numPixels);
             }
-            else // standard opaque image
+            else
             {
-                if (zoom_level == 0)
-                {
-                    // Since we're sampling each pixel at this zoom level, just do a straight std::memcpy
-                    if (numPixels > 0)
-                        std::memcpy(copyDest, copySrc, numPixels);
-                }
-                else
-                {
-                    for (int j = 0; j < numPixels; j += zoom_amount, copySrc += zoom_amount, copyDest++)
-                        *copyDest = *copySrc;
-                }
+                DrawRLERun<image_type, zoom_level>(copySrc, copyDest, palette_pointer, numPixels);
             }
         }
     }
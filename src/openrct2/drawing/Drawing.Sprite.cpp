@@ -279,6 +279,7 @@ bool gfx_load_g1(const IPlatformEnvironment& env)
 
 void gfx_unload_g1()
 {
+    gfx_sprite_cache_clear();
     SafeFree(_g1.data);
     _g1.elements.clear();
     _g1.elements.shrink_to_fit();
@@ -286,6 +287,7 @@ void gfx_unload_g1()
 
 void gfx_unload_g2()
 {
+    gfx_sprite_cache_clear();
     SafeFree(_g2.data);
     _g2.elements.clear();
     _g2.elements.shrink_to_fit();
@@ -293,6 +295,7 @@ void gfx_unload_g2()
 
 void gfx_unload_csg()
 {
+    gfx_sprite_cache_clear();
     SafeFree(_csg.data);
     _csg.elements.clear();
     _csg.elements.shrink_to_fit();
@@ -619,6 +622,12 @@ void FASTCALL gfx_draw_sprite_palette_set_software(
     {
         // We have to use a different method to move the source pointer for
         // rle encoded sprites so that will be handled within this function
+        if (gfx_sprite_cache_draw(
+                imageId.GetIndex(), g1, dest_pointer, palette_pointer, dpi, imageId, source_start_y, height, source_start_x,
+                width))
+        {
+            return;
+        }
         gfx_rle_sprite_to_buffer(
             g1->offset, dest_pointer, palette_pointer, dpi, imageId, source_start_y, height, source_start_x, width);
         return;
@@ -775,6 +784,7 @@ void gfx_set_g1_element(int32_t imageId, const rct_g1_element* g1)
         }
         else if (isValid)
         {
+            gfx_sprite_cache_invalidate(imageId);
             if (imageId < SPR_RCTC_G1_END)
             {
                 if (imageId < (int32_t)_g1.elements.size())
@@ -516,6 +516,54 @@ void mask_init()
     }
 }
 
+void (*rle_run_fn)(
+    int32_t imageType, int32_t zoomLevel, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, const uint8_t* RESTRICT palette,
+    int32_t numPixels)
+    = rle_run_scalar;
+
+void rle_init()
+{
+    if (avx2_available())
+    {
+        log_verbose("registering AVX2 RLE run function");
+        rle_run_fn = rle_run_avx2;
+    }
+    else if (sse41_available())
+    {
+        log_verbose("registering SSE4.1 RLE run function");
+        rle_run_fn = rle_run_sse4_1;
+    }
+    else
+    {
+        log_verbose("registering scalar RLE run function");
+        rle_run_fn = rle_run_scalar;
+    }
+}
+
+void (*frame_convert_row_fn)(
+    FrameFormat format, const uint8_t* RESTRICT src, int32_t srcStep, const uint32_t* RESTRICT lut, void* RESTRICT dst,
+    size_t planeSize, int32_t width)
+    = frame_convert_row_scalar;
+
+void frame_convert_init()
+{
+    if (avx2_available())
+    {
+        log_verbose("registering AVX2 frame conversion function");
+        frame_convert_row_fn = frame_convert_row_avx2;
+    }
+    else if (sse41_available())
+    {
+        log_verbose("registering SSE4.1 frame conversion function");
+        frame_convert_row_fn = frame_convert_row_sse4_1;
+    }
+    else
+    {
+        log_verbose("registering scalar frame conversion function");
+        frame_convert_row_fn = frame_convert_row_scalar;
+    }
+}
+
 void gfx_draw_pixel(rct_drawpixelinfo* dpi, int32_t x, int32_t y, int32_t colour)
 {
     gfx_fill_rect(dpi, x, y, x, y, colour);
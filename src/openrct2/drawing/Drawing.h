@@ -498,6 +498,13 @@ void FASTCALL gfx_rle_sprite_to_buffer(
     const uint8_t* RESTRICT source_bits_pointer, uint8_t* RESTRICT dest_bits_pointer, const uint8_t* RESTRICT palette_pointer,
     const rct_drawpixelinfo* RESTRICT dpi, ImageId imageId, int32_t source_y_start, int32_t height, int32_t source_x_start,
     int32_t width);
+bool FASTCALL gfx_sprite_cache_draw(
+    uint32_t imageIndex, const rct_g1_element* g1, uint8_t* dest_bits_pointer, const uint8_t* palette_pointer,
+    const rct_drawpixelinfo* dpi, ImageId imageId, int32_t source_y_start, int32_t height, int32_t source_x_start,
+    int32_t width);
+void gfx_sprite_cache_invalidate(uint32_t imageIndex);
+void gfx_sprite_cache_clear();
+void gfx_sprite_cache_set_budget(size_t bytes);
 void FASTCALL gfx_draw_sprite(rct_drawpixelinfo* dpi, int32_t image_id, int32_t x, int32_t y, uint32_t tertiary_colour);
 void FASTCALL gfx_draw_glpyh(rct_drawpixelinfo* dpi, int32_t image_id, int32_t x, int32_t y, uint8_t* palette);
 void FASTCALL gfx_draw_sprite_raw_masked(rct_drawpixelinfo* dpi, int32_t x, int32_t y, int32_t maskImage, int32_t colourImage);
@@ -578,6 +585,54 @@ extern void (*mask_fn)(
     int32_t width, int32_t height, const uint8_t* RESTRICT maskSrc, const uint8_t* RESTRICT colourSrc, uint8_t* RESTRICT dst,
     int32_t maskWrap, int32_t colourWrap, int32_t dstWrap);
 
+// Amount of destination pixels the vectorised RLE run kernels process per step.
+constexpr int32_t RLE_RUN_BLOCK_SIZE = 16;
+// Longest run of pixels an RLE sprite chunk can hold, its length is stored in 7 bits.
+constexpr int32_t RLE_RUN_MAX_LENGTH = 0x7F;
+
+void rle_run_scalar(
+    int32_t imageType, int32_t zoomLevel, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, const uint8_t* RESTRICT palette,
+    int32_t numPixels);
+void rle_run_sse4_1(
+    int32_t imageType, int32_t zoomLevel, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, const uint8_t* RESTRICT palette,
+    int32_t numPixels);
+void rle_run_avx2(
+    int32_t imageType, int32_t zoomLevel, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, const uint8_t* RESTRICT palette,
+    int32_t numPixels);
+void rle_init();
+
+extern void (*rle_run_fn)(
+    int32_t imageType, int32_t zoomLevel, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, const uint8_t* RESTRICT palette,
+    int32_t numPixels);
+
+// Pixel layouts a palette indexed frame can be converted to.
+enum class FrameFormat : uint8_t
+{
+    RGB,         // 3 bytes per pixel
+    RGBA,        // 4 bytes per pixel, palette index 0 is transparent
+    PlanarFloat, // Separate red, green and blue planes of floats between 0 and 1 (CHW)
+};
+
+// Amount of bytes a frame converted with gfx_frame_convert needs.
+size_t gfx_frame_get_size(int32_t width, int32_t height, FrameFormat format, int32_t downsample);
+void gfx_frame_convert(
+    const rct_drawpixelinfo* dpi, const rct_palette* palette, FrameFormat format, int32_t downsample, void* dst);
+
+void frame_convert_row_scalar(
+    FrameFormat format, const uint8_t* RESTRICT src, int32_t srcStep, const uint32_t* RESTRICT lut, void* RESTRICT dst,
+    size_t planeSize, int32_t width);
+void frame_convert_row_sse4_1(
+    FrameFormat format, const uint8_t* RESTRICT src, int32_t srcStep, const uint32_t* RESTRICT lut, void* RESTRICT dst,
+    size_t planeSize, int32_t width);
+void frame_convert_row_avx2(
+    FrameFormat format, const uint8_t* RESTRICT src, int32_t srcStep, const uint32_t* RESTRICT lut, void* RESTRICT dst,
+    size_t planeSize, int32_t width);
+void frame_convert_init();
+
+extern void (*frame_convert_row_fn)(
+    FrameFormat format, const uint8_t* RESTRICT src, int32_t srcStep, const uint32_t* RESTRICT lut, void* RESTRICT dst,
+    size_t planeSize, int32_t width);
+
 #include "NewDrawing.h"
 
 #endif
@@ -141,6 +141,9 @@ bool drawing_engine_has_dirty_optimisations()
 
 void drawing_engine_invalidate_image(uint32_t image)
 {
+    // The software renderer may hold a decoded copy regardless of the engine in use, e.g. for screenshots.
+    gfx_sprite_cache_invalidate(image);
+
     auto drawingEngine = GetDrawingEngine();
     if (drawingEngine != nullptr)
     {
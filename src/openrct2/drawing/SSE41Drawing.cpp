@@ -13,6 +13,7 @@
 
 #ifdef __SSE4_1__
 
+#    include <cstring>
 #    include <immintrin.h>
 
 void mask_sse4_1(
@@ -56,6 +57,106 @@ void mask_sse4_1(
     }
 }
 
+// Loads 16 pixels, sampling every (1 << zoomLevel)th source byte. Only zoom levels 1 and 2 are dispatched here,
+// a block at zoom level 3 would need more source pixels than a run can hold.
+static inline __m128i rle_load_strided_sse4_1(const uint8_t* src, int32_t zoomLevel)
+{
+    static_assert((RLE_RUN_BLOCK_SIZE << 2) <= RLE_RUN_MAX_LENGTH);
+    if (zoomLevel == 1)
+    {
+        const __m128i keep = _mm_set1_epi16(0xFF);
+        const __m128i a = _mm_and_si128(_mm_loadu_si128((const __m128i*)src), keep);
+        const __m128i b = _mm_and_si128(_mm_loadu_si128((const __m128i*)(src + 16)), keep);
+        return _mm_packus_epi16(a, b);
+    }
+
+    const __m128i keep = _mm_set1_epi32(0xFF);
+    const __m128i a = _mm_and_si128(_mm_loadu_si128((const __m128i*)src), keep);
+    const __m128i b = _mm_and_si128(_mm_loadu_si128((const __m128i*)(src + 16)), keep);
+    const __m128i c = _mm_and_si128(_mm_loadu_si128((const __m128i*)(src + 32)), keep);
+    const __m128i d = _mm_and_si128(_mm_loadu_si128((const __m128i*)(src + 48)), keep);
+    // _mm_packus_epi32 is SSE4.1
+    return _mm_packus_epi16(_mm_packus_epi32(a, b), _mm_packus_epi32(c, d));
+}
+
+void rle_run_sse4_1(
+    int32_t imageType, int32_t zoomLevel, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, const uint8_t* RESTRICT palette,
+    int32_t numPixels)
+{
+    // Palette lookups need 16 shuffles per vector which is slower than the scalar table lookup,
+    // only the strided copies of zoomed out opaque images are vectorised.
+    if (imageType == IMAGE_TYPE_DEFAULT && (zoomLevel == 1 || zoomLevel == 2))
+    {
+        const int32_t srcStep = RLE_RUN_BLOCK_SIZE << zoomLevel;
+        for (; numPixels >= srcStep; numPixels -= srcStep, src += srcStep, dst += RLE_RUN_BLOCK_SIZE)
+        {
+            _mm_storeu_si128((__m128i*)dst, rle_load_strided_sse4_1(src, zoomLevel));
+        }
+    }
+    rle_run_scalar(imageType, zoomLevel, src, dst, palette, numPixels);
+}
+
+// Without a gather instruction the colours are looked up one by one, the conversion after that is vectorised.
+static inline __m128i frame_gather_sse4_1(const uint8_t* src, int32_t step, const uint32_t* lut)
+{
+    return _mm_setr_epi32(lut[src[0]], lut[src[step]], lut[src[2 * step]], lut[src[3 * step]]);
+}
+
+void frame_convert_row_sse4_1(
+    FrameFormat format, const uint8_t* RESTRICT src, int32_t srcStep, const uint32_t* RESTRICT lut, void* RESTRICT dst,
+    size_t planeSize, int32_t width)
+{
+    constexpr int32_t blockSize = 4;
+    const int32_t srcBlockStep = blockSize * srcStep;
+    int32_t x = 0;
+    switch (format)
+    {
+        case FrameFormat::RGB:
+        {
+            const __m128i packRGB = _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+            auto rgb = static_cast<uint8_t*>(dst);
+            for (; x + blockSize <= width; x += blockSize, src += srcBlockStep, rgb += blockSize * 3)
+            {
+                const __m128i packed = _mm_shuffle_epi8(frame_gather_sse4_1(src, srcStep, lut), packRGB);
+                _mm_storel_epi64((__m128i*)rgb, packed);
+                const int32_t last = _mm_extract_epi32(packed, 2);
+                std::memcpy(rgb + 8, &last, sizeof(last));
+            }
+            dst = rgb;
+            break;
+        }
+        case FrameFormat::RGBA:
+        {
+            auto rgba = static_cast<uint8_t*>(dst);
+            for (; x + blockSize <= width; x += blockSize, src += srcBlockStep, rgba += blockSize * 4)
+            {
+                _mm_storeu_si128((__m128i*)rgba, frame_gather_sse4_1(src, srcStep, lut));
+            }
+            dst = rgba;
+            break;
+        }
+        case FrameFormat::PlanarFloat:
+        {
+            const __m128i byteMask = _mm_set1_epi32(0xFF);
+            const __m128 scale = _mm_set1_ps(1.0f / 255.0f);
+            auto red = static_cast<float*>(dst);
+            for (; x + blockSize <= width; x += blockSize, src += srcBlockStep, red += blockSize)
+            {
+                const __m128i colours = frame_gather_sse4_1(src, srcStep, lut);
+                const __m128i r = _mm_and_si128(colours, byteMask);
+                const __m128i g = _mm_and_si128(_mm_srli_epi32(colours, 8), byteMask);
+                const __m128i b = _mm_and_si128(_mm_srli_epi32(colours, 16), byteMask);
+                _mm_storeu_ps(red, _mm_mul_ps(_mm_cvtepi32_ps(r), scale));
+                _mm_storeu_ps(red + planeSize, _mm_mul_ps(_mm_cvtepi32_ps(g), scale));
+                _mm_storeu_ps(red + 2 * planeSize, _mm_mul_ps(_mm_cvtepi32_ps(b), scale));
+            }
+            dst = red;
+            break;
+        }
+    }
+    frame_convert_row_scalar(format, src, srcStep, lut, dst, planeSize, width - x);
+}
+
 #else
 
 #    ifdef OPENRCT2_X86
@@ -69,4 +170,18 @@ void mask_sse4_1(
     openrct2_assert(false, "SSE 4.1 function called on a CPU that doesn't support SSE 4.1");
 }
 
+void rle_run_sse4_1(
+    int32_t imageType, int32_t zoomLevel, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, const uint8_t* RESTRICT palette,
+    int32_t numPixels)
+{
+    openrct2_assert(false, "SSE 4.1 function called on a CPU that doesn't support SSE 4.1");
+}
+
+void frame_convert_row_sse4_1(
+    FrameFormat format, const uint8_t* RESTRICT src, int32_t srcStep, const uint32_t* RESTRICT lut, void* RESTRICT dst,
+    size_t planeSize, int32_t width)
+{
+    openrct2_assert(false, "SSE 4.1 function called on a CPU that doesn't support SSE 4.1");
+}
+
 #endif // __SSE4_1__
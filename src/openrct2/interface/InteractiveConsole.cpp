@@ -12,6 +12,7 @@
 #include "../Context.h"
 #include "../EditorObjectSelectionSession.h"
 #include "../Game.h"
+#include "../GameState.h"
 #include "../OpenRCT2.h"
 #include "../PlatformEnvironment.h"
 #include "../ReplayManager.h"
@@ -517,6 +518,62 @@ static int32_t cc_staff(InteractiveConsole& console, const arguments_t& argv)
     return 0;
 }
 
+static int32_t cc_guests(InteractiveConsole& console, const arguments_t& argv)
+{
+    if (argv.size() < 2 || (argv[0] != "spawn" && argv[0] != "despawn" && argv[0] != "set"))
+    {
+        console.WriteFormatLine("guests spawn <count>");
+        console.WriteFormatLine("guests despawn <count>");
+        console.WriteFormatLine("guests set <count>");
+        return 0;
+    }
+
+    bool valid = false;
+    int32_t count = console_parse_int(argv[1], &valid);
+    if (!valid || count < 0)
+    {
+        console.WriteLineError("Invalid guest count");
+        return 1;
+    }
+
+    // A client only sees the guests once the server has run the action, so the counts below could not be reported.
+    if (network_get_mode() != NETWORK_MODE_NONE)
+    {
+        console.WriteLineError("Guests can not be spawned or despawned in a network game");
+        return 1;
+    }
+
+    // Spawning and despawning are done by setting the guest count, the cheat is recorded in replays and trajectories.
+    auto guestsBefore = (int32_t)gNumGuestsInPark;
+    count = std::min<int32_t>(count, MAX_SPRITES);
+    int32_t target = count;
+    if (argv[0] == "spawn")
+    {
+        target = guestsBefore + count;
+    }
+    else if (argv[0] == "despawn")
+    {
+        target = std::max(guestsBefore - count, 0);
+    }
+    auto setGuestCountAction = SetCheatAction(CheatType::SetGuestCount, std::min<int32_t>(target, MAX_SPRITES));
+    GameActions::Execute(&setGuestCountAction);
+
+    auto guestsAfter = (int32_t)gNumGuestsInPark;
+    if (argv[0] == "spawn")
+    {
+        console.WriteFormatLine("Spawned %d guests", guestsAfter - guestsBefore);
+    }
+    else if (argv[0] == "despawn")
+    {
+        console.WriteFormatLine("Despawned %d guests", guestsBefore - guestsAfter);
+    }
+    else
+    {
+        console.WriteFormatLine("There are now %u guests in the park", gNumGuestsInPark);
+    }
+    return 0;
+}
+
 static int32_t cc_get(InteractiveConsole& console, const arguments_t& argv)
 {
     if (!argv.empty())
@@ -1398,7 +1455,7 @@ static int32_t cc_replay_startrecord(InteractiveConsole& console, const argument
 
     if (argv.size() < 1)
     {
-        console.WriteFormatLine("Parameters required <replay_name> [<max_ticks = 0xFFFFFFFF>]");
+        console.WriteFormatLine("Parameters required <replay_name> [<max_ticks = 0xFFFFFFFF>] [<keyframe_ticks = 4000>]");
         return 0;
     }
 
@@ -1419,8 +1476,15 @@ static int32_t cc_replay_startrecord(InteractiveConsole& console, const argument
         maxTicks = atol(argv[1].c_str());
     }
 
+    // Keyframes allow seeking during playback, 0 disables them.
+    uint32_t keyframeTicks = OpenRCT2::k_DefaultReplayKeyframeTicks;
+    if (argv.size() >= 3)
+    {
+        keyframeTicks = atol(argv[2].c_str());
+    }
+
     auto* replayManager = OpenRCT2::GetContext()->GetReplayManager();
-    if (replayManager->StartRecording(name, maxTicks))
+    if (replayManager->StartRecording(name, maxTicks, OpenRCT2::IReplayManager::RecordType::NORMAL, keyframeTicks))
     {
         OpenRCT2::ReplayRecordInfo info;
         replayManager->GetCurrentReplayInfo(info);
@@ -1458,11 +1522,15 @@ static int32_t cc_replay_stoprecord(InteractiveConsole& console, const arguments
         const char* logFmt = "Replay recording stopped: (%s) %s\n"
                              "  Ticks: %u\n"
                              "  Commands: %u\n"
-                             "  Checksums: %u";
+                             "  Checksums: %u\n"
+                             "  Keyframes: %u";
 
         console.WriteFormatLine(
-            logFmt, info.Name.c_str(), info.FilePath.c_str(), info.Ticks, info.NumCommands, info.NumChecksums);
-        log_info(logFmt, info.Name.c_str(), info.FilePath.c_str(), info.Ticks, info.NumCommands, info.NumChecksums);
+            logFmt, info.Name.c_str(), info.FilePath.c_str(), info.Ticks, info.NumCommands, info.NumChecksums,
+            info.NumKeyframes);
+        log_info(
+            logFmt, info.Name.c_str(), info.FilePath.c_str(), info.Ticks, info.NumCommands, info.NumChecksums,
+            info.NumKeyframes);
 
         return 1;
     }
@@ -1480,14 +1548,20 @@ static int32_t cc_replay_start(InteractiveConsole& console, const arguments_t& a
 
     if (argv.size() < 1)
     {
-        console.WriteFormatLine("Parameters required <replay_name>");
+        console.WriteFormatLine("Parameters required <replay_name> [<tick = 0>]");
         return 0;
     }
 
     std::string name = argv[0];
 
+    uint32_t replayTick = 0;
+    if (argv.size() >= 2)
+    {
+        replayTick = atol(argv[1].c_str());
+    }
+
     auto* replayManager = OpenRCT2::GetContext()->GetReplayManager();
-    if (replayManager->StartPlayback(name))
+    if (replayManager->StartPlayback(name, replayTick))
     {
         OpenRCT2::ReplayRecordInfo info;
         replayManager->GetCurrentReplayInfo(info);
@@ -1501,11 +1575,47 @@ static int32_t cc_replay_start(InteractiveConsole& console, const arguments_t& a
                              "  Date Recorded: %s\n"
                              "  Ticks: %u\n"
                              "  Commands: %u\n"
-                             "  Checksums: %u";
+                             "  Checksums: %u\n"
+                             "  Keyframes: %u";
+
+        console.WriteFormatLine(
+            logFmt, info.FilePath.c_str(), recordingDate, info.Ticks, info.NumCommands, info.NumChecksums,
+            info.NumKeyframes);
+        log_info(
+            logFmt, info.FilePath.c_str(), recordingDate, info.Ticks, info.NumCommands, info.NumChecksums,
+            info.NumKeyframes);
+
+        return 1;
+    }
+
+    return 0;
+}
+
+static int32_t cc_replay_seek(InteractiveConsole& console, const arguments_t& argv)
+{
+    if (network_get_mode() != NETWORK_MODE_NONE)
+    {
+        console.WriteFormatLine("This command is currently not supported in multiplayer mode.");
+        return 0;
+    }
 
-        console.WriteFormatLine(logFmt, info.FilePath.c_str(), recordingDate, info.Ticks, info.NumCommands, info.NumChecksums);
-        log_info(logFmt, info.FilePath.c_str(), recordingDate, info.Ticks, info.NumCommands, info.NumChecksums);
+    if (argv.size() < 1)
+    {
+        console.WriteFormatLine("Parameters required <tick>");
+        return 0;
+    }
 
+    auto* replayManager = OpenRCT2::GetContext()->GetReplayManager();
+    if (!replayManager->IsReplaying())
+    {
+        console.WriteFormatLine("Replay currently not playing");
+        return 0;
+    }
+
+    uint32_t replayTick = atol(argv[0].c_str());
+    if (replayManager->SeekPlayback(replayTick))
+    {
+        console.WriteFormatLine("Replay seeked to tick %u", replayTick);
         return 1;
     }
 
@@ -1756,6 +1866,7 @@ static constexpr const console_command console_command_table[] = {
     { "echo", cc_echo, "Echoes the text to the console.", "echo <text>" },
     { "exit", cc_close, "Closes the console.", "exit" },
     { "get", cc_get, "Gets the value of the specified variable.", "get <variable>" },
+    { "guests", cc_guests, "Spawns or despawns guests in the park.", "guests <spawn|despawn|set> <count>" },
     { "help", cc_help, "Lists commands or info about a command.", "help [command]" },
     { "hide", cc_hide, "Hides the console.", "hide" },
     { "load_object", cc_load_object, "Loads the object file into the scenario.\n"
@@ -1779,9 +1890,10 @@ static constexpr const console_command console_command_table[] = {
     { "twitch", cc_twitch, "Twitch API", "twitch" },
     { "variables", cc_variables, "Lists all the variables that can be used with get and sometimes set.", "variables" },
     { "windows", cc_windows, "Lists all the windows that can be opened.", "windows" },
-    { "replay_startrecord", cc_replay_startrecord, "Starts recording a new replay.", "replay_startrecord <name> [max_ticks]"},
+    { "replay_startrecord", cc_replay_startrecord, "Starts recording a new replay.", "replay_startrecord <name> [max_ticks] [keyframe_ticks]"},
     { "replay_stoprecord", cc_replay_stoprecord, "Stops recording a new replay.", "replay_stoprecord"},
-    { "replay_start", cc_replay_start, "Starts a replay", "replay_start <name>"},
+    { "replay_start", cc_replay_start, "Starts a replay", "replay_start <name> [tick]"},
+    { "replay_seek", cc_replay_seek, "Seeks the current replay to the given tick", "replay_seek <tick>"},
     { "replay_stop", cc_replay_stop, "Stops the replay", "replay_stop"},
     { "replay_normalise", cc_replay_normalise, "Normalises the replay to remove all gaps", "replay_normalise <input file> <output file>"},
     { "mp_desync", cc_mp_desync, "Forces a multiplayer desync", "cc_mp_desync [desync_type, 0 = Random t-shirt color on random peep, 1 = Remove random peep ]"},
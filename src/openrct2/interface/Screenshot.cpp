@@ -17,6 +17,7 @@
 #include "../audio/audio.h"
 #include "../core/Console.hpp"
 #include "../core/Imaging.h"
+#include "../core/JobPool.hpp"
 #include "../drawing/Drawing.h"
 #include "../drawing/X8DrawingEngine.h"
 #include "../localisation/Localisation.h"
@@ -28,9 +29,11 @@
 #include "../world/Surface.h"
 #include "Viewport.h"
 
+#include <array>
 #include <cctype>
 #include <chrono>
 #include <cstdlib>
+#include <exception>
 #include <memory>
 #include <optional>
 #include <string>
@@ -41,6 +44,9 @@ using namespace OpenRCT2::Drawing;
 
 uint8_t gScreenshotCountdown = 0;
 
+// Giant screenshots are rendered and encoded in strips of this many rows to bound their memory use.
+constexpr int32_t GIANT_SCREENSHOT_STRIP_HEIGHT = 256;
+
 static bool WriteDpiToFile(const std::string_view& path, const rct_drawpixelinfo* dpi, const rct_palette& palette)
 {
     auto const pixels8 = dpi->bits;
@@ -391,80 +397,154 @@ static void RenderViewport(IDrawingEngine* drawingEngine, const rct_viewport& vi
     viewport_render(&dpi, &viewport, 0, 0, viewport.width, viewport.height);
 }
 
-Image get_observation() 
+/**
+ * Renders the viewport in horizontal strips and streams them into a PNG. The next strip is painted while the
+ * previous one is being compressed, so only two strips of the image are ever held in memory.
+ */
+static void RenderViewportToPng(const std::string_view& path, const rct_viewport& viewport)
 {
-    rct_drawpixelinfo dpi{};
-    try
+    auto renderedPalette = screenshot_get_rendered_palette();
+    Imaging::PngStreamWriter writer(path, viewport.width, viewport.height, 8, &renderedPalette);
+
+    // Ensure sprites appear regardless of rotation
+    reset_all_sprite_quadrant_placements();
+    X8DrawingEngine drawingEngine(GetContext()->GetUiContext());
+
+    const int32_t stripHeight = std::min<int32_t>(viewport.height, GIANT_SCREENSHOT_STRIP_HEIGHT);
+    const size_t stripSize = static_cast<size_t>(viewport.width) * stripHeight;
+    std::array<std::vector<uint8_t>, 2> strips;
+    for (auto& strip : strips)
     {
-        auto path = screenshot_get_next_path();
-        if (path == std::nullopt)
-        {
-            throw std::runtime_error("Giant screenshot failed, unable to find a suitable destination path.");
-        }
+        strip.resize(stripSize);
+    }
 
-        int32_t rotation = get_current_rotation();
-        ZoomLevel zoom = 0;
+    JobPool encodeJobs;
+    std::exception_ptr encodeException;
+    for (int32_t y = 0, stripIndex = 0; y < viewport.height; y += stripHeight, stripIndex++)
+    {
+        const int32_t rows = std::min<int32_t>(stripHeight, viewport.height - y);
+        auto& strip = strips[stripIndex % strips.size()];
 
-        auto mainWindow = window_get_main();
-        auto vp = window_get_viewport(mainWindow);
-        if (mainWindow != nullptr && vp != nullptr)
-        {
-            zoom = vp->zoom;
-        }
+        rct_viewport stripViewport = viewport;
+        stripViewport.viewPos.y += y * viewport.zoom;
+        stripViewport.height = rows;
+        stripViewport.view_height = rows * viewport.zoom;
 
-        auto viewport = *vp;
-      //auto viewport = GetGiantViewport(gMapSize, rotation, zoom);
-        if (vp != nullptr)
+        rct_drawpixelinfo dpi{};
+        dpi.bits = strip.data();
+        dpi.width = viewport.width;
+        dpi.height = rows;
+        dpi.DrawingEngine = &drawingEngine;
+        if (viewport.flags & VIEWPORT_FLAG_TRANSPARENT_BACKGROUND)
         {
-            viewport.flags = vp->flags;
+            std::memset(strip.data(), PALETTE_INDEX_0, stripSize);
         }
-        if (gConfigGeneral.transparent_screenshot)
+        viewport_render(&dpi, &stripViewport, 0, 0, stripViewport.width, stripViewport.height);
+
+        // Rows have to be written in order, wait for the previous strip which also frees its buffer for the next one.
+        encodeJobs.Join();
+        if (encodeException != nullptr)
         {
-            viewport.flags |= VIEWPORT_FLAG_TRANSPARENT_BACKGROUND;
+            std::rethrow_exception(encodeException);
         }
+        encodeJobs.AddTask([&writer, &strip, &encodeException, rows, width = viewport.width]() {
+            try
+            {
+                writer.WriteRows(strip.data(), rows, width);
+            }
+            catch (...)
+            {
+                encodeException = std::current_exception();
+            }
+        });
+    }
+
+    encodeJobs.Join();
+    if (encodeException != nullptr)
+    {
+        std::rethrow_exception(encodeException);
+    }
+    writer.Finish();
+}
+
+/**
+ * Renders the main viewport and converts it to true colour in the given format.
+ * @param downsample Only every downsample'th pixel of every downsample'th row is kept.
+ */
+template<typename T>
+static std::vector<T> CaptureMainViewport(FrameFormat format, int32_t downsample, int32_t& width, int32_t& height)
+{
+    auto vp = window_get_viewport(window_get_main());
+    if (vp == nullptr)
+    {
+        throw std::runtime_error("Unable to capture frame, there is no main viewport.");
+    }
 
-        dpi = CreateDPI(viewport);
+    auto viewport = *vp;
+    if (gConfigGeneral.transparent_screenshot)
+    {
+        viewport.flags |= VIEWPORT_FLAG_TRANSPARENT_BACKGROUND;
+    }
 
+    rct_drawpixelinfo dpi = CreateDPI(viewport);
+    std::vector<T> frame;
+    try
+    {
         RenderViewport(nullptr, viewport, dpi);
+
         auto renderedPalette = screenshot_get_rendered_palette();
-        auto const pixels8 = dpi.bits;
-        auto const pixelsLen = (dpi.width + dpi.pitch) * dpi.height;
-        Image image;
-        try
-        {
-            image.Width = dpi.width;
-            image.Height = dpi.height;
-            image.Depth = 8;
-            image.Stride = dpi.width + dpi.pitch;
-            image.Palette = std::make_unique<rct_palette>(renderedPalette);
-            image.Pixels = std::vector<uint8_t>(pixels8, pixels8 + pixelsLen);
-          //Imaging::WriteToFile(path, image, IMAGE_FORMAT::PNG);
-        }
-        catch (const std::exception& e)
-        {
-            log_error("Unable to take observation: %s", e.what());
-        }
+        frame.resize(gfx_frame_get_size(dpi.width, dpi.height, format, downsample) / sizeof(T));
+        gfx_frame_convert(&dpi, &renderedPalette, format, downsample, frame.data());
+    }
+    catch (const std::exception&)
+    {
+        ReleaseDPI(dpi);
+        throw;
+    }
 
-        return image;
+    width = (dpi.width + downsample - 1) / downsample;
+    height = (dpi.height + downsample - 1) / downsample;
+    ReleaseDPI(dpi);
+    return frame;
+}
 
-      //// Show user that screenshot saved successfully
-      //set_format_arg(0, rct_string_id, STR_STRING);
-      //set_format_arg(2, char*, path_get_filename(path->c_str()));
-      //context_show_error(STR_SCREENSHOT_SAVED_AS, STR_NONE);
+Image get_observation(int32_t downsample)
+{
+    Image image;
+    try
+    {
+        int32_t width, height;
+        image.Pixels = CaptureMainViewport<uint8_t>(FrameFormat::RGBA, downsample, width, height);
+        image.Width = width;
+        image.Height = height;
+        image.Depth = 32;
+        image.Stride = width * 4;
     }
     catch (const std::exception& e)
     {
-        log_error("%s", e.what());
-        context_show_error(STR_SCREENSHOT_FAILED, STR_NONE);
+        log_error("Unable to take observation: %s", e.what());
     }
+    return image;
+}
 
-    ReleaseDPI(dpi);
-
+std::vector<float> get_observation_chw(int32_t downsample, int32_t& width, int32_t& height)
+{
+    std::vector<float> planes;
+    try
+    {
+        planes = CaptureMainViewport<float>(FrameFormat::PlanarFloat, downsample, width, height);
+    }
+    catch (const std::exception& e)
+    {
+        log_error("Unable to take observation: %s", e.what());
+        width = 0;
+        height = 0;
+    }
+    return planes;
 }
 
 void screenshot_giant()
 {
-    rct_drawpixelinfo dpi{};
     try
     {
         auto path = screenshot_get_next_path();
@@ -493,11 +573,7 @@ void screenshot_giant()
             viewport.flags |= VIEWPORT_FLAG_TRANSPARENT_BACKGROUND;
         }
 
-        dpi = CreateDPI(viewport);
-
-        RenderViewport(nullptr, viewport, dpi);
-        auto renderedPalette = screenshot_get_rendered_palette();
-        WriteDpiToFile(path->c_str(), &dpi, renderedPalette);
+        RenderViewportToPng(*path, viewport);
 
         // Show user that screenshot saved successfully
         set_format_arg(0, rct_string_id, STR_STRING);
@@ -509,8 +585,6 @@ void screenshot_giant()
         log_error("%s", e.what());
         context_show_error(STR_SCREENSHOT_FAILED, STR_NONE);
     }
-
-    ReleaseDPI(dpi);
 }
 
 // TODO: Move this at some point into a more appropriate place.
@@ -709,7 +783,7 @@ int32_t cmdline_for_screenshot(const char** argv, int32_t argc, ScreenshotOption
     }
 
     int32_t exitCode = 1;
-    rct_drawpixelinfo dpi;
+    rct_drawpixelinfo dpi{};
     try
     {
         core_init();
@@ -811,11 +885,18 @@ int32_t cmdline_for_screenshot(const char** argv, int32_t argc, ScreenshotOption
 
         ApplyOptions(options, viewport);
 
-        dpi = CreateDPI(viewport);
+        if (giantScreenshot)
+        {
+            RenderViewportToPng(outputPath, viewport);
+        }
+        else
+        {
+            dpi = CreateDPI(viewport);
 
-        RenderViewport(nullptr, viewport, dpi);
-        auto renderedPalette = screenshot_get_rendered_palette();
-        WriteDpiToFile(outputPath, &dpi, renderedPalette);
+            RenderViewport(nullptr, viewport, dpi);
+            auto renderedPalette = screenshot_get_rendered_palette();
+            WriteDpiToFile(outputPath, &dpi, renderedPalette);
+        }
     }
     catch (const std::exception& e)
     {
@@ -12,6 +12,7 @@
 #include "../common.h"
 
 #include <string>
+#include <vector>
 #include "Viewport.h"
 #include "../core/Imaging.h"
 #include "../drawing/IDrawingEngine.h"
@@ -41,7 +42,10 @@ std::string screenshot_dump();
 std::string screenshot_dump_png(rct_drawpixelinfo* dpi);
 std::string screenshot_dump_png_32bpp(int32_t width, int32_t height, const void* pixels);
 
-Image get_observation();
+// Captures the main viewport as 32-bit RGBA.
+Image get_observation(int32_t downsample = 1);
+// Captures the main viewport as separate red, green and blue planes of floats between 0 and 1.
+std::vector<float> get_observation_chw(int32_t downsample, int32_t& width, int32_t& height);
 
 void screenshot_giant();
 int32_t cmdline_for_screenshot(const char** argv, int32_t argc, ScreenshotOptions* options);
@@ -16,9 +16,11 @@
 #include "../ride/Ride.h"
 #include "../scenario/Scenario.h"
 #include "../world/Park.h"
+#include "../world/ParkStatistics.h"
 #include "NewsItem.h"
 
 #include <algorithm>
+#include <initializer_list>
 
 constexpr uint8_t NEGATIVE = 0;
 constexpr uint8_t POSITIVE = 1;
@@ -72,12 +74,27 @@ bool award_is_positive(int32_t type)
 
 #pragma region Award checks
 
+/** Number of guests in the park whose latest thought is fresh and of one of the types. */
+static uint32_t award_count_fresh_thoughts(std::initializer_list<PeepThoughtType> thoughtTypes)
+{
+    const auto& guestCounts = ParkStatistics::GetGuestCounts();
+    uint32_t count = 0;
+    for (auto thoughtType : thoughtTypes)
+    {
+        count += guestCounts.FreshThoughts[thoughtType];
+    }
+    return count;
+}
+
+static uint32_t award_count_untidy_thoughts()
+{
+    return award_count_fresh_thoughts(
+        { PEEP_THOUGHT_TYPE_BAD_LITTER, PEEP_THOUGHT_TYPE_PATH_DISGUSTING, PEEP_THOUGHT_TYPE_VANDALISM });
+}
+
 /** More than 1/16 of the total guests must be thinking untidy thoughts. */
 static bool award_is_deserved_most_untidy(int32_t activeAwardTypes)
 {
-    uint16_t spriteIndex;
-    Peep* peep;
-
     if (activeAwardTypes & (1 << PARK_AWARD_MOST_BEAUTIFUL))
         return false;
     if (activeAwardTypes & (1 << PARK_AWARD_BEST_STAFF))
@@ -85,58 +102,20 @@ static bool award_is_deserved_most_untidy(int32_t activeAwardTypes)
     if (activeAwardTypes & (1 << PARK_AWARD_MOST_TIDY))
         return false;
 
-    uint32_t negativeCount = 0;
-    FOR_ALL_GUESTS (spriteIndex, peep)
-    {
-        if (peep->outside_of_park != 0)
-            continue;
-
-        if (peep->thoughts[0].freshness > 5)
-            continue;
-
-        if (peep->thoughts[0].type == PEEP_THOUGHT_TYPE_BAD_LITTER
-            || peep->thoughts[0].type == PEEP_THOUGHT_TYPE_PATH_DISGUSTING
-            || peep->thoughts[0].type == PEEP_THOUGHT_TYPE_VANDALISM)
-        {
-            negativeCount++;
-        }
-    }
-
+    uint32_t negativeCount = award_count_untidy_thoughts();
     return (negativeCount > gNumGuestsInPark / 16);
 }
 
 /** More than 1/64 of the total guests must be thinking tidy thoughts and less than 6 guests thinking untidy thoughts. */
 static bool award_is_deserved_most_tidy(int32_t activeAwardTypes)
 {
-    uint16_t spriteIndex;
-    Peep* peep;
-
     if (activeAwardTypes & (1 << PARK_AWARD_MOST_UNTIDY))
         return false;
     if (activeAwardTypes & (1 << PARK_AWARD_MOST_DISAPPOINTING))
         return false;
 
-    uint32_t positiveCount = 0;
-    uint32_t negativeCount = 0;
-    FOR_ALL_GUESTS (spriteIndex, peep)
-    {
-        if (peep->outside_of_park != 0)
-            continue;
-
-        if (peep->thoughts[0].freshness > 5)
-            continue;
-
-        if (peep->thoughts[0].type == PEEP_THOUGHT_TYPE_VERY_CLEAN)
-            positiveCount++;
-
-        if (peep->thoughts[0].type == PEEP_THOUGHT_TYPE_BAD_LITTER
-            || peep->thoughts[0].type == PEEP_THOUGHT_TYPE_PATH_DISGUSTING
-            || peep->thoughts[0].type == PEEP_THOUGHT_TYPE_VANDALISM)
-        {
-            negativeCount++;
-        }
-    }
-
+    uint32_t positiveCount = award_count_fresh_thoughts({ PEEP_THOUGHT_TYPE_VERY_CLEAN });
+    uint32_t negativeCount = award_count_untidy_thoughts();
     return (negativeCount <= 5 && positiveCount > gNumGuestsInPark / 64);
 }
 
@@ -191,35 +170,13 @@ static bool award_is_deserved_best_value(int32_t activeAwardTypes)
 /** More than 1/128 of the total guests must be thinking scenic thoughts and fewer than 16 untidy thoughts. */
 static bool award_is_deserved_most_beautiful(int32_t activeAwardTypes)
 {
-    uint16_t spriteIndex;
-    Peep* peep;
-
     if (activeAwardTypes & (1 << PARK_AWARD_MOST_UNTIDY))
         return false;
     if (activeAwardTypes & (1 << PARK_AWARD_MOST_DISAPPOINTING))
         return false;
 
-    uint32_t positiveCount = 0;
-    uint32_t negativeCount = 0;
-    FOR_ALL_GUESTS (spriteIndex, peep)
-    {
-        if (peep->outside_of_park != 0)
-            continue;
-
-        if (peep->thoughts[0].freshness > 5)
-            continue;
-
-        if (peep->thoughts[0].type == PEEP_THOUGHT_TYPE_SCENERY)
-            positiveCount++;
-
-        if (peep->thoughts[0].type == PEEP_THOUGHT_TYPE_BAD_LITTER
-            || peep->thoughts[0].type == PEEP_THOUGHT_TYPE_PATH_DISGUSTING
-            || peep->thoughts[0].type == PEEP_THOUGHT_TYPE_VANDALISM)
-        {
-            negativeCount++;
-        }
-    }
-
+    uint32_t positiveCount = award_count_fresh_thoughts({ PEEP_THOUGHT_TYPE_SCENERY });
+    uint32_t negativeCount = award_count_untidy_thoughts();
     return (negativeCount <= 15 && positiveCount > gNumGuestsInPark / 128);
 }
 
@@ -242,18 +199,7 @@ static bool award_is_deserved_worst_value(int32_t activeAwardTypes)
 /** No more than 2 people who think the vandalism is bad and no crashes. */
 static bool award_is_deserved_safest([[maybe_unused]] int32_t activeAwardTypes)
 {
-    uint16_t spriteIndex;
-    Peep* peep;
-
-    auto peepsWhoDislikeVandalism = 0;
-    FOR_ALL_GUESTS (spriteIndex, peep)
-    {
-        if (peep->outside_of_park != 0)
-            continue;
-        if (peep->thoughts[0].freshness <= 5 && peep->thoughts[0].type == PEEP_THOUGHT_TYPE_VANDALISM)
-            peepsWhoDislikeVandalism++;
-    }
-
+    auto peepsWhoDislikeVandalism = award_count_fresh_thoughts({ PEEP_THOUGHT_TYPE_VANDALISM });
     if (peepsWhoDislikeVandalism > 2)
         return false;
 
@@ -331,17 +277,7 @@ static bool award_is_deserved_best_food(int32_t activeAwardTypes)
         return false;
 
     // Count hungry peeps
-    auto hungryPeeps = 0;
-    uint16_t spriteIndex;
-    Peep* peep;
-    FOR_ALL_GUESTS (spriteIndex, peep)
-    {
-        if (peep->outside_of_park != 0)
-            continue;
-
-        if (peep->thoughts[0].freshness <= 5 && peep->thoughts[0].type == PEEP_THOUGHT_TYPE_HUNGRY)
-            hungryPeeps++;
-    }
+    auto hungryPeeps = award_count_fresh_thoughts({ PEEP_THOUGHT_TYPE_HUNGRY });
     return (hungryPeeps <= 12);
 }
 
@@ -377,17 +313,7 @@ static bool award_is_deserved_worst_food(int32_t activeAwardTypes)
         return false;
 
     // Count hungry peeps
-    auto hungryPeeps = 0;
-    uint16_t spriteIndex;
-    Peep* peep;
-    FOR_ALL_GUESTS (spriteIndex, peep)
-    {
-        if (peep->outside_of_park != 0)
-            continue;
-
-        if (peep->thoughts[0].freshness <= 5 && peep->thoughts[0].type == PEEP_THOUGHT_TYPE_HUNGRY)
-            hungryPeeps++;
-    }
+    auto hungryPeeps = award_count_fresh_thoughts({ PEEP_THOUGHT_TYPE_HUNGRY });
     return (hungryPeeps > 15);
 }
 
@@ -409,17 +335,7 @@ static bool award_is_deserved_best_restrooms([[maybe_unused]] int32_t activeAwar
         return false;
 
     // Count number of guests who are thinking they need the restroom
-    auto guestsWhoNeedRestroom = 0;
-    uint16_t spriteIndex;
-    Peep* peep;
-    FOR_ALL_GUESTS (spriteIndex, peep)
-    {
-        if (peep->outside_of_park != 0)
-            continue;
-
-        if (peep->thoughts[0].freshness <= 5 && peep->thoughts[0].type == PEEP_THOUGHT_TYPE_BATHROOM)
-            guestsWhoNeedRestroom++;
-    }
+    auto guestsWhoNeedRestroom = award_count_fresh_thoughts({ PEEP_THOUGHT_TYPE_BATHROOM });
     return (guestsWhoNeedRestroom <= 16);
 }
 
@@ -537,23 +453,8 @@ static bool award_is_deserved_most_dazzling_ride_colours(int32_t activeAwardType
 /** At least 10 peeps and more than 1/64 of total guests are lost or can't find something. */
 static bool award_is_deserved_most_confusing_layout([[maybe_unused]] int32_t activeAwardTypes)
 {
-    uint32_t peepsCounted, peepsLost;
-    uint16_t spriteIndex;
-    Peep* peep;
-
-    peepsCounted = 0;
-    peepsLost = 0;
-    FOR_ALL_GUESTS (spriteIndex, peep)
-    {
-        if (peep->outside_of_park != 0)
-            continue;
-
-        peepsCounted++;
-        if (peep->thoughts[0].freshness <= 5
-            && (peep->thoughts[0].type == PEEP_THOUGHT_TYPE_LOST || peep->thoughts[0].type == PEEP_THOUGHT_TYPE_CANT_FIND))
-            peepsLost++;
-    }
-
+    uint32_t peepsCounted = ParkStatistics::GetGuestCounts().InPark;
+    uint32_t peepsLost = award_count_fresh_thoughts({ PEEP_THOUGHT_TYPE_LOST, PEEP_THOUGHT_TYPE_CANT_FIND });
     return (peepsLost >= 10 && peepsLost >= peepsCounted / 64);
 }
 
@@ -609,6 +510,9 @@ static constexpr const award_deserved_check _awardChecks[] = {
 
 static bool award_is_deserved(int32_t awardType, int32_t activeAwardTypes)
 {
+#if defined(DEBUG_LEVEL_1) && DEBUG_LEVEL_1
+    ParkStatistics::Verify();
+#endif // defined(DEBUG_LEVEL_1) && DEBUG_LEVEL_1
     return _awardChecks[awardType](activeAwardTypes);
 }
 
@@ -0,0 +1,345 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "MapResync.h"
+
+#include "../ParkSnapshot.h"
+#include "../core/IStream.hpp"
+#include "../core/MemoryStream.h"
+#include "../scenario/Scenario.h"
+#include "../world/Map.h"
+
+#include <algorithm>
+#include <cstring>
+#include <unordered_map>
+
+using namespace MapResync;
+
+constexpr int32_t MAP_TILE_COUNT = MAXIMUM_MAP_SIZE_TECHNICAL * MAXIMUM_MAP_SIZE_TECHNICAL;
+constexpr int32_t TILE_REGIONS_PER_ROW = MAXIMUM_MAP_SIZE_TECHNICAL / TILE_REGION_SIZE;
+constexpr size_t TILE_REGION_COUNT = TILE_REGIONS_PER_ROW * TILE_REGIONS_PER_ROW;
+constexpr size_t SPRITE_BLOCK_COUNT = (RCT2_MAX_SPRITES + SPRITE_BLOCK_SIZE - 1) / SPRITE_BLOCK_SIZE;
+
+// Upper bound for the number of hashes in a list, anything larger can only come from a malformed packet.
+constexpr uint32_t MAX_HASH_COUNT = 0x10000;
+
+struct DataBlock
+{
+    size_t Offset;
+    size_t Length;
+};
+
+/**
+ * Splits everything apart from the objects, map, sprites and rides into blocks.
+ */
+static std::vector<DataBlock> GetDataBlocks(const rct_s6_data& s6)
+{
+    auto base = reinterpret_cast<const uint8_t*>(&s6);
+    auto offsetOf = [base](const void* field) { return static_cast<size_t>(static_cast<const uint8_t*>(field) - base); };
+
+    const std::pair<size_t, size_t> ranges[] = {
+        { 0, offsetOf(&s6.objects) },
+        { offsetOf(&s6.elapsed_months), offsetOf(&s6.tile_elements) },
+        { offsetOf(&s6.next_free_tile_element_pointer_index), offsetOf(&s6.sprites) },
+        { offsetOf(&s6.sprite_lists_head), offsetOf(&s6.rides) },
+        { offsetOf(&s6.rides) + sizeof(s6.rides), sizeof(rct_s6_data) },
+    };
+
+    std::vector<DataBlock> blocks;
+    for (const auto& range : ranges)
+    {
+        for (size_t offset = range.first; offset < range.second; offset += DATA_BLOCK_SIZE)
+        {
+            blocks.push_back({ offset, std::min(DATA_BLOCK_SIZE, range.second - offset) });
+        }
+    }
+    return blocks;
+}
+
+static size_t GetSpriteBlockCount(size_t block)
+{
+    return std::min(SPRITE_BLOCK_SIZE, RCT2_MAX_SPRITES - block * SPRITE_BLOCK_SIZE);
+}
+
+/**
+ * Returns the index of the first element of every tile, followed by the number of elements in use.
+ */
+static std::vector<uint32_t> GetTileOffsets(const rct_s6_data& s6)
+{
+    std::vector<uint32_t> offsets;
+    offsets.reserve(MAP_TILE_COUNT + 1);
+    uint32_t index = 0;
+    for (int32_t tile = 0; tile < MAP_TILE_COUNT; tile++)
+    {
+        offsets.push_back(index);
+        do
+        {
+            if (index >= RCT2_MAX_TILE_ELEMENTS)
+            {
+                throw IOException("Tile elements are not terminated.");
+            }
+        } while (!s6.tile_elements[index++].IsLastForTile());
+    }
+    offsets.push_back(index);
+    return offsets;
+}
+
+/**
+ * The elements of a row of tiles within a region are contiguous, so a region is a list of spans.
+ */
+static std::pair<uint32_t, uint32_t> GetTileRegionRow(const std::vector<uint32_t>& tileOffsets, size_t region, int32_t row)
+{
+    int32_t x = static_cast<int32_t>(region % TILE_REGIONS_PER_ROW) * TILE_REGION_SIZE;
+    int32_t y = static_cast<int32_t>(region / TILE_REGIONS_PER_ROW) * TILE_REGION_SIZE + row;
+    int32_t tile = y * MAXIMUM_MAP_SIZE_TECHNICAL + x;
+    return { tileOffsets[tile], tileOffsets[tile + TILE_REGION_SIZE] };
+}
+
+static uint64_t GetTileRegionHash(const rct_s6_data& s6, const std::vector<uint32_t>& tileOffsets, size_t region)
+{
+    uint64_t hash = 0;
+    for (int32_t row = 0; row < TILE_REGION_SIZE; row++)
+    {
+        auto span = GetTileRegionRow(tileOffsets, region, row);
+        auto rowHash = ParkSnapshot::Checksum(
+            &s6.tile_elements[span.first], (span.second - span.first) * sizeof(RCT12TileElement));
+        hash = (hash ^ rowHash) * 0x9E3779B97F4A7C15ULL;
+    }
+    return hash;
+}
+
+static void WriteHashList(IStream* stream, const std::vector<uint64_t>& hashes)
+{
+    stream->WriteValue<uint32_t>(static_cast<uint32_t>(hashes.size()));
+    stream->Write(hashes.data(), hashes.size() * sizeof(uint64_t));
+}
+
+static std::vector<uint64_t> ReadHashList(IStream* stream)
+{
+    auto count = stream->ReadValue<uint32_t>();
+    if (count > MAX_HASH_COUNT)
+    {
+        throw IOException("Too many region hashes.");
+    }
+    std::vector<uint64_t> hashes(count);
+    stream->Read(hashes.data(), hashes.size() * sizeof(uint64_t));
+    return hashes;
+}
+
+/**
+ * Writes the indices and contents of the regions whose hashes differ, preceded by their count.
+ */
+template<typename TWriteRegion>
+static void WriteChangedRegions(
+    IStream* stream, const std::vector<uint64_t>& local, const std::vector<uint64_t>& remote, TWriteRegion writeRegion)
+{
+    std::vector<uint32_t> changed;
+    for (size_t i = 0; i < local.size(); i++)
+    {
+        if (local[i] != remote[i])
+        {
+            changed.push_back(static_cast<uint32_t>(i));
+        }
+    }
+
+    stream->WriteValue<uint32_t>(static_cast<uint32_t>(changed.size()));
+    for (auto index : changed)
+    {
+        stream->WriteValue<uint32_t>(index);
+        writeRegion(index);
+    }
+}
+
+template<typename TReadRegion> static void ReadChangedRegions(IStream* stream, size_t regionCount, TReadRegion readRegion)
+{
+    auto count = stream->ReadValue<uint32_t>();
+    for (uint32_t i = 0; i < count; i++)
+    {
+        auto index = stream->ReadValue<uint32_t>();
+        if (index >= regionCount)
+        {
+            throw IOException("Invalid region in map delta.");
+        }
+        readRegion(index);
+    }
+}
+
+namespace MapResync
+{
+    RegionHashes ComputeHashes(const rct_s6_data& s6)
+    {
+        RegionHashes hashes;
+        hashes.Objects = ParkSnapshot::Checksum(s6.objects, sizeof(s6.objects));
+
+        auto base = reinterpret_cast<const uint8_t*>(&s6);
+        for (const auto& block : GetDataBlocks(s6))
+        {
+            hashes.Data.push_back(ParkSnapshot::Checksum(base + block.Offset, block.Length));
+        }
+
+        auto tileOffsets = GetTileOffsets(s6);
+        for (size_t region = 0; region < TILE_REGION_COUNT; region++)
+        {
+            hashes.Tiles.push_back(GetTileRegionHash(s6, tileOffsets, region));
+        }
+
+        for (size_t block = 0; block < SPRITE_BLOCK_COUNT; block++)
+        {
+            hashes.Sprites.push_back(ParkSnapshot::Checksum(
+                &s6.sprites[block * SPRITE_BLOCK_SIZE], GetSpriteBlockCount(block) * sizeof(RCT2Sprite)));
+        }
+
+        for (const auto& ride : s6.rides)
+        {
+            hashes.Rides.push_back(ParkSnapshot::Checksum(&ride, sizeof(ride)));
+        }
+        return hashes;
+    }
+
+    void WriteHashes(IStream* stream, const RegionHashes& hashes)
+    {
+        stream->WriteValue<uint64_t>(hashes.Objects);
+        WriteHashList(stream, hashes.Data);
+        WriteHashList(stream, hashes.Tiles);
+        WriteHashList(stream, hashes.Sprites);
+        WriteHashList(stream, hashes.Rides);
+    }
+
+    RegionHashes ReadHashes(IStream* stream)
+    {
+        RegionHashes hashes;
+        hashes.Objects = stream->ReadValue<uint64_t>();
+        hashes.Data = ReadHashList(stream);
+        hashes.Tiles = ReadHashList(stream);
+        hashes.Sprites = ReadHashList(stream);
+        hashes.Rides = ReadHashList(stream);
+        return hashes;
+    }
+
+    bool WriteDelta(IStream* stream, const rct_s6_data& s6, const RegionHashes& remoteHashes)
+    {
+        auto localHashes = ComputeHashes(s6);
+        if (localHashes.Objects != remoteHashes.Objects || localHashes.Data.size() != remoteHashes.Data.size()
+            || localHashes.Tiles.size() != remoteHashes.Tiles.size()
+            || localHashes.Sprites.size() != remoteHashes.Sprites.size()
+            || localHashes.Rides.size() != remoteHashes.Rides.size())
+        {
+            return false;
+        }
+
+        MemoryStream delta;
+        auto base = reinterpret_cast<const uint8_t*>(&s6);
+        auto dataBlocks = GetDataBlocks(s6);
+        WriteChangedRegions(&delta, localHashes.Data, remoteHashes.Data, [&](uint32_t index) {
+            delta.Write(base + dataBlocks[index].Offset, dataBlocks[index].Length);
+        });
+
+        auto tileOffsets = GetTileOffsets(s6);
+        WriteChangedRegions(&delta, localHashes.Tiles, remoteHashes.Tiles, [&](uint32_t index) {
+            for (int32_t row = 0; row < TILE_REGION_SIZE; row++)
+            {
+                auto span = GetTileRegionRow(tileOffsets, index, row);
+                delta.WriteValue<uint32_t>(span.second - span.first);
+                delta.Write(&s6.tile_elements[span.first], (span.second - span.first) * sizeof(RCT12TileElement));
+            }
+        });
+
+        WriteChangedRegions(&delta, localHashes.Sprites, remoteHashes.Sprites, [&](uint32_t index) {
+            delta.Write(&s6.sprites[index * SPRITE_BLOCK_SIZE], GetSpriteBlockCount(index) * sizeof(RCT2Sprite));
+        });
+
+        WriteChangedRegions(&delta, localHashes.Rides, remoteHashes.Rides, [&](uint32_t index) {
+            delta.Write(&s6.rides[index], sizeof(rct2_ride));
+        });
+
+        // Past this point the full map compresses better than the delta.
+        if (delta.GetLength() > sizeof(rct_s6_data) / 2)
+        {
+            return false;
+        }
+        stream->Write(delta.GetData(), delta.GetLength());
+        return true;
+    }
+
+    void ApplyDelta(IStream* stream, rct_s6_data& s6)
+    {
+        // Read everything before modifying the data, the tile offsets refer to the elements the client hashed.
+        auto base = reinterpret_cast<uint8_t*>(&s6);
+        auto dataBlocks = GetDataBlocks(s6);
+        ReadChangedRegions(stream, dataBlocks.size(), [&](uint32_t index) {
+            stream->Read(base + dataBlocks[index].Offset, dataBlocks[index].Length);
+        });
+
+        std::unordered_map<uint32_t, std::vector<std::vector<RCT12TileElement>>> tileRegions;
+        ReadChangedRegions(stream, TILE_REGION_COUNT, [&](uint32_t index) {
+            auto& rows = tileRegions[index];
+            rows.resize(TILE_REGION_SIZE);
+            for (auto& row : rows)
+            {
+                auto count = stream->ReadValue<uint32_t>();
+                if (count < static_cast<uint32_t>(TILE_REGION_SIZE) || count > RCT2_MAX_TILE_ELEMENTS)
+                {
+                    throw IOException("Invalid tile region in map delta.");
+                }
+                row.resize(count);
+                stream->Read(row.data(), count * sizeof(RCT12TileElement));
+
+                auto numTiles = std::count_if(
+                    row.begin(), row.end(), [](const RCT12TileElement& element) { return element.IsLastForTile(); });
+                if (numTiles != TILE_REGION_SIZE || !row.back().IsLastForTile())
+                {
+                    throw IOException("Invalid tile region in map delta.");
+                }
+            }
+        });
+
+        ReadChangedRegions(stream, SPRITE_BLOCK_COUNT, [&](uint32_t index) {
+            stream->Read(&s6.sprites[index * SPRITE_BLOCK_SIZE], GetSpriteBlockCount(index) * sizeof(RCT2Sprite));
+        });
+
+        ReadChangedRegions(
+            stream, RCT12_MAX_RIDES_IN_PARK, [&](uint32_t index) { stream->Read(&s6.rides[index], sizeof(rct2_ride)); });
+
+        if (tileRegions.empty())
+        {
+            return;
+        }
+
+        // Rebuild the element list row by row, taking each region's part of the row from the delta if it changed.
+        auto tileOffsets = GetTileOffsets(s6);
+        std::vector<RCT12TileElement> elements;
+        elements.reserve(RCT2_MAX_TILE_ELEMENTS);
+        for (int32_t y = 0; y < MAXIMUM_MAP_SIZE_TECHNICAL; y++)
+        {
+            for (int32_t regionX = 0; regionX < TILE_REGIONS_PER_ROW; regionX++)
+            {
+                auto region = static_cast<uint32_t>((y / TILE_REGION_SIZE) * TILE_REGIONS_PER_ROW + regionX);
+                auto row = y % TILE_REGION_SIZE;
+                auto it = tileRegions.find(region);
+                if (it != tileRegions.end())
+                {
+                    elements.insert(elements.end(), it->second[row].begin(), it->second[row].end());
+                }
+                else
+                {
+                    auto span = GetTileRegionRow(tileOffsets, region, row);
+                    elements.insert(elements.end(), s6.tile_elements + span.first, s6.tile_elements + span.second);
+                }
+            }
+        }
+        if (elements.size() > RCT2_MAX_TILE_ELEMENTS)
+        {
+            throw IOException("Too many tile elements in map delta.");
+        }
+
+        std::memcpy(s6.tile_elements, elements.data(), elements.size() * sizeof(RCT12TileElement));
+        std::memset(
+            &s6.tile_elements[elements.size()], 0, (RCT2_MAX_TILE_ELEMENTS - elements.size()) * sizeof(RCT12TileElement));
+    }
+} // namespace MapResync
@@ -0,0 +1,58 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+
+#include <vector>
+
+interface IStream;
+struct rct_s6_data;
+
+/**
+ * Brings a client's copy of the park back in line with the server by only transferring the parts that differ. The client
+ * hashes regions of its own S6 export, the server compares them with its export and answers with the regions that do
+ * not match, which the client patches into the export it hashed before loading it.
+ *
+ * Regions are blocks of 16x16 tiles, blocks of 64 sprites, single rides and 4 KiB blocks of the remaining data.
+ */
+namespace MapResync
+{
+    constexpr int32_t TILE_REGION_SIZE = 16;
+    constexpr size_t SPRITE_BLOCK_SIZE = 64;
+    constexpr size_t DATA_BLOCK_SIZE = 4096;
+
+    struct RegionHashes
+    {
+        uint64_t Objects = 0;
+        std::vector<uint64_t> Data;
+        std::vector<uint64_t> Tiles;
+        std::vector<uint64_t> Sprites;
+        std::vector<uint64_t> Rides;
+    };
+
+    /**
+     * The tile elements of the S6 data have to be ordered by tile, as done by map_reorganise_elements.
+     */
+    RegionHashes ComputeHashes(const rct_s6_data& s6);
+    void WriteHashes(IStream* stream, const RegionHashes& hashes);
+    RegionHashes ReadHashes(IStream* stream);
+
+    /**
+     * Writes the regions of the S6 data whose hashes differ from the given ones. Returns false without writing anything
+     * if the client has to load the full map instead, because the objects differ or the delta would not be much smaller.
+     */
+    bool WriteDelta(IStream* stream, const rct_s6_data& s6, const RegionHashes& remoteHashes);
+
+    /**
+     * Patches a delta into the S6 data the remote hashes were computed from. Throws if the delta is malformed.
+     */
+    void ApplyDelta(IStream* stream, rct_s6_data& s6);
+} // namespace MapResync
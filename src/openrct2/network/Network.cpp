@@ -31,7 +31,7 @@
 // This string specifies which version of network stream current build uses.
 // It is used for making sure only compatible builds get connected, even within
 // single OpenRCT2 version.
-#define NETWORK_STREAM_VERSION "0"
+#define NETWORK_STREAM_VERSION "2"
 #define NETWORK_STREAM_ID OPENRCT2_VERSION "-" NETWORK_STREAM_VERSION
 
 static Peep* _pickup_peep = nullptr;
@@ -65,6 +65,7 @@ static constexpr uint32_t CHUNK_SIZE = 1024 * 63;
 #    include "../scenario/Scenario.h"
 #    include "../util/Util.h"
 #    include "../world/Park.h"
+#    include "MapResync.h"
 #    include "NetworkAction.h"
 #    include "NetworkConnection.h"
 #    include "NetworkGroup.h"
@@ -167,6 +168,7 @@ public:
     void CloseServerLog();
 
     void Client_Send_RequestGameState(uint32_t tick);
+    void Client_Send_REQUEST_MAP_RESYNC(bool fullMap = false);
 
     void Client_Send_TOKEN();
     void Client_Send_AUTH(
@@ -215,6 +217,9 @@ private:
     void CloseConnection();
 
     bool ProcessConnection(NetworkConnection& connection);
+    bool ReadConnection(NetworkConnection& connection);
+    bool WriteConnection(NetworkConnection& connection);
+    bool SetWriteInterest(NetworkConnection& connection, bool enabled);
     void ProcessPacket(NetworkConnection& connection, NetworkPacket& packet);
     void AddClient(std::unique_ptr<ITcpSocket>&& socket);
     void ServerClientDisconnected(std::unique_ptr<NetworkConnection>& connection);
@@ -229,6 +234,8 @@ private:
 
     bool LoadMap(IStream* stream);
     bool SaveMap(IStream* stream, const std::vector<const ObjectRepositoryItem*>& objects) const;
+    void ReadMapExtras(IStream* stream);
+    void WriteMapExtras(IStream* stream) const;
 
     struct PlayerListUpdate
     {
@@ -254,6 +261,7 @@ private:
     bool wsa_initialized = false;
     bool _clientMapLoaded = false;
     std::unique_ptr<ITcpSocket> _listenSocket;
+    std::unique_ptr<ISocketPoller> _socketPoller; // Watches the listening socket and client connections.
     std::unique_ptr<NetworkConnection> _serverConnection;
     std::unique_ptr<INetworkServerAdvertiser> _advertiser;
     uint16_t listening_port = 0;
@@ -262,6 +270,7 @@ private:
     uint8_t player_id = 0;
     std::list<std::unique_ptr<NetworkConnection>> client_connection_list;
     std::vector<uint8_t> chunk_buffer;
+    std::unique_ptr<S6Exporter> _resyncBase; // The export the last map resync request was hashed from.
     std::string _host;
     uint16_t _port = 0;
     std::string _password;
@@ -285,10 +294,12 @@ private:
     std::vector<void (Network::*)(NetworkConnection& connection, NetworkPacket& packet)> client_command_handlers;
     std::vector<void (Network::*)(NetworkConnection& connection, NetworkPacket& packet)> server_command_handlers;
     void Server_Handle_REQUEST_GAMESTATE(NetworkConnection& connection, NetworkPacket& packet);
+    void Server_Handle_REQUEST_MAP_RESYNC(NetworkConnection& connection, NetworkPacket& packet);
     void Client_Handle_AUTH(NetworkConnection& connection, NetworkPacket& packet);
     void Server_Handle_AUTH(NetworkConnection& connection, NetworkPacket& packet);
     void Server_Client_Joined(const char* name, const std::string& keyhash, NetworkConnection& connection);
     void Client_Handle_MAP(NetworkConnection& connection, NetworkPacket& packet);
+    void Client_Handle_MAP_DELTA(NetworkConnection& connection, NetworkPacket& packet);
     void Client_Handle_CHAT(NetworkConnection& connection, NetworkPacket& packet);
     void Server_Handle_CHAT(NetworkConnection& connection, NetworkPacket& packet);
     void Client_Handle_GAME_ACTION(NetworkConnection& connection, NetworkPacket& packet);
@@ -344,6 +355,7 @@ Network::Network()
     client_command_handlers[NETWORK_COMMAND_TOKEN] = &Network::Client_Handle_TOKEN;
     client_command_handlers[NETWORK_COMMAND_OBJECTS] = &Network::Client_Handle_OBJECTS;
     client_command_handlers[NETWORK_COMMAND_GAMESTATE] = &Network::Client_Handle_GAMESTATE;
+    client_command_handlers[NETWORK_COMMAND_MAP_DELTA] = &Network::Client_Handle_MAP_DELTA;
     server_command_handlers.resize(NETWORK_COMMAND_MAX, nullptr);
     server_command_handlers[NETWORK_COMMAND_AUTH] = &Network::Server_Handle_AUTH;
     server_command_handlers[NETWORK_COMMAND_CHAT] = &Network::Server_Handle_CHAT;
@@ -353,6 +365,7 @@ Network::Network()
     server_command_handlers[NETWORK_COMMAND_TOKEN] = &Network::Server_Handle_TOKEN;
     server_command_handlers[NETWORK_COMMAND_OBJECTS] = &Network::Server_Handle_OBJECTS;
     server_command_handlers[NETWORK_COMMAND_REQUEST_GAMESTATE] = &Network::Server_Handle_REQUEST_GAMESTATE;
+    server_command_handlers[NETWORK_COMMAND_REQUEST_MAP_RESYNC] = &Network::Server_Handle_REQUEST_MAP_RESYNC;
 
     _chat_log_fs << std::unitbuf;
     _server_log_fs << std::unitbuf;
@@ -450,6 +463,7 @@ void Network::CloseConnection()
     }
     else if (mode == NETWORK_MODE_SERVER)
     {
+        _socketPoller.reset();
         _listenSocket.reset();
         _advertiser.reset();
     }
@@ -580,6 +594,8 @@ bool Network::BeginServer(uint16_t port, const std::string& address)
     try
     {
         _listenSocket->Listen(address, port);
+        _socketPoller = CreateSocketPoller();
+        _socketPoller->Add(_listenSocket.get(), nullptr);
     }
     catch (const std::exception& ex)
     {
@@ -707,13 +723,39 @@ void Network::Flush()
 
 void Network::UpdateServer()
 {
+    // Only read from connections that received something, the listening socket has no user data.
+    for (const auto& event : _socketPoller->Wait(0))
+    {
+        if (event.UserData == nullptr)
+        {
+            std::unique_ptr<ITcpSocket> tcpSocket;
+            while ((tcpSocket = _listenSocket->Accept()) != nullptr)
+            {
+                AddClient(std::move(tcpSocket));
+            }
+            continue;
+        }
+
+        auto connection = static_cast<NetworkConnection*>(event.UserData);
+        if (event.Writable && connection->IsWriteBlocked)
+        {
+            connection->IsWriteBlocked = false;
+            if (!SetWriteInterest(*connection, false))
+                continue;
+        }
+        if (event.Readable && !connection->IsDisconnected && !ReadConnection(*connection))
+        {
+            connection->IsDisconnected = true;
+        }
+    }
+
     for (auto& connection : client_connection_list)
     {
         // This can be called multiple times before the connection is removed.
         if (connection->IsDisconnected)
             continue;
 
-        if (!ProcessConnection(*connection))
+        if (!WriteConnection(*connection))
         {
             connection->IsDisconnected = true;
         }
@@ -734,12 +776,6 @@ void Network::UpdateServer()
     {
         _advertiser->Update();
     }
-
-    std::unique_ptr<ITcpSocket> tcpSocket = _listenSocket->Accept();
-    if (tcpSocket != nullptr)
-    {
-        AddClient(std::move(tcpSocket));
-    }
 }
 
 void Network::UpdateClient()
@@ -996,6 +1032,11 @@ bool Network::CheckDesynchronizaton()
         {
             Close();
         }
+        else
+        {
+            // The game keeps running desynchronised until the server answers with the parts of the map that differ.
+            Client_Send_REQUEST_MAP_RESYNC();
+        }
 
         return true;
     }
@@ -1404,6 +1445,35 @@ void Network::Client_Send_RequestGameState(uint32_t tick)
     _serverConnection->QueuePacket(std::move(packet));
 }
 
+void Network::Client_Send_REQUEST_MAP_RESYNC(bool fullMap)
+{
+    log_verbose("Requesting map resync from server");
+    std::unique_ptr<NetworkPacket> packet(NetworkPacket::Allocate());
+    *packet << (uint32_t)NETWORK_COMMAND_REQUEST_MAP_RESYNC;
+
+    // Without hashes the server answers with the full map.
+    _resyncBase = nullptr;
+    if (!fullMap)
+    {
+        try
+        {
+            map_reorganise_elements();
+            auto exporter = std::make_unique<S6Exporter>();
+            exporter->Export();
+
+            MemoryStream hashes;
+            MapResync::WriteHashes(&hashes, MapResync::ComputeHashes(exporter->GetData()));
+            packet->Write((const uint8_t*)hashes.GetData(), hashes.GetLength());
+            _resyncBase = std::move(exporter);
+        }
+        catch (const std::exception& e)
+        {
+            log_warning("Unable to hash map for resync: %s", e.what());
+        }
+    }
+    _serverConnection->QueuePacket(std::move(packet));
+}
+
 void Network::Client_Send_TOKEN()
 {
     log_verbose("requesting token");
@@ -1816,6 +1886,14 @@ void Network::Server_Send_EVENT_PLAYER_DISCONNECTED(const char* playerName, cons
 }
 
 bool Network::ProcessConnection(NetworkConnection& connection)
+{
+    return ReadConnection(connection) && WriteConnection(connection);
+}
+
+/**
+ * Processes all complete packets the connection received, returns false if it was closed.
+ */
+bool Network::ReadConnection(NetworkConnection& connection)
 {
     int32_t packetStatus;
     do
@@ -1846,7 +1924,42 @@ bool Network::ProcessConnection(NetworkConnection& connection)
                 break;
         }
     } while (packetStatus == NETWORK_READPACKET_MORE_DATA || packetStatus == NETWORK_READPACKET_SUCCESS);
-    connection.SendQueuedPackets();
+    return true;
+}
+
+/**
+ * Watches the connection for becoming writable or stops doing so, disconnecting it if the poller fails.
+ */
+bool Network::SetWriteInterest(NetworkConnection& connection, bool enabled)
+{
+    try
+    {
+        _socketPoller->SetWriteInterest(connection.Socket.get(), enabled);
+        return true;
+    }
+    catch (const std::exception& ex)
+    {
+        log_error("Unable to watch client %s: %s", connection.Socket->GetHostName(), ex.what());
+        connection.IsDisconnected = true;
+        return false;
+    }
+}
+
+/**
+ * Sends the packets queued for the connection, returns false if it timed out or can no longer be watched.
+ */
+bool Network::WriteConnection(NetworkConnection& connection)
+{
+    if (!connection.IsWriteBlocked)
+    {
+        connection.SendQueuedPackets();
+        if (_socketPoller != nullptr && connection.HasQueuedPackets())
+        {
+            connection.IsWriteBlocked = true;
+            if (!SetWriteInterest(connection, true))
+                return false;
+        }
+    }
     if (!connection.ReceivedPacketRecently())
     {
         if (!connection.GetLastDisconnectReason())
@@ -1999,6 +2112,10 @@ void Network::ProcessDisconnectedClients()
         {
             ServerClientDisconnected(connection);
             RemovePlayer(connection);
+            if (connection->Socket != nullptr)
+            {
+                _socketPoller->Remove(connection->Socket.get());
+            }
 
             it = client_connection_list.erase(it);
         }
@@ -2020,6 +2137,16 @@ void Network::AddClient(std::unique_ptr<ITcpSocket>&& socket)
     auto connection = std::make_unique<NetworkConnection>();
     connection->Socket = std::move(socket);
 
+    try
+    {
+        _socketPoller->Add(connection->Socket.get(), connection.get());
+    }
+    catch (const std::exception& ex)
+    {
+        // Only this connection is dropped, the socket is closed with it.
+        log_error("Unable to add client %s: %s", connection->Socket->GetHostName(), ex.what());
+        return;
+    }
     client_connection_list.push_back(std::move(connection));
 }
 
@@ -2276,6 +2403,56 @@ void Network::Server_Handle_REQUEST_GAMESTATE(NetworkConnection& connection, Net
     }
 }
 
+void Network::Server_Handle_REQUEST_MAP_RESYNC(NetworkConnection& connection, NetworkPacket& packet)
+{
+    size_t hashesSize = packet.Size - packet.BytesRead;
+    MemoryStream hashes(packet.Read(hashesSize), hashesSize);
+
+    MemoryStream delta;
+    bool hasDelta = false;
+    map_reorganise_elements();
+    viewport_set_saved_view();
+    try
+    {
+        auto remoteHashes = MapResync::ReadHashes(&hashes);
+        auto exporter = std::make_unique<S6Exporter>();
+        exporter->Export();
+        hasDelta = MapResync::WriteDelta(&delta, exporter->GetData(), remoteHashes);
+        if (hasDelta)
+        {
+            WriteMapExtras(&delta);
+        }
+    }
+    catch (const std::exception&)
+    {
+        // The client did not send usable hashes.
+    }
+
+    size_t compressedSize = 0;
+    uint8_t* compressed = nullptr;
+    if (hasDelta)
+    {
+        compressed = util_zlib_deflate((const uint8_t*)delta.GetData(), delta.GetLength(), &compressedSize);
+    }
+    if (compressed == nullptr)
+    {
+        log_verbose("Resyncing client with the full map");
+        Server_Send_MAP(&connection);
+        return;
+    }
+
+    log_verbose("Sending map delta of size %u bytes, compressed to %u bytes", delta.GetLength(), compressedSize);
+    for (size_t i = 0; i < compressedSize; i += CHUNK_SIZE)
+    {
+        size_t dataSize = std::min<size_t>(CHUNK_SIZE, compressedSize - i);
+        std::unique_ptr<NetworkPacket> chunk(NetworkPacket::Allocate());
+        *chunk << (uint32_t)NETWORK_COMMAND_MAP_DELTA << (uint32_t)compressedSize << (uint32_t)i;
+        chunk->Write(&compressed[i], dataSize);
+        connection.QueuePacket(std::move(chunk));
+    }
+    free(compressed);
+}
+
 void Network::Client_Handle_AUTH(NetworkConnection& connection, NetworkPacket& packet)
 {
     uint32_t auth_status;
@@ -2707,6 +2884,78 @@ void Network::Client_Handle_MAP([[maybe_unused]] NetworkConnection& connection,
     }
 }
 
+void Network::Client_Handle_MAP_DELTA([[maybe_unused]] NetworkConnection& connection, NetworkPacket& packet)
+{
+    uint32_t size, offset;
+    packet >> size >> offset;
+    int32_t chunksize = (int32_t)(packet.Size - packet.BytesRead);
+    if (chunksize <= 0 || offset + chunksize > size)
+    {
+        return;
+    }
+    if (offset == 0)
+    {
+        // Same as a full map load, actions for the old state are of no use.
+        GameActions::ClearQueue();
+        GameActions::SuspendQueue();
+
+        _serverTickData.clear();
+        _clientMapLoaded = false;
+    }
+    if (size > chunk_buffer.size())
+    {
+        chunk_buffer.resize(size);
+    }
+    std::memcpy(&chunk_buffer[offset], (void*)packet.Read(chunksize), chunksize);
+    if (offset + chunksize != size)
+    {
+        return;
+    }
+
+    GameActions::ResumeQueue();
+
+    bool loaded = false;
+    size_t dataSize;
+    uint8_t* data = util_zlib_inflate(&chunk_buffer[0], size, &dataSize);
+    if (data != nullptr && _resyncBase != nullptr)
+    {
+        try
+        {
+            auto delta = MemoryStream(data, dataSize);
+            MapResync::ApplyDelta(&delta, _resyncBase->GetData());
+
+            // Save the patched park followed by the extra data the server appended to the delta, as SaveMap would.
+            auto ms = MemoryStream();
+            _resyncBase->SaveGame(&ms);
+            auto extrasPosition = (size_t)delta.GetPosition();
+            ms.Write(data + extrasPosition, dataSize - extrasPosition);
+            ms.SetPosition(0);
+            loaded = LoadMap(&ms);
+        }
+        catch (const std::exception& e)
+        {
+            log_warning("Unable to apply map delta: %s", e.what());
+        }
+    }
+    free(data);
+    _resyncBase = nullptr;
+
+    if (!loaded)
+    {
+        log_warning("Map resync failed, requesting the full map.");
+        Client_Send_REQUEST_MAP_RESYNC(true);
+        return;
+    }
+
+    game_load_init();
+    _serverState.tick = gCurrentTicks;
+    _serverState.state = NETWORK_SERVER_STATE_OK;
+    _clientMapLoaded = true;
+    context_force_close_window_by_class(WC_NETWORK_STATUS);
+    fix_invalid_vehicle_sprite_sizes();
+    log_verbose("Resynchronised map from a delta of %u bytes", size);
+}
+
 bool Network::LoadMap(IStream* stream)
 {
     bool result = false;
@@ -2725,32 +2974,7 @@ bool Network::LoadMap(IStream* stream)
         // Read checksum
         [[maybe_unused]] uint32_t checksum = stream->ReadValue<uint32_t>();
 
-        // Read other data not in normal save files
-        gGamePaused = stream->ReadValue<uint32_t>();
-        _guestGenerationProbability = stream->ReadValue<uint32_t>();
-        _suggestedGuestMaximum = stream->ReadValue<uint32_t>();
-        gCheatsEnableAllDrawableTrackPieces = stream->ReadValue<uint8_t>() != 0;
-        gCheatsSandboxMode = stream->ReadValue<uint8_t>() != 0;
-        gCheatsDisableClearanceChecks = stream->ReadValue<uint8_t>() != 0;
-        gCheatsDisableSupportLimits = stream->ReadValue<uint8_t>() != 0;
-        gCheatsDisableTrainLengthLimit = stream->ReadValue<uint8_t>() != 0;
-        gCheatsEnableChainLiftOnAllTrack = stream->ReadValue<uint8_t>() != 0;
-        gCheatsShowAllOperatingModes = stream->ReadValue<uint8_t>() != 0;
-        gCheatsShowVehiclesFromOtherTrackTypes = stream->ReadValue<uint8_t>() != 0;
-        gCheatsFastLiftHill = stream->ReadValue<uint8_t>() != 0;
-        gCheatsDisableBrakesFailure = stream->ReadValue<uint8_t>() != 0;
-        gCheatsDisableAllBreakdowns = stream->ReadValue<uint8_t>() != 0;
-        gCheatsBuildInPauseMode = stream->ReadValue<uint8_t>() != 0;
-        gCheatsIgnoreRideIntensity = stream->ReadValue<uint8_t>() != 0;
-        gCheatsDisableVandalism = stream->ReadValue<uint8_t>() != 0;
-        gCheatsDisableLittering = stream->ReadValue<uint8_t>() != 0;
-        gCheatsNeverendingMarketing = stream->ReadValue<uint8_t>() != 0;
-        gCheatsFreezeWeather = stream->ReadValue<uint8_t>() != 0;
-        gCheatsDisablePlantAging = stream->ReadValue<uint8_t>() != 0;
-        gCheatsAllowArbitraryRideTypeChanges = stream->ReadValue<uint8_t>() != 0;
-        gCheatsDisableRideValueAging = stream->ReadValue<uint8_t>() != 0;
-        gConfigGeneral.show_real_names_of_guests = stream->ReadValue<uint8_t>() != 0;
-        gCheatsIgnoreResearchStatus = stream->ReadValue<uint8_t>() != 0;
+        ReadMapExtras(stream);
 
         gLastAutoSaveUpdate = AUTOSAVE_PAUSE;
         result = true;
@@ -2773,32 +2997,7 @@ bool Network::SaveMap(IStream* stream, const std::vector<const ObjectRepositoryI
         s6exporter->Export();
         s6exporter->SaveGame(stream);
 
-        // Write other data not in normal save files
-        stream->WriteValue<uint32_t>(gGamePaused);
-        stream->WriteValue<uint32_t>(_guestGenerationProbability);
-        stream->WriteValue<uint32_t>(_suggestedGuestMaximum);
-        stream->WriteValue<uint8_t>(gCheatsEnableAllDrawableTrackPieces);
-        stream->WriteValue<uint8_t>(gCheatsSandboxMode);
-        stream->WriteValue<uint8_t>(gCheatsDisableClearanceChecks);
-        stream->WriteValue<uint8_t>(gCheatsDisableSupportLimits);
-        stream->WriteValue<uint8_t>(gCheatsDisableTrainLengthLimit);
-        stream->WriteValue<uint8_t>(gCheatsEnableChainLiftOnAllTrack);
-        stream->WriteValue<uint8_t>(gCheatsShowAllOperatingModes);
-        stream->WriteValue<uint8_t>(gCheatsShowVehiclesFromOtherTrackTypes);
-        stream->WriteValue<uint8_t>(gCheatsFastLiftHill);
-        stream->WriteValue<uint8_t>(gCheatsDisableBrakesFailure);
-        stream->WriteValue<uint8_t>(gCheatsDisableAllBreakdowns);
-        stream->WriteValue<uint8_t>(gCheatsBuildInPauseMode);
-        stream->WriteValue<uint8_t>(gCheatsIgnoreRideIntensity);
-        stream->WriteValue<uint8_t>(gCheatsDisableVandalism);
-        stream->WriteValue<uint8_t>(gCheatsDisableLittering);
-        stream->WriteValue<uint8_t>(gCheatsNeverendingMarketing);
-        stream->WriteValue<uint8_t>(gCheatsFreezeWeather);
-        stream->WriteValue<uint8_t>(gCheatsDisablePlantAging);
-        stream->WriteValue<uint8_t>(gCheatsAllowArbitraryRideTypeChanges);
-        stream->WriteValue<uint8_t>(gCheatsDisableRideValueAging);
-        stream->WriteValue<uint8_t>(gConfigGeneral.show_real_names_of_guests);
-        stream->WriteValue<uint8_t>(gCheatsIgnoreResearchStatus);
+        WriteMapExtras(stream);
 
         result = true;
     }
@@ -2808,6 +3007,67 @@ bool Network::SaveMap(IStream* stream, const std::vector<const ObjectRepositoryI
     return result;
 }
 
+/**
+ * Data not stored in normal save files, sent after the park for full maps and deltas alike.
+ */
+void Network::ReadMapExtras(IStream* stream)
+{
+    gGamePaused = stream->ReadValue<uint32_t>();
+    _guestGenerationProbability = stream->ReadValue<uint32_t>();
+    _suggestedGuestMaximum = stream->ReadValue<uint32_t>();
+    gCheatsEnableAllDrawableTrackPieces = stream->ReadValue<uint8_t>() != 0;
+    gCheatsSandboxMode = stream->ReadValue<uint8_t>() != 0;
+    gCheatsDisableClearanceChecks = stream->ReadValue<uint8_t>() != 0;
+    gCheatsDisableSupportLimits = stream->ReadValue<uint8_t>() != 0;
+    gCheatsDisableTrainLengthLimit = stream->ReadValue<uint8_t>() != 0;
+    gCheatsEnableChainLiftOnAllTrack = stream->ReadValue<uint8_t>() != 0;
+    gCheatsShowAllOperatingModes = stream->ReadValue<uint8_t>() != 0;
+    gCheatsShowVehiclesFromOtherTrackTypes = stream->ReadValue<uint8_t>() != 0;
+    gCheatsFastLiftHill = stream->ReadValue<uint8_t>() != 0;
+    gCheatsDisableBrakesFailure = stream->ReadValue<uint8_t>() != 0;
+    gCheatsDisableAllBreakdowns = stream->ReadValue<uint8_t>() != 0;
+    gCheatsBuildInPauseMode = stream->ReadValue<uint8_t>() != 0;
+    gCheatsIgnoreRideIntensity = stream->ReadValue<uint8_t>() != 0;
+    gCheatsDisableVandalism = stream->ReadValue<uint8_t>() != 0;
+    gCheatsDisableLittering = stream->ReadValue<uint8_t>() != 0;
+    gCheatsNeverendingMarketing = stream->ReadValue<uint8_t>() != 0;
+    gCheatsFreezeWeather = stream->ReadValue<uint8_t>() != 0;
+    gCheatsDisablePlantAging = stream->ReadValue<uint8_t>() != 0;
+    gCheatsAllowArbitraryRideTypeChanges = stream->ReadValue<uint8_t>() != 0;
+    gCheatsDisableRideValueAging = stream->ReadValue<uint8_t>() != 0;
+    gConfigGeneral.show_real_names_of_guests = stream->ReadValue<uint8_t>() != 0;
+    gCheatsIgnoreResearchStatus = stream->ReadValue<uint8_t>() != 0;
+}
+
+void Network::WriteMapExtras(IStream* stream) const
+{
+    stream->WriteValue<uint32_t>(gGamePaused);
+    stream->WriteValue<uint32_t>(_guestGenerationProbability);
+    stream->WriteValue<uint32_t>(_suggestedGuestMaximum);
+    stream->WriteValue<uint8_t>(gCheatsEnableAllDrawableTrackPieces);
+    stream->WriteValue<uint8_t>(gCheatsSandboxMode);
+    stream->WriteValue<uint8_t>(gCheatsDisableClearanceChecks);
+    stream->WriteValue<uint8_t>(gCheatsDisableSupportLimits);
+    stream->WriteValue<uint8_t>(gCheatsDisableTrainLengthLimit);
+    stream->WriteValue<uint8_t>(gCheatsEnableChainLiftOnAllTrack);
+    stream->WriteValue<uint8_t>(gCheatsShowAllOperatingModes);
+    stream->WriteValue<uint8_t>(gCheatsShowVehiclesFromOtherTrackTypes);
+    stream->WriteValue<uint8_t>(gCheatsFastLiftHill);
+    stream->WriteValue<uint8_t>(gCheatsDisableBrakesFailure);
+    stream->WriteValue<uint8_t>(gCheatsDisableAllBreakdowns);
+    stream->WriteValue<uint8_t>(gCheatsBuildInPauseMode);
+    stream->WriteValue<uint8_t>(gCheatsIgnoreRideIntensity);
+    stream->WriteValue<uint8_t>(gCheatsDisableVandalism);
+    stream->WriteValue<uint8_t>(gCheatsDisableLittering);
+    stream->WriteValue<uint8_t>(gCheatsNeverendingMarketing);
+    stream->WriteValue<uint8_t>(gCheatsFreezeWeather);
+    stream->WriteValue<uint8_t>(gCheatsDisablePlantAging);
+    stream->WriteValue<uint8_t>(gCheatsAllowArbitraryRideTypeChanges);
+    stream->WriteValue<uint8_t>(gCheatsDisableRideValueAging);
+    stream->WriteValue<uint8_t>(gConfigGeneral.show_real_names_of_guests);
+    stream->WriteValue<uint8_t>(gCheatsIgnoreResearchStatus);
+}
+
 void Network::Client_Handle_CHAT([[maybe_unused]] NetworkConnection& connection, NetworkPacket& packet)
 {
     const char* text = packet.ReadString();
@@ -17,7 +17,12 @@
 #    include "Socket.h"
 #    include "network.h"
 
+#    include <algorithm>
+#    include <cstring>
+#    include <iterator>
+
 constexpr size_t NETWORK_DISCONNECT_REASON_BUFFER_SIZE = 256;
+constexpr size_t READ_BLOCK_SIZE = 16 * 1024;
 
 NetworkConnection::NetworkConnection()
 {
@@ -31,74 +36,91 @@ NetworkConnection::~NetworkConnection()
 
 int32_t NetworkConnection::ReadPacket()
 {
-    if (InboundPacket.BytesTransferred < sizeof(InboundPacket.Size))
+    auto status = TakeInboundPacket();
+    if (status == NETWORK_READPACKET_MORE_DATA)
     {
-        // read packet size
-        void* buffer = &((char*)&InboundPacket.Size)[InboundPacket.BytesTransferred];
-        size_t bufferLength = sizeof(InboundPacket.Size) - InboundPacket.BytesTransferred;
+        // Move the start of the incomplete packet to the front and make room for another block.
+        if (_readStart > 0)
+        {
+            std::memmove(_readBuffer.data(), _readBuffer.data() + _readStart, _readEnd - _readStart);
+            _readEnd -= _readStart;
+            _readStart = 0;
+        }
+        if (_readBuffer.size() - _readEnd < READ_BLOCK_SIZE)
+        {
+            _readBuffer.resize(_readEnd + READ_BLOCK_SIZE);
+        }
+
         size_t readBytes;
-        NETWORK_READPACKET status = Socket->ReceiveData(buffer, bufferLength, &readBytes);
+        status = Socket->ReceiveData(&_readBuffer[_readEnd], _readBuffer.size() - _readEnd, &readBytes);
         if (status != NETWORK_READPACKET_SUCCESS)
         {
             return status;
         }
+        _readEnd += readBytes;
 
-        InboundPacket.BytesTransferred += readBytes;
-        if (InboundPacket.BytesTransferred == sizeof(InboundPacket.Size))
-        {
-            InboundPacket.Size = Convert::NetworkToHost(InboundPacket.Size);
-            if (InboundPacket.Size == 0) // Can't have a size 0 packet
-            {
-                return NETWORK_READPACKET_DISCONNECTED;
-            }
-            InboundPacket.Data->resize(InboundPacket.Size);
-        }
+        status = TakeInboundPacket();
     }
-    else
+
+    if (status == NETWORK_READPACKET_SUCCESS)
     {
-        // read packet data
-        if (InboundPacket.Data->capacity() > 0)
-        {
-            void* buffer = &InboundPacket.GetData()[InboundPacket.BytesTransferred - sizeof(InboundPacket.Size)];
-            size_t bufferLength = sizeof(InboundPacket.Size) + InboundPacket.Size - InboundPacket.BytesTransferred;
-            size_t readBytes;
-            NETWORK_READPACKET status = Socket->ReceiveData(buffer, bufferLength, &readBytes);
-            if (status != NETWORK_READPACKET_SUCCESS)
-            {
-                return status;
-            }
+        _lastPacketTime = platform_get_ticks();
 
-            InboundPacket.BytesTransferred += readBytes;
-        }
-        if (InboundPacket.BytesTransferred == sizeof(InboundPacket.Size) + InboundPacket.Size)
-        {
-            _lastPacketTime = platform_get_ticks();
+        RecordPacketStats(InboundPacket, false);
+    }
+    return status;
+}
 
-            RecordPacketStats(InboundPacket, false);
+/**
+ * Moves the next complete packet from the read buffer into the inbound packet.
+ */
+NETWORK_READPACKET NetworkConnection::TakeInboundPacket()
+{
+    size_t available = _readEnd - _readStart;
+    if (available < sizeof(InboundPacket.Size))
+    {
+        return NETWORK_READPACKET_MORE_DATA;
+    }
 
-            return NETWORK_READPACKET_SUCCESS;
-        }
+    uint16_t size;
+    std::memcpy(&size, &_readBuffer[_readStart], sizeof(size));
+    size = Convert::NetworkToHost(size);
+    if (size == 0) // Can't have a size 0 packet
+    {
+        return NETWORK_READPACKET_DISCONNECTED;
+    }
+    if (available < sizeof(size) + size)
+    {
+        return NETWORK_READPACKET_MORE_DATA;
     }
-    return NETWORK_READPACKET_MORE_DATA;
+
+    auto data = &_readBuffer[_readStart + sizeof(size)];
+    InboundPacket.Size = size;
+    InboundPacket.Data->assign(data, data + size);
+    InboundPacket.BytesTransferred = sizeof(size) + size;
+    InboundPacket.BytesRead = 0;
+    _readStart += sizeof(size) + size;
+    return NETWORK_READPACKET_SUCCESS;
 }
 
 bool NetworkConnection::SendPacket(NetworkPacket& packet)
 {
+    // The payload is sent straight from the packet, it may be shared with the same packet queued for other connections.
     uint16_t sizen = Convert::HostToNetwork(packet.Size);
-    std::vector<uint8_t> tosend;
-    tosend.reserve(sizeof(sizen) + packet.Size);
-    tosend.insert(tosend.end(), (uint8_t*)&sizen, (uint8_t*)&sizen + sizeof(sizen));
-    tosend.insert(tosend.end(), packet.Data->begin(), packet.Data->end());
-
-    const void* buffer = &tosend[packet.BytesTransferred];
-    size_t bufferSize = tosend.size() - packet.BytesTransferred;
-    size_t sent = Socket->SendData(buffer, bufferSize);
+    size_t headerSent = std::min(packet.BytesTransferred, sizeof(sizen));
+    size_t payloadSent = packet.BytesTransferred - headerSent;
+    const SocketBuffer buffers[] = {
+        { (const uint8_t*)&sizen + headerSent, sizeof(sizen) - headerSent },
+        { packet.GetData() + payloadSent, packet.Size - payloadSent },
+    };
+
+    size_t sent = Socket->SendData(buffers, std::size(buffers));
     if (sent > 0)
     {
         packet.BytesTransferred += sent;
     }
 
-    bool sendComplete = packet.BytesTransferred == tosend.size();
+    bool sendComplete = packet.BytesTransferred == sizeof(sizen) + packet.Size;
     if (sendComplete)
     {
         RecordPacketStats(packet, true);
@@ -140,6 +162,11 @@ void NetworkConnection::SendQueuedPackets()
     }
 }
 
+bool NetworkConnection::HasQueuedPackets() const
+{
+    return !_outboundPackets.empty();
+}
+
 void NetworkConnection::ResetLastPacketTime()
 {
     _lastPacketTime = platform_get_ticks();
@@ -36,6 +36,7 @@ public:
     std::vector<uint8_t> Challenge;
     std::vector<const ObjectRepositoryItem*> RequestedObjects;
     bool IsDisconnected = false;
+    bool IsWriteBlocked = false; // The socket could not take all queued packets, wait until it is writable again.
 
     NetworkConnection();
     ~NetworkConnection();
@@ -43,6 +44,7 @@ public:
     int32_t ReadPacket();
     void QueuePacket(std::unique_ptr<NetworkPacket> packet, bool front = false);
     void SendQueuedPackets();
+    bool HasQueuedPackets() const;
     void ResetLastPacketTime();
     bool ReceivedPacketRecently();
 
@@ -52,10 +54,15 @@ public:
 
 private:
     std::list<std::unique_ptr<NetworkPacket>> _outboundPackets;
+    // Received data not yet split into packets, read in large blocks so several small packets take one call.
+    std::vector<uint8_t> _readBuffer;
+    size_t _readStart = 0;
+    size_t _readEnd = 0;
     uint32_t _lastPacketTime = 0;
     utf8* _lastDisconnectReason = nullptr;
 
     void RecordPacketStats(const NetworkPacket& packet, bool sending);
+    NETWORK_READPACKET TakeInboundPacket();
     bool SendPacket(NetworkPacket& packet);
 };
 
@@ -14,6 +14,75 @@
 #    include "NetworkTypes.h"
 
 #    include <memory>
+#    include <mutex>
+
+/**
+ * Keeps the buffers of released packets for reuse, servers send several small packets to every client each tick.
+ */
+class NetworkPacketBufferPool final
+{
+private:
+    // Enough for every packet queued in a busy tick, larger buffers are freed so a burst of map chunks does not pin memory.
+    static constexpr size_t MAX_BUFFERS = 256;
+    static constexpr size_t MAX_BUFFER_CAPACITY = 128 * 1024;
+
+    std::mutex _mutex;
+    std::vector<std::unique_ptr<std::vector<uint8_t>>> _buffers;
+
+public:
+    std::shared_ptr<std::vector<uint8_t>> Acquire()
+    {
+        std::unique_ptr<std::vector<uint8_t>> buffer;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (!_buffers.empty())
+            {
+                buffer = std::move(_buffers.back());
+                _buffers.pop_back();
+            }
+        }
+        if (buffer == nullptr)
+        {
+            buffer = std::make_unique<std::vector<uint8_t>>();
+        }
+        return std::shared_ptr<std::vector<uint8_t>>(buffer.release(), [this](std::vector<uint8_t>* released) {
+            Release(std::unique_ptr<std::vector<uint8_t>>(released));
+        });
+    }
+
+private:
+    void Release(std::unique_ptr<std::vector<uint8_t>> buffer)
+    {
+        if (buffer->capacity() > MAX_BUFFER_CAPACITY)
+        {
+            return;
+        }
+        buffer->clear();
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_buffers.size() < MAX_BUFFERS)
+        {
+            _buffers.push_back(std::move(buffer));
+        }
+    }
+};
+
+static NetworkPacketBufferPool& GetBufferPool()
+{
+    // Never destroyed, packets owned by other static objects may still release their buffers during shutdown.
+    static auto pool = new NetworkPacketBufferPool();
+    return *pool;
+}
+
+NetworkPacket::NetworkPacket()
+    : Data(AllocateBuffer())
+{
+}
+
+std::shared_ptr<std::vector<uint8_t>> NetworkPacket::AllocateBuffer()
+{
+    return GetBufferPool().Acquire();
+}
 
 std::unique_ptr<NetworkPacket> NetworkPacket::Allocate()
 {
@@ -16,16 +16,30 @@
 #include <memory>
 #include <vector>
 
+/**
+ * Payload buffers come from a pool and are reference counted. Once a packet is queued its payload must not be modified,
+ * duplicates for other connections share it.
+ */
 class NetworkPacket final
 {
 public:
     uint16_t Size = 0;
-    std::shared_ptr<std::vector<uint8_t>> Data = std::make_shared<std::vector<uint8_t>>();
+    std::shared_ptr<std::vector<uint8_t>> Data;
     size_t BytesTransferred = 0;
     size_t BytesRead = 0;
 
+    NetworkPacket();
+    // Copies share the payload, only a new packet takes a buffer from the pool.
+    NetworkPacket(const NetworkPacket&) = default;
+    NetworkPacket& operator=(const NetworkPacket&) = default;
+
     static std::unique_ptr<NetworkPacket> Allocate();
+    /**
+     * Creates a packet with its own transfer state that shares the payload of the given packet, so a packet can be
+     * queued for several connections without copying it.
+     */
     static std::unique_ptr<NetworkPacket> Duplicate(NetworkPacket& packet);
+    static std::shared_ptr<std::vector<uint8_t>> AllocateBuffer();
 
     uint8_t* GetData();
     int32_t GetCommand() const;
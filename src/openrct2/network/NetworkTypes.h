@@ -68,6 +68,8 @@ enum NETWORK_COMMAND
     NETWORK_COMMAND_PLAYERINFO,
     NETWORK_COMMAND_REQUEST_GAMESTATE,
     NETWORK_COMMAND_GAMESTATE,
+    NETWORK_COMMAND_REQUEST_MAP_RESYNC,
+    NETWORK_COMMAND_MAP_DELTA,
     NETWORK_COMMAND_MAX,
     NETWORK_COMMAND_INVALID = -1
 };
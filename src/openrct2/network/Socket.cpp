@@ -9,6 +9,7 @@
 
 #ifndef DISABLE_NETWORK
 
+#    include <algorithm>
 #    include <atomic>
 #    include <chrono>
 #    include <cmath>
@@ -16,6 +17,7 @@
 #    include <future>
 #    include <string>
 #    include <thread>
+#    include <unordered_map>
 
 // clang-format off
 // MSVC: include <math.h> here otherwise PI gets defined twice
@@ -46,6 +48,7 @@
     #include <netinet/tcp.h>
     #include <sys/ioctl.h>
     #include <sys/socket.h>
+    #include <sys/uio.h>
     #include "../common.h"
     using SOCKET = int32_t;
     #define SOCKET_ERROR -1
@@ -54,6 +57,7 @@
     #define closesocket close
     #define ioctlsocket ioctl
     #if defined(__linux__)
+        #include <sys/epoll.h>
         #define FLAG_NO_PIPE MSG_NOSIGNAL
     #else
         #define FLAG_NO_PIPE 0
@@ -65,6 +69,9 @@
 
 constexpr auto CONNECT_TIMEOUT = std::chrono::milliseconds(3000);
 
+// Number of buffers passed to the system per gather write, more are sent in further calls.
+constexpr size_t MAX_GATHER_BUFFERS = 16;
+
 #    ifdef _WIN32
 static bool _wsaInitialised = false;
 #    endif
@@ -222,6 +229,11 @@ public:
         return _status;
     }
 
+    SOCKET GetSocket() const
+    {
+        return _socket;
+    }
+
     const char* GetError() const override
     {
         return _error.empty() ? nullptr : _error.c_str();
@@ -488,6 +500,71 @@ public:
         return totalSent;
     }
 
+    size_t SendData(const SocketBuffer* buffers, size_t count) override
+    {
+        if (_status != SOCKET_STATUS_CONNECTED)
+        {
+            throw std::runtime_error("Socket not connected.");
+        }
+
+        size_t totalSize = 0;
+        for (size_t i = 0; i < count; i++)
+        {
+            totalSize += buffers[i].Size;
+        }
+
+        size_t totalSent = 0;
+        while (totalSent < totalSize)
+        {
+            // Gather the remaining data, a previous send may have stopped in the middle of a buffer.
+#    ifdef _WIN32
+            WSABUF parts[MAX_GATHER_BUFFERS];
+#    else
+            iovec parts[MAX_GATHER_BUFFERS];
+#    endif
+            size_t numParts = 0;
+            size_t skip = totalSent;
+            for (size_t i = 0; i < count && numParts < MAX_GATHER_BUFFERS; i++)
+            {
+                if (skip >= buffers[i].Size)
+                {
+                    skip -= buffers[i].Size;
+                    continue;
+                }
+                auto data = (const char*)buffers[i].Data + skip;
+                auto size = buffers[i].Size - skip;
+                skip = 0;
+#    ifdef _WIN32
+                parts[numParts].buf = (CHAR*)data;
+                parts[numParts].len = (ULONG)size;
+#    else
+                parts[numParts].iov_base = (void*)data;
+                parts[numParts].iov_len = size;
+#    endif
+                numParts++;
+            }
+
+#    ifdef _WIN32
+            DWORD sentBytes;
+            if (WSASend(_socket, parts, (DWORD)numParts, &sentBytes, 0, nullptr, nullptr) == SOCKET_ERROR)
+            {
+                return totalSent;
+            }
+#    else
+            msghdr message{};
+            message.msg_iov = parts;
+            message.msg_iovlen = numParts;
+            auto sentBytes = sendmsg(_socket, &message, FLAG_NO_PIPE);
+            if (sentBytes == SOCKET_ERROR)
+            {
+                return totalSent;
+            }
+#    endif
+            totalSent += sentBytes;
+        }
+        return totalSent;
+    }
+
     NETWORK_READPACKET ReceiveData(void* buffer, size_t size, size_t* sizeReceived) override
     {
         if (_status != SOCKET_STATUS_CONNECTED)
@@ -800,6 +877,132 @@ void DisposeWSA()
 #    endif
 }
 
+/**
+ * Reports every socket as ready, which is what polling each connection every frame amounts to.
+ */
+class ReadySocketPoller final : public ISocketPoller
+{
+private:
+    std::vector<std::pair<ITcpSocket*, void*>> _sockets;
+    std::vector<SocketEvent> _events;
+
+public:
+    void Add(ITcpSocket* socket, void* userData) override
+    {
+        _sockets.emplace_back(socket, userData);
+    }
+
+    void Remove(ITcpSocket* socket) override
+    {
+        auto it = std::find_if(
+            _sockets.begin(), _sockets.end(), [socket](const std::pair<ITcpSocket*, void*>& s) { return s.first == socket; });
+        if (it != _sockets.end())
+        {
+            _sockets.erase(it);
+        }
+    }
+
+    void SetWriteInterest([[maybe_unused]] ITcpSocket* socket, [[maybe_unused]] bool enabled) override
+    {
+    }
+
+    const std::vector<SocketEvent>& Wait([[maybe_unused]] int32_t timeoutMilliseconds) override
+    {
+        _events.clear();
+        for (const auto& s : _sockets)
+        {
+            _events.push_back({ s.second, true, true });
+        }
+        return _events;
+    }
+};
+
+#    ifdef __linux__
+class EpollSocketPoller final : public ISocketPoller
+{
+private:
+    int _epoll;
+    std::unordered_map<SOCKET, void*> _userData;
+    std::vector<epoll_event> _readyEvents;
+    std::vector<SocketEvent> _events;
+
+public:
+    EpollSocketPoller()
+    {
+        _epoll = epoll_create1(EPOLL_CLOEXEC);
+        if (_epoll == -1)
+        {
+            throw SocketException("Unable to create epoll instance.");
+        }
+    }
+
+    ~EpollSocketPoller() override
+    {
+        close(_epoll);
+    }
+
+    void Add(ITcpSocket* socket, void* userData) override
+    {
+        auto handle = GetHandle(socket);
+        Control(EPOLL_CTL_ADD, handle, userData, EPOLLIN | EPOLLRDHUP);
+        _userData[handle] = userData;
+    }
+
+    void Remove(ITcpSocket* socket) override
+    {
+        // Closing the socket also removes it, so this is allowed to fail.
+        auto handle = GetHandle(socket);
+        epoll_ctl(_epoll, EPOLL_CTL_DEL, handle, nullptr);
+        _userData.erase(handle);
+    }
+
+    void SetWriteInterest(ITcpSocket* socket, bool enabled) override
+    {
+        auto handle = GetHandle(socket);
+        auto it = _userData.find(handle);
+        if (it != _userData.end())
+        {
+            Control(EPOLL_CTL_MOD, handle, it->second, EPOLLIN | EPOLLRDHUP | (enabled ? static_cast<uint32_t>(EPOLLOUT) : 0u));
+        }
+    }
+
+    const std::vector<SocketEvent>& Wait(int32_t timeoutMilliseconds) override
+    {
+        // The sockets are level triggered, waiting again before they are read would return the same ones. Room for every
+        // socket gets them all in a single wait.
+        _readyEvents.resize(std::max<size_t>(_userData.size(), 1));
+        int32_t count = epoll_wait(_epoll, _readyEvents.data(), (int32_t)_readyEvents.size(), timeoutMilliseconds);
+
+        _events.clear();
+        for (int32_t i = 0; i < count; i++)
+        {
+            auto flags = _readyEvents[i].events;
+            bool readable = (flags & (EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR)) != 0;
+            bool writable = (flags & EPOLLOUT) != 0;
+            _events.push_back({ _readyEvents[i].data.ptr, readable, writable });
+        }
+        return _events;
+    }
+
+private:
+    static SOCKET GetHandle(ITcpSocket* socket)
+    {
+        return static_cast<TcpSocket*>(socket)->GetSocket();
+    }
+
+    void Control(int32_t operation, SOCKET handle, void* userData, uint32_t flags)
+    {
+        epoll_event event{};
+        event.events = flags;
+        event.data.ptr = userData;
+        if (epoll_ctl(_epoll, operation, handle, &event) != 0)
+        {
+            throw SocketException("Unable to watch socket.");
+        }
+    }
+};
+#    endif
+
 std::unique_ptr<ITcpSocket> CreateTcpSocket()
 {
     return std::make_unique<TcpSocket>();
@@ -810,6 +1013,21 @@ std::unique_ptr<IUdpSocket> CreateUdpSocket()
     return std::make_unique<UdpSocket>();
 }
 
+std::unique_ptr<ISocketPoller> CreateSocketPoller()
+{
+#    ifdef __linux__
+    try
+    {
+        return std::make_unique<EpollSocketPoller>();
+    }
+    catch (const std::exception& e)
+    {
+        log_warning("%s Falling back to polling every socket.", e.what());
+    }
+#    endif
+    return std::make_unique<ReadySocketPoller>();
+}
+
 #    ifdef _WIN32
 static std::vector<INTERFACE_INFO> GetNetworkInterfaces()
 {
@@ -32,6 +32,15 @@ enum NETWORK_READPACKET
     NETWORK_READPACKET_DISCONNECTED
 };
 
+/**
+ * A part of the data passed to a gather write.
+ */
+struct SocketBuffer
+{
+    const void* Data;
+    size_t Size;
+};
+
 /**
  * Represents an address and port.
  */
@@ -64,6 +73,11 @@ public:
     virtual void ConnectAsync(const std::string& address, uint16_t port) abstract;
 
     virtual size_t SendData(const void* buffer, size_t size) abstract;
+    /**
+     * Sends the buffers in order as if they were one, without copying them together first. Returns the number of bytes
+     * sent across all buffers.
+     */
+    virtual size_t SendData(const SocketBuffer* buffers, size_t count) abstract;
     virtual NETWORK_READPACKET ReceiveData(void* buffer, size_t size, size_t* sizeReceived) abstract;
 
     virtual void Disconnect() abstract;
@@ -93,10 +107,42 @@ public:
     virtual void Close() abstract;
 };
 
+struct SocketEvent
+{
+    void* UserData;
+    bool Readable; // Also set when the connection was closed or failed, the next read reports it.
+    bool Writable;
+};
+
+/**
+ * Reports which TCP sockets are ready, so a server with many connections only has to touch the ones that have work.
+ * Uses epoll on Linux, elsewhere every socket is reported as ready on each wait.
+ */
+interface ISocketPoller
+{
+public:
+    virtual ~ISocketPoller() = default;
+
+    virtual void Add(ITcpSocket * socket, void* userData) abstract;
+    virtual void Remove(ITcpSocket * socket) abstract;
+
+    /**
+     * Sockets are only watched for being writable while enabled, which should be the case while a send is blocked.
+     */
+    virtual void SetWriteInterest(ITcpSocket * socket, bool enabled) abstract;
+
+    /**
+     * Waits up to the given number of milliseconds for any socket to become ready. The events stay valid until the
+     * next call.
+     */
+    virtual const std::vector<SocketEvent>& Wait(int32_t timeoutMilliseconds) abstract;
+};
+
 bool InitialiseWSA();
 void DisposeWSA();
 std::unique_ptr<ITcpSocket> CreateTcpSocket();
 std::unique_ptr<IUdpSocket> CreateUdpSocket();
+std::unique_ptr<ISocketPoller> CreateSocketPoller();
 std::vector<std::unique_ptr<INetworkEndpoint>> GetBroadcastAddresses();
 
 namespace Convert
@@ -32,6 +32,7 @@
 #include "../world/LargeScenery.h"
 #include "../world/Map.h"
 #include "../world/Park.h"
+#include "../world/RegionSummary.h"
 #include "../world/Scenery.h"
 #include "../world/Sprite.h"
 #include "../world/Surface.h"
@@ -1920,30 +1921,10 @@ std::bitset<MAX_RIDES> Guest::FindRidesToGoOn()
     else
     {
         // Take nearby rides into consideration
-        constexpr auto radius = 10 * 32;
-        int32_t cx = floor2(x, 32);
-        int32_t cy = floor2(y, 32);
-        for (int32_t tileX = cx - radius; tileX <= cx + radius; tileX += COORDS_XY_STEP)
-        {
-            for (int32_t tileY = cy - radius; tileY <= cy + radius; tileY += COORDS_XY_STEP)
-            {
-                if (map_is_location_valid({ tileX, tileY }))
-                {
-                    auto tileElement = map_get_first_element_at({ tileX, tileY });
-                    if (tileElement != nullptr)
-                    {
-                        do
-                        {
-                            if (tileElement->GetType() == TILE_ELEMENT_TYPE_TRACK)
-                            {
-                                auto rideIndex = tileElement->AsTrack()->GetRideIndex();
-                                rideConsideration[rideIndex] = true;
-                            }
-                        } while (!(tileElement++)->IsLastForTile());
-                    }
-                }
-            }
-        }
+        constexpr auto radius = 10;
+        auto centre = TileCoordsXY(CoordsXY{ floor2(x, 32), floor2(y, 32) });
+        RegionSummary::GetRidesInArea(
+            { centre.x - radius, centre.y - radius }, { centre.x + radius, centre.y + radius }, rideConsideration);
 
         // Always take the tall rides into consideration (realistic as you can usually see them from anywhere in the park)
         for (auto& ride : GetRideManager())
@@ -2499,6 +2480,7 @@ static void peep_choose_seat_from_car(Peep* peep, Ride* ride, Vehicle* vehicle)
     }
     peep->current_seat = chosen_seat;
     vehicle->next_free_seat++;
+    vehicle_wake_ride(ride->id);
 
     vehicle->peep[peep->current_seat] = peep->sprite_index;
     vehicle->peep_tshirt_colours[peep->current_seat] = peep->tshirt_colour;
@@ -2940,89 +2922,57 @@ static PeepThoughtType peep_assess_surroundings(int16_t centre_x, int16_t centre
     int16_t final_x = std::min(centre_x + 160, MAXIMUM_MAP_SIZE_BIG);
     int16_t final_y = std::min(centre_y + 160, MAXIMUM_MAP_SIZE_BIG);
 
-    for (int16_t x = initial_x; x < final_x; x += COORDS_XY_STEP)
-    {
-        for (int16_t y = initial_y; y < final_y; y += COORDS_XY_STEP)
-        {
-            TileElement* tileElement = map_get_first_element_at({ x, y });
-            if (tileElement == nullptr)
-                continue;
-            do
-            {
-                Ride* ride;
-                rct_scenery_entry* scenery;
+    auto surroundings = RegionSummary::CountSurroundings(
+        TileCoordsXY(CoordsXY{ initial_x, initial_y }), TileCoordsXY(CoordsXY{ final_x - 1, final_y - 1 }));
+    if (surroundings.HasInvalidAddition)
+        return PEEP_THOUGHT_TYPE_NONE;
 
-                switch (tileElement->GetType())
-                {
-                    case TILE_ELEMENT_TYPE_PATH:
-                        if (!tileElement->AsPath()->HasAddition())
-                            break;
+    num_scenery = surroundings.Scenery;
+    num_fountains = surroundings.Fountains;
+    num_rubbish = surroundings.BrokenAdditions;
 
-                        scenery = tileElement->AsPath()->GetAdditionEntry();
-                        if (scenery == nullptr)
-                        {
-                            return PEEP_THOUGHT_TYPE_NONE;
-                        }
-                        if (tileElement->AsPath()->AdditionIsGhost())
-                            break;
-
-                        if (scenery->path_bit.flags
-                            & (PATH_BIT_FLAG_JUMPING_FOUNTAIN_WATER | PATH_BIT_FLAG_JUMPING_FOUNTAIN_SNOW))
-                        {
-                            num_fountains++;
-                            break;
-                        }
-                        if (tileElement->AsPath()->IsBroken())
-                        {
-                            num_rubbish++;
-                        }
-                        break;
-                    case TILE_ELEMENT_TYPE_LARGE_SCENERY:
-                    case TILE_ELEMENT_TYPE_SMALL_SCENERY:
-                        num_scenery++;
-                        break;
-                    case TILE_ELEMENT_TYPE_TRACK:
-                        ride = get_ride(tileElement->AsTrack()->GetRideIndex());
-                        if (ride != nullptr)
-                        {
-                            if (ride->lifecycle_flags & RIDE_LIFECYCLE_MUSIC && ride->status != RIDE_STATUS_CLOSED
-                                && !(ride->lifecycle_flags & (RIDE_LIFECYCLE_BROKEN_DOWN | RIDE_LIFECYCLE_CRASHED)))
-                            {
-                                if (ride->type == RIDE_TYPE_MERRY_GO_ROUND)
-                                {
-                                    nearby_music |= 1;
-                                    break;
-                                }
-
-                                if (ride->music == MUSIC_STYLE_ORGAN)
-                                {
-                                    nearby_music |= 1;
-                                    break;
-                                }
+    for (auto& ride : GetRideManager())
+    {
+        if (!surroundings.Rides[ride.id])
+            continue;
 
-                                if (ride->type == RIDE_TYPE_DODGEMS)
-                                {
-                                    // Dodgems drown out music?
-                                    nearby_music |= 2;
-                                }
-                            }
-                        }
-                        break;
-                }
-            } while (!(tileElement++)->IsLastForTile());
+        if (ride.lifecycle_flags & RIDE_LIFECYCLE_MUSIC && ride.status != RIDE_STATUS_CLOSED
+            && !(ride.lifecycle_flags & (RIDE_LIFECYCLE_BROKEN_DOWN | RIDE_LIFECYCLE_CRASHED)))
+        {
+            if (ride.type == RIDE_TYPE_MERRY_GO_ROUND || ride.music == MUSIC_STYLE_ORGAN)
+            {
+                nearby_music |= 1;
+            }
+            else if (ride.type == RIDE_TYPE_DODGEMS)
+            {
+                // Dodgems drown out music?
+                nearby_music |= 2;
+            }
         }
     }
 
-    Litter* litter;
-    for (uint16_t sprite_idx = gSpriteListHead[SPRITE_LIST_LITTER]; sprite_idx != SPRITE_INDEX_NULL; sprite_idx = litter->next)
+    // Litter can only be on the tiles within range, so only their sprites have to be looked at.
+    for (int32_t x = std::max(centre_x - 160, 0); x <= centre_x + 160; x += COORDS_XY_STEP)
     {
-        litter = &(get_sprite(sprite_idx)->litter);
-
-        int16_t dist_x = abs(litter->x - centre_x);
-        int16_t dist_y = abs(litter->y - centre_y);
-        if (std::max(dist_x, dist_y) <= 160)
+        for (int32_t y = std::max(centre_y - 160, 0); y <= centre_y + 160; y += COORDS_XY_STEP)
         {
-            num_rubbish++;
+            if (!map_is_location_valid({ x, y }))
+                continue;
+
+            for (uint16_t sprite_idx = sprite_get_first_in_quadrant(x, y); sprite_idx != SPRITE_INDEX_NULL;)
+            {
+                auto sprite = get_sprite(sprite_idx);
+                sprite_idx = sprite->generic.next_in_quadrant;
+                if (sprite->generic.sprite_identifier != SPRITE_IDENTIFIER_LITTER)
+                    continue;
+
+                int16_t dist_x = abs(sprite->litter.x - centre_x);
+                int16_t dist_y = abs(sprite->litter.y - centre_y);
+                if (std::max(dist_x, dist_y) <= 160)
+                {
+                    num_rubbish++;
+                }
+            }
         }
     }
 
@@ -5247,6 +5197,43 @@ void Guest::UpdateRide()
 static void peep_update_walking_break_scenery(Peep* peep);
 static bool peep_find_ride_to_look_at(Peep* peep, uint8_t edge, uint8_t* rideToView, uint8_t* rideSeatToView);
 
+/**
+ * Takes the next step of UpdateWalking when all it would do is move the guest further along the tile it is on, without
+ * the checks UpdateWalking makes on every step. Returns false without changing the guest when a full update is needed,
+ * e.g. when the guest reaches its destination and has to decide where to go next.
+ */
+bool Guest::UpdateWalkingStraight()
+{
+    // Checking the path, starting an action and dropping litter are left to UpdateWalking.
+    if (((path_check_optimisation + 1) & 0xF) == (sprite_index & 0xF))
+        return false;
+    if (action < PEEP_ACTION_NONE_1)
+        return false;
+    if (peep_flags & (PEEP_FLAGS_WAVING | PEEP_FLAGS_PHOTO | PEEP_FLAGS_PAINTING | PEEP_FLAGS_LITTER))
+        return false;
+    if (HasEmptyContainer())
+        return false;
+
+    // The destination has to be on the same tile and far enough from its edges for a step towards it to stay there.
+    CoordsXY tile = CoordsXY{ x, y }.ToTileStart();
+    CoordsXY destination = { destination_x, destination_y };
+    if (tile != CoordsXY{ NextLoc } || destination.ToTileStart() != tile)
+        return false;
+    CoordsXY offset = destination - tile;
+    if (offset.x < 1 || offset.y < 1 || offset.x > COORDS_XY_STEP - 2 || offset.y > COORDS_XY_STEP - 2)
+        return false;
+    if (abs(x - destination.x) + abs(y - destination.y) <= destination_tolerance)
+        return false;
+
+    path_check_optimisation++;
+    std::optional<CoordsXY> loc = UpdateAction();
+    if (loc.has_value())
+    {
+        MoveTo(loc->x, loc->y, GetZOnSlope(loc->x, loc->y));
+    }
+    return true;
+}
+
 /**
  *
  *  rct2: 0x0069030A
@@ -6289,6 +6276,7 @@ static void peep_update_walking_break_scenery(Peep* peep)
     }
 
     tileElement->AsPath()->SetIsBroken(true);
+    RegionSummary::Invalidate(peep->NextLoc);
 
     map_invalidate_tile_zoom1({ peep->NextLoc, tileElement->GetBaseZ(), tileElement->GetBaseZ() + 32 });
 
@@ -9,6 +9,7 @@
 
 #include "../core/Guard.hpp"
 #include "../ride/Station.h"
+#include "../ride/StationQueues.h"
 #include "../ride/Track.h"
 #include "../scenario/Scenario.h"
 #include "../util/Util.h"
@@ -1704,7 +1705,7 @@ static int32_t guest_path_find_park_entrance(Peep* peep, uint8_t edges)
  * In case where the map element at (x, y) is invalid or there is no entrance
  * or queue leading to it the function will not update its arguments.
  */
-static void get_ride_queue_end(TileCoordsXYZ& loc)
+void get_ride_queue_end(TileCoordsXYZ& loc)
 {
     TileCoordsXY queueEnd = { 0, 0 };
     TileElement* tileElement = map_get_first_element_at(loc.ToCoordsXY());
@@ -2138,7 +2139,12 @@ int32_t guest_path_finding(Guest* peep)
         loc.z = entranceXYZD.z;
     }
 
-    get_ride_queue_end(loc);
+    if (!StationQueues::GetQueueEnd(ride->id, closestStationNum, loc))
+    {
+        auto entranceLoc = loc;
+        get_ride_queue_end(loc);
+        StationQueues::SetQueueEnd(ride->id, closestStationNum, entranceLoc, loc);
+    }
 
     gPeepPathFindGoalPosition = loc;
     gPeepPathFindIgnoreForeignQueues = true;
@@ -14,10 +14,12 @@
 #include "../Game.h"
 #include "../Input.h"
 #include "../OpenRCT2.h"
+#include "../ReplayManager.h"
 #include "../audio/AudioMixer.h"
 #include "../audio/audio.h"
 #include "../config/Config.h"
 #include "../core/Guard.hpp"
+#include "../interface/Viewport.h"
 #include "../interface/Window.h"
 #include "../localisation/Localisation.h"
 #include "../management/Finance.h"
@@ -28,6 +30,7 @@
 #include "../ride/RideData.h"
 #include "../ride/ShopItem.h"
 #include "../ride/Station.h"
+#include "../ride/StationQueues.h"
 #include "../ride/Track.h"
 #include "../scenario/Scenario.h"
 #include "../sprites.h"
@@ -39,6 +42,7 @@
 #include "../world/LargeScenery.h"
 #include "../world/Map.h"
 #include "../world/Park.h"
+#include "../world/ParkStatistics.h"
 #include "../world/Scenery.h"
 #include "../world/SmallScenery.h"
 #include "../world/Sprite.h"
@@ -46,6 +50,7 @@
 #include "Staff.h"
 
 #include <algorithm>
+#include <array>
 #include <iterator>
 #include <limits>
 
@@ -73,12 +78,23 @@ bool gPeepPathFindIgnoreForeignQueues;
 ride_id_t gPeepPathFindQueueRideIndex;
 // uint32_t gPeepPathFindAltStationNum;
 
+bool gGuestLevelOfDetail = false;
+
+// Guests nobody is watching are updated once every this many ticks when gGuestLevelOfDetail is set.
+constexpr uint8_t GUEST_LOD_INTERVAL = 4;
+
+// The ticks each guest has not been updated for yet.
+static std::array<uint8_t, MAX_SPRITES> _guestTicksBehind;
+
 static uint8_t _unk_F1AEF0;
 static TileElement* _peepRideEntranceExitElement;
 
 static void* _crowdSoundChannel = nullptr;
 
 static void peep_128_tick_update(Peep* peep, int32_t index);
+static bool peep_update_level_of_detail(Peep* peep);
+static void peep_catch_up(Peep* peep);
+static bool peep_level_of_detail_allowed();
 static void peep_release_balloon(Guest* peep, int16_t spawn_height);
 // clang-format off
 
@@ -411,6 +427,8 @@ void peep_update_all()
     if (gScreenFlags & SCREEN_FLAGS_EDITOR)
         return;
 
+    bool levelOfDetail = gGuestLevelOfDetail && peep_level_of_detail_allowed();
+
     spriteIndex = gSpriteListHead[SPRITE_LIST_PEEP];
     i = 0;
     while (spriteIndex != SPRITE_INDEX_NULL)
@@ -420,21 +438,138 @@ void peep_update_all()
 
         if ((uint32_t)(i & 0x7F) != (gCurrentTicks & 0x7F))
         {
-            peep->Update();
+            if (!levelOfDetail || !peep_update_level_of_detail(peep))
+            {
+                peep->Update();
+            }
         }
         else
         {
-            peep_128_tick_update(peep, i);
+            peep_catch_up(peep);
+            if (peep->linked_list_index == SPRITE_LIST_PEEP)
+            {
+                peep_128_tick_update(peep, i);
+            }
             if (peep->linked_list_index == SPRITE_LIST_PEEP)
             {
                 peep->Update();
             }
         }
 
+        // The guest may have left or been removed during the update.
+        ParkStatistics::UpdateGuest(peep);
+
         i++;
     }
 }
 
+void peep_reset_level_of_detail()
+{
+    _guestTicksBehind.fill(0);
+}
+
+/**
+ * Which guests are watched depends on the viewports, so the level of detail is only used when there are none. It is not
+ * used in network games or while a replay or trajectory is recorded or played either, as those need every run of the
+ * same actions to give the same park.
+ */
+static bool peep_level_of_detail_allowed()
+{
+    if (!gOpenRCT2Headless || network_get_mode() != NETWORK_MODE_NONE)
+        return false;
+
+    auto context = OpenRCT2::GetContext();
+    auto replayManager = context != nullptr ? context->GetReplayManager() : nullptr;
+    return replayManager == nullptr
+        || (!replayManager->IsRecording() && !replayManager->IsReplaying() && !replayManager->IsRecordingTrajectory()
+            && !replayManager->IsPlayingTrajectory());
+}
+
+void peep_catch_up_all()
+{
+    // The next sprite is read first as a guest can leave the park while catching up.
+    uint16_t spriteIndex = gSpriteListHead[SPRITE_LIST_PEEP];
+    while (spriteIndex != SPRITE_INDEX_NULL)
+    {
+        auto peep = &(get_sprite(spriteIndex)->peep);
+        spriteIndex = peep->next;
+        peep_catch_up(peep);
+        ParkStatistics::UpdateGuest(peep);
+    }
+}
+
+/**
+ * Whether the peep can be seen in any of the viewports.
+ */
+static bool peep_is_watched(const Peep* peep)
+{
+    if (peep->sprite_left == LOCATION_NULL)
+        return false;
+
+    for (int32_t i = 0; i < MAX_VIEWPORT_COUNT; i++)
+    {
+        const rct_viewport* viewport = &g_viewport_list[i];
+        if (viewport->width == 0 || viewport->visibility == VC_COVERED)
+            continue;
+
+        if (peep->sprite_right > viewport->viewPos.x && peep->sprite_bottom > viewport->viewPos.y
+            && peep->sprite_left < viewport->viewPos.x + viewport->view_width
+            && peep->sprite_top < viewport->viewPos.y + viewport->view_height)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Guests that nobody is watching and that are walking, queuing or on a ride are only updated every GUEST_LOD_INTERVAL
+ * ticks, staggered by their sprite index, and then catch up on the ticks they missed in one go. Returns false when the
+ * peep has to be updated as usual this tick.
+ */
+static bool peep_update_level_of_detail(Peep* peep)
+{
+    auto guest = peep->AsGuest();
+    if (guest == nullptr || guest->sprite_index >= MAX_SPRITES)
+        return false;
+
+    bool steady = guest->state == PEEP_STATE_WALKING || guest->state == PEEP_STATE_QUEUING
+        || guest->state == PEEP_STATE_ON_RIDE;
+    if (!steady || peep_is_watched(guest))
+    {
+        peep_catch_up(guest);
+        return guest->linked_list_index != SPRITE_LIST_PEEP;
+    }
+
+    auto& ticksBehind = _guestTicksBehind[guest->sprite_index];
+    ticksBehind++;
+    if (((guest->sprite_index + gCurrentTicks) % GUEST_LOD_INTERVAL) == 0)
+    {
+        uint8_t ticks = ticksBehind;
+        ticksBehind = 0;
+        guest->UpdateCoarse(ticks);
+    }
+    return true;
+}
+
+/**
+ * Updates the peep for the ticks it has missed while it was updated less often.
+ */
+static void peep_catch_up(Peep* peep)
+{
+    if (peep->sprite_index >= MAX_SPRITES)
+        return;
+
+    auto& ticksBehind = _guestTicksBehind[peep->sprite_index];
+    auto guest = peep->AsGuest();
+    if (ticksBehind != 0 && guest != nullptr)
+    {
+        uint8_t ticks = ticksBehind;
+        ticksBehind = 0;
+        guest->UpdateCoarse(ticks);
+    }
+}
+
 /**
  *
  *  rct2: 0x0068F41A
@@ -832,6 +967,10 @@ void peep_sprite_remove(Peep* peep)
 
     if (peep->type == PEEP_TYPE_GUEST)
     {
+        if (peep->sprite_index < MAX_SPRITES)
+        {
+            _guestTicksBehind[peep->sprite_index] = 0;
+        }
         window_invalidate_by_class(WC_GUEST_LIST);
 
         news_item_disable_news(NEWS_ITEM_PEEP_ON_RIDE, peep->sprite_index);
@@ -1095,34 +1234,44 @@ static void peep_update_thoughts(Peep* peep)
     }
 }
 
-/**
- *
- *  rct2: 0x0068FC1E
- */
-void Peep::Update()
+static void peep_update_time_outs(Peep* peep)
 {
-    if (type == PEEP_TYPE_GUEST)
-    {
-        if (previous_ride != RIDE_ID_NULL)
-            if (++previous_ride_time_out >= 720)
-                previous_ride = RIDE_ID_NULL;
+    if (peep->previous_ride != RIDE_ID_NULL)
+        if (++peep->previous_ride_time_out >= 720)
+            peep->previous_ride = RIDE_ID_NULL;
 
-        peep_update_thoughts(this);
-    }
+    peep_update_thoughts(peep);
+}
 
-    // Walking speed logic
-    uint32_t stepsToTake = energy;
-    if (stepsToTake < 95 && state == PEEP_STATE_QUEUING)
+// Walking speed logic
+static uint32_t peep_get_steps_to_take(const Peep* peep)
+{
+    uint32_t stepsToTake = peep->energy;
+    if (stepsToTake < 95 && peep->state == PEEP_STATE_QUEUING)
         stepsToTake = 95;
-    if ((peep_flags & PEEP_FLAGS_SLOW_WALK) && state != PEEP_STATE_QUEUING)
+    if ((peep->peep_flags & PEEP_FLAGS_SLOW_WALK) && peep->state != PEEP_STATE_QUEUING)
         stepsToTake /= 2;
-    if (action == PEEP_ACTION_NONE_2 && (GetNextIsSloped()))
+    if (peep->action == PEEP_ACTION_NONE_2 && (peep->GetNextIsSloped()))
     {
         stepsToTake /= 2;
-        if (state == PEEP_STATE_QUEUING)
+        if (peep->state == PEEP_STATE_QUEUING)
             stepsToTake += stepsToTake / 2;
     }
+    return stepsToTake;
+}
+
+/**
+ *
+ *  rct2: 0x0068FC1E
+ */
+void Peep::Update()
+{
+    if (type == PEEP_TYPE_GUEST)
+    {
+        peep_update_time_outs(this);
+    }
 
+    uint32_t stepsToTake = peep_get_steps_to_take(this);
     uint32_t carryCheck = step_progress + stepsToTake;
     step_progress = carryCheck;
     if (carryCheck <= 255)
@@ -1175,6 +1324,32 @@ void Peep::Update()
     }
 }
 
+/**
+ * Updates the guest for several ticks at once. Steps that only take the guest further along the tile it is on are made
+ * without a full update, any other step is a full update so the guest still decides where to go exactly as it would
+ * otherwise.
+ */
+void Guest::UpdateCoarse(uint8_t ticks)
+{
+    for (uint8_t i = 0; i < ticks; i++)
+    {
+        uint32_t carryCheck = step_progress + peep_get_steps_to_take(this);
+        if (carryCheck > 255 && state == PEEP_STATE_WALKING && UpdateWalkingStraight())
+        {
+            step_progress = carryCheck;
+            peep_update_time_outs(this);
+        }
+        else
+        {
+            Update();
+
+            // The guest may have left the park.
+            if (linked_list_index != SPRITE_LIST_PEEP)
+                break;
+        }
+    }
+}
+
 /**
  *
  *  rct2: 0x0069BF41
@@ -1603,6 +1778,7 @@ void Peep::InsertNewThought(PeepThoughtType thoughtType, uint8_t thoughtArgument
     thoughts[0].fresh_timeout = 0;
 
     window_invalidate_flags |= PEEP_INVALIDATE_PEEP_THOUGHTS;
+    ParkStatistics::UpdateGuest(this);
 }
 
 /**
@@ -2423,6 +2599,8 @@ static void peep_interact_with_entrance(Peep* peep, int16_t x, int16_t y, TileEl
         ride->stations[stationNum].LastPeepInQueue = peep->sprite_index;
         peep->next_in_queue = previous_last;
         ride->stations[stationNum].QueueLength++;
+        StationQueues::SetGuestBehind(previous_last, peep->sprite_index);
+        StationQueues::SetGuestBehind(peep->sprite_index, SPRITE_INDEX_NULL);
 
         peep->current_ride = rideIndex;
         peep->current_ride_station = stationNum;
@@ -2849,6 +3027,8 @@ static void peep_interact_with_path(Peep* peep, int16_t x, int16_t y, TileElemen
                     ride->stations[stationNum].LastPeepInQueue = peep->sprite_index;
                     peep->next_in_queue = old_last_peep;
                     ride->stations[stationNum].QueueLength++;
+                    StationQueues::SetGuestBehind(old_last_peep, peep->sprite_index);
+                    StationQueues::SetGuestBehind(peep->sprite_index, SPRITE_INDEX_NULL);
 
                     peep_decrement_num_riders(peep);
                     peep->current_ride = rideIndex;
@@ -3413,6 +3593,17 @@ void Peep::RemoveFromQueue()
     if (sprite_index == station.LastPeepInQueue)
     {
         station.LastPeepInQueue = next_in_queue;
+        StationQueues::SetGuestBehind(next_in_queue, SPRITE_INDEX_NULL);
+        return;
+    }
+
+    // The guest behind is only trusted while it is still queuing for the same station and linked to this guest.
+    Peep* behind = try_get_guest(StationQueues::GetGuestBehind(sprite_index));
+    if (behind != nullptr && behind->next_in_queue == sprite_index && behind->state == PEEP_STATE_QUEUING
+        && behind->current_ride == current_ride && behind->current_ride_station == current_ride_station)
+    {
+        behind->next_in_queue = next_in_queue;
+        StationQueues::SetGuestBehind(next_in_queue, behind->sprite_index);
         return;
     }
 
@@ -3423,6 +3614,7 @@ void Peep::RemoveFromQueue()
         if (sprite_index == other_peep->next_in_queue)
         {
             other_peep->next_in_queue = next_in_queue;
+            StationQueues::SetGuestBehind(next_in_queue, spriteId);
             return;
         }
         spriteId = other_peep->next_in_queue;
@@ -744,6 +744,7 @@ struct Guest : Peep
 {
 public:
     void UpdateGuest();
+    void UpdateCoarse(uint8_t ticks);
     void Tick128UpdateGuest(int32_t index);
     bool HasItem(int32_t peepItem) const;
     bool HasFood() const;
@@ -788,6 +789,7 @@ private:
     void UpdateRide();
     void UpdateOnRide(){}; // TODO
     void UpdateWalking();
+    bool UpdateWalkingStraight();
     void UpdateQueuing();
     void UpdateSitting();
     void UpdateEnteringPark();
@@ -968,10 +970,16 @@ extern TileCoordsXYZ gPeepPathFindGoalPosition;
 extern bool gPeepPathFindIgnoreForeignQueues;
 extern ride_id_t gPeepPathFindQueueRideIndex;
 
+// Update guests nobody is watching a few ticks at a time in headless games, see peep_update_all.
+extern bool gGuestLevelOfDetail;
+
 Peep* try_get_guest(uint16_t spriteIndex);
 int32_t peep_get_staff_count();
 bool peep_can_be_picked_up(Peep* peep);
 void peep_update_all();
+void peep_reset_level_of_detail();
+// Brings every guest up to date, so the park can be saved or compared without the ticks guests are behind.
+void peep_catch_up_all();
 void peep_problem_warnings_update();
 void peep_stop_crowd_noise();
 void peep_update_crowd_noise();
@@ -1000,6 +1008,7 @@ void peep_reset_pathfind_goal(Peep* peep);
 
 bool is_valid_path_z_and_direction(TileElement* tileElement, int32_t currentZ, int32_t currentDirection);
 int32_t guest_path_finding(Guest* peep);
+void get_ride_queue_end(TileCoordsXYZ& loc);
 
 #if defined(DEBUG_LEVEL_1) && DEBUG_LEVEL_1
 #    define PATHFIND_DEBUG                                                                                                     \
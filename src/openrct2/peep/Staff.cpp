@@ -35,6 +35,7 @@
 #include "../world/Footpath.h"
 #include "../world/Scenery.h"
 #include "../world/SmallScenery.h"
+#include "../world/SpatialHash.h"
 #include "../world/Sprite.h"
 #include "../world/Surface.h"
 #include "Peep.h"
@@ -435,6 +436,11 @@ void staff_toggle_patrol_area(int32_t staffIndex, int32_t x, int32_t y)
     gStaffPatrolAreas[peepOffset + offset] ^= (1 << bitIndex);
 }
 
+static uint16_t staff_handyman_distance_to_litter(Peep* peep, Litter* litter)
+{
+    return abs(litter->x - peep->x) + abs(litter->y - peep->y) + abs(litter->z - peep->z) * 4;
+}
+
 /**
  *
  *  rct2: 0x006BFBE8
@@ -445,26 +451,46 @@ static uint8_t staff_handyman_direction_to_nearest_litter(Peep* peep)
 {
     uint16_t nearestLitterDist = (uint16_t)-1;
     Litter* nearestLitter = nullptr;
-    Litter* litter = nullptr;
-
-    for (uint16_t litterIndex = gSpriteListHead[SPRITE_LIST_LITTER]; litterIndex != 0xFFFF; litterIndex = litter->next)
-    {
-        litter = &get_sprite(litterIndex)->litter;
-
-        uint16_t distance = abs(litter->x - peep->x) + abs(litter->y - peep->y) + abs(litter->z - peep->z) * 4;
+    bool isTied = false;
 
+    // Only litter within 0x60 is picked, which is all on the nearby tiles.
+    auto checkLitter = [peep, &nearestLitterDist, &nearestLitter, &isTied](uint16_t litterIndex) {
+        Litter* litter = &get_sprite(litterIndex)->litter;
+        uint16_t distance = staff_handyman_distance_to_litter(peep, litter);
         if (distance < nearestLitterDist)
         {
             nearestLitterDist = distance;
             nearestLitter = litter;
+            isTied = false;
         }
-    }
+        else if (distance == nearestLitterDist)
+        {
+            isTied = true;
+        }
+    };
+    SpatialHash::ForEachInRadius(SpatialHash::Kind::Litter, { peep->x, peep->y }, 0x60, checkLitter);
 
     if (nearestLitterDist > 0x60)
     {
         return INVALID_DIRECTION;
     }
 
+    if (isTied)
+    {
+        // Equally near litter is picked in the order of the litter list.
+        Litter* litter = nullptr;
+        for (uint16_t litterIndex = gSpriteListHead[SPRITE_LIST_LITTER]; litterIndex != SPRITE_INDEX_NULL;
+             litterIndex = litter->next)
+        {
+            litter = &get_sprite(litterIndex)->litter;
+            if (staff_handyman_distance_to_litter(peep, litter) == nearestLitterDist)
+            {
+                nearestLitter = litter;
+                break;
+            }
+        }
+    }
+
     auto litterTile = CoordsXY{ nearestLitter->x, nearestLitter->y }.ToTileStart();
 
     if (!peep->AsStaff()->IsLocationInPatrol(litterTile))
@@ -14,6 +14,8 @@
 #include "SawyerChunk.h"
 
 #include <memory>
+#include <utility>
+#include <vector>
 
 interface IStream;
 
@@ -55,6 +57,14 @@ public:
      */
     void ReadChunk(void* dst, size_t length);
 
+    /**
+     * Reads the next chunks from the stream into the given destination buffers,
+     * each one is treated like ReadChunk(dst, length). The compressed data is
+     * read in order and then all chunks are decoded concurrently.
+     * @param destinations The destination buffer and its size for each chunk.
+     */
+    void ReadChunks(const std::vector<std::pair<void*, size_t>>& destinations);
+
     /**
      * Reads the next chunk from the stream into a buffer returned as the
      * specified type. If the chunk is smaller than the size of the type
@@ -68,6 +78,9 @@ public:
     }
 
 private:
+    std::unique_ptr<uint8_t[]> ReadCompressedChunk(sawyercoding_chunk_header& header);
+    static void CopyChunkData(void* dst, size_t length, const void* chunkData, size_t chunkLength);
+
     static size_t DecodeChunk(void* dst, size_t dstCapacity, const void* src, const sawyercoding_chunk_header& header);
     static size_t DecodeChunkRLERepeat(void* dst, size_t dstCapacity, const void* src, size_t srcLength);
     static size_t DecodeChunkRLE(void* dst, size_t dstCapacity, const void* src, size_t srcLength);
@@ -13,6 +13,7 @@
 #include "../Game.h"
 #include "../GameState.h"
 #include "../OpenRCT2.h"
+#include "../ParkSnapshot.h"
 #include "../common.h"
 #include "../config/Config.h"
 #include "../core/FileStream.hpp"
@@ -48,9 +49,12 @@
 #include "../world/Sprite.h"
 
 #include <algorithm>
+#include <chrono>
 #include <cstring>
 #include <functional>
+#include <future>
 #include <iterator>
+#include <memory>
 #include <optional>
 
 S6Exporter::S6Exporter()
@@ -81,6 +85,41 @@ void S6Exporter::SaveScenario(IStream* stream)
     Save(stream, true);
 }
 
+void S6Exporter::SaveSnapshot(const utf8* path)
+{
+    auto fs = FileStream(path, FILE_MODE_WRITE);
+    SaveSnapshot(&fs);
+}
+
+/**
+ * Writes a park snapshot, ExportSnapshot has to be called first. Packed objects are not included, the objects have to
+ * be available when the snapshot is loaded again.
+ */
+void S6Exporter::SaveSnapshot(IStream* stream)
+{
+    _s6.header.type = S6_TYPE_SAVEDGAME;
+    _s6.header.classic_flag = 0;
+    _s6.header.num_packed_objects = 0;
+    _s6.header.version = S6_RCT2_VERSION;
+    _s6.header.magic_number = S6_MAGIC_NUMBER;
+    _s6.game_version_number = 201028;
+
+    ParkSnapshotWriter writer;
+    for (const auto& range : ParkSnapshot::GetS6Ranges(_s6))
+    {
+        writer.AddSection(range.Id, range.Data, 1, range.Length);
+    }
+    writer.AddSection(
+        ParkSnapshot::SectionId::TileElements, _snapshotTileElements.data(), sizeof(TileElement),
+        _snapshotTileElements.size());
+    writer.AddSection(
+        ParkSnapshot::SectionId::Sprites, _snapshotSprites.data(), sizeof(rct_sprite), _snapshotSprites.size());
+    writer.AddSection(
+        ParkSnapshot::SectionId::SpriteLists, _snapshotSpriteLists.data(), sizeof(uint16_t), _snapshotSpriteLists.size());
+    writer.AddSection(ParkSnapshot::SectionId::PeepNames, _snapshotPeepNames.data(), 1, _snapshotPeepNames.size());
+    writer.Write(stream);
+}
+
 void S6Exporter::Save(IStream* stream, bool isScenario)
 {
     _s6.header.type = isScenario ? S6_TYPE_SCENARIO : S6_TYPE_SAVEDGAME;
@@ -149,8 +188,21 @@ void S6Exporter::Save(IStream* stream, bool isScenario)
     stream->WriteValue(checksum);
 }
 
+/**
+ * Same as Export, but keeps the map and sprites in their native layout for SaveSnapshot.
+ */
+void S6Exporter::ExportSnapshot()
+{
+    _isSnapshot = true;
+    Export();
+}
+
 void S6Exporter::Export()
 {
+    // The live guests are caught up rather than a copy, catching up also moves them in ride queues and vehicles, and the
+    // game has to carry on from the saved park for replays and clients to match it.
+    peep_catch_up_all();
+
     int32_t spatial_cycle = check_for_spatial_index_cycles(false);
     int32_t regular_cycle = check_for_sprite_list_cycles(false);
     int32_t disjoint_sprites_count = fix_disjoint_sprites();
@@ -198,8 +250,15 @@ void S6Exporter::Export()
 
     // Map elements must be reorganised prior to saving otherwise save may be invalid
     map_reorganise_elements();
-    ExportTileElements();
-    ExportSprites();
+    if (_isSnapshot)
+    {
+        ExportSnapshotSprites();
+    }
+    else
+    {
+        ExportTileElements();
+        ExportSprites();
+    }
     ExportParkName();
 
     _s6.initial_cash = gInitialCash;
@@ -423,7 +482,15 @@ void S6Exporter::Export()
         scenario_remove_trackless_rides(&_s6);
     }
 
-    scenario_fix_ghosts(&_s6);
+    if (_isSnapshot)
+    {
+        // Needs the exported banners, as it removes those of ghost elements like scenario_fix_ghosts does
+        ExportSnapshotTileElements();
+    }
+    else
+    {
+        scenario_fix_ghosts(&_s6);
+    }
     game_convert_strings_to_rct2(&_s6);
 
     ExportUserStrings();
@@ -953,6 +1020,34 @@ void S6Exporter::ExportSprites()
     }
 }
 
+/**
+ * Copies all sprites as they are. Peep names live on the heap, so they are stored separately as a list of
+ * sprite index, name length and name.
+ */
+void S6Exporter::ExportSnapshotSprites()
+{
+    sprite_clear_all_unused();
+    _snapshotSprites.resize(MAX_SPRITES);
+    _snapshotPeepNames.clear();
+    for (uint16_t i = 0; i < MAX_SPRITES; i++)
+    {
+        auto& sprite = _snapshotSprites[i];
+        sprite = *get_sprite(i);
+        if (sprite.generic.sprite_identifier == SPRITE_IDENTIFIER_PEEP && sprite.peep.name != nullptr)
+        {
+            auto nameLength = static_cast<uint16_t>(std::min<size_t>(std::strlen(sprite.peep.name), UINT16_MAX));
+            uint8_t entry[4] = { static_cast<uint8_t>(i), static_cast<uint8_t>(i >> 8), static_cast<uint8_t>(nameLength),
+                                 static_cast<uint8_t>(nameLength >> 8) };
+            _snapshotPeepNames.insert(_snapshotPeepNames.end(), std::begin(entry), std::end(entry));
+            _snapshotPeepNames.insert(_snapshotPeepNames.end(), sprite.peep.name, sprite.peep.name + nameLength);
+            sprite.peep.name = nullptr;
+        }
+    }
+
+    _snapshotSpriteLists.assign(std::begin(gSpriteListHead), std::end(gSpriteListHead));
+    _snapshotSpriteLists.insert(_snapshotSpriteLists.end(), std::begin(gSpriteListCount), std::end(gSpriteListCount));
+}
+
 void S6Exporter::ExportSprite(RCT2Sprite* dst, const rct_sprite* src)
 {
     std::memset(dst, 0, sizeof(rct_sprite));
@@ -1427,6 +1522,43 @@ void S6Exporter::ExportTileElements()
     _s6.next_free_tile_element_pointer_index = gNextFreeTileElementPointerIndex;
 }
 
+/**
+ * Copies the map without its ghost elements, the native equivalent of ExportTileElements followed by scenario_fix_ghosts.
+ */
+void S6Exporter::ExportSnapshotTileElements()
+{
+    _snapshotTileElements.clear();
+    _snapshotTileElements.reserve(gNextFreeTileElement - gTileElements);
+    for (auto tileElement = gTileElements; tileElement < gNextFreeTileElement; tileElement++)
+    {
+        if (tileElement->IsGhost())
+        {
+            auto bannerIndex = tile_element_get_banner_index(tileElement);
+            if (bannerIndex < RCT2_MAX_BANNERS_IN_PARK)
+            {
+                auto banner = &_s6.banners[bannerIndex];
+                if (banner->type != BANNER_NULL)
+                {
+                    banner->type = BANNER_NULL;
+                    if (is_user_string_id(banner->string_idx))
+                        _s6.custom_strings[(banner->string_idx % RCT12_MAX_USER_STRINGS)][0] = 0;
+                }
+            }
+        }
+        else
+        {
+            _snapshotTileElements.push_back(*tileElement);
+        }
+
+        // Set last element flag in case the original last element was a ghost
+        if (tileElement->IsLastForTile() && !_snapshotTileElements.empty())
+        {
+            _snapshotTileElements.back().SetLastForTile(true);
+        }
+    }
+    _s6.next_free_tile_element_pointer_index = gNextFreeTileElementPointerIndex;
+}
+
 void S6Exporter::ExportTileElement(RCT12TileElement* dst, TileElement* src)
 {
     // Todo: allow for changing defition of OpenRCT2 tile element types - replace with a map
@@ -1673,12 +1805,20 @@ enum : uint32_t
     S6_SAVE_FLAG_AUTOMATIC = 1u << 31,
 };
 
+struct PendingSave
+{
+    std::string Path;
+    std::future<bool> Result;
+    std::function<void(bool)> Callback;
+};
+
+// Only one save is written at a time so saves to the same path always complete in order.
+static std::optional<PendingSave> _pendingSave;
+
 /**
- *
- *  rct2: 0x006754F5
- * @param flags bit 0: pack objects, 1: save as scenario
+ * Captures the game state into an exporter, this is the part of saving that has to run on the game thread.
  */
-int32_t scenario_save(const utf8* path, int32_t flags)
+static std::unique_ptr<S6Exporter> scenario_save_prepare(const utf8* path, int32_t flags)
 {
     if (flags & S6_SAVE_FLAG_SCENARIO)
     {
@@ -1697,8 +1837,7 @@ int32_t scenario_save(const utf8* path, int32_t flags)
     map_reorganise_elements();
     viewport_set_saved_view();
 
-    bool result = false;
-    auto s6exporter = new S6Exporter();
+    auto s6exporter = std::make_unique<S6Exporter>();
     try
     {
         if (flags & S6_SAVE_FLAG_EXPORT)
@@ -1708,27 +1847,137 @@ int32_t scenario_save(const utf8* path, int32_t flags)
         }
         s6exporter->RemoveTracklessRides = true;
         s6exporter->Export();
+    }
+    catch (const std::exception& e)
+    {
+        log_error("Unable to save park: '%s'", e.what());
+        s6exporter = nullptr;
+    }
+
+    gfx_invalidate_screen();
+    return s6exporter;
+}
+
+/**
+ * Encodes the captured game state and writes it to disk, safe to run on any thread.
+ */
+static bool scenario_save_write(S6Exporter& s6exporter, const utf8* path, int32_t flags)
+{
+    try
+    {
         if (flags & S6_SAVE_FLAG_SCENARIO)
         {
-            s6exporter->SaveScenario(path);
+            s6exporter.SaveScenario(path);
         }
         else
         {
-            s6exporter->SaveGame(path);
+            s6exporter.SaveGame(path);
         }
-        result = true;
+        return true;
     }
     catch (const std::exception& e)
     {
         log_error("Unable to save park: '%s'", e.what());
+        return false;
     }
-    delete s6exporter;
-
-    gfx_invalidate_screen();
+}
 
+static void scenario_save_complete(bool result, int32_t flags)
+{
     if (result && !(flags & S6_SAVE_FLAG_AUTOMATIC))
     {
         gScreenAge = 0;
     }
+}
+
+/**
+ *
+ *  rct2: 0x006754F5
+ * @param flags bit 0: pack objects, 1: save as scenario
+ */
+int32_t scenario_save(const utf8* path, int32_t flags)
+{
+    scenario_save_async_flush();
+
+    bool result = false;
+    auto s6exporter = scenario_save_prepare(path, flags);
+    if (s6exporter != nullptr)
+    {
+        result = scenario_save_write(*s6exporter, path, flags);
+    }
+    scenario_save_complete(result, flags);
     return result;
 }
+
+/**
+ * Captures the game state immediately, then encodes and writes it on a background thread so the game does not
+ * stall on compression or disk access. The callback is invoked on the game thread once the file has been written.
+ * @return false if the game state could not be captured, the callback is not invoked in that case.
+ */
+bool scenario_save_async(const utf8* path, int32_t flags, std::function<void(bool)> callback)
+{
+    scenario_save_async_flush();
+
+    auto s6exporter = scenario_save_prepare(path, flags);
+    if (s6exporter == nullptr)
+    {
+        return false;
+    }
+
+    // Packed objects are read from the object repository while writing, which is not safe from another thread.
+    if (!s6exporter->ExportObjectsList.empty())
+    {
+        bool result = scenario_save_write(*s6exporter, path, flags);
+        scenario_save_complete(result, flags);
+        if (callback != nullptr)
+        {
+            callback(result);
+        }
+        return true;
+    }
+
+    std::string pathCopy = path;
+    auto completionCallback = [flags, callback = std::move(callback)](bool result) {
+        scenario_save_complete(result, flags);
+        if (callback != nullptr)
+        {
+            callback(result);
+        }
+    };
+    _pendingSave = PendingSave{ pathCopy,
+                                std::async(
+                                    std::launch::async,
+                                    [s6exporter = std::move(s6exporter), pathCopy, flags]() {
+                                        return scenario_save_write(*s6exporter, pathCopy.c_str(), flags);
+                                    }),
+                                std::move(completionCallback) };
+    return true;
+}
+
+/**
+ * Reports a finished background save, call regularly from the game thread.
+ */
+void scenario_save_async_update()
+{
+    if (_pendingSave.has_value()
+        && _pendingSave->Result.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+    {
+        scenario_save_async_flush();
+    }
+}
+
+/**
+ * Waits for the background save to finish, e.g. before loading a park or quitting.
+ */
+void scenario_save_async_flush()
+{
+    if (_pendingSave.has_value())
+    {
+        auto pendingSave = std::move(*_pendingSave);
+        _pendingSave.reset();
+
+        bool result = pendingSave.Result.get();
+        log_verbose("Finished saving %s", pendingSave.Path.c_str());
+        pendingSave.Callback(result);
+    }
+}
@@ -12,6 +12,7 @@
 #include "../common.h"
 #include "../object/ObjectList.h"
 #include "../scenario/Scenario.h"
+#include "../world/TileElement.h"
 
 #include <optional>
 #include <string>
@@ -38,7 +39,14 @@ public:
     void SaveGame(IStream* stream);
     void SaveScenario(const utf8* path);
     void SaveScenario(IStream* stream);
+    void SaveSnapshot(const utf8* path);
+    void SaveSnapshot(IStream* stream);
+    /**
+     * Copies the park into the save data. This changes the running park: guests behind because of the level of detail
+     * are caught up first, so the game carries on from exactly the park that is saved.
+     */
     void Export();
+    void ExportSnapshot();
     void ExportParkName();
     void ExportRides();
     void ExportRide(rct2_ride* dst, const Ride* src);
@@ -50,10 +58,25 @@ public:
     void ExportSpriteMisc(RCT12SpriteBase* dst, const SpriteBase* src);
     void ExportSpriteLitter(RCT12SpriteLitter* dst, const Litter* src);
 
+    /**
+     * The data written by the save functions, filled in by Export.
+     */
+    rct_s6_data& GetData()
+    {
+        return _s6;
+    }
+
 private:
     rct_s6_data _s6{};
     std::vector<std::string> _userStrings;
 
+    // Native copies of the map and sprites, only used when exporting a park snapshot
+    bool _isSnapshot = false;
+    std::vector<TileElement> _snapshotTileElements;
+    std::vector<rct_sprite> _snapshotSprites;
+    std::vector<uint16_t> _snapshotSpriteLists;
+    std::vector<uint8_t> _snapshotPeepNames;
+
     void Save(IStream* stream, bool isScenario);
     static uint32_t GetLoanHash(money32 initialCash, money32 bankLoan, uint32_t maxBankLoan);
     void ExportResearchedRideTypes();
@@ -72,6 +95,9 @@ private:
     void ExportTileElements();
     void ExportTileElement(RCT12TileElement* dst, TileElement* src);
 
+    void ExportSnapshotTileElements();
+    void ExportSnapshotSprites();
+
     std::optional<uint16_t> AllocateUserString(const std::string_view& value);
     void ExportUserStrings();
 };
@@ -13,6 +13,7 @@
 #include "../GameState.h"
 #include "../OpenRCT2.h"
 #include "../ParkImporter.h"
+#include "../ParkSnapshot.h"
 #include "../config/Config.h"
 #include "../core/Console.hpp"
 #include "../core/FileStream.hpp"
@@ -67,9 +68,14 @@ private:
     rct_s6_data _s6{};
     uint8_t _gameVersion = 0;
 
+    // Park snapshots only differ in how the map and sprites are stored, see ParkSnapshot.h
+    bool _isSnapshot = false;
+    std::unique_ptr<ParkSnapshotReader> _snapshot;
+
 public:
-    S6Importer(IObjectRepository& objectRepository)
+    S6Importer(IObjectRepository& objectRepository, bool isSnapshot = false)
         : _objectRepository(objectRepository)
+        , _isSnapshot(isSnapshot)
     {
     }
 
@@ -92,6 +98,14 @@ public:
 
     ParkLoadResult LoadSavedGame(const utf8* path, bool skipObjectCheck = false) override
     {
+        if (_isSnapshot)
+        {
+            // Mapping the file means only the pages that are copied from are ever read
+            auto result = LoadFromSnapshot(std::make_unique<ParkSnapshotReader>(path));
+            _s6Path = path;
+            return result;
+        }
+
         auto fs = FileStream(path, FILE_MODE_OPEN);
         auto result = LoadFromStream(&fs, false, skipObjectCheck);
         _s6Path = path;
@@ -100,6 +114,11 @@ public:
 
     ParkLoadResult LoadScenario(const utf8* path, bool skipObjectCheck = false) override
     {
+        if (_isSnapshot)
+        {
+            throw std::runtime_error("Park snapshots can not be loaded as scenarios.");
+        }
+
         auto fs = FileStream(path, FILE_MODE_OPEN);
         auto result = LoadFromStream(&fs, true, skipObjectCheck);
         _s6Path = path;
@@ -110,6 +129,17 @@ public:
         IStream* stream, bool isScenario, [[maybe_unused]] bool skipObjectCheck = false,
         const utf8* path = String::Empty) override
     {
+        if (_isSnapshot)
+        {
+            if (isScenario)
+            {
+                throw std::runtime_error("Park snapshots can not be loaded as scenarios.");
+            }
+            auto result = LoadFromSnapshot(std::make_unique<ParkSnapshotReader>(stream));
+            _s6Path = path;
+            return result;
+        }
+
         if (isScenario && !gConfigGeneral.allow_loading_with_incorrect_checksum && !SawyerEncoding::ValidateChecksum(stream))
         {
             throw IOException("Invalid checksum.");
@@ -147,26 +177,31 @@ public:
             _objectRepository.ExportPackedObject(stream);
         }
 
+        // The remaining chunks are independent of each other and decoded concurrently
         if (isScenario)
         {
-            chunkReader.ReadChunk(&_s6.objects, sizeof(_s6.objects));
-            chunkReader.ReadChunk(&_s6.elapsed_months, 16);
-            chunkReader.ReadChunk(&_s6.tile_elements, sizeof(_s6.tile_elements));
-            chunkReader.ReadChunk(&_s6.next_free_tile_element_pointer_index, 2560076);
-            chunkReader.ReadChunk(&_s6.guests_in_park, 4);
-            chunkReader.ReadChunk(&_s6.last_guests_in_park, 8);
-            chunkReader.ReadChunk(&_s6.park_rating, 2);
-            chunkReader.ReadChunk(&_s6.active_research_types, 1082);
-            chunkReader.ReadChunk(&_s6.current_expenditure, 16);
-            chunkReader.ReadChunk(&_s6.park_value, 4);
-            chunkReader.ReadChunk(&_s6.completed_company_value, 483816);
+            chunkReader.ReadChunks({
+                { &_s6.objects, sizeof(_s6.objects) },
+                { &_s6.elapsed_months, 16 },
+                { &_s6.tile_elements, sizeof(_s6.tile_elements) },
+                { &_s6.next_free_tile_element_pointer_index, 2560076 },
+                { &_s6.guests_in_park, 4 },
+                { &_s6.last_guests_in_park, 8 },
+                { &_s6.park_rating, 2 },
+                { &_s6.active_research_types, 1082 },
+                { &_s6.current_expenditure, 16 },
+                { &_s6.park_value, 4 },
+                { &_s6.completed_company_value, 483816 },
+            });
         }
         else
         {
-            chunkReader.ReadChunk(&_s6.objects, sizeof(_s6.objects));
-            chunkReader.ReadChunk(&_s6.elapsed_months, 16);
-            chunkReader.ReadChunk(&_s6.tile_elements, sizeof(_s6.tile_elements));
-            chunkReader.ReadChunk(&_s6.next_free_tile_element_pointer_index, 3048816);
+            chunkReader.ReadChunks({
+                { &_s6.objects, sizeof(_s6.objects) },
+                { &_s6.elapsed_months, 16 },
+                { &_s6.tile_elements, sizeof(_s6.tile_elements) },
+                { &_s6.next_free_tile_element_pointer_index, 3048816 },
+            });
         }
 
         _s6Path = path;
@@ -174,6 +209,27 @@ public:
         return ParkLoadResult(GetRequiredObjects());
     }
 
+    ParkLoadResult LoadFromSnapshot(std::unique_ptr<ParkSnapshotReader> snapshot)
+    {
+        for (const auto& range : ParkSnapshot::GetS6Ranges(_s6))
+        {
+            size_t length;
+            auto data = snapshot->GetSection<uint8_t>(range.Id, &length);
+            if (length != range.Length)
+            {
+                throw IOException("Park snapshot was written by an incompatible version.");
+            }
+            std::memcpy(range.Data, data, length);
+        }
+        if (_s6.header.type != S6_TYPE_SAVEDGAME)
+        {
+            throw std::runtime_error("Park is not a saved game.");
+        }
+
+        _snapshot = std::move(snapshot);
+        return ParkLoadResult(GetRequiredObjects());
+    }
+
     bool GetDetails(scenario_index_entry* dst) override
     {
         *dst = {};
@@ -215,8 +271,16 @@ public:
 
         scenario_rand_seed(_s6.scenario_srand_0, _s6.scenario_srand_1);
 
-        ImportTileElements();
-        ImportSprites();
+        if (_snapshot != nullptr)
+        {
+            ImportSnapshotTileElements();
+            ImportSnapshotSprites();
+        }
+        else
+        {
+            ImportTileElements();
+            ImportSprites();
+        }
 
         gInitialCash = _s6.initial_cash;
         gBankLoan = _s6.current_loan;
@@ -991,13 +1055,15 @@ public:
     void ImportNumRiders(Ride* dst, const ride_id_t rideIndex)
     {
         // The number of riders might have overflown or underflown. Re-calculate the value.
+        // The sprites have already been imported at this point, which also covers park snapshots.
         uint16_t numRiders = 0;
-        for (const auto& sprite : _s6.sprites)
+        for (uint16_t i = 0; i < MAX_SPRITES; i++)
         {
-            if (sprite.unknown.sprite_identifier == SPRITE_IDENTIFIER_PEEP)
+            auto sprite = get_sprite(i);
+            if (sprite->generic.sprite_identifier == SPRITE_IDENTIFIER_PEEP)
             {
-                if (sprite.peep.current_ride == rideIndex
-                    && (sprite.peep.state == PEEP_STATE_ON_RIDE || sprite.peep.state == PEEP_STATE_ENTERING_RIDE))
+                if (sprite->peep.current_ride == rideIndex
+                    && (sprite->peep.state == PEEP_STATE_ON_RIDE || sprite->peep.state == PEEP_STATE_ENTERING_RIDE))
                 {
                     numRiders++;
                 }
@@ -1031,6 +1097,25 @@ public:
         gNextFreeTileElementPointerIndex = _s6.next_free_tile_element_pointer_index;
     }
 
+    void ImportSnapshotTileElements()
+    {
+        size_t count;
+        auto tileElements = _snapshot->GetSection<TileElement>(ParkSnapshot::SectionId::TileElements, &count);
+
+        // Every tile has to end with a last element, otherwise the tile pointers would run past the map
+        size_t numTiles = std::count_if(
+            tileElements, tileElements + count, [](const TileElement& element) { return element.IsLastForTile(); });
+        if (count > MAX_TILE_ELEMENTS || numTiles != MAXIMUM_MAP_SIZE_TECHNICAL * MAXIMUM_MAP_SIZE_TECHNICAL
+            || !tileElements[count - 1].IsLastForTile())
+        {
+            throw IOException("Park snapshot map is corrupt.");
+        }
+
+        std::memcpy(gTileElements, tileElements, count * sizeof(TileElement));
+        std::memset(gTileElements + count, 0, (std::size(gTileElements) - count) * sizeof(TileElement));
+        gNextFreeTileElementPointerIndex = _s6.next_free_tile_element_pointer_index;
+    }
+
     void ImportTileElement(TileElement* dst, const RCT12TileElement* src)
     {
         // Todo: allow for changing defition of OpenRCT2 tile element types - replace with a map
@@ -1280,6 +1365,53 @@ public:
         gSpriteListCount[SPRITE_LIST_FREE] += (MAX_SPRITES - RCT2_MAX_SPRITES);
     }
 
+    void ImportSnapshotSprites()
+    {
+        size_t count;
+        auto sprites = _snapshot->GetSection<rct_sprite>(ParkSnapshot::SectionId::Sprites, &count);
+        size_t spriteListsCount;
+        auto spriteLists = _snapshot->GetSection<uint16_t>(ParkSnapshot::SectionId::SpriteLists, &spriteListsCount);
+        if (count != MAX_SPRITES || spriteListsCount != SPRITE_LIST_COUNT * 2)
+        {
+            throw IOException("Park snapshot was written by an incompatible version.");
+        }
+
+        for (uint16_t i = 0; i < MAX_SPRITES; i++)
+        {
+            *get_sprite(i) = sprites[i];
+        }
+        for (int32_t i = 0; i < SPRITE_LIST_COUNT; i++)
+        {
+            gSpriteListHead[i] = spriteLists[i];
+            gSpriteListCount[i] = spriteLists[SPRITE_LIST_COUNT + i];
+        }
+
+        size_t namesLength;
+        auto names = _snapshot->GetSection<uint8_t>(ParkSnapshot::SectionId::PeepNames, &namesLength);
+        size_t offset = 0;
+        while (offset + 4 <= namesLength)
+        {
+            uint16_t spriteIndex = names[offset] | (names[offset + 1] << 8);
+            uint16_t nameLength = names[offset + 2] | (names[offset + 3] << 8);
+            offset += 4;
+            if (spriteIndex >= MAX_SPRITES || nameLength > namesLength - offset)
+            {
+                break;
+            }
+
+            auto sprite = get_sprite(spriteIndex);
+            if (sprite->generic.sprite_identifier == SPRITE_IDENTIFIER_PEEP)
+            {
+                sprite->peep.SetName(std::string_view(reinterpret_cast<const char*>(names + offset), nameLength));
+            }
+            offset += nameLength;
+        }
+        if (offset != namesLength)
+        {
+            throw IOException("Park snapshot peep names are corrupt.");
+        }
+    }
+
     void ImportSprite(rct_sprite* dst, const RCT2Sprite* src)
     {
         std::memset(&dst->pad_00, 0, sizeof(rct_sprite));
@@ -1665,6 +1797,11 @@ std::unique_ptr<IParkImporter> ParkImporter::CreateS6(IObjectRepository& objectR
     return std::make_unique<S6Importer>(objectRepository);
 }
 
+std::unique_ptr<IParkImporter> ParkImporter::CreateParkSnapshot(IObjectRepository& objectRepository)
+{
+    return std::make_unique<S6Importer>(objectRepository, true);
+}
+
 static void show_error(uint8_t errorType, rct_string_id errorStringId)
 {
     if (errorType == ERROR_TYPE_GENERIC)
@@ -52,6 +52,7 @@
 #include "../world/MapAnimation.h"
 #include "../world/Park.h"
 #include "../world/Scenery.h"
+#include "../world/SpatialHash.h"
 #include "../world/Sprite.h"
 #include "CableLift.h"
 #include "MusicList.h"
@@ -59,6 +60,7 @@
 #include "RideGroupManager.h"
 #include "ShopItem.h"
 #include "Station.h"
+#include "StationQueues.h"
 #include "Track.h"
 #include "TrackData.h"
 #include "TrackDesign.h"
@@ -77,6 +79,9 @@ static constexpr const int32_t RideInspectionInterval[] = {
     10, 20, 30, 45, 60, 120, 0, 0,
 };
 
+// How far around a ride the nearby tiles are searched for a mechanic before going through all the staff.
+static constexpr const int32_t MECHANIC_SEARCH_DISTANCE = 32 * COORDS_XY_STEP;
+
 static std::vector<Ride> _rides;
 
 bool gGotoStartPlacementMode = false;
@@ -266,6 +271,39 @@ int32_t Ride::GetMaxQueueTime() const
     return (int32_t)queueTime;
 }
 
+/**
+ * How long a guest joining the queues now would wait, in the same minutes as the measured queue time. The guests queuing
+ * are divided by the customers the ride has had recently. The result is blended with the measured queue time, weighted
+ * by how many customers there have been, so it does not jump when the first customer is counted.
+ */
+int32_t Ride::GetEstimatedQueueTime() const
+{
+    // A minute of queue time is a day in the queue (peep_update_days_in_queue), a month is 0x10000 / 4 ticks.
+    constexpr uint64_t QUEUE_TIME_MINUTE_TICKS = (0x10000 / 4) / 31;
+    constexpr uint64_t CUSTOMER_INTERVAL_TICKS = 960;
+    // How many customers the measured queue time counts as.
+    constexpr uint64_t MEASURED_QUEUE_TIME_WEIGHT = 8;
+
+    int32_t queueLength = GetTotalQueueLength();
+    if (queueLength == 0)
+        return 0;
+
+    uint64_t customers = cur_num_customers;
+    for (auto intervalCustomers : num_customers)
+    {
+        customers += intervalCustomers;
+    }
+    uint64_t measuredQueueTime = GetMaxQueueTime();
+    if (customers == 0)
+        return (int32_t)measuredQueueTime;
+
+    uint64_t historyTicks = CUSTOMER_HISTORY_SIZE * CUSTOMER_INTERVAL_TICKS + num_customers_timeout;
+    uint64_t waitTicks = queueLength * historyTicks / customers;
+    uint64_t queueTime = std::min<uint64_t>(waitTicks / QUEUE_TIME_MINUTE_TICKS, 255);
+    return (int32_t)((queueTime * customers + measuredQueueTime * MEASURED_QUEUE_TIME_WEIGHT)
+                     / (customers + MEASURED_QUEUE_TIME_WEIGHT));
+}
+
 Peep* Ride::GetQueueHeadGuest(StationIndex stationIndex) const
 {
     Peep* peep;
@@ -302,10 +340,12 @@ void Ride::QueueInsertGuestAtFront(StationIndex stationIndex, Peep* peep)
     if (queueHeadGuest == nullptr)
     {
         stations[peep->current_ride_station].LastPeepInQueue = peep->sprite_index;
+        StationQueues::SetGuestBehind(peep->sprite_index, SPRITE_INDEX_NULL);
     }
     else
     {
         queueHeadGuest->next_in_queue = peep->sprite_index;
+        StationQueues::SetGuestBehind(peep->sprite_index, queueHeadGuest->sprite_index);
     }
     UpdateQueueLength(peep->current_ride_station);
 }
@@ -2665,6 +2705,37 @@ Peep* ride_find_closest_mechanic(Ride* ride, int32_t forInspection)
     return find_closest_mechanic(centreMapLocation.x, centreMapLocation.y, forInspection);
 }
 
+static bool mechanic_can_be_called(Peep* peep, const CoordsXY& location, int32_t forInspection)
+{
+    if (peep->staff_type != STAFF_TYPE_MECHANIC)
+        return false;
+
+    if (!forInspection)
+    {
+        if (peep->state == PEEP_STATE_HEADING_TO_INSPECTION)
+        {
+            if (peep->sub_state >= 4)
+                return false;
+        }
+        else if (peep->state != PEEP_STATE_PATROLLING)
+            return false;
+
+        if (!(peep->staff_orders & STAFF_ORDERS_FIX_RIDES))
+            return false;
+    }
+    else
+    {
+        if (peep->state != PEEP_STATE_PATROLLING || !(peep->staff_orders & STAFF_ORDERS_INSPECT_RIDES))
+            return false;
+    }
+
+    if (map_is_location_in_park(location))
+        if (!peep->AsStaff()->IsLocationInPatrol(location))
+            return false;
+
+    return peep->x != LOCATION_NULL;
+}
+
 /**
  *
  *  rct2: 0x006B774B (forInspection = 0)
@@ -2672,6 +2743,19 @@ Peep* ride_find_closest_mechanic(Ride* ride, int32_t forInspection)
  */
 Peep* find_closest_mechanic(int32_t x, int32_t y, int32_t forInspection)
 {
+    auto location = CoordsXY(x, y).ToTileStart();
+
+    // Mechanics are usually close by, look on the nearby tiles first.
+    auto canBeCalled = [location, forInspection](uint16_t spriteIndex) {
+        return mechanic_can_be_called(&get_sprite(spriteIndex)->peep, location, forInspection);
+    };
+    auto nearest = SpatialHash::GetNearest(SpatialHash::Kind::Staff, { x, y }, MECHANIC_SEARCH_DISTANCE, 1, canBeCalled);
+    if (nearest.size() == 1)
+    {
+        return &get_sprite(nearest[0].SpriteIndex)->peep;
+    }
+
+    // None nearby, or several as close, then the first mechanic in the staff list that is nearest is called.
     uint32_t closestDistance, distance;
     uint16_t spriteIndex;
     Peep *peep, *closestMechanic = nullptr;
@@ -2679,34 +2763,7 @@ Peep* find_closest_mechanic(int32_t x, int32_t y, int32_t forInspection)
     closestDistance = UINT_MAX;
     FOR_ALL_STAFF (spriteIndex, peep)
     {
-        if (peep->staff_type != STAFF_TYPE_MECHANIC)
-            continue;
-
-        if (!forInspection)
-        {
-            if (peep->state == PEEP_STATE_HEADING_TO_INSPECTION)
-            {
-                if (peep->sub_state >= 4)
-                    continue;
-            }
-            else if (peep->state != PEEP_STATE_PATROLLING)
-                continue;
-
-            if (!(peep->staff_orders & STAFF_ORDERS_FIX_RIDES))
-                continue;
-        }
-        else
-        {
-            if (peep->state != PEEP_STATE_PATROLLING || !(peep->staff_orders & STAFF_ORDERS_INSPECT_RIDES))
-                continue;
-        }
-
-        auto location = CoordsXY(x, y).ToTileStart();
-        if (map_is_location_in_park(location))
-            if (!peep->AsStaff()->IsLocationInPatrol(location))
-                continue;
-
-        if (peep->x == LOCATION_NULL)
+        if (!mechanic_can_be_called(peep, location, forInspection))
             continue;
 
         // Manhattan distance
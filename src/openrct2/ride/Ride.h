@@ -433,6 +433,7 @@ public:
 
     int32_t GetTotalQueueLength() const;
     int32_t GetMaxQueueTime() const;
+    int32_t GetEstimatedQueueTime() const;
 
     void QueueInsertGuestAtFront(StationIndex stationIndex, Peep* peep);
     Peep* GetQueueHeadGuest(StationIndex stationIndex) const;
@@ -22,6 +22,7 @@
 #include "Track.h"
 
 #include <algorithm>
+#include <array>
 #include <iterator>
 
 enum
@@ -1714,81 +1715,179 @@ static void ride_ratings_apply_first_length_penalty(
 
 #pragma endregion
 
-#pragma region Ride rating calculation functions
-
-static void ride_ratings_calculate_spiral_roller_coaster(Ride* ride)
-{
-    if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
-        return;
-
-    ride->unreliability_factor = 14;
-    set_unreliability_factor(ride);
+#pragma region Tracked ride rating calculation
+
+enum class RatingsModifierType : uint8_t
+{
+    NoModifier,
+    // Bonuses added to the ratings
+    BonusLength,
+    BonusSynchronisation,
+    BonusTrainLength,
+    BonusMaxSpeed,
+    BonusAverageSpeed,
+    BonusDuration,
+    BonusGForces,
+    BonusTurns,
+    BonusDrops,
+    BonusSheltered,
+    BonusProximity,
+    BonusScenery,
+    // Requirements that divide the ratings when they are not met
+    RequirementDropHeight,
+    RequirementMaxSpeed,
+    RequirementNegativeGs,
+    RequirementLateralGs,
+    RequirementLength,
+    RequirementNumDrops,
+    RequirementInversions,
+    // Penalties subtracted from the ratings
+    PenaltyLateralGs,
+};
 
-    rating_tuple ratings;
-    ride_ratings_set(&ratings, RIDE_RATING(3, 30), RIDE_RATING(0, 30), RIDE_RATING(0, 30));
-    ride_ratings_apply_length(&ratings, ride, 6000, 819);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 40), RIDE_RATING(0, 05));
-    ride_ratings_apply_train_length(&ratings, ride, 140434);
-    ride_ratings_apply_max_speed(&ratings, ride, 51366, 85019, 35424);
-    ride_ratings_apply_average_speed(&ratings, ride, 364088, 400497);
-    ride_ratings_apply_duration(&ratings, ride, 150, 26214);
-    ride_ratings_apply_gforces(&ratings, ride, 36864, 30384, 49648);
-    ride_ratings_apply_turns(&ratings, ride, 28235, 34767, 45749);
-    ride_ratings_apply_drops(&ratings, ride, 43690, 46811, 49152);
-    ride_ratings_apply_sheltered_ratings(&ratings, ride, 15420, 32768, 35108);
-    ride_ratings_apply_proximity(&ratings, 20130);
-    ride_ratings_apply_scenery(&ratings, ride, 6693);
+/**
+ * One step of a tracked ride's rating calculation. Threshold is the limit of a bonus or the requirement to meet, the
+ * other values are the multipliers, bonuses or divisors of the three ratings, as taken by the matching
+ * ride_ratings_apply_ function.
+ */
+struct RatingsModifier
+{
+    RatingsModifierType Type;
+    int32_t Threshold;
+    int32_t Excitement;
+    int32_t Intensity;
+    int32_t Nausea;
+    // The modifier is skipped when the ride has inversions.
+    bool OnlyWithoutInversions = false;
+};
 
-    if (ride->inversions == 0)
-        ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 12, 2, 2, 2);
+constexpr size_t MAX_RATINGS_MODIFIERS = 20;
 
-    ride_ratings_apply_max_speed_penalty(&ratings, ride, 0xA0000, 2, 2, 2);
+/**
+ * The constants of a tracked ride type's rating calculation. The modifiers are applied in order as the ratings are
+ * clamped after each of them.
+ */
+struct RideRatingsDescriptor
+{
+    uint8_t Unreliability;
+    uint8_t PoweredLaunchUnreliability;
+    rating_tuple BaseRatings;
+    // The excitement is divided by 4 when at least this many eighths of the track are sheltered, 0 to never divide it.
+    uint8_t ShelteredExcitementEighths;
+    std::array<RatingsModifier, MAX_RATINGS_MODIFIERS> Modifiers;
+};
 
+static void ride_ratings_apply_inversions_penalty(
+    rating_tuple* ratings, Ride* ride, int32_t excitementPenalty, int32_t intensityPenalty, int32_t nauseaPenalty)
+{
     if (ride->inversions == 0)
     {
-        ride_ratings_apply_max_negative_g_penalty(&ratings, ride, FIXED_2DP(0, 40), 2, 2, 2);
-        ride_ratings_apply_num_drops_penalty(&ratings, ride, 2, 2, 2, 2);
+        ratings->excitement /= excitementPenalty;
+        ratings->intensity /= intensityPenalty;
+        ratings->nausea /= nauseaPenalty;
     }
+}
 
-    ride_ratings_apply_excessive_lateral_g_penalty(&ratings, ride, 36864, 30384, 49648);
-    ride_ratings_apply_intensity_penalty(&ratings);
-    ride_ratings_apply_adjustments(ride, &ratings);
-
-    ride->ratings = ratings;
-
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+static void ride_ratings_apply_modifier(rating_tuple* ratings, Ride* ride, const RatingsModifier& modifier)
+{
+    if (modifier.OnlyWithoutInversions && ride->inversions != 0)
+        return;
 
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
+    switch (modifier.Type)
+    {
+        case RatingsModifierType::NoModifier:
+            break;
+        case RatingsModifierType::BonusLength:
+            ride_ratings_apply_length(ratings, ride, modifier.Threshold, modifier.Excitement);
+            break;
+        case RatingsModifierType::BonusSynchronisation:
+            ride_ratings_apply_synchronisation(ratings, ride, modifier.Excitement, modifier.Intensity);
+            break;
+        case RatingsModifierType::BonusTrainLength:
+            ride_ratings_apply_train_length(ratings, ride, modifier.Excitement);
+            break;
+        case RatingsModifierType::BonusMaxSpeed:
+            ride_ratings_apply_max_speed(ratings, ride, modifier.Excitement, modifier.Intensity, modifier.Nausea);
+            break;
+        case RatingsModifierType::BonusAverageSpeed:
+            ride_ratings_apply_average_speed(ratings, ride, modifier.Excitement, modifier.Intensity);
+            break;
+        case RatingsModifierType::BonusDuration:
+            ride_ratings_apply_duration(ratings, ride, modifier.Threshold, modifier.Excitement);
+            break;
+        case RatingsModifierType::BonusGForces:
+            ride_ratings_apply_gforces(ratings, ride, modifier.Excitement, modifier.Intensity, modifier.Nausea);
+            break;
+        case RatingsModifierType::BonusTurns:
+            ride_ratings_apply_turns(ratings, ride, modifier.Excitement, modifier.Intensity, modifier.Nausea);
+            break;
+        case RatingsModifierType::BonusDrops:
+            ride_ratings_apply_drops(ratings, ride, modifier.Excitement, modifier.Intensity, modifier.Nausea);
+            break;
+        case RatingsModifierType::BonusSheltered:
+            ride_ratings_apply_sheltered_ratings(ratings, ride, modifier.Excitement, modifier.Intensity, modifier.Nausea);
+            break;
+        case RatingsModifierType::BonusProximity:
+            ride_ratings_apply_proximity(ratings, modifier.Excitement);
+            break;
+        case RatingsModifierType::BonusScenery:
+            ride_ratings_apply_scenery(ratings, ride, modifier.Excitement);
+            break;
+        case RatingsModifierType::RequirementDropHeight:
+            ride_ratings_apply_highest_drop_height_penalty(
+                ratings, ride, modifier.Threshold, modifier.Excitement, modifier.Intensity, modifier.Nausea);
+            break;
+        case RatingsModifierType::RequirementMaxSpeed:
+            ride_ratings_apply_max_speed_penalty(
+                ratings, ride, modifier.Threshold, modifier.Excitement, modifier.Intensity, modifier.Nausea);
+            break;
+        case RatingsModifierType::RequirementNegativeGs:
+            ride_ratings_apply_max_negative_g_penalty(
+                ratings, ride, modifier.Threshold, modifier.Excitement, modifier.Intensity, modifier.Nausea);
+            break;
+        case RatingsModifierType::RequirementLateralGs:
+            ride_ratings_apply_max_lateral_g_penalty(
+                ratings, ride, modifier.Threshold, modifier.Excitement, modifier.Intensity, modifier.Nausea);
+            break;
+        case RatingsModifierType::RequirementLength:
+            ride_ratings_apply_first_length_penalty(
+                ratings, ride, modifier.Threshold, modifier.Excitement, modifier.Intensity, modifier.Nausea);
+            break;
+        case RatingsModifierType::RequirementNumDrops:
+            ride_ratings_apply_num_drops_penalty(
+                ratings, ride, modifier.Threshold, modifier.Excitement, modifier.Intensity, modifier.Nausea);
+            break;
+        case RatingsModifierType::RequirementInversions:
+            ride_ratings_apply_inversions_penalty(ratings, ride, modifier.Excitement, modifier.Intensity, modifier.Nausea);
+            break;
+        case RatingsModifierType::PenaltyLateralGs:
+            ride_ratings_apply_excessive_lateral_g_penalty(
+                ratings, ride, modifier.Excitement, modifier.Intensity, modifier.Nausea);
+            break;
+    }
 }
 
-static void ride_ratings_calculate_stand_up_roller_coaster(Ride* ride)
+/**
+ * Calculates the ratings of a tracked ride from the constants of its type. The descriptor is a template argument so each
+ * ride type gets its own copy of the calculation with the constants folded in.
+ */
+template<const RideRatingsDescriptor& TDescriptor> static void ride_ratings_calculate_tracked(Ride* ride)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
 
-    ride->unreliability_factor = 17;
+    ride->unreliability_factor = ride->IsPoweredLaunched() ? TDescriptor.PoweredLaunchUnreliability
+                                                           : TDescriptor.Unreliability;
     set_unreliability_factor(ride);
 
     rating_tuple ratings;
-    ride_ratings_set(&ratings, RIDE_RATING(2, 50), RIDE_RATING(3, 00), RIDE_RATING(3, 00));
-    ride_ratings_apply_length(&ratings, ride, 6000, 764);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 40), RIDE_RATING(0, 10));
-    ride_ratings_apply_train_length(&ratings, ride, 187245);
-    ride_ratings_apply_max_speed(&ratings, ride, 44281, 123987, 35424);
-    ride_ratings_apply_average_speed(&ratings, ride, 291271, 436906);
-    ride_ratings_apply_duration(&ratings, ride, 150, 26214);
-    ride_ratings_apply_gforces(&ratings, ride, 24576, 35746, 59578);
-    ride_ratings_apply_turns(&ratings, ride, 26749, 34767, 45749);
-    ride_ratings_apply_drops(&ratings, ride, 34952, 46811, 49152);
-    ride_ratings_apply_sheltered_ratings(&ratings, ride, 12850, 28398, 30427);
-    ride_ratings_apply_proximity(&ratings, 17893);
-    ride_ratings_apply_scenery(&ratings, ride, 5577);
-    ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 12, 2, 2, 2);
-    ride_ratings_apply_max_speed_penalty(&ratings, ride, 0xA0000, 2, 2, 2);
-    ride_ratings_apply_max_negative_g_penalty(&ratings, ride, FIXED_2DP(0, 50), 2, 2, 2);
+    ride_ratings_set(
+        &ratings, TDescriptor.BaseRatings.excitement, TDescriptor.BaseRatings.intensity, TDescriptor.BaseRatings.nausea);
+    for (const auto& modifier : TDescriptor.Modifiers)
+    {
+        ride_ratings_apply_modifier(&ratings, ride, modifier);
+    }
 
-    ride_ratings_apply_excessive_lateral_g_penalty(&ratings, ride, 24576, 35746, 59578);
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
@@ -1797,38 +1896,39 @@ static void ride_ratings_calculate_stand_up_roller_coaster(Ride* ride)
     ride->upkeep_cost = ride_compute_upkeep(ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
+    auto shelteredEighths = get_num_of_sheltered_eighths(ride);
+    if (TDescriptor.ShelteredExcitementEighths != 0
+        && shelteredEighths.TrackShelteredEighths >= TDescriptor.ShelteredExcitementEighths)
+        ride->excitement /= 4;
+
+    ride->sheltered_eighths = shelteredEighths.TotalShelteredEighths;
 }
 
-static void ride_ratings_calculate_suspended_swinging_coaster(Ride* ride)
-{
-    if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
-        return;
+#pragma endregion
 
-    ride->unreliability_factor = 18;
+#pragma region Ride rating calculation functions
+
+static void ride_ratings_calculate_boat_hire(Ride* ride)
+{
+    ride->unreliability_factor = 7;
     set_unreliability_factor(ride);
 
+    // NOTE In the original game, the ratings were zeroed before calling set_unreliability_factor which is unusual as rest
+    // of the calculation functions do this before hand. This is because set_unreliability_factor alters the value of ebx
+    // (excitement). This is assumed to be a bug and therefore fixed.
+
     rating_tuple ratings;
-    ride_ratings_set(&ratings, RIDE_RATING(3, 30), RIDE_RATING(2, 90), RIDE_RATING(3, 50));
-    ride_ratings_apply_length(&ratings, ride, 6000, 764);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 40), RIDE_RATING(0, 10));
-    ride_ratings_apply_train_length(&ratings, ride, 187245);
-    ride_ratings_apply_max_speed(&ratings, ride, 44281, 88562, 35424);
-    ride_ratings_apply_average_speed(&ratings, ride, 291271, 436906);
-    ride_ratings_apply_duration(&ratings, ride, 150, 26214);
-    ride_ratings_apply_gforces(&ratings, ride, 32768, 23831, 79437);
-    ride_ratings_apply_turns(&ratings, ride, 26749, 34767, 48036);
-    ride_ratings_apply_drops(&ratings, ride, 29127, 46811, 49152);
-    ride_ratings_apply_sheltered_ratings(&ratings, ride, 15420, 32768, 35108);
-    ride_ratings_apply_proximity(&ratings, 20130);
-    ride_ratings_apply_scenery(&ratings, ride, 6971);
-    ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 8, 2, 2, 2);
-    ride_ratings_apply_max_speed_penalty(&ratings, ride, 0xC0000, 2, 2, 2);
-    ride_ratings_apply_max_negative_g_penalty(&ratings, ride, FIXED_2DP(0, 60), 2, 2, 2);
-    ride_ratings_apply_max_lateral_g_penalty(&ratings, ride, FIXED_2DP(1, 50), 2, 2, 2);
-    ride_ratings_apply_first_length_penalty(&ratings, ride, 0x1720000, 2, 2, 2);
+    ride_ratings_set(&ratings, RIDE_RATING(1, 90), RIDE_RATING(0, 80), RIDE_RATING(0, 90));
+
+    // Most likely checking if the ride has does not have a circuit
+    if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
+    {
+        ride_ratings_add(&ratings, RIDE_RATING(0, 20), 0, 0);
+    }
+
+    ride_ratings_apply_proximity(&ratings, 11183);
+    ride_ratings_apply_scenery(&ratings, ride, 22310);
 
-    ride_ratings_apply_excessive_lateral_g_penalty(&ratings, ride, 32768, 23831, 79437);
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
@@ -1837,41 +1937,49 @@ static void ride_ratings_calculate_suspended_swinging_coaster(Ride* ride)
     ride->upkeep_cost = ride_compute_upkeep(ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
+    ride->sheltered_eighths = 0;
 }
 
-static void ride_ratings_calculate_inverted_roller_coaster(Ride* ride)
+static void ride_ratings_calculate_launched_freefall(Ride* ride)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
 
-    ride->unreliability_factor = 17;
+    ride->unreliability_factor = 16;
     set_unreliability_factor(ride);
 
     rating_tuple ratings;
-    ride_ratings_set(&ratings, RIDE_RATING(3, 60), RIDE_RATING(2, 80), RIDE_RATING(3, 20));
-    ride_ratings_apply_length(&ratings, ride, 6000, 764);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 42), RIDE_RATING(0, 05));
-    ride_ratings_apply_train_length(&ratings, ride, 187245);
-    ride_ratings_apply_max_speed(&ratings, ride, 44281, 88562, 35424);
-    ride_ratings_apply_average_speed(&ratings, ride, 291271, 436906);
-    ride_ratings_apply_duration(&ratings, ride, 150, 26214);
-    ride_ratings_apply_gforces(&ratings, ride, 24576, 29789, 55606);
-    ride_ratings_apply_turns(&ratings, ride, 26749, 29552, 57186);
-    ride_ratings_apply_drops(&ratings, ride, 29127, 39009, 49152);
-    ride_ratings_apply_sheltered_ratings(&ratings, ride, 15420, 15291, 35108);
-    ride_ratings_apply_proximity(&ratings, 15657);
-    ride_ratings_apply_scenery(&ratings, ride, 8366);
+    ride_ratings_set(&ratings, RIDE_RATING(2, 70), RIDE_RATING(3, 00), RIDE_RATING(3, 50));
 
-    if (ride->inversions == 0)
-        ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 12, 2, 2, 2);
+    if (ride->mode == RIDE_MODE_DOWNWARD_LAUNCH)
+    {
+        ride_ratings_add(&ratings, RIDE_RATING(0, 30), RIDE_RATING(0, 65), RIDE_RATING(0, 45));
+    }
 
-    ride_ratings_apply_max_speed_penalty(&ratings, ride, 0xA0000, 2, 2, 2);
+    int32_t excitementModifier = ((ride_get_total_length(ride) >> 16) * 32768) >> 16;
+    ride_ratings_add(&ratings, excitementModifier, 0, 0);
 
-    if (ride->inversions == 0)
-        ride_ratings_apply_max_negative_g_penalty(&ratings, ride, FIXED_2DP(0, 30), 2, 2, 2);
+#ifdef ORIGINAL_RATINGS
+    ride_ratings_apply_operation_option(&ratings, ride, 0, 1355917, 451972);
+#else
+    // Only apply "launch speed" effects when the setting can be modified
+    if (ride->mode == RIDE_MODE_UPWARD_LAUNCH)
+    {
+        ride_ratings_apply_operation_option(&ratings, ride, 0, 1355917, 451972);
+    }
+    else
+    {
+        // Fix #3282: When the ride mode is in downward launch mode, the intensity and
+        //            nausea were fixed regardless of how high the ride is. The following
+        //            calculation is based on roto-drop which is a similar mechanic.
+        int32_t lengthFactor = ((ride_get_total_length(ride) >> 16) * 209715) >> 16;
+        ride_ratings_add(&ratings, lengthFactor, lengthFactor * 2, lengthFactor * 2);
+    }
+#endif
+
+    ride_ratings_apply_proximity(&ratings, 20130);
+    ride_ratings_apply_scenery(&ratings, ride, 25098);
 
-    ride_ratings_apply_excessive_lateral_g_penalty(&ratings, ride, 24576, 29789, 55606);
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
@@ -1883,33 +1991,21 @@ static void ride_ratings_calculate_inverted_roller_coaster(Ride* ride)
     ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-static void ride_ratings_calculate_junior_roller_coaster(Ride* ride)
+static void ride_ratings_calculate_observation_tower(Ride* ride)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
 
-    ride->unreliability_factor = 13;
+    ride->unreliability_factor = 15;
     set_unreliability_factor(ride);
 
     rating_tuple ratings;
-    ride_ratings_set(&ratings, RIDE_RATING(2, 40), RIDE_RATING(2, 50), RIDE_RATING(1, 80));
-    ride_ratings_apply_length(&ratings, ride, 6000, 764);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 40), RIDE_RATING(0, 05));
-    ride_ratings_apply_train_length(&ratings, ride, 187245);
-    ride_ratings_apply_max_speed(&ratings, ride, 44281, 88562, 35424);
-    ride_ratings_apply_average_speed(&ratings, ride, 291271, 436906);
-    ride_ratings_apply_duration(&ratings, ride, 150, 26214);
-    ride_ratings_apply_gforces(&ratings, ride, 20480, 23831, 49648);
-    ride_ratings_apply_turns(&ratings, ride, 26749, 34767, 45749);
-    ride_ratings_apply_drops(&ratings, ride, 29127, 46811, 49152);
-    ride_ratings_apply_sheltered_ratings(&ratings, ride, 25700, 30583, 35108);
+    ride_ratings_set(&ratings, RIDE_RATING(1, 50), RIDE_RATING(0, 00), RIDE_RATING(0, 10));
+    ride_ratings_add(
+        &ratings, ((ride_get_total_length(ride) >> 16) * 45875) >> 16, 0, ((ride_get_total_length(ride) >> 16) * 26214) >> 16);
     ride_ratings_apply_proximity(&ratings, 20130);
-    ride_ratings_apply_scenery(&ratings, ride, 9760);
-    ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 6, 2, 2, 2);
-    ride_ratings_apply_max_speed_penalty(&ratings, ride, 0x70000, 2, 2, 2);
-    ride_ratings_apply_num_drops_penalty(&ratings, ride, 1, 2, 2, 2);
+    ride_ratings_apply_scenery(&ratings, ride, 83662);
 
-    ride_ratings_apply_excessive_lateral_g_penalty(&ratings, ride, 20480, 23831, 49648);
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
@@ -1918,32 +2014,43 @@ static void ride_ratings_calculate_junior_roller_coaster(Ride* ride)
     ride->upkeep_cost = ride_compute_upkeep(ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
+    ride->sheltered_eighths = 7;
+
+    auto shelteredEighths = get_num_of_sheltered_eighths(ride);
+    if (shelteredEighths.TrackShelteredEighths >= 5)
+        ride->excitement /= 4;
 }
 
-static void ride_ratings_calculate_miniature_railway(Ride* ride)
+static void ride_ratings_calculate_chairlift(Ride* ride)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
 
-    ride->unreliability_factor = 11;
+    ride->unreliability_factor = 14 + (ride->speed * 2);
     set_unreliability_factor(ride);
 
     rating_tuple ratings;
-    ride_ratings_set(&ratings, RIDE_RATING(2, 50), RIDE_RATING(0, 00), RIDE_RATING(0, 00));
+    ride_ratings_set(&ratings, RIDE_RATING(1, 60), RIDE_RATING(0, 40), RIDE_RATING(0, 50));
     ride_ratings_apply_length(&ratings, ride, 6000, 764);
-    ride_ratings_apply_train_length(&ratings, ride, 140434);
+    ride_ratings_apply_train_length(&ratings, ride, 187245);
     ride_ratings_apply_max_speed(&ratings, ride, 44281, 88562, 35424);
     ride_ratings_apply_average_speed(&ratings, ride, 291271, 436906);
     ride_ratings_apply_duration(&ratings, ride, 150, 26214);
-    ride_ratings_apply_sheltered_ratings(&ratings, ride, -6425, 6553, 23405);
-    ride_ratings_apply_proximity(&ratings, 8946);
-    ride_ratings_apply_scenery(&ratings, ride, 20915);
-    ride_ratings_apply_first_length_penalty(&ratings, ride, 0xC80000, 2, 2, 2);
+    ride_ratings_apply_turns(&ratings, ride, 7430, 3476, 4574);
+    ride_ratings_apply_sheltered_ratings(&ratings, ride, -19275, 21845, 23405);
+    ride_ratings_apply_proximity(&ratings, 11183);
+    ride_ratings_apply_scenery(&ratings, ride, 25098);
+    ride_ratings_apply_first_length_penalty(&ratings, ride, 0x960000, 2, 2, 2);
 
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
+    if (ride->num_stations <= 1)
+    {
+        ratings.excitement = 0;
+        ratings.intensity /= 2;
+    }
+
     ride->ratings = ratings;
 
     ride->upkeep_cost = ride_compute_upkeep(ride);
@@ -1956,25 +2063,20 @@ static void ride_ratings_calculate_miniature_railway(Ride* ride)
     ride->sheltered_eighths = shelteredEighths.TotalShelteredEighths;
 }
 
-static void ride_ratings_calculate_monorail(Ride* ride)
+static void ride_ratings_calculate_maze(Ride* ride)
 {
-    if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
-        return;
-
-    ride->unreliability_factor = 14;
+    ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
+    ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
+    ride->unreliability_factor = 8;
     set_unreliability_factor(ride);
 
     rating_tuple ratings;
-    ride_ratings_set(&ratings, RIDE_RATING(2, 00), RIDE_RATING(0, 00), RIDE_RATING(0, 00));
-    ride_ratings_apply_length(&ratings, ride, 6000, 764);
-    ride_ratings_apply_train_length(&ratings, ride, 93622);
-    ride_ratings_apply_max_speed(&ratings, ride, 44281, 70849, 35424);
-    ride_ratings_apply_average_speed(&ratings, ride, 291271, 218453);
-    ride_ratings_apply_duration(&ratings, ride, 150, 21845);
-    ride_ratings_apply_sheltered_ratings(&ratings, ride, 5140, 6553, 18724);
-    ride_ratings_apply_proximity(&ratings, 8946);
-    ride_ratings_apply_scenery(&ratings, ride, 16732);
-    ride_ratings_apply_first_length_penalty(&ratings, ride, 0xAA0000, 2, 2, 2);
+    ride_ratings_set(&ratings, RIDE_RATING(1, 30), RIDE_RATING(0, 50), RIDE_RATING(0, 00));
+
+    int32_t size = std::min<uint16_t>(ride->maze_tiles, 100);
+    ride_ratings_add(&ratings, size, size * 2, 0);
+
+    ride_ratings_apply_scenery(&ratings, ride, 22310);
 
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
@@ -1984,41 +2086,27 @@ static void ride_ratings_calculate_monorail(Ride* ride)
     ride->upkeep_cost = ride_compute_upkeep(ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
-    auto shelteredEighths = get_num_of_sheltered_eighths(ride);
-    if (shelteredEighths.TrackShelteredEighths >= 4)
-        ride->excitement /= 4;
-
-    ride->sheltered_eighths = shelteredEighths.TotalShelteredEighths;
+    ride->sheltered_eighths = 0;
 }
 
-static void ride_ratings_calculate_mini_suspended_coaster(Ride* ride)
+static void ride_ratings_calculate_spiral_slide(Ride* ride)
 {
-    if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
-        return;
-
-    ride->unreliability_factor = 15;
+    ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
+    ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
+    ride->unreliability_factor = 8;
     set_unreliability_factor(ride);
 
     rating_tuple ratings;
-    ride_ratings_set(&ratings, RIDE_RATING(2, 80), RIDE_RATING(2, 50), RIDE_RATING(2, 70));
-    ride_ratings_apply_length(&ratings, ride, 6000, 764);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 45), RIDE_RATING(0, 15));
-    ride_ratings_apply_train_length(&ratings, ride, 187245);
-    ride_ratings_apply_max_speed(&ratings, ride, 44281, 88562, 35424);
-    ride_ratings_apply_average_speed(&ratings, ride, 291271, 436906);
-    ride_ratings_apply_duration(&ratings, ride, 150, 26214);
-    ride_ratings_apply_gforces(&ratings, ride, 24576, 35746, 49648);
-    ride_ratings_apply_turns(&ratings, ride, 34179, 34767, 45749);
-    ride_ratings_apply_drops(&ratings, ride, 58254, 46811, 49152);
-    ride_ratings_apply_sheltered_ratings(&ratings, ride, 19275, 32768, 35108);
-    ride_ratings_apply_proximity(&ratings, 20130);
-    ride_ratings_apply_scenery(&ratings, ride, 13943);
-    ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 6, 2, 2, 2);
-    ride_ratings_apply_max_speed_penalty(&ratings, ride, 0x80000, 2, 2, 2);
-    ride_ratings_apply_max_lateral_g_penalty(&ratings, ride, FIXED_2DP(1, 30), 2, 2, 2);
-    ride_ratings_apply_first_length_penalty(&ratings, ride, 0xC80000, 2, 2, 2);
+    ride_ratings_set(&ratings, RIDE_RATING(1, 50), RIDE_RATING(1, 40), RIDE_RATING(0, 90));
+
+    // Unlimited slides boost
+    if (ride->mode == RIDE_MODE_UNLIMITED_RIDES_PER_ADMISSION)
+    {
+        ride_ratings_add(&ratings, RIDE_RATING(0, 40), RIDE_RATING(0, 20), RIDE_RATING(0, 25));
+    }
+
+    ride_ratings_apply_scenery(&ratings, ride, 25098);
 
-    ride_ratings_apply_excessive_lateral_g_penalty(&ratings, ride, 24576, 35746, 49648);
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
@@ -2027,1034 +2115,35 @@ static void ride_ratings_calculate_mini_suspended_coaster(Ride* ride)
     ride->upkeep_cost = ride_compute_upkeep(ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
+    ride->sheltered_eighths = 2;
 }
 
-static void ride_ratings_calculate_boat_hire(Ride* ride)
+static void ride_ratings_calculate_go_karts(Ride* ride)
 {
-    ride->unreliability_factor = 7;
-    set_unreliability_factor(ride);
+    if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
+        return;
 
-    // NOTE In the original game, the ratings were zeroed before calling set_unreliability_factor which is unusual as rest
-    // of the calculation functions do this before hand. This is because set_unreliability_factor alters the value of ebx
-    // (excitement). This is assumed to be a bug and therefore fixed.
+    ride->unreliability_factor = 16;
+    set_unreliability_factor(ride);
 
     rating_tuple ratings;
-    ride_ratings_set(&ratings, RIDE_RATING(1, 90), RIDE_RATING(0, 80), RIDE_RATING(0, 90));
-
-    // Most likely checking if the ride has does not have a circuit
-    if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
-    {
-        ride_ratings_add(&ratings, RIDE_RATING(0, 20), 0, 0);
-    }
-
-    ride_ratings_apply_proximity(&ratings, 11183);
-    ride_ratings_apply_scenery(&ratings, ride, 22310);
-
-    ride_ratings_apply_intensity_penalty(&ratings);
-    ride_ratings_apply_adjustments(ride, &ratings);
-
-    ride->ratings = ratings;
-
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
-
-    ride->sheltered_eighths = 0;
-}
-
-static void ride_ratings_calculate_wooden_wild_mouse(Ride* ride)
-{
-    if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
-        return;
-
-    ride->unreliability_factor = 14;
-    set_unreliability_factor(ride);
-
-    rating_tuple ratings;
-    ride_ratings_set(&ratings, RIDE_RATING(2, 90), RIDE_RATING(2, 90), RIDE_RATING(2, 10));
-    ride_ratings_apply_length(&ratings, ride, 6000, 873);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 40), RIDE_RATING(0, 8));
-    ride_ratings_apply_train_length(&ratings, ride, 187245);
-    ride_ratings_apply_max_speed(&ratings, ride, 44281, 88562, 35424);
-    ride_ratings_apply_average_speed(&ratings, ride, 364088, 655360);
-    ride_ratings_apply_duration(&ratings, ride, 150, 26214);
-    ride_ratings_apply_gforces(&ratings, ride, 102400, 35746, 49648);
-    ride_ratings_apply_turns(&ratings, ride, 29721, 43458, 45749);
-    ride_ratings_apply_drops(&ratings, ride, 40777, 46811, 49152);
-    ride_ratings_apply_sheltered_ratings(&ratings, ride, 16705, 30583, 35108);
-    ride_ratings_apply_proximity(&ratings, 17893);
-    ride_ratings_apply_scenery(&ratings, ride, 5577);
-    ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 8, 2, 2, 2);
-    ride_ratings_apply_max_speed_penalty(&ratings, ride, 0x70000, 2, 2, 2);
-    ride_ratings_apply_max_negative_g_penalty(&ratings, ride, FIXED_2DP(0, 10), 2, 2, 2);
-    ride_ratings_apply_max_lateral_g_penalty(&ratings, ride, FIXED_2DP(1, 50), 2, 2, 2);
-    ride_ratings_apply_first_length_penalty(&ratings, ride, 0xAA0000, 2, 2, 2);
-    ride_ratings_apply_num_drops_penalty(&ratings, ride, 3, 2, 2, 2);
-
-    ride_ratings_apply_excessive_lateral_g_penalty(&ratings, ride, 102400, 35746, 49648);
-    ride_ratings_apply_intensity_penalty(&ratings);
-    ride_ratings_apply_adjustments(ride, &ratings);
-
-    ride->ratings = ratings;
-
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
-
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
-}
-
-static void ride_ratings_calculate_steeplechase(Ride* ride)
-{
-    if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
-        return;
-
-    ride->unreliability_factor = 14;
-    set_unreliability_factor(ride);
-
-    rating_tuple ratings;
-    ride_ratings_set(&ratings, RIDE_RATING(2, 70), RIDE_RATING(2, 40), RIDE_RATING(1, 80));
-    ride_ratings_apply_length(&ratings, ride, 6000, 764);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 75), RIDE_RATING(0, 9));
-    ride_ratings_apply_train_length(&ratings, ride, 187245);
-    ride_ratings_apply_max_speed(&ratings, ride, 44281, 88562, 35424);
-    ride_ratings_apply_average_speed(&ratings, ride, 291271, 436906);
-    ride_ratings_apply_duration(&ratings, ride, 150, 26214);
-    ride_ratings_apply_gforces(&ratings, ride, 20480, 20852, 49648);
-    ride_ratings_apply_turns(&ratings, ride, 26749, 34767, 45749);
-    ride_ratings_apply_drops(&ratings, ride, 29127, 46811, 49152);
-    ride_ratings_apply_sheltered_ratings(&ratings, ride, 25700, 30583, 35108);
-    ride_ratings_apply_proximity(&ratings, 20130);
-    ride_ratings_apply_scenery(&ratings, ride, 9760);
-    ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 4, 2, 2, 2);
-    ride_ratings_apply_max_speed_penalty(&ratings, ride, 0x80000, 2, 2, 2);
-    ride_ratings_apply_max_negative_g_penalty(&ratings, ride, FIXED_2DP(0, 50), 2, 2, 2);
-    ride_ratings_apply_first_length_penalty(&ratings, ride, 0xF00000, 2, 2, 2);
-    ride_ratings_apply_num_drops_penalty(&ratings, ride, 2, 2, 2, 2);
-
-    ride_ratings_apply_excessive_lateral_g_penalty(&ratings, ride, 20480, 20852, 49648);
-    ride_ratings_apply_intensity_penalty(&ratings);
-    ride_ratings_apply_adjustments(ride, &ratings);
-
-    ride->ratings = ratings;
-
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
-
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
-}
-
-static void ride_ratings_calculate_car_ride(Ride* ride)
-{
-    if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
-        return;
-
-    ride->unreliability_factor = 12;
-    set_unreliability_factor(ride);
-
-    rating_tuple ratings;
-    ride_ratings_set(&ratings, RIDE_RATING(2, 00), RIDE_RATING(0, 50), RIDE_RATING(0, 00));
-    ride_ratings_apply_length(&ratings, ride, 6000, 764);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 15), RIDE_RATING(0, 00));
-    ride_ratings_apply_train_length(&ratings, ride, 187245);
-    ride_ratings_apply_max_speed(&ratings, ride, 44281, 88562, 35424);
-    ride_ratings_apply_average_speed(&ratings, ride, 291271, 436906);
-    ride_ratings_apply_duration(&ratings, ride, 150, 26214);
-    ride_ratings_apply_turns(&ratings, ride, 14860, 0, 11437);
-    ride_ratings_apply_drops(&ratings, ride, 8738, 0, 0);
-    ride_ratings_apply_sheltered_ratings(&ratings, ride, 12850, 6553, 4681);
-    ride_ratings_apply_proximity(&ratings, 11183);
-    ride_ratings_apply_scenery(&ratings, ride, 8366);
-    ride_ratings_apply_first_length_penalty(&ratings, ride, 0xC80000, 8, 2, 2);
-
-    ride_ratings_apply_intensity_penalty(&ratings);
-    ride_ratings_apply_adjustments(ride, &ratings);
-
-    ride->ratings = ratings;
-
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
-
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
-}
-
-static void ride_ratings_calculate_launched_freefall(Ride* ride)
-{
-    if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
-        return;
-
-    ride->unreliability_factor = 16;
-    set_unreliability_factor(ride);
-
-    rating_tuple ratings;
-    ride_ratings_set(&ratings, RIDE_RATING(2, 70), RIDE_RATING(3, 00), RIDE_RATING(3, 50));
-
-    if (ride->mode == RIDE_MODE_DOWNWARD_LAUNCH)
-    {
-        ride_ratings_add(&ratings, RIDE_RATING(0, 30), RIDE_RATING(0, 65), RIDE_RATING(0, 45));
-    }
-
-    int32_t excitementModifier = ((ride_get_total_length(ride) >> 16) * 32768) >> 16;
-    ride_ratings_add(&ratings, excitementModifier, 0, 0);
-
-#ifdef ORIGINAL_RATINGS
-    ride_ratings_apply_operation_option(&ratings, ride, 0, 1355917, 451972);
-#else
-    // Only apply "launch speed" effects when the setting can be modified
-    if (ride->mode == RIDE_MODE_UPWARD_LAUNCH)
-    {
-        ride_ratings_apply_operation_option(&ratings, ride, 0, 1355917, 451972);
-    }
-    else
-    {
-        // Fix #3282: When the ride mode is in downward launch mode, the intensity and
-        //            nausea were fixed regardless of how high the ride is. The following
-        //            calculation is based on roto-drop which is a similar mechanic.
-        int32_t lengthFactor = ((ride_get_total_length(ride) >> 16) * 209715) >> 16;
-        ride_ratings_add(&ratings, lengthFactor, lengthFactor * 2, lengthFactor * 2);
-    }
-#endif
-
-    ride_ratings_apply_proximity(&ratings, 20130);
-    ride_ratings_apply_scenery(&ratings, ride, 25098);
-
-    ride_ratings_apply_intensity_penalty(&ratings);
-    ride_ratings_apply_adjustments(ride, &ratings);
-
-    ride->ratings = ratings;
-
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
-
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
-}
-
-static void ride_ratings_calculate_bobsleigh_coaster(Ride* ride)
-{
-    if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
-        return;
-
-    ride->unreliability_factor = 16;
-    set_unreliability_factor(ride);
-
-    rating_tuple ratings;
-    ride_ratings_set(&ratings, RIDE_RATING(2, 80), RIDE_RATING(3, 20), RIDE_RATING(2, 50));
-    ride_ratings_apply_length(&ratings, ride, 6000, 764);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 20), RIDE_RATING(0, 00));
-    ride_ratings_apply_train_length(&ratings, ride, 187245);
-    ride_ratings_apply_max_speed(&ratings, ride, 44281, 88562, 35424);
-    ride_ratings_apply_average_speed(&ratings, ride, 291271, 436906);
-    ride_ratings_apply_duration(&ratings, ride, 150, 26214);
-    ride_ratings_apply_gforces(&ratings, ride, 65536, 23831, 49648);
-    ride_ratings_apply_turns(&ratings, ride, 26749, 34767, 45749);
-    ride_ratings_apply_drops(&ratings, ride, 29127, 46811, 49152);
-    ride_ratings_apply_sheltered_ratings(&ratings, ride, 15420, 32768, 35108);
-    ride_ratings_apply_proximity(&ratings, 20130);
-    ride_ratings_apply_scenery(&ratings, ride, 5577);
-    ride_ratings_apply_max_speed_penalty(&ratings, ride, 0xC0000, 2, 2, 2);
-    ride_ratings_apply_max_lateral_g_penalty(&ratings, ride, FIXED_2DP(1, 20), 2, 2, 2);
-    ride_ratings_apply_first_length_penalty(&ratings, ride, 0x1720000, 2, 2, 2);
-
-    ride_ratings_apply_excessive_lateral_g_penalty(&ratings, ride, 65536, 23831, 49648);
-    ride_ratings_apply_intensity_penalty(&ratings);
-    ride_ratings_apply_adjustments(ride, &ratings);
-
-    ride->ratings = ratings;
-
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
-
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
-}
-
-static void ride_ratings_calculate_observation_tower(Ride* ride)
-{
-    if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
-        return;
-
-    ride->unreliability_factor = 15;
-    set_unreliability_factor(ride);
-
-    rating_tuple ratings;
-    ride_ratings_set(&ratings, RIDE_RATING(1, 50), RIDE_RATING(0, 00), RIDE_RATING(0, 10));
-    ride_ratings_add(
-        &ratings, ((ride_get_total_length(ride) >> 16) * 45875) >> 16, 0, ((ride_get_total_length(ride) >> 16) * 26214) >> 16);
-    ride_ratings_apply_proximity(&ratings, 20130);
-    ride_ratings_apply_scenery(&ratings, ride, 83662);
-
-    ride_ratings_apply_intensity_penalty(&ratings);
-    ride_ratings_apply_adjustments(ride, &ratings);
-
-    ride->ratings = ratings;
-
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
-
-    ride->sheltered_eighths = 7;
-
-    auto shelteredEighths = get_num_of_sheltered_eighths(ride);
-    if (shelteredEighths.TrackShelteredEighths >= 5)
-        ride->excitement /= 4;
-}
-
-static void ride_ratings_calculate_looping_roller_coaster(Ride* ride)
-{
-    if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
-        return;
-
-    ride->unreliability_factor = ride->IsPoweredLaunched() ? 20 : 15;
-    set_unreliability_factor(ride);
-
-    rating_tuple ratings;
-    ride_ratings_set(&ratings, RIDE_RATING(3, 00), RIDE_RATING(0, 50), RIDE_RATING(0, 20));
-    ride_ratings_apply_length(&ratings, ride, 6000, 764);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 40), RIDE_RATING(0, 05));
-    ride_ratings_apply_train_length(&ratings, ride, 187245);
-    ride_ratings_apply_max_speed(&ratings, ride, 44281, 88562, 35424);
-    ride_ratings_apply_average_speed(&ratings, ride, 291271, 436906);
-    ride_ratings_apply_duration(&ratings, ride, 150, 26214);
-    ride_ratings_apply_gforces(&ratings, ride, 24576, 35746, 49648);
-    ride_ratings_apply_turns(&ratings, ride, 26749, 34767, 45749);
-    ride_ratings_apply_drops(&ratings, ride, 29127, 46811, 49152);
-    ride_ratings_apply_sheltered_ratings(&ratings, ride, 15420, 32768, 35108);
-    ride_ratings_apply_proximity(&ratings, 20130);
-    ride_ratings_apply_scenery(&ratings, ride, 6693);
-
-    if (ride->inversions == 0)
-        ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 14, 2, 2, 2);
-
-    ride_ratings_apply_max_speed_penalty(&ratings, ride, 0xA0000, 2, 2, 2);
-
-    if (ride->inversions == 0)
-    {
-        ride_ratings_apply_max_negative_g_penalty(&ratings, ride, FIXED_2DP(0, 10), 2, 2, 2);
-        ride_ratings_apply_num_drops_penalty(&ratings, ride, 2, 2, 2, 2);
-    }
-
-    ride_ratings_apply_excessive_lateral_g_penalty(&ratings, ride, 24576, 35746, 49648);
-    ride_ratings_apply_intensity_penalty(&ratings);
-    ride_ratings_apply_adjustments(ride, &ratings);
-
-    ride->ratings = ratings;
-
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
-
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
-}
-
-static void ride_ratings_calculate_dinghy_slide(Ride* ride)
-{
-    if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
-        return;
-
-    ride->unreliability_factor = 13;
-    set_unreliability_factor(ride);
-
-    rating_tuple ratings;
-    ride_ratings_set(&ratings, RIDE_RATING(2, 70), RIDE_RATING(2, 00), RIDE_RATING(1, 50));
-    ride_ratings_apply_length(&ratings, ride, 6000, 764);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 50), RIDE_RATING(0, 05));
-    ride_ratings_apply_train_length(&ratings, ride, 187245);
-    ride_ratings_apply_max_speed(&ratings, ride, 44281, 88562, 35424);
-    ride_ratings_apply_average_speed(&ratings, ride, 291271, 436906);
-    ride_ratings_apply_duration(&ratings, ride, 150, 26214);
-    ride_ratings_apply_gforces(&ratings, ride, 65536, 29789, 49648);
-    ride_ratings_apply_turns(&ratings, ride, 26749, 34767, 45749);
-    ride_ratings_apply_drops(&ratings, ride, 29127, 46811, 49152);
-    ride_ratings_apply_sheltered_ratings(&ratings, ride, 15420, 32768, 35108);
-    ride_ratings_apply_proximity(&ratings, 11183);
-    ride_ratings_apply_scenery(&ratings, ride, 5577);
-    ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 12, 2, 2, 2);
-    ride_ratings_apply_max_speed_penalty(&ratings, ride, 0x70000, 2, 2, 2);
-    ride_ratings_apply_first_length_penalty(&ratings, ride, 0x8C0000, 2, 2, 2);
-
-    ride_ratings_apply_excessive_lateral_g_penalty(&ratings, ride, 65536, 29789, 49648);
-    ride_ratings_apply_intensity_penalty(&ratings);
-    ride_ratings_apply_adjustments(ride, &ratings);
-
-    ride->ratings = ratings;
-
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
-
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
-}
-
-static void ride_ratings_calculate_mine_train_coaster(Ride* ride)
-{
-    if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
-        return;
-
-    ride->unreliability_factor = 16;
-    set_unreliability_factor(ride);
-
-    rating_tuple ratings;
-    ride_ratings_set(&ratings, RIDE_RATING(2, 90), RIDE_RATING(2, 30), RIDE_RATING(2, 10));
-    ride_ratings_apply_length(&ratings, ride, 6000, 764);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 40), RIDE_RATING(0, 05));
-    ride_ratings_apply_train_length(&ratings, ride, 187245);
-    ride_ratings_apply_max_speed(&ratings, ride, 44281, 88562, 35424);
-    ride_ratings_apply_average_speed(&ratings, ride, 291271, 436906);
-    ride_ratings_apply_duration(&ratings, ride, 150, 26214);
-    ride_ratings_apply_gforces(&ratings, ride, 40960, 35746, 49648);
-    ride_ratings_apply_turns(&ratings, ride, 29721, 34767, 45749);
-    ride_ratings_apply_drops(&ratings, ride, 29127, 46811, 49152);
-    ride_ratings_apply_sheltered_ratings(&ratings, ride, 19275, 32768, 35108);
-    ride_ratings_apply_proximity(&ratings, 21472);
-    ride_ratings_apply_scenery(&ratings, ride, 16732);
-    ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 8, 2, 2, 2);
-    ride_ratings_apply_max_speed_penalty(&ratings, ride, 0xA0000, 2, 2, 2);
-    ride_ratings_apply_max_negative_g_penalty(&ratings, ride, FIXED_2DP(0, 10), 2, 2, 2);
-    ride_ratings_apply_first_length_penalty(&ratings, ride, 0x1720000, 2, 2, 2);
-    ride_ratings_apply_num_drops_penalty(&ratings, ride, 2, 2, 2, 2);
-
-    ride_ratings_apply_excessive_lateral_g_penalty(&ratings, ride, 40960, 35746, 49648);
-    ride_ratings_apply_intensity_penalty(&ratings);
-    ride_ratings_apply_adjustments(ride, &ratings);
-
-    ride->ratings = ratings;
-
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
-
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
-}
-
-static void ride_ratings_calculate_chairlift(Ride* ride)
-{
-    if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
-        return;
-
-    ride->unreliability_factor = 14 + (ride->speed * 2);
-    set_unreliability_factor(ride);
-
-    rating_tuple ratings;
-    ride_ratings_set(&ratings, RIDE_RATING(1, 60), RIDE_RATING(0, 40), RIDE_RATING(0, 50));
-    ride_ratings_apply_length(&ratings, ride, 6000, 764);
-    ride_ratings_apply_train_length(&ratings, ride, 187245);
-    ride_ratings_apply_max_speed(&ratings, ride, 44281, 88562, 35424);
-    ride_ratings_apply_average_speed(&ratings, ride, 291271, 436906);
-    ride_ratings_apply_duration(&ratings, ride, 150, 26214);
-    ride_ratings_apply_turns(&ratings, ride, 7430, 3476, 4574);
-    ride_ratings_apply_sheltered_ratings(&ratings, ride, -19275, 21845, 23405);
-    ride_ratings_apply_proximity(&ratings, 11183);
-    ride_ratings_apply_scenery(&ratings, ride, 25098);
-    ride_ratings_apply_first_length_penalty(&ratings, ride, 0x960000, 2, 2, 2);
-
-    ride_ratings_apply_intensity_penalty(&ratings);
-    ride_ratings_apply_adjustments(ride, &ratings);
-
-    if (ride->num_stations <= 1)
-    {
-        ratings.excitement = 0;
-        ratings.intensity /= 2;
-    }
-
-    ride->ratings = ratings;
-
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
-
-    auto shelteredEighths = get_num_of_sheltered_eighths(ride);
-    if (shelteredEighths.TrackShelteredEighths >= 4)
-        ride->excitement /= 4;
-
-    ride->sheltered_eighths = shelteredEighths.TotalShelteredEighths;
-}
-
-static void ride_ratings_calculate_corkscrew_roller_coaster(Ride* ride)
-{
-    if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
-        return;
-
-    ride->unreliability_factor = 16;
-    set_unreliability_factor(ride);
-
-    rating_tuple ratings;
-    ride_ratings_set(&ratings, RIDE_RATING(3, 00), RIDE_RATING(0, 50), RIDE_RATING(0, 20));
-    ride_ratings_apply_length(&ratings, ride, 6000, 764);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 40), RIDE_RATING(0, 05));
-    ride_ratings_apply_train_length(&ratings, ride, 187245);
-    ride_ratings_apply_max_speed(&ratings, ride, 44281, 88562, 35424);
-    ride_ratings_apply_average_speed(&ratings, ride, 291271, 436906);
-    ride_ratings_apply_duration(&ratings, ride, 150, 26214);
-    ride_ratings_apply_gforces(&ratings, ride, 24576, 35746, 49648);
-    ride_ratings_apply_turns(&ratings, ride, 26749, 34767, 45749);
-    ride_ratings_apply_drops(&ratings, ride, 29127, 46811, 49152);
-    ride_ratings_apply_sheltered_ratings(&ratings, ride, 15420, 32768, 35108);
-    ride_ratings_apply_proximity(&ratings, 20130);
-    ride_ratings_apply_scenery(&ratings, ride, 6693);
-
-    if (ride->inversions == 0)
-        ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 12, 2, 2, 2);
-
-    ride_ratings_apply_max_speed_penalty(&ratings, ride, 0xA0000, 2, 2, 2);
-
-    if (ride->inversions == 0)
-    {
-        ride_ratings_apply_max_negative_g_penalty(&ratings, ride, FIXED_2DP(0, 40), 2, 2, 2);
-        ride_ratings_apply_num_drops_penalty(&ratings, ride, 2, 2, 2, 2);
-    }
-
-    ride_ratings_apply_excessive_lateral_g_penalty(&ratings, ride, 24576, 35746, 49648);
-    ride_ratings_apply_intensity_penalty(&ratings);
-    ride_ratings_apply_adjustments(ride, &ratings);
-
-    ride->ratings = ratings;
-
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
-
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
-}
-
-static void ride_ratings_calculate_maze(Ride* ride)
-{
-    ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
-    ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
-    ride->unreliability_factor = 8;
-    set_unreliability_factor(ride);
-
-    rating_tuple ratings;
-    ride_ratings_set(&ratings, RIDE_RATING(1, 30), RIDE_RATING(0, 50), RIDE_RATING(0, 00));
-
-    int32_t size = std::min<uint16_t>(ride->maze_tiles, 100);
-    ride_ratings_add(&ratings, size, size * 2, 0);
-
-    ride_ratings_apply_scenery(&ratings, ride, 22310);
-
-    ride_ratings_apply_intensity_penalty(&ratings);
-    ride_ratings_apply_adjustments(ride, &ratings);
-
-    ride->ratings = ratings;
-
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
-
-    ride->sheltered_eighths = 0;
-}
-
-static void ride_ratings_calculate_spiral_slide(Ride* ride)
-{
-    ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
-    ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
-    ride->unreliability_factor = 8;
-    set_unreliability_factor(ride);
-
-    rating_tuple ratings;
-    ride_ratings_set(&ratings, RIDE_RATING(1, 50), RIDE_RATING(1, 40), RIDE_RATING(0, 90));
-
-    // Unlimited slides boost
-    if (ride->mode == RIDE_MODE_UNLIMITED_RIDES_PER_ADMISSION)
-    {
-        ride_ratings_add(&ratings, RIDE_RATING(0, 40), RIDE_RATING(0, 20), RIDE_RATING(0, 25));
-    }
-
-    ride_ratings_apply_scenery(&ratings, ride, 25098);
-
-    ride_ratings_apply_intensity_penalty(&ratings);
-    ride_ratings_apply_adjustments(ride, &ratings);
-
-    ride->ratings = ratings;
-
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
-
-    ride->sheltered_eighths = 2;
-}
-
-static void ride_ratings_calculate_go_karts(Ride* ride)
-{
-    if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
-        return;
-
-    ride->unreliability_factor = 16;
-    set_unreliability_factor(ride);
-
-    rating_tuple ratings;
-    ride_ratings_set(&ratings, RIDE_RATING(1, 42), RIDE_RATING(1, 73), RIDE_RATING(0, 40));
-    ride_ratings_apply_length(&ratings, ride, 700, 32768);
-
-    if (ride->mode == RIDE_MODE_RACE && ride->num_vehicles >= 4)
-    {
-        ride_ratings_add(&ratings, RIDE_RATING(1, 40), RIDE_RATING(0, 50), 0);
-
-        int32_t lapsFactor = (ride->num_laps - 1) * 30;
-        ride_ratings_add(&ratings, lapsFactor, lapsFactor / 2, 0);
-    }
-
-    ride_ratings_apply_turns(&ratings, ride, 4458, 3476, 5718);
-    ride_ratings_apply_drops(&ratings, ride, 8738, 5461, 6553);
-    ride_ratings_apply_sheltered_ratings(&ratings, ride, 2570, 8738, 2340);
-    ride_ratings_apply_proximity(&ratings, 11183);
-    ride_ratings_apply_scenery(&ratings, ride, 16732);
-
-    ride_ratings_apply_intensity_penalty(&ratings);
-    ride_ratings_apply_adjustments(ride, &ratings);
-
-    ride->ratings = ratings;
-
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
-
-    auto shelteredEighths = get_num_of_sheltered_eighths(ride);
-    ride->sheltered_eighths = shelteredEighths.TotalShelteredEighths;
-
-    if (shelteredEighths.TrackShelteredEighths >= 6)
-        ride->excitement /= 2;
-}
-
-static void ride_ratings_calculate_log_flume(Ride* ride)
-{
-    if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
-        return;
-
-    ride->unreliability_factor = 15;
-    set_unreliability_factor(ride);
-
-    rating_tuple ratings;
-    ride_ratings_set(&ratings, RIDE_RATING(1, 50), RIDE_RATING(0, 55), RIDE_RATING(0, 30));
-    ride_ratings_apply_length(&ratings, ride, 2000, 7208);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 40), RIDE_RATING(0, 05));
-    ride_ratings_apply_max_speed(&ratings, ride, 531372, 655360, 301111);
-    ride_ratings_apply_duration(&ratings, ride, 300, 13107);
-    ride_ratings_apply_turns(&ratings, ride, 22291, 20860, 4574);
-    ride_ratings_apply_drops(&ratings, ride, 69905, 62415, 49152);
-    ride_ratings_apply_sheltered_ratings(&ratings, ride, 16705, 30583, 35108);
-    ride_ratings_apply_proximity(&ratings, 22367);
-    ride_ratings_apply_scenery(&ratings, ride, 11155);
-    ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 2, 2, 2, 2);
-
-    ride_ratings_apply_intensity_penalty(&ratings);
-    ride_ratings_apply_adjustments(ride, &ratings);
-
-    ride->ratings = ratings;
-
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
-
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
-}
-
-static void ride_ratings_calculate_river_rapids(Ride* ride)
-{
-    if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
-        return;
-
-    ride->unreliability_factor = 16;
-    set_unreliability_factor(ride);
-
-    rating_tuple ratings;
-    ride_ratings_set(&ratings, RIDE_RATING(1, 20), RIDE_RATING(0, 70), RIDE_RATING(0, 50));
-    ride_ratings_apply_length(&ratings, ride, 2000, 6225);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 30), RIDE_RATING(0, 05));
-    ride_ratings_apply_max_speed(&ratings, ride, 115130, 159411, 106274);
-    ride_ratings_apply_duration(&ratings, ride, 500, 13107);
-    ride_ratings_apply_turns(&ratings, ride, 29721, 22598, 5718);
-    ride_ratings_apply_drops(&ratings, ride, 40777, 46811, 49152);
-    ride_ratings_apply_sheltered_ratings(&ratings, ride, 16705, 30583, 35108);
-    ride_ratings_apply_proximity(&ratings, 31314);
-    ride_ratings_apply_scenery(&ratings, ride, 13943);
-    ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 2, 2, 2, 2);
-    ride_ratings_apply_first_length_penalty(&ratings, ride, 0xC80000, 2, 2, 2);
-
-    ride_ratings_apply_intensity_penalty(&ratings);
-    ride_ratings_apply_adjustments(ride, &ratings);
-
-    ride->ratings = ratings;
-
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
-
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
-}
-
-static void ride_ratings_calculate_dodgems(Ride* ride)
-{
-    ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
-    ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
-    ride->unreliability_factor = 16;
-    set_unreliability_factor(ride);
-
-    rating_tuple ratings;
-    ride_ratings_set(&ratings, RIDE_RATING(1, 30), RIDE_RATING(0, 50), RIDE_RATING(0, 35));
-
-    if (ride->num_vehicles >= 4)
-    {
-        ride_ratings_add(&ratings, RIDE_RATING(0, 40), 0, 0);
-    }
-
-    ride_ratings_add(&ratings, ride->operation_option, ride->operation_option / 2, 0);
-
-    if (ride->num_vehicles >= 4)
-    {
-        ride_ratings_add(&ratings, RIDE_RATING(0, 40), 0, 0);
-    }
-
-    ride_ratings_apply_scenery(&ratings, ride, 5577);
-
-    ride_ratings_apply_intensity_penalty(&ratings);
-    ride_ratings_apply_adjustments(ride, &ratings);
-
-    ride->ratings = ratings;
-
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
-
-    ride->sheltered_eighths = 7;
-}
-
-static void ride_ratings_calculate_pirate_ship(Ride* ride)
-{
-    ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
-    ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
-    ride->unreliability_factor = 10;
-    set_unreliability_factor(ride);
-
-    rating_tuple ratings;
-    ride_ratings_set(&ratings, RIDE_RATING(1, 50), RIDE_RATING(1, 90), RIDE_RATING(1, 41));
-
-    ride_ratings_add(&ratings, ride->operation_option * 5, ride->operation_option * 5, ride->operation_option * 10);
-
-    ride_ratings_apply_scenery(&ratings, ride, 16732);
-
-    ride_ratings_apply_intensity_penalty(&ratings);
-    ride_ratings_apply_adjustments(ride, &ratings);
-
-    ride->ratings = ratings;
-
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
-
-    ride->sheltered_eighths = 0;
-}
-
-static void ride_ratings_calculate_inverter_ship(Ride* ride)
-{
-    ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
-    ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
-    ride->unreliability_factor = 16;
-    set_unreliability_factor(ride);
-
-    rating_tuple ratings;
-    ride_ratings_set(&ratings, RIDE_RATING(2, 50), RIDE_RATING(2, 70), RIDE_RATING(2, 74));
-
-    ride_ratings_add(&ratings, ride->operation_option * 11, ride->operation_option * 22, ride->operation_option * 22);
-
-    ride_ratings_apply_scenery(&ratings, ride, 11155);
-
-    ride_ratings_apply_intensity_penalty(&ratings);
-    ride_ratings_apply_adjustments(ride, &ratings);
-
-    ride->ratings = ratings;
-
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
-
-    ride->sheltered_eighths = 0;
-}
-
-static void ride_ratings_calculate_food_stall(Ride* ride)
-{
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
-}
-
-static void ride_ratings_calculate_drink_stall(Ride* ride)
-{
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
-}
-
-static void ride_ratings_calculate_shop(Ride* ride)
-{
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
-}
-
-static void ride_ratings_calculate_merry_go_round(Ride* ride)
-{
-    ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
-    ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
-    ride->unreliability_factor = 16;
-    set_unreliability_factor(ride);
-
-    rating_tuple ratings;
-    ride_ratings_set(&ratings, RIDE_RATING(0, 60), RIDE_RATING(0, 15), RIDE_RATING(0, 30));
-    ride_ratings_apply_rotations(&ratings, ride, 5, 5, 5);
-    ride_ratings_apply_scenery(&ratings, ride, 19521);
-    ride_ratings_apply_intensity_penalty(&ratings);
-    ride_ratings_apply_adjustments(ride, &ratings);
-
-    ride->ratings = ratings;
-
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
-
-    ride->sheltered_eighths = 7;
-}
-
-static void ride_ratings_calculate_information_kiosk(Ride* ride)
-{
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
-}
-
-static void ride_ratings_calculate_toilets(Ride* ride)
-{
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
-}
-
-static void ride_ratings_calculate_ferris_wheel(Ride* ride)
-{
-    ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
-    ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
-    ride->unreliability_factor = 16;
-    set_unreliability_factor(ride);
-
-    rating_tuple ratings;
-    ride_ratings_set(&ratings, RIDE_RATING(0, 60), RIDE_RATING(0, 25), RIDE_RATING(0, 30));
-    ride_ratings_apply_rotations(&ratings, ride, 25, 25, 25);
-    ride_ratings_apply_scenery(&ratings, ride, 41831);
-    ride_ratings_apply_intensity_penalty(&ratings);
-    ride_ratings_apply_adjustments(ride, &ratings);
-
-    ride->ratings = ratings;
-
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
-
-    ride->sheltered_eighths = 0;
-}
-
-static void ride_ratings_calculate_motion_simulator(Ride* ride)
-{
-    ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
-    ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
-    ride->unreliability_factor = 21;
-    set_unreliability_factor(ride);
-
-    // Base ratings
-    rating_tuple ratings;
-    if (ride->mode == RIDE_MODE_FILM_THRILL_RIDERS)
-    {
-        ratings.excitement = RIDE_RATING(3, 25);
-        ratings.intensity = RIDE_RATING(4, 10);
-        ratings.nausea = RIDE_RATING(3, 30);
-    }
-    else
-    {
-        ratings.excitement = RIDE_RATING(2, 90);
-        ratings.intensity = RIDE_RATING(3, 50);
-        ratings.nausea = RIDE_RATING(3, 00);
-    }
-
-    ride_ratings_apply_intensity_penalty(&ratings);
-    ride_ratings_apply_adjustments(ride, &ratings);
-
-    ride->ratings = ratings;
-
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
-
-    ride->sheltered_eighths = 7;
-}
-
-static void ride_ratings_calculate_3d_cinema(Ride* ride)
-{
-    ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
-    ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
-    ride->unreliability_factor = 21;
-    set_unreliability_factor(ride);
+    ride_ratings_set(&ratings, RIDE_RATING(1, 42), RIDE_RATING(1, 73), RIDE_RATING(0, 40));
+    ride_ratings_apply_length(&ratings, ride, 700, 32768);
 
-    // Base ratings
-    rating_tuple ratings;
-    switch (ride->mode)
+    if (ride->mode == RIDE_MODE_RACE && ride->num_vehicles >= 4)
     {
-        default:
-        case RIDE_MODE_3D_FILM_MOUSE_TAILS:
-            ratings.excitement = RIDE_RATING(3, 50);
-            ratings.intensity = RIDE_RATING(2, 40);
-            ratings.nausea = RIDE_RATING(1, 40);
-            break;
-        case RIDE_MODE_3D_FILM_STORM_CHASERS:
-            ratings.excitement = RIDE_RATING(4, 00);
-            ratings.intensity = RIDE_RATING(2, 65);
-            ratings.nausea = RIDE_RATING(1, 55);
-            break;
-        case RIDE_MODE_3D_FILM_SPACE_RAIDERS:
-            ratings.excitement = RIDE_RATING(4, 20);
-            ratings.intensity = RIDE_RATING(2, 60);
-            ratings.nausea = RIDE_RATING(1, 48);
-            break;
-    }
-
-    ride_ratings_apply_intensity_penalty(&ratings);
-    ride_ratings_apply_adjustments(ride, &ratings);
-
-    ride->ratings = ratings;
-
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
-
-    ride->sheltered_eighths |= 7;
-}
-
-static void ride_ratings_calculate_top_spin(Ride* ride)
-{
-    ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
-    ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
-    ride->unreliability_factor = 19;
-    set_unreliability_factor(ride);
+        ride_ratings_add(&ratings, RIDE_RATING(1, 40), RIDE_RATING(0, 50), 0);
 
-    // Base ratings
-    rating_tuple ratings;
-    switch (ride->mode)
-    {
-        default:
-        case RIDE_MODE_BEGINNERS:
-            ratings.excitement = RIDE_RATING(2, 00);
-            ratings.intensity = RIDE_RATING(4, 80);
-            ratings.nausea = RIDE_RATING(5, 74);
-            break;
-        case RIDE_MODE_INTENSE:
-            ratings.excitement = RIDE_RATING(3, 00);
-            ratings.intensity = RIDE_RATING(5, 75);
-            ratings.nausea = RIDE_RATING(6, 64);
-            break;
-        case RIDE_MODE_BERSERK:
-            ratings.excitement = RIDE_RATING(3, 20);
-            ratings.intensity = RIDE_RATING(6, 80);
-            ratings.nausea = RIDE_RATING(7, 94);
-            break;
+        int32_t lapsFactor = (ride->num_laps - 1) * 30;
+        ride_ratings_add(&ratings, lapsFactor, lapsFactor / 2, 0);
     }
 
-    ride_ratings_apply_scenery(&ratings, ride, 11155);
-
-    ride_ratings_apply_intensity_penalty(&ratings);
-    ride_ratings_apply_adjustments(ride, &ratings);
-
-    ride->ratings = ratings;
-
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
-
-    ride->sheltered_eighths = 0;
-}
-
-static void ride_ratings_calculate_space_rings(Ride* ride)
-{
-    ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
-    ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
-    ride->unreliability_factor = 7;
-    set_unreliability_factor(ride);
-
-    rating_tuple ratings;
-    ride_ratings_set(&ratings, RIDE_RATING(1, 50), RIDE_RATING(2, 10), RIDE_RATING(6, 50));
-    ride_ratings_apply_scenery(&ratings, ride, 25098);
-
-    ride_ratings_apply_intensity_penalty(&ratings);
-    ride_ratings_apply_adjustments(ride, &ratings);
-
-    ride->ratings = ratings;
-
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
-
-    ride->sheltered_eighths = 0;
-}
-
-static void ride_ratings_calculate_reverse_freefall_coaster(Ride* ride)
-{
-    if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
-        return;
-
-    ride->unreliability_factor = 25;
-    set_unreliability_factor(ride);
-
-    rating_tuple ratings;
-    ride_ratings_set(&ratings, RIDE_RATING(2, 00), RIDE_RATING(3, 20), RIDE_RATING(2, 80));
-    ride_ratings_apply_length(&ratings, ride, 6000, 327);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 60), RIDE_RATING(0, 15));
-    ride_ratings_apply_max_speed(&ratings, ride, 436906, 436906, 320398);
-    ride_ratings_apply_gforces(&ratings, ride, 24576, 41704, 59578);
-    ride_ratings_apply_sheltered_ratings(&ratings, ride, 12850, 28398, 11702);
-    ride_ratings_apply_proximity(&ratings, 17893);
-    ride_ratings_apply_scenery(&ratings, ride, 11155);
-    ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 34, 2, 2, 2);
-
-    ride_ratings_apply_intensity_penalty(&ratings);
-    ride_ratings_apply_adjustments(ride, &ratings);
-
-    ride->ratings = ratings;
-
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
-
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
-}
-
-static void ride_ratings_calculate_lift(Ride* ride)
-{
-    int32_t totalLength;
-
-    if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
-        return;
-
-    ride->unreliability_factor = 15;
-    set_unreliability_factor(ride);
-
-    rating_tuple ratings;
-    ride_ratings_set(&ratings, RIDE_RATING(1, 11), RIDE_RATING(0, 35), RIDE_RATING(0, 30));
-
-    totalLength = ride_get_total_length(ride) >> 16;
-    ride_ratings_add(&ratings, (totalLength * 45875) >> 16, 0, (totalLength * 26214) >> 16);
-
+    ride_ratings_apply_turns(&ratings, ride, 4458, 3476, 5718);
+    ride_ratings_apply_drops(&ratings, ride, 8738, 5461, 6553);
+    ride_ratings_apply_sheltered_ratings(&ratings, ride, 2570, 8738, 2340);
     ride_ratings_apply_proximity(&ratings, 11183);
-    ride_ratings_apply_scenery(&ratings, ride, 83662);
-
-    ride_ratings_apply_intensity_penalty(&ratings);
-    ride_ratings_apply_adjustments(ride, &ratings);
-
-    ride->ratings = ratings;
-
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
-
-    ride->sheltered_eighths = 7;
-
-    if ((get_num_of_sheltered_eighths(ride).TrackShelteredEighths) >= 5)
-        ride->excitement /= 4;
-}
-
-static void ride_ratings_calculate_vertical_drop_roller_coaster(Ride* ride)
-{
-    if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
-        return;
-
-    ride->unreliability_factor = 16;
-    set_unreliability_factor(ride);
-
-    rating_tuple ratings;
-    ride_ratings_set(&ratings, RIDE_RATING(3, 20), RIDE_RATING(0, 80), RIDE_RATING(0, 30));
-    ride_ratings_apply_length(&ratings, ride, 4000, 1146);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 40), RIDE_RATING(0, 05));
-    ride_ratings_apply_max_speed(&ratings, ride, 97418, 141699, 70849);
-    ride_ratings_apply_average_speed(&ratings, ride, 291271, 436906);
-    ride_ratings_apply_duration(&ratings, ride, 150, 26214);
-    ride_ratings_apply_gforces(&ratings, ride, 40960, 35746, 49648);
-    ride_ratings_apply_turns(&ratings, ride, 26749, 34767, 45749);
-    ride_ratings_apply_drops(&ratings, ride, 58254, 46811, 49152);
-    ride_ratings_apply_sheltered_ratings(&ratings, ride, 15420, 32768, 35108);
-    ride_ratings_apply_proximity(&ratings, 20130);
-    ride_ratings_apply_scenery(&ratings, ride, 6693);
-    ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 20, 2, 2, 2);
-    ride_ratings_apply_max_speed_penalty(&ratings, ride, 0xA0000, 2, 2, 2);
-    ride_ratings_apply_max_negative_g_penalty(&ratings, ride, FIXED_2DP(0, 10), 2, 2, 2);
-    ride_ratings_apply_num_drops_penalty(&ratings, ride, 1, 2, 2, 2);
+    ride_ratings_apply_scenery(&ratings, ride, 16732);
 
-    ride_ratings_apply_excessive_lateral_g_penalty(&ratings, ride, 40960, 35746, 49648);
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
@@ -3063,49 +2152,36 @@ static void ride_ratings_calculate_vertical_drop_roller_coaster(Ride* ride)
     ride->upkeep_cost = ride_compute_upkeep(ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
-}
-
-static void ride_ratings_calculate_cash_machine(Ride* ride)
-{
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
-}
-
-static void ride_ratings_calculate_twist(Ride* ride)
-{
-    ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
-    ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
-    ride->unreliability_factor = 16;
-    set_unreliability_factor(ride);
-
-    rating_tuple ratings;
-    ride_ratings_set(&ratings, RIDE_RATING(1, 13), RIDE_RATING(0, 97), RIDE_RATING(1, 90));
-    ride_ratings_apply_rotations(&ratings, ride, 20, 20, 20);
-    ride_ratings_apply_scenery(&ratings, ride, 13943);
-    ride_ratings_apply_intensity_penalty(&ratings);
-    ride_ratings_apply_adjustments(ride, &ratings);
-
-    ride->ratings = ratings;
-
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+    auto shelteredEighths = get_num_of_sheltered_eighths(ride);
+    ride->sheltered_eighths = shelteredEighths.TotalShelteredEighths;
 
-    ride->sheltered_eighths = 0;
+    if (shelteredEighths.TrackShelteredEighths >= 6)
+        ride->excitement /= 2;
 }
 
-static void ride_ratings_calculate_haunted_house(Ride* ride)
+static void ride_ratings_calculate_dodgems(Ride* ride)
 {
     ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
     ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
-    ride->unreliability_factor = 8;
+    ride->unreliability_factor = 16;
     set_unreliability_factor(ride);
 
-    rating_tuple ratings = {
-        /* .excitement =  */ RIDE_RATING(3, 41),
-        /* .intensity =  */ RIDE_RATING(1, 53),
-        /* .nausea =  */ RIDE_RATING(0, 10),
-    };
+    rating_tuple ratings;
+    ride_ratings_set(&ratings, RIDE_RATING(1, 30), RIDE_RATING(0, 50), RIDE_RATING(0, 35));
+
+    if (ride->num_vehicles >= 4)
+    {
+        ride_ratings_add(&ratings, RIDE_RATING(0, 40), 0, 0);
+    }
+
+    ride_ratings_add(&ratings, ride->operation_option, ride->operation_option / 2, 0);
+
+    if (ride->num_vehicles >= 4)
+    {
+        ride_ratings_add(&ratings, RIDE_RATING(0, 40), 0, 0);
+    }
+
+    ride_ratings_apply_scenery(&ratings, ride, 5577);
 
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
@@ -3118,40 +2194,20 @@ static void ride_ratings_calculate_haunted_house(Ride* ride)
     ride->sheltered_eighths = 7;
 }
 
-static void ride_ratings_calculate_flying_roller_coaster(Ride* ride)
+static void ride_ratings_calculate_pirate_ship(Ride* ride)
 {
-    if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
-        return;
-
-    ride->unreliability_factor = 17;
+    ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
+    ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
+    ride->unreliability_factor = 10;
     set_unreliability_factor(ride);
 
     rating_tuple ratings;
-    ride_ratings_set(&ratings, RIDE_RATING(4, 35), RIDE_RATING(1, 85), RIDE_RATING(4, 33));
-    ride_ratings_apply_length(&ratings, ride, 6000, 764);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 40), RIDE_RATING(0, 05));
-    ride_ratings_apply_train_length(&ratings, ride, 187245);
-    ride_ratings_apply_max_speed(&ratings, ride, 44281, 88562, 35424);
-    ride_ratings_apply_average_speed(&ratings, ride, 291271, 436906);
-    ride_ratings_apply_duration(&ratings, ride, 150, 26214);
-    ride_ratings_apply_gforces(&ratings, ride, 24576, 38130, 49648);
-    ride_ratings_apply_turns(&ratings, ride, 26749, 34767, 45749);
-    ride_ratings_apply_drops(&ratings, ride, 29127, 46811, 49152);
-    ride_ratings_apply_sheltered_ratings(&ratings, ride, 15420, 32768, 35108);
-    ride_ratings_apply_proximity(&ratings, 20130);
-    ride_ratings_apply_scenery(&ratings, ride, 6693);
-
-    if (ride->inversions == 0)
-        ratings.excitement /= 2;
-
-    ride_ratings_apply_max_speed_penalty(&ratings, ride, 0xA0000, 2, 1, 1);
+    ride_ratings_set(&ratings, RIDE_RATING(1, 50), RIDE_RATING(1, 90), RIDE_RATING(1, 41));
 
-    if (ride->inversions == 0)
-        ride_ratings_apply_max_negative_g_penalty(&ratings, ride, FIXED_2DP(0, 40), 2, 1, 1);
+    ride_ratings_add(&ratings, ride->operation_option * 5, ride->operation_option * 5, ride->operation_option * 10);
 
-    ride_ratings_apply_num_drops_penalty(&ratings, ride, 2, 2, 1, 1);
+    ride_ratings_apply_scenery(&ratings, ride, 16732);
 
-    ride_ratings_apply_excessive_lateral_g_penalty(&ratings, ride, 24576, 38130, 49648);
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
@@ -3160,35 +2216,23 @@ static void ride_ratings_calculate_flying_roller_coaster(Ride* ride)
     ride->upkeep_cost = ride_compute_upkeep(ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
+    ride->sheltered_eighths = 0;
 }
 
-static void ride_ratings_calculate_virginia_reel(Ride* ride)
+static void ride_ratings_calculate_inverter_ship(Ride* ride)
 {
-    if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
-        return;
-
-    ride->unreliability_factor = 19;
+    ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
+    ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
+    ride->unreliability_factor = 16;
     set_unreliability_factor(ride);
 
     rating_tuple ratings;
-    ride_ratings_set(&ratings, RIDE_RATING(2, 10), RIDE_RATING(1, 90), RIDE_RATING(3, 70));
-    ride_ratings_apply_length(&ratings, ride, 6000, 873);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 40), RIDE_RATING(0, 05));
-    ride_ratings_apply_train_length(&ratings, ride, 187245);
-    ride_ratings_apply_max_speed(&ratings, ride, 44281, 88562, 35424);
-    ride_ratings_apply_average_speed(&ratings, ride, 364088, 655360);
-    ride_ratings_apply_duration(&ratings, ride, 150, 26214);
-    ride_ratings_apply_gforces(&ratings, ride, 110592, 29789, 59578);
-    ride_ratings_apply_turns(&ratings, ride, 52012, 26075, 45749);
-    ride_ratings_apply_drops(&ratings, ride, 43690, 46811, 49152);
-    ride_ratings_apply_sheltered_ratings(&ratings, ride, 16705, 30583, 35108);
-    ride_ratings_apply_proximity(&ratings, 22367);
+    ride_ratings_set(&ratings, RIDE_RATING(2, 50), RIDE_RATING(2, 70), RIDE_RATING(2, 74));
+
+    ride_ratings_add(&ratings, ride->operation_option * 11, ride->operation_option * 22, ride->operation_option * 22);
+
     ride_ratings_apply_scenery(&ratings, ride, 11155);
-    ride_ratings_apply_first_length_penalty(&ratings, ride, 0xD20000, 2, 2, 2);
-    ride_ratings_apply_num_drops_penalty(&ratings, ride, 2, 2, 2, 2);
 
-    ride_ratings_apply_excessive_lateral_g_penalty(&ratings, ride, 110592, 29789, 59578);
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
@@ -3197,30 +2241,38 @@ static void ride_ratings_calculate_virginia_reel(Ride* ride)
     ride->upkeep_cost = ride_compute_upkeep(ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
+    ride->sheltered_eighths = 0;
 }
 
-static void ride_ratings_calculate_splash_boats(Ride* ride)
+static void ride_ratings_calculate_food_stall(Ride* ride)
 {
-    if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
-        return;
+    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+}
 
-    ride->unreliability_factor = 15;
+static void ride_ratings_calculate_drink_stall(Ride* ride)
+{
+    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+}
+
+static void ride_ratings_calculate_shop(Ride* ride)
+{
+    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+}
+
+static void ride_ratings_calculate_merry_go_round(Ride* ride)
+{
+    ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
+    ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
+    ride->unreliability_factor = 16;
     set_unreliability_factor(ride);
 
     rating_tuple ratings;
-    ride_ratings_set(&ratings, RIDE_RATING(1, 46), RIDE_RATING(0, 35), RIDE_RATING(0, 30));
-    ride_ratings_apply_length(&ratings, ride, 2000, 7208);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 40), RIDE_RATING(0, 05));
-    ride_ratings_apply_max_speed(&ratings, ride, 797059, 655360, 301111);
-    ride_ratings_apply_duration(&ratings, ride, 500, 13107);
-    ride_ratings_apply_turns(&ratings, ride, 22291, 20860, 4574);
-    ride_ratings_apply_drops(&ratings, ride, 87381, 93622, 62259);
-    ride_ratings_apply_sheltered_ratings(&ratings, ride, 16705, 30583, 35108);
-    ride_ratings_apply_proximity(&ratings, 22367);
-    ride_ratings_apply_scenery(&ratings, ride, 11155);
-    ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 6, 2, 2, 2);
-
+    ride_ratings_set(&ratings, RIDE_RATING(0, 60), RIDE_RATING(0, 15), RIDE_RATING(0, 30));
+    ride_ratings_apply_rotations(&ratings, ride, 5, 5, 5);
+    ride_ratings_apply_scenery(&ratings, ride, 19521);
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
@@ -3229,32 +2281,32 @@ static void ride_ratings_calculate_splash_boats(Ride* ride)
     ride->upkeep_cost = ride_compute_upkeep(ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
+    ride->sheltered_eighths = 7;
 }
 
-static void ride_ratings_calculate_mini_helicopters(Ride* ride)
+static void ride_ratings_calculate_information_kiosk(Ride* ride)
 {
-    if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
-        return;
+    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+}
 
-    ride->unreliability_factor = 12;
+static void ride_ratings_calculate_toilets(Ride* ride)
+{
+    ride->upkeep_cost = ride_compute_upkeep(ride);
+    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+}
+
+static void ride_ratings_calculate_ferris_wheel(Ride* ride)
+{
+    ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
+    ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
+    ride->unreliability_factor = 16;
     set_unreliability_factor(ride);
 
     rating_tuple ratings;
-    ride_ratings_set(&ratings, RIDE_RATING(1, 60), RIDE_RATING(0, 40), RIDE_RATING(0, 00));
-    ride_ratings_apply_length(&ratings, ride, 6000, 764);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 15), RIDE_RATING(0, 00));
-    ride_ratings_apply_train_length(&ratings, ride, 187245);
-    ride_ratings_apply_max_speed(&ratings, ride, 44281, 88562, 35424);
-    ride_ratings_apply_average_speed(&ratings, ride, 291271, 436906);
-    ride_ratings_apply_duration(&ratings, ride, 150, 26214);
-    ride_ratings_apply_turns(&ratings, ride, 14860, 0, 4574);
-    ride_ratings_apply_drops(&ratings, ride, 8738, 0, 0);
-    ride_ratings_apply_sheltered_ratings(&ratings, ride, 12850, 6553, 4681);
-    ride_ratings_apply_proximity(&ratings, 8946);
-    ride_ratings_apply_scenery(&ratings, ride, 8366);
-    ride_ratings_apply_first_length_penalty(&ratings, ride, 0xA00000, 2, 2, 2);
-
+    ride_ratings_set(&ratings, RIDE_RATING(0, 60), RIDE_RATING(0, 25), RIDE_RATING(0, 30));
+    ride_ratings_apply_rotations(&ratings, ride, 25, 25, 25);
+    ride_ratings_apply_scenery(&ratings, ride, 41831);
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
@@ -3263,48 +2315,31 @@ static void ride_ratings_calculate_mini_helicopters(Ride* ride)
     ride->upkeep_cost = ride_compute_upkeep(ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
-    ride->sheltered_eighths = 6;
+    ride->sheltered_eighths = 0;
 }
 
-static void ride_ratings_calculate_lay_down_roller_coaster(Ride* ride)
+static void ride_ratings_calculate_motion_simulator(Ride* ride)
 {
-    if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
-        return;
-
-    ride->unreliability_factor = 18;
+    ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
+    ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
+    ride->unreliability_factor = 21;
     set_unreliability_factor(ride);
 
+    // Base ratings
     rating_tuple ratings;
-    ride_ratings_set(&ratings, RIDE_RATING(3, 85), RIDE_RATING(1, 15), RIDE_RATING(2, 75));
-    ride_ratings_apply_length(&ratings, ride, 6000, 764);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 40), RIDE_RATING(0, 05));
-    ride_ratings_apply_train_length(&ratings, ride, 187245);
-    ride_ratings_apply_max_speed(&ratings, ride, 44281, 88562, 35424);
-    ride_ratings_apply_average_speed(&ratings, ride, 291271, 436906);
-    ride_ratings_apply_duration(&ratings, ride, 150, 26214);
-    ride_ratings_apply_gforces(&ratings, ride, 24576, 38130, 49648);
-    ride_ratings_apply_turns(&ratings, ride, 26749, 34767, 45749);
-    ride_ratings_apply_drops(&ratings, ride, 29127, 46811, 49152);
-    ride_ratings_apply_sheltered_ratings(&ratings, ride, 15420, 32768, 35108);
-    ride_ratings_apply_proximity(&ratings, 20130);
-    ride_ratings_apply_scenery(&ratings, ride, 6693);
-
-    if (ride->inversions == 0)
+    if (ride->mode == RIDE_MODE_FILM_THRILL_RIDERS)
     {
-        ratings.excitement /= 4;
-        ratings.intensity /= 2;
-        ratings.nausea /= 2;
+        ratings.excitement = RIDE_RATING(3, 25);
+        ratings.intensity = RIDE_RATING(4, 10);
+        ratings.nausea = RIDE_RATING(3, 30);
     }
-
-    ride_ratings_apply_max_speed_penalty(&ratings, ride, 0xA0000, 2, 2, 2);
-
-    if (ride->inversions == 0)
+    else
     {
-        ride_ratings_apply_max_negative_g_penalty(&ratings, ride, FIXED_2DP(0, 40), 2, 2, 2);
-        ride_ratings_apply_num_drops_penalty(&ratings, ride, 2, 2, 2, 2);
+        ratings.excitement = RIDE_RATING(2, 90);
+        ratings.intensity = RIDE_RATING(3, 50);
+        ratings.nausea = RIDE_RATING(3, 00);
     }
 
-    ride_ratings_apply_excessive_lateral_g_penalty(&ratings, ride, 24576, 38130, 49648);
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
@@ -3313,28 +2348,37 @@ static void ride_ratings_calculate_lay_down_roller_coaster(Ride* ride)
     ride->upkeep_cost = ride_compute_upkeep(ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
+    ride->sheltered_eighths = 7;
 }
 
-static void ride_ratings_calculate_suspended_monorail(Ride* ride)
+static void ride_ratings_calculate_3d_cinema(Ride* ride)
 {
-    if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
-        return;
-
-    ride->unreliability_factor = 14;
+    ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
+    ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
+    ride->unreliability_factor = 21;
     set_unreliability_factor(ride);
 
+    // Base ratings
     rating_tuple ratings;
-    ride_ratings_set(&ratings, RIDE_RATING(2, 15), RIDE_RATING(0, 23), RIDE_RATING(0, 8));
-    ride_ratings_apply_length(&ratings, ride, 6000, 764);
-    ride_ratings_apply_train_length(&ratings, ride, 93622);
-    ride_ratings_apply_max_speed(&ratings, ride, 44281, 70849, 35424);
-    ride_ratings_apply_average_speed(&ratings, ride, 291271, 218453);
-    ride_ratings_apply_duration(&ratings, ride, 150, 21845);
-    ride_ratings_apply_sheltered_ratings(&ratings, ride, 5140, 6553, 18724);
-    ride_ratings_apply_proximity(&ratings, 12525);
-    ride_ratings_apply_scenery(&ratings, ride, 25098);
-    ride_ratings_apply_first_length_penalty(&ratings, ride, 0xAA0000, 2, 2, 2);
+    switch (ride->mode)
+    {
+        default:
+        case RIDE_MODE_3D_FILM_MOUSE_TAILS:
+            ratings.excitement = RIDE_RATING(3, 50);
+            ratings.intensity = RIDE_RATING(2, 40);
+            ratings.nausea = RIDE_RATING(1, 40);
+            break;
+        case RIDE_MODE_3D_FILM_STORM_CHASERS:
+            ratings.excitement = RIDE_RATING(4, 00);
+            ratings.intensity = RIDE_RATING(2, 65);
+            ratings.nausea = RIDE_RATING(1, 55);
+            break;
+        case RIDE_MODE_3D_FILM_SPACE_RAIDERS:
+            ratings.excitement = RIDE_RATING(4, 20);
+            ratings.intensity = RIDE_RATING(2, 60);
+            ratings.nausea = RIDE_RATING(1, 48);
+            break;
+    }
 
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
@@ -3344,50 +2388,40 @@ static void ride_ratings_calculate_suspended_monorail(Ride* ride)
     ride->upkeep_cost = ride_compute_upkeep(ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
-    auto shelteredEighths = get_num_of_sheltered_eighths(ride);
-    if (shelteredEighths.TrackShelteredEighths >= 4)
-        ride->excitement /= 4;
-
-    ride->sheltered_eighths = shelteredEighths.TotalShelteredEighths;
+    ride->sheltered_eighths |= 7;
 }
 
-static void ride_ratings_calculate_reverser_roller_coaster(Ride* ride)
+static void ride_ratings_calculate_top_spin(Ride* ride)
 {
-    if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
-        return;
-
+    ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
+    ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
     ride->unreliability_factor = 19;
     set_unreliability_factor(ride);
 
+    // Base ratings
     rating_tuple ratings;
-    ride_ratings_set(&ratings, RIDE_RATING(2, 40), RIDE_RATING(1, 80), RIDE_RATING(1, 70));
-    ride_ratings_apply_length(&ratings, ride, 6000, 873);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 40), RIDE_RATING(0, 05));
-    ride_ratings_apply_train_length(&ratings, ride, 187245);
-    ride_ratings_apply_max_speed(&ratings, ride, 44281, 88562, 35424);
-    ride_ratings_apply_average_speed(&ratings, ride, 364088, 655360);
-
-    int32_t numReversers = std::min<uint16_t>(gRideRatingsCalcData.num_reversers, 6);
-    ride_rating reverserRating = numReversers * RIDE_RATING(0, 20);
-    ride_ratings_add(&ratings, reverserRating, reverserRating, reverserRating);
-
-    ride_ratings_apply_duration(&ratings, ride, 150, 26214);
-    ride_ratings_apply_gforces(&ratings, ride, 28672, 23831, 49648);
-    ride_ratings_apply_turns(&ratings, ride, 26749, 43458, 45749);
-    ride_ratings_apply_drops(&ratings, ride, 40777, 46811, 49152);
-    ride_ratings_apply_sheltered_ratings(&ratings, ride, 16705, 30583, 35108);
-    ride_ratings_apply_proximity(&ratings, 22367);
-    ride_ratings_apply_scenery(&ratings, ride, 11155);
-
-    if (gRideRatingsCalcData.num_reversers < 1)
+    switch (ride->mode)
     {
-        ratings.excitement /= 8;
+        default:
+        case RIDE_MODE_BEGINNERS:
+            ratings.excitement = RIDE_RATING(2, 00);
+            ratings.intensity = RIDE_RATING(4, 80);
+            ratings.nausea = RIDE_RATING(5, 74);
+            break;
+        case RIDE_MODE_INTENSE:
+            ratings.excitement = RIDE_RATING(3, 00);
+            ratings.intensity = RIDE_RATING(5, 75);
+            ratings.nausea = RIDE_RATING(6, 64);
+            break;
+        case RIDE_MODE_BERSERK:
+            ratings.excitement = RIDE_RATING(3, 20);
+            ratings.intensity = RIDE_RATING(6, 80);
+            ratings.nausea = RIDE_RATING(7, 94);
+            break;
     }
 
-    ride_ratings_apply_first_length_penalty(&ratings, ride, 0xC80000, 2, 1, 1);
-    ride_ratings_apply_num_drops_penalty(&ratings, ride, 2, 2, 1, 1);
+    ride_ratings_apply_scenery(&ratings, ride, 11155);
 
-    ride_ratings_apply_excessive_lateral_g_penalty(&ratings, ride, 28672, 23831, 49648);
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
@@ -3396,38 +2430,20 @@ static void ride_ratings_calculate_reverser_roller_coaster(Ride* ride)
     ride->upkeep_cost = ride_compute_upkeep(ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
+    ride->sheltered_eighths = 0;
 }
 
-static void ride_ratings_calculate_heartline_twister_coaster(Ride* ride)
+static void ride_ratings_calculate_space_rings(Ride* ride)
 {
-    if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
-        return;
-
-    ride->unreliability_factor = 18;
+    ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
+    ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
+    ride->unreliability_factor = 7;
     set_unreliability_factor(ride);
 
     rating_tuple ratings;
-    ride_ratings_set(&ratings, RIDE_RATING(1, 40), RIDE_RATING(1, 70), RIDE_RATING(1, 65));
-    ride_ratings_apply_length(&ratings, ride, 6000, 764);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 20), RIDE_RATING(0, 04));
-    ride_ratings_apply_train_length(&ratings, ride, 187245);
-    ride_ratings_apply_max_speed(&ratings, ride, 97418, 123987, 70849);
-    ride_ratings_apply_average_speed(&ratings, ride, 291271, 436906);
-    ride_ratings_apply_duration(&ratings, ride, 150, 26214);
-    ride_ratings_apply_gforces(&ratings, ride, 24576, 44683, 89367);
-    ride_ratings_apply_turns(&ratings, ride, 26749, 52150, 57186);
-    ride_ratings_apply_drops(&ratings, ride, 29127, 53052, 55705);
-    ride_ratings_apply_sheltered_ratings(&ratings, ride, 15420, 34952, 35108);
-    ride_ratings_apply_proximity(&ratings, 9841);
-    ride_ratings_apply_scenery(&ratings, ride, 3904);
-
-    if (ride->inversions == 0)
-        ratings.excitement /= 4;
-
-    ride_ratings_apply_num_drops_penalty(&ratings, ride, 1, 4, 1, 1);
+    ride_ratings_set(&ratings, RIDE_RATING(1, 50), RIDE_RATING(2, 10), RIDE_RATING(6, 50));
+    ride_ratings_apply_scenery(&ratings, ride, 25098);
 
-    ride_ratings_apply_excessive_lateral_g_penalty(&ratings, ride, 24576, 44683, 89367);
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
@@ -3436,35 +2452,27 @@ static void ride_ratings_calculate_heartline_twister_coaster(Ride* ride)
     ride->upkeep_cost = ride_compute_upkeep(ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
+    ride->sheltered_eighths = 0;
 }
 
-static void ride_ratings_calculate_mini_golf(Ride* ride)
+static void ride_ratings_calculate_lift(Ride* ride)
 {
+    int32_t totalLength;
+
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
 
-    ride->unreliability_factor = 0;
+    ride->unreliability_factor = 15;
     set_unreliability_factor(ride);
 
     rating_tuple ratings;
-    ride_ratings_set(&ratings, RIDE_RATING(1, 50), RIDE_RATING(0, 90), RIDE_RATING(0, 00));
-    ride_ratings_apply_length(&ratings, ride, 6000, 873);
-    ride_ratings_apply_turns(&ratings, ride, 14860, 0, 0);
-    ride_ratings_apply_sheltered_ratings(&ratings, ride, 5140, 6553, 4681);
-    ride_ratings_apply_proximity(&ratings, 15657);
-    ride_ratings_apply_scenery(&ratings, ride, 27887);
+    ride_ratings_set(&ratings, RIDE_RATING(1, 11), RIDE_RATING(0, 35), RIDE_RATING(0, 30));
 
-    // Apply golf holes factor
-    ride_ratings_add(&ratings, (ride->holes) * 5, 0, 0);
+    totalLength = ride_get_total_length(ride) >> 16;
+    ride_ratings_add(&ratings, (totalLength * 45875) >> 16, 0, (totalLength * 26214) >> 16);
 
-    // Apply no golf holes penalty
-    if (ride->holes == 0)
-    {
-        ratings.excitement /= 8;
-        ratings.intensity /= 2;
-        ratings.nausea /= 2;
-    }
+    ride_ratings_apply_proximity(&ratings, 11183);
+    ride_ratings_apply_scenery(&ratings, ride, 83662);
 
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
@@ -3474,28 +2482,29 @@ static void ride_ratings_calculate_mini_golf(Ride* ride)
     ride->upkeep_cost = ride_compute_upkeep(ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
+    ride->sheltered_eighths = 7;
+
+    if ((get_num_of_sheltered_eighths(ride).TrackShelteredEighths) >= 5)
+        ride->excitement /= 4;
 }
 
-static void ride_ratings_calculate_first_aid(Ride* ride)
+static void ride_ratings_calculate_cash_machine(Ride* ride)
 {
     ride->upkeep_cost = ride_compute_upkeep(ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 }
 
-static void ride_ratings_calculate_circus_show(Ride* ride)
+static void ride_ratings_calculate_twist(Ride* ride)
 {
     ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
     ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
-    ride->unreliability_factor = 9;
+    ride->unreliability_factor = 16;
     set_unreliability_factor(ride);
 
-    rating_tuple ratings = {
-        /* .excitement = */ RIDE_RATING(2, 10),
-        /* .intensity  = */ RIDE_RATING(0, 30),
-        /* .nausea     = */ RIDE_RATING(0, 0),
-    };
-
+    rating_tuple ratings;
+    ride_ratings_set(&ratings, RIDE_RATING(1, 13), RIDE_RATING(0, 97), RIDE_RATING(1, 90));
+    ride_ratings_apply_rotations(&ratings, ride, 20, 20, 20);
+    ride_ratings_apply_scenery(&ratings, ride, 13943);
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
@@ -3504,30 +2513,21 @@ static void ride_ratings_calculate_circus_show(Ride* ride)
     ride->upkeep_cost = ride_compute_upkeep(ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
-    ride->sheltered_eighths = 7;
+    ride->sheltered_eighths = 0;
 }
 
-static void ride_ratings_calculate_ghost_train(Ride* ride)
+static void ride_ratings_calculate_haunted_house(Ride* ride)
 {
-    if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
-        return;
-
-    ride->unreliability_factor = 12;
+    ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
+    ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
+    ride->unreliability_factor = 8;
     set_unreliability_factor(ride);
 
-    rating_tuple ratings;
-    ride_ratings_set(&ratings, RIDE_RATING(2, 00), RIDE_RATING(0, 20), RIDE_RATING(0, 03));
-    ride_ratings_apply_length(&ratings, ride, 6000, 764);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 15), RIDE_RATING(0, 00));
-    ride_ratings_apply_max_speed(&ratings, ride, 44281, 88562, 35424);
-    ride_ratings_apply_average_speed(&ratings, ride, 291271, 436906);
-    ride_ratings_apply_duration(&ratings, ride, 150, 26214);
-    ride_ratings_apply_turns(&ratings, ride, 14860, 0, 11437);
-    ride_ratings_apply_drops(&ratings, ride, 8738, 0, 0);
-    ride_ratings_apply_sheltered_ratings(&ratings, ride, 25700, 6553, 4681);
-    ride_ratings_apply_proximity(&ratings, 11183);
-    ride_ratings_apply_scenery(&ratings, ride, 8366);
-    ride_ratings_apply_first_length_penalty(&ratings, ride, 0xB40000, 2, 2, 2);
+    rating_tuple ratings = {
+        /* .excitement =  */ RIDE_RATING(3, 41),
+        /* .intensity =  */ RIDE_RATING(1, 53),
+        /* .nausea =  */ RIDE_RATING(0, 10),
+    };
 
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
@@ -3537,44 +2537,32 @@ static void ride_ratings_calculate_ghost_train(Ride* ride)
     ride->upkeep_cost = ride_compute_upkeep(ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
+    ride->sheltered_eighths = 7;
 }
 
-static void ride_ratings_calculate_twister_roller_coaster(Ride* ride)
+static void ride_ratings_calculate_mini_helicopters(Ride* ride)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
 
-    ride->unreliability_factor = 15;
+    ride->unreliability_factor = 12;
     set_unreliability_factor(ride);
 
     rating_tuple ratings;
-    ride_ratings_set(&ratings, RIDE_RATING(3, 50), RIDE_RATING(0, 40), RIDE_RATING(0, 30));
+    ride_ratings_set(&ratings, RIDE_RATING(1, 60), RIDE_RATING(0, 40), RIDE_RATING(0, 00));
     ride_ratings_apply_length(&ratings, ride, 6000, 764);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 40), RIDE_RATING(0, 05));
+    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 15), RIDE_RATING(0, 00));
     ride_ratings_apply_train_length(&ratings, ride, 187245);
     ride_ratings_apply_max_speed(&ratings, ride, 44281, 88562, 35424);
     ride_ratings_apply_average_speed(&ratings, ride, 291271, 436906);
     ride_ratings_apply_duration(&ratings, ride, 150, 26214);
-    ride_ratings_apply_gforces(&ratings, ride, 24576, 32768, 49648);
-    ride_ratings_apply_turns(&ratings, ride, 26749, 34767, 45749);
-    ride_ratings_apply_drops(&ratings, ride, 29127, 46811, 49152);
-    ride_ratings_apply_sheltered_ratings(&ratings, ride, 15420, 32768, 35108);
-    ride_ratings_apply_proximity(&ratings, 20130);
-    ride_ratings_apply_scenery(&ratings, ride, 6693);
-
-    if (ride->inversions == 0)
-        ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 12, 2, 2, 2);
-
-    ride_ratings_apply_max_speed_penalty(&ratings, ride, 0xA0000, 2, 2, 2);
-
-    if (ride->inversions == 0)
-    {
-        ride_ratings_apply_max_negative_g_penalty(&ratings, ride, FIXED_2DP(0, 40), 2, 2, 2);
-        ride_ratings_apply_num_drops_penalty(&ratings, ride, 2, 2, 2, 2);
-    }
+    ride_ratings_apply_turns(&ratings, ride, 14860, 0, 4574);
+    ride_ratings_apply_drops(&ratings, ride, 8738, 0, 0);
+    ride_ratings_apply_sheltered_ratings(&ratings, ride, 12850, 6553, 4681);
+    ride_ratings_apply_proximity(&ratings, 8946);
+    ride_ratings_apply_scenery(&ratings, ride, 8366);
+    ride_ratings_apply_first_length_penalty(&ratings, ride, 0xA00000, 2, 2, 2);
 
-    ride_ratings_apply_excessive_lateral_g_penalty(&ratings, ride, 24576, 32768, 49648);
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
@@ -3583,10 +2571,10 @@ static void ride_ratings_calculate_twister_roller_coaster(Ride* ride)
     ride->upkeep_cost = ride_compute_upkeep(ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
+    ride->sheltered_eighths = 6;
 }
 
-static void ride_ratings_calculate_wooden_roller_coaster(Ride* ride)
+static void ride_ratings_calculate_reverser_roller_coaster(Ride* ride)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
@@ -3595,65 +2583,34 @@ static void ride_ratings_calculate_wooden_roller_coaster(Ride* ride)
     set_unreliability_factor(ride);
 
     rating_tuple ratings;
-    ride_ratings_set(&ratings, RIDE_RATING(3, 20), RIDE_RATING(2, 60), RIDE_RATING(2, 00));
+    ride_ratings_set(&ratings, RIDE_RATING(2, 40), RIDE_RATING(1, 80), RIDE_RATING(1, 70));
     ride_ratings_apply_length(&ratings, ride, 6000, 873);
     ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 40), RIDE_RATING(0, 05));
     ride_ratings_apply_train_length(&ratings, ride, 187245);
     ride_ratings_apply_max_speed(&ratings, ride, 44281, 88562, 35424);
     ride_ratings_apply_average_speed(&ratings, ride, 364088, 655360);
-    ride_ratings_apply_duration(&ratings, ride, 150, 26214);
-    ride_ratings_apply_gforces(&ratings, ride, 40960, 34555, 49648);
-    ride_ratings_apply_turns(&ratings, ride, 26749, 43458, 45749);
-    ride_ratings_apply_drops(&ratings, ride, 40777, 46811, 49152);
-    ride_ratings_apply_sheltered_ratings(&ratings, ride, 16705, 30583, 35108);
-    ride_ratings_apply_proximity(&ratings, 22367);
-    ride_ratings_apply_scenery(&ratings, ride, 11155);
-    ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 12, 2, 2, 2);
-    ride_ratings_apply_max_speed_penalty(&ratings, ride, 0xA0000, 2, 2, 2);
-    ride_ratings_apply_max_negative_g_penalty(&ratings, ride, FIXED_2DP(0, 10), 2, 2, 2);
-    ride_ratings_apply_first_length_penalty(&ratings, ride, 0x1720000, 2, 2, 2);
-    ride_ratings_apply_num_drops_penalty(&ratings, ride, 2, 2, 2, 2);
-
-    ride_ratings_apply_excessive_lateral_g_penalty(&ratings, ride, 40960, 34555, 49648);
-    ride_ratings_apply_intensity_penalty(&ratings);
-    ride_ratings_apply_adjustments(ride, &ratings);
 
-    ride->ratings = ratings;
-
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
-
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
-}
-
-static void ride_ratings_calculate_side_friction_roller_coaster(Ride* ride)
-{
-    if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
-        return;
-
-    ride->unreliability_factor = 19;
-    set_unreliability_factor(ride);
+    int32_t numReversers = std::min<uint16_t>(gRideRatingsCalcData.num_reversers, 6);
+    ride_rating reverserRating = numReversers * RIDE_RATING(0, 20);
+    ride_ratings_add(&ratings, reverserRating, reverserRating, reverserRating);
 
-    rating_tuple ratings;
-    ride_ratings_set(&ratings, RIDE_RATING(2, 50), RIDE_RATING(2, 00), RIDE_RATING(1, 50));
-    ride_ratings_apply_length(&ratings, ride, 6000, 873);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 40), RIDE_RATING(0, 05));
-    ride_ratings_apply_train_length(&ratings, ride, 187245);
-    ride_ratings_apply_max_speed(&ratings, ride, 44281, 88562, 35424);
-    ride_ratings_apply_average_speed(&ratings, ride, 364088, 655360);
     ride_ratings_apply_duration(&ratings, ride, 150, 26214);
-    ride_ratings_apply_gforces(&ratings, ride, 28672, 35746, 49648);
+    ride_ratings_apply_gforces(&ratings, ride, 28672, 23831, 49648);
     ride_ratings_apply_turns(&ratings, ride, 26749, 43458, 45749);
     ride_ratings_apply_drops(&ratings, ride, 40777, 46811, 49152);
     ride_ratings_apply_sheltered_ratings(&ratings, ride, 16705, 30583, 35108);
     ride_ratings_apply_proximity(&ratings, 22367);
     ride_ratings_apply_scenery(&ratings, ride, 11155);
-    ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 6, 2, 2, 2);
-    ride_ratings_apply_max_speed_penalty(&ratings, ride, 0x50000, 2, 2, 2);
-    ride_ratings_apply_first_length_penalty(&ratings, ride, 0xFA0000, 2, 2, 2);
-    ride_ratings_apply_num_drops_penalty(&ratings, ride, 2, 2, 2, 2);
 
-    ride_ratings_apply_excessive_lateral_g_penalty(&ratings, ride, 28672, 35746, 49648);
+    if (gRideRatingsCalcData.num_reversers < 1)
+    {
+        ratings.excitement /= 8;
+    }
+
+    ride_ratings_apply_first_length_penalty(&ratings, ride, 0xC80000, 2, 1, 1);
+    ride_ratings_apply_num_drops_penalty(&ratings, ride, 2, 2, 1, 1);
+
+    ride_ratings_apply_excessive_lateral_g_penalty(&ratings, ride, 28672, 23831, 49648);
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
@@ -3665,35 +2622,33 @@ static void ride_ratings_calculate_side_friction_roller_coaster(Ride* ride)
     ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-static void ride_ratings_calculate_wild_mouse(Ride* ride)
+static void ride_ratings_calculate_mini_golf(Ride* ride)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
         return;
 
-    ride->unreliability_factor = 14;
+    ride->unreliability_factor = 0;
     set_unreliability_factor(ride);
 
     rating_tuple ratings;
-    ride_ratings_set(&ratings, RIDE_RATING(2, 80), RIDE_RATING(2, 50), RIDE_RATING(2, 10));
+    ride_ratings_set(&ratings, RIDE_RATING(1, 50), RIDE_RATING(0, 90), RIDE_RATING(0, 00));
     ride_ratings_apply_length(&ratings, ride, 6000, 873);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 40), RIDE_RATING(0, 8));
-    ride_ratings_apply_train_length(&ratings, ride, 187245);
-    ride_ratings_apply_max_speed(&ratings, ride, 44281, 88562, 35424);
-    ride_ratings_apply_average_speed(&ratings, ride, 364088, 655360);
-    ride_ratings_apply_duration(&ratings, ride, 150, 26214);
-    ride_ratings_apply_gforces(&ratings, ride, 102400, 35746, 49648);
-    ride_ratings_apply_turns(&ratings, ride, 29721, 43458, 45749);
-    ride_ratings_apply_drops(&ratings, ride, 40777, 46811, 49152);
-    ride_ratings_apply_sheltered_ratings(&ratings, ride, 16705, 30583, 35108);
-    ride_ratings_apply_proximity(&ratings, 17893);
-    ride_ratings_apply_scenery(&ratings, ride, 5577);
-    ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 6, 2, 2, 2);
-    ride_ratings_apply_max_speed_penalty(&ratings, ride, 0x70000, 2, 2, 2);
-    ride_ratings_apply_max_lateral_g_penalty(&ratings, ride, FIXED_2DP(1, 50), 2, 2, 2);
-    ride_ratings_apply_first_length_penalty(&ratings, ride, 0xAA0000, 2, 2, 2);
-    ride_ratings_apply_num_drops_penalty(&ratings, ride, 2, 2, 2, 2);
+    ride_ratings_apply_turns(&ratings, ride, 14860, 0, 0);
+    ride_ratings_apply_sheltered_ratings(&ratings, ride, 5140, 6553, 4681);
+    ride_ratings_apply_proximity(&ratings, 15657);
+    ride_ratings_apply_scenery(&ratings, ride, 27887);
+
+    // Apply golf holes factor
+    ride_ratings_add(&ratings, (ride->holes) * 5, 0, 0);
+
+    // Apply no golf holes penalty
+    if (ride->holes == 0)
+    {
+        ratings.excitement /= 8;
+        ratings.intensity /= 2;
+        ratings.nausea /= 2;
+    }
 
-    ride_ratings_apply_excessive_lateral_g_penalty(&ratings, ride, 102400, 35746, 49648);
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
@@ -3705,86 +2660,25 @@ static void ride_ratings_calculate_wild_mouse(Ride* ride)
     ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-static void ride_ratings_calculate_multi_dimension_roller_coaster(Ride* ride)
+static void ride_ratings_calculate_first_aid(Ride* ride)
 {
-    if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
-        return;
-
-    ride->unreliability_factor = 18;
-    set_unreliability_factor(ride);
-
-    rating_tuple ratings;
-    ride_ratings_set(&ratings, RIDE_RATING(3, 75), RIDE_RATING(1, 95), RIDE_RATING(4, 79));
-    ride_ratings_apply_length(&ratings, ride, 6000, 764);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 40), RIDE_RATING(0, 05));
-    ride_ratings_apply_train_length(&ratings, ride, 187245);
-    ride_ratings_apply_max_speed(&ratings, ride, 44281, 88562, 35424);
-    ride_ratings_apply_average_speed(&ratings, ride, 291271, 436906);
-    ride_ratings_apply_duration(&ratings, ride, 150, 26214);
-    ride_ratings_apply_gforces(&ratings, ride, 24576, 38130, 49648);
-    ride_ratings_apply_turns(&ratings, ride, 26749, 34767, 45749);
-    ride_ratings_apply_drops(&ratings, ride, 29127, 46811, 49152);
-    ride_ratings_apply_sheltered_ratings(&ratings, ride, 15420, 32768, 35108);
-    ride_ratings_apply_proximity(&ratings, 20130);
-    ride_ratings_apply_scenery(&ratings, ride, 6693);
-
-    if (ride->inversions == 0)
-        ratings.excitement /= 4;
-
-    ride_ratings_apply_max_speed_penalty(&ratings, ride, 0xA0000, 2, 1, 1);
-    if (ride->inversions == 0)
-        ride_ratings_apply_max_negative_g_penalty(&ratings, ride, FIXED_2DP(0, 40), 2, 1, 1);
-
-    if (ride->inversions == 0)
-        ride_ratings_apply_num_drops_penalty(&ratings, ride, 2, 2, 1, 1);
-
-    ride_ratings_apply_excessive_lateral_g_penalty(&ratings, ride, 24576, 38130, 49648);
-    ride_ratings_apply_intensity_penalty(&ratings);
-    ride_ratings_apply_adjustments(ride, &ratings);
-
-    ride->ratings = ratings;
-
     ride->upkeep_cost = ride_compute_upkeep(ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
-
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-static void ride_ratings_calculate_giga_coaster(Ride* ride)
+static void ride_ratings_calculate_circus_show(Ride* ride)
 {
-    if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
-        return;
-
-    ride->unreliability_factor = 14;
+    ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
+    ride->lifecycle_flags |= RIDE_LIFECYCLE_NO_RAW_STATS;
+    ride->unreliability_factor = 9;
     set_unreliability_factor(ride);
 
-    rating_tuple ratings;
-    ride_ratings_set(&ratings, RIDE_RATING(3, 85), RIDE_RATING(0, 40), RIDE_RATING(0, 35));
-    ride_ratings_apply_length(&ratings, ride, 6000, 819);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 40), RIDE_RATING(0, 05));
-    ride_ratings_apply_train_length(&ratings, ride, 140434);
-    ride_ratings_apply_max_speed(&ratings, ride, 51366, 85019, 35424);
-    ride_ratings_apply_average_speed(&ratings, ride, 364088, 400497);
-    ride_ratings_apply_duration(&ratings, ride, 150, 26214);
-    ride_ratings_apply_gforces(&ratings, ride, 36864, 30384, 49648);
-    ride_ratings_apply_turns(&ratings, ride, 28235, 34767, 45749);
-    ride_ratings_apply_drops(&ratings, ride, 43690, 46811, 49152);
-    ride_ratings_apply_sheltered_ratings(&ratings, ride, 15420, 32768, 35108);
-    ride_ratings_apply_proximity(&ratings, 20130);
-    ride_ratings_apply_scenery(&ratings, ride, 6693);
-
-    if (ride->inversions == 0)
-        ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 16, 2, 2, 2);
-
-    ride_ratings_apply_max_speed_penalty(&ratings, ride, 0xA0000, 2, 2, 2);
-
-    if (ride->inversions == 0)
-    {
-        ride_ratings_apply_max_negative_g_penalty(&ratings, ride, FIXED_2DP(0, 40), 2, 2, 2);
-        ride_ratings_apply_num_drops_penalty(&ratings, ride, 2, 2, 2, 2);
-    }
+    rating_tuple ratings = {
+        /* .excitement = */ RIDE_RATING(2, 10),
+        /* .intensity  = */ RIDE_RATING(0, 30),
+        /* .nausea     = */ RIDE_RATING(0, 0),
+    };
 
-    ride_ratings_apply_excessive_lateral_g_penalty(&ratings, ride, 36864, 30384, 49648);
     ride_ratings_apply_intensity_penalty(&ratings);
     ride_ratings_apply_adjustments(ride, &ratings);
 
@@ -3793,7 +2687,7 @@ static void ride_ratings_calculate_giga_coaster(Ride* ride)
     ride->upkeep_cost = ride_compute_upkeep(ride);
     ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
 
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
+    ride->sheltered_eighths = 7;
 }
 
 static void ride_ratings_calculate_roto_drop(Ride* ride)
@@ -3886,40 +2780,6 @@ static void ride_ratings_calculate_crooked_house(Ride* ride)
     ride->sheltered_eighths = 7;
 }
 
-static void ride_ratings_calculate_monorail_cycles(Ride* ride)
-{
-    if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
-        return;
-
-    ride->unreliability_factor = 4;
-    set_unreliability_factor(ride);
-
-    rating_tuple ratings;
-    ride_ratings_set(&ratings, RIDE_RATING(1, 40), RIDE_RATING(0, 20), RIDE_RATING(0, 00));
-    ride_ratings_apply_length(&ratings, ride, 6000, 764);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 15), RIDE_RATING(0, 00));
-    ride_ratings_apply_train_length(&ratings, ride, 187245);
-    ride_ratings_apply_max_speed(&ratings, ride, 44281, 88562, 35424);
-    ride_ratings_apply_average_speed(&ratings, ride, 291271, 436906);
-    ride_ratings_apply_duration(&ratings, ride, 150, 26214);
-    ride_ratings_apply_turns(&ratings, ride, 14860, 0, 4574);
-    ride_ratings_apply_drops(&ratings, ride, 8738, 0, 0);
-    ride_ratings_apply_sheltered_ratings(&ratings, ride, 5140, 6553, 2340);
-    ride_ratings_apply_proximity(&ratings, 8946);
-    ride_ratings_apply_scenery(&ratings, ride, 11155);
-    ride_ratings_apply_first_length_penalty(&ratings, ride, 0x8C0000, 2, 2, 2);
-
-    ride_ratings_apply_intensity_penalty(&ratings);
-    ride_ratings_apply_adjustments(ride, &ratings);
-
-    ride->ratings = ratings;
-
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
-
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
-}
-
 static void ride_ratings_calculate_compact_inverted_coaster(Ride* ride)
 {
     if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
@@ -4004,78 +2864,6 @@ static void ride_ratings_calculate_water_coaster(Ride* ride)
     ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-static void ride_ratings_calculate_air_powered_vertical_coaster(Ride* ride)
-{
-    if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
-        return;
-
-    ride->unreliability_factor = 28;
-    set_unreliability_factor(ride);
-
-    rating_tuple ratings;
-    ride_ratings_set(&ratings, RIDE_RATING(4, 13), RIDE_RATING(2, 50), RIDE_RATING(2, 80));
-    ride_ratings_apply_length(&ratings, ride, 6000, 327);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 60), RIDE_RATING(0, 05));
-    ride_ratings_apply_max_speed(&ratings, ride, 509724, 364088, 320398);
-    ride_ratings_apply_gforces(&ratings, ride, 24576, 35746, 59578);
-    ride_ratings_apply_sheltered_ratings(&ratings, ride, 15420, 21845, 11702);
-    ride_ratings_apply_proximity(&ratings, 17893);
-    ride_ratings_apply_scenery(&ratings, ride, 11155);
-    ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 34, 2, 1, 1);
-
-    ride_ratings_apply_excessive_lateral_g_penalty(&ratings, ride, 24576, 35746, 59578);
-    ride_ratings_apply_intensity_penalty(&ratings);
-    ride_ratings_apply_adjustments(ride, &ratings);
-
-    ride->ratings = ratings;
-
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
-
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
-}
-
-static void ride_ratings_calculate_inverted_hairpin_coaster(Ride* ride)
-{
-    if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
-        return;
-
-    ride->unreliability_factor = 14;
-    set_unreliability_factor(ride);
-
-    rating_tuple ratings;
-    ride_ratings_set(&ratings, RIDE_RATING(3, 00), RIDE_RATING(2, 65), RIDE_RATING(2, 25));
-    ride_ratings_apply_length(&ratings, ride, 6000, 873);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 40), RIDE_RATING(0, 8));
-    ride_ratings_apply_train_length(&ratings, ride, 187245);
-    ride_ratings_apply_max_speed(&ratings, ride, 44281, 88562, 35424);
-    ride_ratings_apply_average_speed(&ratings, ride, 364088, 655360);
-    ride_ratings_apply_duration(&ratings, ride, 150, 26214);
-    ride_ratings_apply_gforces(&ratings, ride, 102400, 35746, 49648);
-    ride_ratings_apply_turns(&ratings, ride, 29721, 43458, 45749);
-    ride_ratings_apply_drops(&ratings, ride, 40777, 46811, 49152);
-    ride_ratings_apply_sheltered_ratings(&ratings, ride, 16705, 30583, 35108);
-    ride_ratings_apply_proximity(&ratings, 17893);
-    ride_ratings_apply_scenery(&ratings, ride, 5577);
-    ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 8, 2, 2, 2);
-    ride_ratings_apply_max_speed_penalty(&ratings, ride, 0x70000, 2, 2, 2);
-    ride_ratings_apply_max_negative_g_penalty(&ratings, ride, FIXED_2DP(0, 10), 2, 2, 2);
-    ride_ratings_apply_max_lateral_g_penalty(&ratings, ride, FIXED_2DP(1, 50), 2, 2, 2);
-    ride_ratings_apply_first_length_penalty(&ratings, ride, 0xAA0000, 2, 2, 2);
-    ride_ratings_apply_num_drops_penalty(&ratings, ride, 3, 2, 2, 2);
-
-    ride_ratings_apply_excessive_lateral_g_penalty(&ratings, ride, 102400, 35746, 49648);
-    ride_ratings_apply_intensity_penalty(&ratings);
-    ride_ratings_apply_adjustments(ride, &ratings);
-
-    ride->ratings = ratings;
-
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
-
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
-}
-
 static void ride_ratings_calculate_magic_carpet(Ride* ride)
 {
     ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
@@ -4126,36 +2914,6 @@ static void ride_ratings_calculate_submarine_ride(Ride* ride)
     ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
 }
 
-static void ride_ratings_calculate_river_rafts(Ride* ride)
-{
-    if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
-        return;
-
-    ride->unreliability_factor = 12;
-    set_unreliability_factor(ride);
-
-    rating_tuple ratings;
-    ride_ratings_set(&ratings, RIDE_RATING(1, 45), RIDE_RATING(0, 25), RIDE_RATING(0, 34));
-    ride_ratings_apply_length(&ratings, ride, 2000, 7208);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 40), RIDE_RATING(0, 05));
-    ride_ratings_apply_max_speed(&ratings, ride, 531372, 655360, 301111);
-    ride_ratings_apply_duration(&ratings, ride, 500, 13107);
-    ride_ratings_apply_turns(&ratings, ride, 22291, 20860, 4574);
-    ride_ratings_apply_drops(&ratings, ride, 78643, 93622, 62259);
-    ride_ratings_apply_proximity(&ratings, 13420);
-    ride_ratings_apply_scenery(&ratings, ride, 11155);
-
-    ride_ratings_apply_intensity_penalty(&ratings);
-    ride_ratings_apply_adjustments(ride, &ratings);
-
-    ride->ratings = ratings;
-
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
-
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
-}
-
 static void ride_ratings_calculate_enterprise(Ride* ride)
 {
     ride->lifecycle_flags |= RIDE_LIFECYCLE_TESTED;
@@ -4185,163 +2943,862 @@ static void ride_ratings_calculate_enterprise(Ride* ride)
     ride->sheltered_eighths = 3;
 }
 
-static void ride_ratings_calculate_inverted_impulse_coaster(Ride* ride)
-{
-    if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
-        return;
+#pragma endregion
 
-    ride->unreliability_factor = 20;
-    set_unreliability_factor(ride);
+#pragma region Ride rating descriptors
+
+// clang-format off
+static constexpr RideRatingsDescriptor SpiralRollerCoasterRatings = {
+    14, 14, { RIDE_RATING(3, 30), RIDE_RATING(0, 30), RIDE_RATING(0, 30) }, 0,
+    {{
+        { RatingsModifierType::BonusLength, 6000, 819, 0, 0 },
+        { RatingsModifierType::BonusSynchronisation, 0, RIDE_RATING(0, 40), RIDE_RATING(0, 05), 0 },
+        { RatingsModifierType::BonusTrainLength, 0, 140434, 0, 0 },
+        { RatingsModifierType::BonusMaxSpeed, 0, 51366, 85019, 35424 },
+        { RatingsModifierType::BonusAverageSpeed, 0, 364088, 400497, 0 },
+        { RatingsModifierType::BonusDuration, 150, 26214, 0, 0 },
+        { RatingsModifierType::BonusGForces, 0, 36864, 30384, 49648 },
+        { RatingsModifierType::BonusTurns, 0, 28235, 34767, 45749 },
+        { RatingsModifierType::BonusDrops, 0, 43690, 46811, 49152 },
+        { RatingsModifierType::BonusSheltered, 0, 15420, 32768, 35108 },
+        { RatingsModifierType::BonusProximity, 0, 20130, 0, 0 },
+        { RatingsModifierType::BonusScenery, 0, 6693, 0, 0 },
+        { RatingsModifierType::RequirementDropHeight, 12, 2, 2, 2, true },
+        { RatingsModifierType::RequirementMaxSpeed, 0xA0000, 2, 2, 2 },
+        { RatingsModifierType::RequirementNegativeGs, FIXED_2DP(0, 40), 2, 2, 2, true },
+        { RatingsModifierType::RequirementNumDrops, 2, 2, 2, 2, true },
+        { RatingsModifierType::PenaltyLateralGs, 0, 36864, 30384, 49648 },
+    }},
+};
 
-    rating_tuple ratings;
-    ride_ratings_set(&ratings, RIDE_RATING(4, 00), RIDE_RATING(3, 00), RIDE_RATING(3, 20));
-    ride_ratings_apply_length(&ratings, ride, 6000, 764);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 42), RIDE_RATING(0, 05));
-    ride_ratings_apply_train_length(&ratings, ride, 187245);
-    ride_ratings_apply_max_speed(&ratings, ride, 44281, 88562, 35424);
-    ride_ratings_apply_average_speed(&ratings, ride, 291271, 436906);
-    ride_ratings_apply_duration(&ratings, ride, 150, 26214);
-    ride_ratings_apply_gforces(&ratings, ride, 24576, 29789, 55606);
-    ride_ratings_apply_turns(&ratings, ride, 26749, 29552, 57186);
-    ride_ratings_apply_drops(&ratings, ride, 29127, 39009, 49152);
-    ride_ratings_apply_sheltered_ratings(&ratings, ride, 15420, 15291, 35108);
-    ride_ratings_apply_proximity(&ratings, 15657);
-    ride_ratings_apply_scenery(&ratings, ride, 9760);
-    ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 20, 2, 2, 2);
-    ride_ratings_apply_max_speed_penalty(&ratings, ride, 0xA0000, 2, 2, 2);
+static constexpr RideRatingsDescriptor StandUpRollerCoasterRatings = {
+    17, 17, { RIDE_RATING(2, 50), RIDE_RATING(3, 00), RIDE_RATING(3, 00) }, 0,
+    {{
+        { RatingsModifierType::BonusLength, 6000, 764, 0, 0 },
+        { RatingsModifierType::BonusSynchronisation, 0, RIDE_RATING(0, 40), RIDE_RATING(0, 10), 0 },
+        { RatingsModifierType::BonusTrainLength, 0, 187245, 0, 0 },
+        { RatingsModifierType::BonusMaxSpeed, 0, 44281, 123987, 35424 },
+        { RatingsModifierType::BonusAverageSpeed, 0, 291271, 436906, 0 },
+        { RatingsModifierType::BonusDuration, 150, 26214, 0, 0 },
+        { RatingsModifierType::BonusGForces, 0, 24576, 35746, 59578 },
+        { RatingsModifierType::BonusTurns, 0, 26749, 34767, 45749 },
+        { RatingsModifierType::BonusDrops, 0, 34952, 46811, 49152 },
+        { RatingsModifierType::BonusSheltered, 0, 12850, 28398, 30427 },
+        { RatingsModifierType::BonusProximity, 0, 17893, 0, 0 },
+        { RatingsModifierType::BonusScenery, 0, 5577, 0, 0 },
+        { RatingsModifierType::RequirementDropHeight, 12, 2, 2, 2 },
+        { RatingsModifierType::RequirementMaxSpeed, 0xA0000, 2, 2, 2 },
+        { RatingsModifierType::RequirementNegativeGs, FIXED_2DP(0, 50), 2, 2, 2 },
+        { RatingsModifierType::PenaltyLateralGs, 0, 24576, 35746, 59578 },
+    }},
+};
 
-    ride_ratings_apply_excessive_lateral_g_penalty(&ratings, ride, 24576, 29789, 55606);
-    ride_ratings_apply_intensity_penalty(&ratings);
-    ride_ratings_apply_adjustments(ride, &ratings);
+static constexpr RideRatingsDescriptor SuspendedSwingingCoasterRatings = {
+    18, 18, { RIDE_RATING(3, 30), RIDE_RATING(2, 90), RIDE_RATING(3, 50) }, 0,
+    {{
+        { RatingsModifierType::BonusLength, 6000, 764, 0, 0 },
+        { RatingsModifierType::BonusSynchronisation, 0, RIDE_RATING(0, 40), RIDE_RATING(0, 10), 0 },
+        { RatingsModifierType::BonusTrainLength, 0, 187245, 0, 0 },
+        { RatingsModifierType::BonusMaxSpeed, 0, 44281, 88562, 35424 },
+        { RatingsModifierType::BonusAverageSpeed, 0, 291271, 436906, 0 },
+        { RatingsModifierType::BonusDuration, 150, 26214, 0, 0 },
+        { RatingsModifierType::BonusGForces, 0, 32768, 23831, 79437 },
+        { RatingsModifierType::BonusTurns, 0, 26749, 34767, 48036 },
+        { RatingsModifierType::BonusDrops, 0, 29127, 46811, 49152 },
+        { RatingsModifierType::BonusSheltered, 0, 15420, 32768, 35108 },
+        { RatingsModifierType::BonusProximity, 0, 20130, 0, 0 },
+        { RatingsModifierType::BonusScenery, 0, 6971, 0, 0 },
+        { RatingsModifierType::RequirementDropHeight, 8, 2, 2, 2 },
+        { RatingsModifierType::RequirementMaxSpeed, 0xC0000, 2, 2, 2 },
+        { RatingsModifierType::RequirementNegativeGs, FIXED_2DP(0, 60), 2, 2, 2 },
+        { RatingsModifierType::RequirementLateralGs, FIXED_2DP(1, 50), 2, 2, 2 },
+        { RatingsModifierType::RequirementLength, 0x1720000, 2, 2, 2 },
+        { RatingsModifierType::PenaltyLateralGs, 0, 32768, 23831, 79437 },
+    }},
+};
 
-    ride->ratings = ratings;
+static constexpr RideRatingsDescriptor InvertedRollerCoasterRatings = {
+    17, 17, { RIDE_RATING(3, 60), RIDE_RATING(2, 80), RIDE_RATING(3, 20) }, 0,
+    {{
+        { RatingsModifierType::BonusLength, 6000, 764, 0, 0 },
+        { RatingsModifierType::BonusSynchronisation, 0, RIDE_RATING(0, 42), RIDE_RATING(0, 05), 0 },
+        { RatingsModifierType::BonusTrainLength, 0, 187245, 0, 0 },
+        { RatingsModifierType::BonusMaxSpeed, 0, 44281, 88562, 35424 },
+        { RatingsModifierType::BonusAverageSpeed, 0, 291271, 436906, 0 },
+        { RatingsModifierType::BonusDuration, 150, 26214, 0, 0 },
+        { RatingsModifierType::BonusGForces, 0, 24576, 29789, 55606 },
+        { RatingsModifierType::BonusTurns, 0, 26749, 29552, 57186 },
+        { RatingsModifierType::BonusDrops, 0, 29127, 39009, 49152 },
+        { RatingsModifierType::BonusSheltered, 0, 15420, 15291, 35108 },
+        { RatingsModifierType::BonusProximity, 0, 15657, 0, 0 },
+        { RatingsModifierType::BonusScenery, 0, 8366, 0, 0 },
+        { RatingsModifierType::RequirementDropHeight, 12, 2, 2, 2, true },
+        { RatingsModifierType::RequirementMaxSpeed, 0xA0000, 2, 2, 2 },
+        { RatingsModifierType::RequirementNegativeGs, FIXED_2DP(0, 30), 2, 2, 2, true },
+        { RatingsModifierType::PenaltyLateralGs, 0, 24576, 29789, 55606 },
+    }},
+};
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+static constexpr RideRatingsDescriptor JuniorRollerCoasterRatings = {
+    13, 13, { RIDE_RATING(2, 40), RIDE_RATING(2, 50), RIDE_RATING(1, 80) }, 0,
+    {{
+        { RatingsModifierType::BonusLength, 6000, 764, 0, 0 },
+        { RatingsModifierType::BonusSynchronisation, 0, RIDE_RATING(0, 40), RIDE_RATING(0, 05), 0 },
+        { RatingsModifierType::BonusTrainLength, 0, 187245, 0, 0 },
+        { RatingsModifierType::BonusMaxSpeed, 0, 44281, 88562, 35424 },
+        { RatingsModifierType::BonusAverageSpeed, 0, 291271, 436906, 0 },
+        { RatingsModifierType::BonusDuration, 150, 26214, 0, 0 },
+        { RatingsModifierType::BonusGForces, 0, 20480, 23831, 49648 },
+        { RatingsModifierType::BonusTurns, 0, 26749, 34767, 45749 },
+        { RatingsModifierType::BonusDrops, 0, 29127, 46811, 49152 },
+        { RatingsModifierType::BonusSheltered, 0, 25700, 30583, 35108 },
+        { RatingsModifierType::BonusProximity, 0, 20130, 0, 0 },
+        { RatingsModifierType::BonusScenery, 0, 9760, 0, 0 },
+        { RatingsModifierType::RequirementDropHeight, 6, 2, 2, 2 },
+        { RatingsModifierType::RequirementMaxSpeed, 0x70000, 2, 2, 2 },
+        { RatingsModifierType::RequirementNumDrops, 1, 2, 2, 2 },
+        { RatingsModifierType::PenaltyLateralGs, 0, 20480, 23831, 49648 },
+    }},
+};
 
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
-}
+static constexpr RideRatingsDescriptor MiniatureRailwayRatings = {
+    11, 11, { RIDE_RATING(2, 50), RIDE_RATING(0, 00), RIDE_RATING(0, 00) }, 4,
+    {{
+        { RatingsModifierType::BonusLength, 6000, 764, 0, 0 },
+        { RatingsModifierType::BonusTrainLength, 0, 140434, 0, 0 },
+        { RatingsModifierType::BonusMaxSpeed, 0, 44281, 88562, 35424 },
+        { RatingsModifierType::BonusAverageSpeed, 0, 291271, 436906, 0 },
+        { RatingsModifierType::BonusDuration, 150, 26214, 0, 0 },
+        { RatingsModifierType::BonusSheltered, 0, -6425, 6553, 23405 },
+        { RatingsModifierType::BonusProximity, 0, 8946, 0, 0 },
+        { RatingsModifierType::BonusScenery, 0, 20915, 0, 0 },
+        { RatingsModifierType::RequirementLength, 0xC80000, 2, 2, 2 },
+    }},
+};
 
-static void ride_ratings_calculate_mini_roller_coaster(Ride* ride)
-{
-    if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
-        return;
+static constexpr RideRatingsDescriptor MonorailRatings = {
+    14, 14, { RIDE_RATING(2, 00), RIDE_RATING(0, 00), RIDE_RATING(0, 00) }, 4,
+    {{
+        { RatingsModifierType::BonusLength, 6000, 764, 0, 0 },
+        { RatingsModifierType::BonusTrainLength, 0, 93622, 0, 0 },
+        { RatingsModifierType::BonusMaxSpeed, 0, 44281, 70849, 35424 },
+        { RatingsModifierType::BonusAverageSpeed, 0, 291271, 218453, 0 },
+        { RatingsModifierType::BonusDuration, 150, 21845, 0, 0 },
+        { RatingsModifierType::BonusSheltered, 0, 5140, 6553, 18724 },
+        { RatingsModifierType::BonusProximity, 0, 8946, 0, 0 },
+        { RatingsModifierType::BonusScenery, 0, 16732, 0, 0 },
+        { RatingsModifierType::RequirementLength, 0xAA0000, 2, 2, 2 },
+    }},
+};
 
-    ride->unreliability_factor = 13;
-    set_unreliability_factor(ride);
+static constexpr RideRatingsDescriptor MiniSuspendedCoasterRatings = {
+    15, 15, { RIDE_RATING(2, 80), RIDE_RATING(2, 50), RIDE_RATING(2, 70) }, 0,
+    {{
+        { RatingsModifierType::BonusLength, 6000, 764, 0, 0 },
+        { RatingsModifierType::BonusSynchronisation, 0, RIDE_RATING(0, 45), RIDE_RATING(0, 15), 0 },
+        { RatingsModifierType::BonusTrainLength, 0, 187245, 0, 0 },
+        { RatingsModifierType::BonusMaxSpeed, 0, 44281, 88562, 35424 },
+        { RatingsModifierType::BonusAverageSpeed, 0, 291271, 436906, 0 },
+        { RatingsModifierType::BonusDuration, 150, 26214, 0, 0 },
+        { RatingsModifierType::BonusGForces, 0, 24576, 35746, 49648 },
+        { RatingsModifierType::BonusTurns, 0, 34179, 34767, 45749 },
+        { RatingsModifierType::BonusDrops, 0, 58254, 46811, 49152 },
+        { RatingsModifierType::BonusSheltered, 0, 19275, 32768, 35108 },
+        { RatingsModifierType::BonusProximity, 0, 20130, 0, 0 },
+        { RatingsModifierType::BonusScenery, 0, 13943, 0, 0 },
+        { RatingsModifierType::RequirementDropHeight, 6, 2, 2, 2 },
+        { RatingsModifierType::RequirementMaxSpeed, 0x80000, 2, 2, 2 },
+        { RatingsModifierType::RequirementLateralGs, FIXED_2DP(1, 30), 2, 2, 2 },
+        { RatingsModifierType::RequirementLength, 0xC80000, 2, 2, 2 },
+        { RatingsModifierType::PenaltyLateralGs, 0, 24576, 35746, 49648 },
+    }},
+};
 
-    rating_tuple ratings;
-    ride_ratings_set(&ratings, RIDE_RATING(2, 55), RIDE_RATING(2, 40), RIDE_RATING(1, 85));
-    ride_ratings_apply_length(&ratings, ride, 6000, 764);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 40), RIDE_RATING(0, 05));
-    ride_ratings_apply_train_length(&ratings, ride, 187245);
-    ride_ratings_apply_max_speed(&ratings, ride, 44281, 88562, 35424);
-    ride_ratings_apply_average_speed(&ratings, ride, 291271, 436906);
-    ride_ratings_apply_duration(&ratings, ride, 150, 26214);
-    ride_ratings_apply_gforces(&ratings, ride, 20480, 23831, 49648);
-    ride_ratings_apply_turns(&ratings, ride, 26749, 34767, 45749);
-    ride_ratings_apply_drops(&ratings, ride, 29127, 46811, 49152);
-    ride_ratings_apply_sheltered_ratings(&ratings, ride, 25700, 30583, 35108);
-    ride_ratings_apply_proximity(&ratings, 20130);
-    ride_ratings_apply_scenery(&ratings, ride, 9760);
-    ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 12, 2, 2, 2);
-    ride_ratings_apply_max_speed_penalty(&ratings, ride, 0x70000, 2, 2, 2);
-    ride_ratings_apply_max_negative_g_penalty(&ratings, ride, FIXED_2DP(0, 50), 2, 2, 2);
-    ride_ratings_apply_num_drops_penalty(&ratings, ride, 2, 2, 2, 2);
+static constexpr RideRatingsDescriptor WoodenWildMouseRatings = {
+    14, 14, { RIDE_RATING(2, 90), RIDE_RATING(2, 90), RIDE_RATING(2, 10) }, 0,
+    {{
+        { RatingsModifierType::BonusLength, 6000, 873, 0, 0 },
+        { RatingsModifierType::BonusSynchronisation, 0, RIDE_RATING(0, 40), RIDE_RATING(0, 8), 0 },
+        { RatingsModifierType::BonusTrainLength, 0, 187245, 0, 0 },
+        { RatingsModifierType::BonusMaxSpeed, 0, 44281, 88562, 35424 },
+        { RatingsModifierType::BonusAverageSpeed, 0, 364088, 655360, 0 },
+        { RatingsModifierType::BonusDuration, 150, 26214, 0, 0 },
+        { RatingsModifierType::BonusGForces, 0, 102400, 35746, 49648 },
+        { RatingsModifierType::BonusTurns, 0, 29721, 43458, 45749 },
+        { RatingsModifierType::BonusDrops, 0, 40777, 46811, 49152 },
+        { RatingsModifierType::BonusSheltered, 0, 16705, 30583, 35108 },
+        { RatingsModifierType::BonusProximity, 0, 17893, 0, 0 },
+        { RatingsModifierType::BonusScenery, 0, 5577, 0, 0 },
+        { RatingsModifierType::RequirementDropHeight, 8, 2, 2, 2 },
+        { RatingsModifierType::RequirementMaxSpeed, 0x70000, 2, 2, 2 },
+        { RatingsModifierType::RequirementNegativeGs, FIXED_2DP(0, 10), 2, 2, 2 },
+        { RatingsModifierType::RequirementLateralGs, FIXED_2DP(1, 50), 2, 2, 2 },
+        { RatingsModifierType::RequirementLength, 0xAA0000, 2, 2, 2 },
+        { RatingsModifierType::RequirementNumDrops, 3, 2, 2, 2 },
+        { RatingsModifierType::PenaltyLateralGs, 0, 102400, 35746, 49648 },
+    }},
+};
 
-    ride_ratings_apply_excessive_lateral_g_penalty(&ratings, ride, 20480, 23831, 49648);
-    ride_ratings_apply_intensity_penalty(&ratings);
-    ride_ratings_apply_adjustments(ride, &ratings);
+static constexpr RideRatingsDescriptor SteeplechaseRatings = {
+    14, 14, { RIDE_RATING(2, 70), RIDE_RATING(2, 40), RIDE_RATING(1, 80) }, 0,
+    {{
+        { RatingsModifierType::BonusLength, 6000, 764, 0, 0 },
+        { RatingsModifierType::BonusSynchronisation, 0, RIDE_RATING(0, 75), RIDE_RATING(0, 9), 0 },
+        { RatingsModifierType::BonusTrainLength, 0, 187245, 0, 0 },
+        { RatingsModifierType::BonusMaxSpeed, 0, 44281, 88562, 35424 },
+        { RatingsModifierType::BonusAverageSpeed, 0, 291271, 436906, 0 },
+        { RatingsModifierType::BonusDuration, 150, 26214, 0, 0 },
+        { RatingsModifierType::BonusGForces, 0, 20480, 20852, 49648 },
+        { RatingsModifierType::BonusTurns, 0, 26749, 34767, 45749 },
+        { RatingsModifierType::BonusDrops, 0, 29127, 46811, 49152 },
+        { RatingsModifierType::BonusSheltered, 0, 25700, 30583, 35108 },
+        { RatingsModifierType::BonusProximity, 0, 20130, 0, 0 },
+        { RatingsModifierType::BonusScenery, 0, 9760, 0, 0 },
+        { RatingsModifierType::RequirementDropHeight, 4, 2, 2, 2 },
+        { RatingsModifierType::RequirementMaxSpeed, 0x80000, 2, 2, 2 },
+        { RatingsModifierType::RequirementNegativeGs, FIXED_2DP(0, 50), 2, 2, 2 },
+        { RatingsModifierType::RequirementLength, 0xF00000, 2, 2, 2 },
+        { RatingsModifierType::RequirementNumDrops, 2, 2, 2, 2 },
+        { RatingsModifierType::PenaltyLateralGs, 0, 20480, 20852, 49648 },
+    }},
+};
 
-    ride->ratings = ratings;
+static constexpr RideRatingsDescriptor CarRideRatings = {
+    12, 12, { RIDE_RATING(2, 00), RIDE_RATING(0, 50), RIDE_RATING(0, 00) }, 0,
+    {{
+        { RatingsModifierType::BonusLength, 6000, 764, 0, 0 },
+        { RatingsModifierType::BonusSynchronisation, 0, RIDE_RATING(0, 15), RIDE_RATING(0, 00), 0 },
+        { RatingsModifierType::BonusTrainLength, 0, 187245, 0, 0 },
+        { RatingsModifierType::BonusMaxSpeed, 0, 44281, 88562, 35424 },
+        { RatingsModifierType::BonusAverageSpeed, 0, 291271, 436906, 0 },
+        { RatingsModifierType::BonusDuration, 150, 26214, 0, 0 },
+        { RatingsModifierType::BonusTurns, 0, 14860, 0, 11437 },
+        { RatingsModifierType::BonusDrops, 0, 8738, 0, 0 },
+        { RatingsModifierType::BonusSheltered, 0, 12850, 6553, 4681 },
+        { RatingsModifierType::BonusProximity, 0, 11183, 0, 0 },
+        { RatingsModifierType::BonusScenery, 0, 8366, 0, 0 },
+        { RatingsModifierType::RequirementLength, 0xC80000, 8, 2, 2 },
+    }},
+};
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+static constexpr RideRatingsDescriptor BobsleighCoasterRatings = {
+    16, 16, { RIDE_RATING(2, 80), RIDE_RATING(3, 20), RIDE_RATING(2, 50) }, 0,
+    {{
+        { RatingsModifierType::BonusLength, 6000, 764, 0, 0 },
+        { RatingsModifierType::BonusSynchronisation, 0, RIDE_RATING(0, 20), RIDE_RATING(0, 00), 0 },
+        { RatingsModifierType::BonusTrainLength, 0, 187245, 0, 0 },
+        { RatingsModifierType::BonusMaxSpeed, 0, 44281, 88562, 35424 },
+        { RatingsModifierType::BonusAverageSpeed, 0, 291271, 436906, 0 },
+        { RatingsModifierType::BonusDuration, 150, 26214, 0, 0 },
+        { RatingsModifierType::BonusGForces, 0, 65536, 23831, 49648 },
+        { RatingsModifierType::BonusTurns, 0, 26749, 34767, 45749 },
+        { RatingsModifierType::BonusDrops, 0, 29127, 46811, 49152 },
+        { RatingsModifierType::BonusSheltered, 0, 15420, 32768, 35108 },
+        { RatingsModifierType::BonusProximity, 0, 20130, 0, 0 },
+        { RatingsModifierType::BonusScenery, 0, 5577, 0, 0 },
+        { RatingsModifierType::RequirementMaxSpeed, 0xC0000, 2, 2, 2 },
+        { RatingsModifierType::RequirementLateralGs, FIXED_2DP(1, 20), 2, 2, 2 },
+        { RatingsModifierType::RequirementLength, 0x1720000, 2, 2, 2 },
+        { RatingsModifierType::PenaltyLateralGs, 0, 65536, 23831, 49648 },
+    }},
+};
 
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
-}
+static constexpr RideRatingsDescriptor LoopingRollerCoasterRatings = {
+    15, 20, { RIDE_RATING(3, 00), RIDE_RATING(0, 50), RIDE_RATING(0, 20) }, 0,
+    {{
+        { RatingsModifierType::BonusLength, 6000, 764, 0, 0 },
+        { RatingsModifierType::BonusSynchronisation, 0, RIDE_RATING(0, 40), RIDE_RATING(0, 05), 0 },
+        { RatingsModifierType::BonusTrainLength, 0, 187245, 0, 0 },
+        { RatingsModifierType::BonusMaxSpeed, 0, 44281, 88562, 35424 },
+        { RatingsModifierType::BonusAverageSpeed, 0, 291271, 436906, 0 },
+        { RatingsModifierType::BonusDuration, 150, 26214, 0, 0 },
+        { RatingsModifierType::BonusGForces, 0, 24576, 35746, 49648 },
+        { RatingsModifierType::BonusTurns, 0, 26749, 34767, 45749 },
+        { RatingsModifierType::BonusDrops, 0, 29127, 46811, 49152 },
+        { RatingsModifierType::BonusSheltered, 0, 15420, 32768, 35108 },
+        { RatingsModifierType::BonusProximity, 0, 20130, 0, 0 },
+        { RatingsModifierType::BonusScenery, 0, 6693, 0, 0 },
+        { RatingsModifierType::RequirementDropHeight, 14, 2, 2, 2, true },
+        { RatingsModifierType::RequirementMaxSpeed, 0xA0000, 2, 2, 2 },
+        { RatingsModifierType::RequirementNegativeGs, FIXED_2DP(0, 10), 2, 2, 2, true },
+        { RatingsModifierType::RequirementNumDrops, 2, 2, 2, 2, true },
+        { RatingsModifierType::PenaltyLateralGs, 0, 24576, 35746, 49648 },
+    }},
+};
 
-static void ride_ratings_calculate_mine_ride(Ride* ride)
-{
-    if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
-        return;
+static constexpr RideRatingsDescriptor DinghySlideRatings = {
+    13, 13, { RIDE_RATING(2, 70), RIDE_RATING(2, 00), RIDE_RATING(1, 50) }, 0,
+    {{
+        { RatingsModifierType::BonusLength, 6000, 764, 0, 0 },
+        { RatingsModifierType::BonusSynchronisation, 0, RIDE_RATING(0, 50), RIDE_RATING(0, 05), 0 },
+        { RatingsModifierType::BonusTrainLength, 0, 187245, 0, 0 },
+        { RatingsModifierType::BonusMaxSpeed, 0, 44281, 88562, 35424 },
+        { RatingsModifierType::BonusAverageSpeed, 0, 291271, 436906, 0 },
+        { RatingsModifierType::BonusDuration, 150, 26214, 0, 0 },
+        { RatingsModifierType::BonusGForces, 0, 65536, 29789, 49648 },
+        { RatingsModifierType::BonusTurns, 0, 26749, 34767, 45749 },
+        { RatingsModifierType::BonusDrops, 0, 29127, 46811, 49152 },
+        { RatingsModifierType::BonusSheltered, 0, 15420, 32768, 35108 },
+        { RatingsModifierType::BonusProximity, 0, 11183, 0, 0 },
+        { RatingsModifierType::BonusScenery, 0, 5577, 0, 0 },
+        { RatingsModifierType::RequirementDropHeight, 12, 2, 2, 2 },
+        { RatingsModifierType::RequirementMaxSpeed, 0x70000, 2, 2, 2 },
+        { RatingsModifierType::RequirementLength, 0x8C0000, 2, 2, 2 },
+        { RatingsModifierType::PenaltyLateralGs, 0, 65536, 29789, 49648 },
+    }},
+};
 
-    ride->unreliability_factor = 16;
-    set_unreliability_factor(ride);
+static constexpr RideRatingsDescriptor MineTrainCoasterRatings = {
+    16, 16, { RIDE_RATING(2, 90), RIDE_RATING(2, 30), RIDE_RATING(2, 10) }, 0,
+    {{
+        { RatingsModifierType::BonusLength, 6000, 764, 0, 0 },
+        { RatingsModifierType::BonusSynchronisation, 0, RIDE_RATING(0, 40), RIDE_RATING(0, 05), 0 },
+        { RatingsModifierType::BonusTrainLength, 0, 187245, 0, 0 },
+        { RatingsModifierType::BonusMaxSpeed, 0, 44281, 88562, 35424 },
+        { RatingsModifierType::BonusAverageSpeed, 0, 291271, 436906, 0 },
+        { RatingsModifierType::BonusDuration, 150, 26214, 0, 0 },
+        { RatingsModifierType::BonusGForces, 0, 40960, 35746, 49648 },
+        { RatingsModifierType::BonusTurns, 0, 29721, 34767, 45749 },
+        { RatingsModifierType::BonusDrops, 0, 29127, 46811, 49152 },
+        { RatingsModifierType::BonusSheltered, 0, 19275, 32768, 35108 },
+        { RatingsModifierType::BonusProximity, 0, 21472, 0, 0 },
+        { RatingsModifierType::BonusScenery, 0, 16732, 0, 0 },
+        { RatingsModifierType::RequirementDropHeight, 8, 2, 2, 2 },
+        { RatingsModifierType::RequirementMaxSpeed, 0xA0000, 2, 2, 2 },
+        { RatingsModifierType::RequirementNegativeGs, FIXED_2DP(0, 10), 2, 2, 2 },
+        { RatingsModifierType::RequirementLength, 0x1720000, 2, 2, 2 },
+        { RatingsModifierType::RequirementNumDrops, 2, 2, 2, 2 },
+        { RatingsModifierType::PenaltyLateralGs, 0, 40960, 35746, 49648 },
+    }},
+};
 
-    rating_tuple ratings;
-    ride_ratings_set(&ratings, RIDE_RATING(2, 75), RIDE_RATING(1, 00), RIDE_RATING(1, 80));
-    ride_ratings_apply_length(&ratings, ride, 6000, 764);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 40), RIDE_RATING(0, 05));
-    ride_ratings_apply_train_length(&ratings, ride, 187245);
-    ride_ratings_apply_max_speed(&ratings, ride, 44281, 88562, 35424);
-    ride_ratings_apply_average_speed(&ratings, ride, 291271, 436906);
-    ride_ratings_apply_duration(&ratings, ride, 150, 26214);
-    ride_ratings_apply_gforces(&ratings, ride, 40960, 29789, 49648);
-    ride_ratings_apply_turns(&ratings, ride, 29721, 34767, 45749);
-    ride_ratings_apply_drops(&ratings, ride, 29127, 46811, 49152);
-    ride_ratings_apply_sheltered_ratings(&ratings, ride, 19275, 32768, 35108);
-    ride_ratings_apply_proximity(&ratings, 21472);
-    ride_ratings_apply_scenery(&ratings, ride, 16732);
-    ride_ratings_apply_first_length_penalty(&ratings, ride, 0x10E0000, 2, 2, 2);
+static constexpr RideRatingsDescriptor CorkscrewRollerCoasterRatings = {
+    16, 16, { RIDE_RATING(3, 00), RIDE_RATING(0, 50), RIDE_RATING(0, 20) }, 0,
+    {{
+        { RatingsModifierType::BonusLength, 6000, 764, 0, 0 },
+        { RatingsModifierType::BonusSynchronisation, 0, RIDE_RATING(0, 40), RIDE_RATING(0, 05), 0 },
+        { RatingsModifierType::BonusTrainLength, 0, 187245, 0, 0 },
+        { RatingsModifierType::BonusMaxSpeed, 0, 44281, 88562, 35424 },
+        { RatingsModifierType::BonusAverageSpeed, 0, 291271, 436906, 0 },
+        { RatingsModifierType::BonusDuration, 150, 26214, 0, 0 },
+        { RatingsModifierType::BonusGForces, 0, 24576, 35746, 49648 },
+        { RatingsModifierType::BonusTurns, 0, 26749, 34767, 45749 },
+        { RatingsModifierType::BonusDrops, 0, 29127, 46811, 49152 },
+        { RatingsModifierType::BonusSheltered, 0, 15420, 32768, 35108 },
+        { RatingsModifierType::BonusProximity, 0, 20130, 0, 0 },
+        { RatingsModifierType::BonusScenery, 0, 6693, 0, 0 },
+        { RatingsModifierType::RequirementDropHeight, 12, 2, 2, 2, true },
+        { RatingsModifierType::RequirementMaxSpeed, 0xA0000, 2, 2, 2 },
+        { RatingsModifierType::RequirementNegativeGs, FIXED_2DP(0, 40), 2, 2, 2, true },
+        { RatingsModifierType::RequirementNumDrops, 2, 2, 2, 2, true },
+        { RatingsModifierType::PenaltyLateralGs, 0, 24576, 35746, 49648 },
+    }},
+};
 
-    ride_ratings_apply_excessive_lateral_g_penalty(&ratings, ride, 40960, 29789, 49648);
-    ride_ratings_apply_intensity_penalty(&ratings);
-    ride_ratings_apply_adjustments(ride, &ratings);
+static constexpr RideRatingsDescriptor LogFlumeRatings = {
+    15, 15, { RIDE_RATING(1, 50), RIDE_RATING(0, 55), RIDE_RATING(0, 30) }, 0,
+    {{
+        { RatingsModifierType::BonusLength, 2000, 7208, 0, 0 },
+        { RatingsModifierType::BonusSynchronisation, 0, RIDE_RATING(0, 40), RIDE_RATING(0, 05), 0 },
+        { RatingsModifierType::BonusMaxSpeed, 0, 531372, 655360, 301111 },
+        { RatingsModifierType::BonusDuration, 300, 13107, 0, 0 },
+        { RatingsModifierType::BonusTurns, 0, 22291, 20860, 4574 },
+        { RatingsModifierType::BonusDrops, 0, 69905, 62415, 49152 },
+        { RatingsModifierType::BonusSheltered, 0, 16705, 30583, 35108 },
+        { RatingsModifierType::BonusProximity, 0, 22367, 0, 0 },
+        { RatingsModifierType::BonusScenery, 0, 11155, 0, 0 },
+        { RatingsModifierType::RequirementDropHeight, 2, 2, 2, 2 },
+    }},
+};
 
-    ride->ratings = ratings;
+static constexpr RideRatingsDescriptor RiverRapidsRatings = {
+    16, 16, { RIDE_RATING(1, 20), RIDE_RATING(0, 70), RIDE_RATING(0, 50) }, 0,
+    {{
+        { RatingsModifierType::BonusLength, 2000, 6225, 0, 0 },
+        { RatingsModifierType::BonusSynchronisation, 0, RIDE_RATING(0, 30), RIDE_RATING(0, 05), 0 },
+        { RatingsModifierType::BonusMaxSpeed, 0, 115130, 159411, 106274 },
+        { RatingsModifierType::BonusDuration, 500, 13107, 0, 0 },
+        { RatingsModifierType::BonusTurns, 0, 29721, 22598, 5718 },
+        { RatingsModifierType::BonusDrops, 0, 40777, 46811, 49152 },
+        { RatingsModifierType::BonusSheltered, 0, 16705, 30583, 35108 },
+        { RatingsModifierType::BonusProximity, 0, 31314, 0, 0 },
+        { RatingsModifierType::BonusScenery, 0, 13943, 0, 0 },
+        { RatingsModifierType::RequirementDropHeight, 2, 2, 2, 2 },
+        { RatingsModifierType::RequirementLength, 0xC80000, 2, 2, 2 },
+    }},
+};
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+static constexpr RideRatingsDescriptor ReverseFreefallCoasterRatings = {
+    25, 25, { RIDE_RATING(2, 00), RIDE_RATING(3, 20), RIDE_RATING(2, 80) }, 0,
+    {{
+        { RatingsModifierType::BonusLength, 6000, 327, 0, 0 },
+        { RatingsModifierType::BonusSynchronisation, 0, RIDE_RATING(0, 60), RIDE_RATING(0, 15), 0 },
+        { RatingsModifierType::BonusMaxSpeed, 0, 436906, 436906, 320398 },
+        { RatingsModifierType::BonusGForces, 0, 24576, 41704, 59578 },
+        { RatingsModifierType::BonusSheltered, 0, 12850, 28398, 11702 },
+        { RatingsModifierType::BonusProximity, 0, 17893, 0, 0 },
+        { RatingsModifierType::BonusScenery, 0, 11155, 0, 0 },
+        { RatingsModifierType::RequirementDropHeight, 34, 2, 2, 2 },
+    }},
+};
 
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
-}
+static constexpr RideRatingsDescriptor VerticalDropRollerCoasterRatings = {
+    16, 16, { RIDE_RATING(3, 20), RIDE_RATING(0, 80), RIDE_RATING(0, 30) }, 0,
+    {{
+        { RatingsModifierType::BonusLength, 4000, 1146, 0, 0 },
+        { RatingsModifierType::BonusSynchronisation, 0, RIDE_RATING(0, 40), RIDE_RATING(0, 05), 0 },
+        { RatingsModifierType::BonusMaxSpeed, 0, 97418, 141699, 70849 },
+        { RatingsModifierType::BonusAverageSpeed, 0, 291271, 436906, 0 },
+        { RatingsModifierType::BonusDuration, 150, 26214, 0, 0 },
+        { RatingsModifierType::BonusGForces, 0, 40960, 35746, 49648 },
+        { RatingsModifierType::BonusTurns, 0, 26749, 34767, 45749 },
+        { RatingsModifierType::BonusDrops, 0, 58254, 46811, 49152 },
+        { RatingsModifierType::BonusSheltered, 0, 15420, 32768, 35108 },
+        { RatingsModifierType::BonusProximity, 0, 20130, 0, 0 },
+        { RatingsModifierType::BonusScenery, 0, 6693, 0, 0 },
+        { RatingsModifierType::RequirementDropHeight, 20, 2, 2, 2 },
+        { RatingsModifierType::RequirementMaxSpeed, 0xA0000, 2, 2, 2 },
+        { RatingsModifierType::RequirementNegativeGs, FIXED_2DP(0, 10), 2, 2, 2 },
+        { RatingsModifierType::RequirementNumDrops, 1, 2, 2, 2 },
+        { RatingsModifierType::PenaltyLateralGs, 0, 40960, 35746, 49648 },
+    }},
+};
 
-static void ride_ratings_calculate_lim_launched_roller_coaster(Ride* ride)
-{
-    if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
-        return;
+static constexpr RideRatingsDescriptor GhostTrainRatings = {
+    12, 12, { RIDE_RATING(2, 00), RIDE_RATING(0, 20), RIDE_RATING(0, 03) }, 0,
+    {{
+        { RatingsModifierType::BonusLength, 6000, 764, 0, 0 },
+        { RatingsModifierType::BonusSynchronisation, 0, RIDE_RATING(0, 15), RIDE_RATING(0, 00), 0 },
+        { RatingsModifierType::BonusMaxSpeed, 0, 44281, 88562, 35424 },
+        { RatingsModifierType::BonusAverageSpeed, 0, 291271, 436906, 0 },
+        { RatingsModifierType::BonusDuration, 150, 26214, 0, 0 },
+        { RatingsModifierType::BonusTurns, 0, 14860, 0, 11437 },
+        { RatingsModifierType::BonusDrops, 0, 8738, 0, 0 },
+        { RatingsModifierType::BonusSheltered, 0, 25700, 6553, 4681 },
+        { RatingsModifierType::BonusProximity, 0, 11183, 0, 0 },
+        { RatingsModifierType::BonusScenery, 0, 8366, 0, 0 },
+        { RatingsModifierType::RequirementLength, 0xB40000, 2, 2, 2 },
+    }},
+};
 
-    ride->unreliability_factor = 25;
-    set_unreliability_factor(ride);
+static constexpr RideRatingsDescriptor TwisterRollerCoasterRatings = {
+    15, 15, { RIDE_RATING(3, 50), RIDE_RATING(0, 40), RIDE_RATING(0, 30) }, 0,
+    {{
+        { RatingsModifierType::BonusLength, 6000, 764, 0, 0 },
+        { RatingsModifierType::BonusSynchronisation, 0, RIDE_RATING(0, 40), RIDE_RATING(0, 05), 0 },
+        { RatingsModifierType::BonusTrainLength, 0, 187245, 0, 0 },
+        { RatingsModifierType::BonusMaxSpeed, 0, 44281, 88562, 35424 },
+        { RatingsModifierType::BonusAverageSpeed, 0, 291271, 436906, 0 },
+        { RatingsModifierType::BonusDuration, 150, 26214, 0, 0 },
+        { RatingsModifierType::BonusGForces, 0, 24576, 32768, 49648 },
+        { RatingsModifierType::BonusTurns, 0, 26749, 34767, 45749 },
+        { RatingsModifierType::BonusDrops, 0, 29127, 46811, 49152 },
+        { RatingsModifierType::BonusSheltered, 0, 15420, 32768, 35108 },
+        { RatingsModifierType::BonusProximity, 0, 20130, 0, 0 },
+        { RatingsModifierType::BonusScenery, 0, 6693, 0, 0 },
+        { RatingsModifierType::RequirementDropHeight, 12, 2, 2, 2, true },
+        { RatingsModifierType::RequirementMaxSpeed, 0xA0000, 2, 2, 2 },
+        { RatingsModifierType::RequirementNegativeGs, FIXED_2DP(0, 40), 2, 2, 2, true },
+        { RatingsModifierType::RequirementNumDrops, 2, 2, 2, 2, true },
+        { RatingsModifierType::PenaltyLateralGs, 0, 24576, 32768, 49648 },
+    }},
+};
 
-    rating_tuple ratings;
-    ride_ratings_set(&ratings, RIDE_RATING(2, 90), RIDE_RATING(1, 50), RIDE_RATING(2, 20));
-    ride_ratings_apply_length(&ratings, ride, 6000, 764);
-    ride_ratings_apply_synchronisation(&ratings, ride, RIDE_RATING(0, 40), RIDE_RATING(0, 05));
-    ride_ratings_apply_train_length(&ratings, ride, 187245);
-    ride_ratings_apply_max_speed(&ratings, ride, 44281, 88562, 35424);
-    ride_ratings_apply_average_speed(&ratings, ride, 291271, 436906);
-    ride_ratings_apply_duration(&ratings, ride, 150, 26214);
-    ride_ratings_apply_gforces(&ratings, ride, 24576, 35746, 49648);
-    ride_ratings_apply_turns(&ratings, ride, 26749, 34767, 45749);
-    ride_ratings_apply_drops(&ratings, ride, 29127, 46811, 49152);
-    ride_ratings_apply_sheltered_ratings(&ratings, ride, 15420, 32768, 35108);
-    ride_ratings_apply_proximity(&ratings, 20130);
-    ride_ratings_apply_scenery(&ratings, ride, 6693);
+static constexpr RideRatingsDescriptor WoodenRollerCoasterRatings = {
+    19, 19, { RIDE_RATING(3, 20), RIDE_RATING(2, 60), RIDE_RATING(2, 00) }, 0,
+    {{
+        { RatingsModifierType::BonusLength, 6000, 873, 0, 0 },
+        { RatingsModifierType::BonusSynchronisation, 0, RIDE_RATING(0, 40), RIDE_RATING(0, 05), 0 },
+        { RatingsModifierType::BonusTrainLength, 0, 187245, 0, 0 },
+        { RatingsModifierType::BonusMaxSpeed, 0, 44281, 88562, 35424 },
+        { RatingsModifierType::BonusAverageSpeed, 0, 364088, 655360, 0 },
+        { RatingsModifierType::BonusDuration, 150, 26214, 0, 0 },
+        { RatingsModifierType::BonusGForces, 0, 40960, 34555, 49648 },
+        { RatingsModifierType::BonusTurns, 0, 26749, 43458, 45749 },
+        { RatingsModifierType::BonusDrops, 0, 40777, 46811, 49152 },
+        { RatingsModifierType::BonusSheltered, 0, 16705, 30583, 35108 },
+        { RatingsModifierType::BonusProximity, 0, 22367, 0, 0 },
+        { RatingsModifierType::BonusScenery, 0, 11155, 0, 0 },
+        { RatingsModifierType::RequirementDropHeight, 12, 2, 2, 2 },
+        { RatingsModifierType::RequirementMaxSpeed, 0xA0000, 2, 2, 2 },
+        { RatingsModifierType::RequirementNegativeGs, FIXED_2DP(0, 10), 2, 2, 2 },
+        { RatingsModifierType::RequirementLength, 0x1720000, 2, 2, 2 },
+        { RatingsModifierType::RequirementNumDrops, 2, 2, 2, 2 },
+        { RatingsModifierType::PenaltyLateralGs, 0, 40960, 34555, 49648 },
+    }},
+};
 
-    if (ride->inversions == 0)
-        ride_ratings_apply_highest_drop_height_penalty(&ratings, ride, 10, 2, 2, 2);
+static constexpr RideRatingsDescriptor SideFrictionRollerCoasterRatings = {
+    19, 19, { RIDE_RATING(2, 50), RIDE_RATING(2, 00), RIDE_RATING(1, 50) }, 0,
+    {{
+        { RatingsModifierType::BonusLength, 6000, 873, 0, 0 },
+        { RatingsModifierType::BonusSynchronisation, 0, RIDE_RATING(0, 40), RIDE_RATING(0, 05), 0 },
+        { RatingsModifierType::BonusTrainLength, 0, 187245, 0, 0 },
+        { RatingsModifierType::BonusMaxSpeed, 0, 44281, 88562, 35424 },
+        { RatingsModifierType::BonusAverageSpeed, 0, 364088, 655360, 0 },
+        { RatingsModifierType::BonusDuration, 150, 26214, 0, 0 },
+        { RatingsModifierType::BonusGForces, 0, 28672, 35746, 49648 },
+        { RatingsModifierType::BonusTurns, 0, 26749, 43458, 45749 },
+        { RatingsModifierType::BonusDrops, 0, 40777, 46811, 49152 },
+        { RatingsModifierType::BonusSheltered, 0, 16705, 30583, 35108 },
+        { RatingsModifierType::BonusProximity, 0, 22367, 0, 0 },
+        { RatingsModifierType::BonusScenery, 0, 11155, 0, 0 },
+        { RatingsModifierType::RequirementDropHeight, 6, 2, 2, 2 },
+        { RatingsModifierType::RequirementMaxSpeed, 0x50000, 2, 2, 2 },
+        { RatingsModifierType::RequirementLength, 0xFA0000, 2, 2, 2 },
+        { RatingsModifierType::RequirementNumDrops, 2, 2, 2, 2 },
+        { RatingsModifierType::PenaltyLateralGs, 0, 28672, 35746, 49648 },
+    }},
+};
 
-    ride_ratings_apply_max_speed_penalty(&ratings, ride, 0xA0000, 2, 2, 2);
+static constexpr RideRatingsDescriptor WildMouseRatings = {
+    14, 14, { RIDE_RATING(2, 80), RIDE_RATING(2, 50), RIDE_RATING(2, 10) }, 0,
+    {{
+        { RatingsModifierType::BonusLength, 6000, 873, 0, 0 },
+        { RatingsModifierType::BonusSynchronisation, 0, RIDE_RATING(0, 40), RIDE_RATING(0, 8), 0 },
+        { RatingsModifierType::BonusTrainLength, 0, 187245, 0, 0 },
+        { RatingsModifierType::BonusMaxSpeed, 0, 44281, 88562, 35424 },
+        { RatingsModifierType::BonusAverageSpeed, 0, 364088, 655360, 0 },
+        { RatingsModifierType::BonusDuration, 150, 26214, 0, 0 },
+        { RatingsModifierType::BonusGForces, 0, 102400, 35746, 49648 },
+        { RatingsModifierType::BonusTurns, 0, 29721, 43458, 45749 },
+        { RatingsModifierType::BonusDrops, 0, 40777, 46811, 49152 },
+        { RatingsModifierType::BonusSheltered, 0, 16705, 30583, 35108 },
+        { RatingsModifierType::BonusProximity, 0, 17893, 0, 0 },
+        { RatingsModifierType::BonusScenery, 0, 5577, 0, 0 },
+        { RatingsModifierType::RequirementDropHeight, 6, 2, 2, 2 },
+        { RatingsModifierType::RequirementMaxSpeed, 0x70000, 2, 2, 2 },
+        { RatingsModifierType::RequirementLateralGs, FIXED_2DP(1, 50), 2, 2, 2 },
+        { RatingsModifierType::RequirementLength, 0xAA0000, 2, 2, 2 },
+        { RatingsModifierType::RequirementNumDrops, 2, 2, 2, 2 },
+        { RatingsModifierType::PenaltyLateralGs, 0, 102400, 35746, 49648 },
+    }},
+};
 
-    if (ride->inversions == 0)
-    {
-        ride_ratings_apply_max_negative_g_penalty(&ratings, ride, 10, 2, 2, 2);
-        ride_ratings_apply_num_drops_penalty(&ratings, ride, 2, 2, 2, 2);
-    }
+static constexpr RideRatingsDescriptor MultiDimensionRollerCoasterRatings = {
+    18, 18, { RIDE_RATING(3, 75), RIDE_RATING(1, 95), RIDE_RATING(4, 79) }, 0,
+    {{
+        { RatingsModifierType::BonusLength, 6000, 764, 0, 0 },
+        { RatingsModifierType::BonusSynchronisation, 0, RIDE_RATING(0, 40), RIDE_RATING(0, 05), 0 },
+        { RatingsModifierType::BonusTrainLength, 0, 187245, 0, 0 },
+        { RatingsModifierType::BonusMaxSpeed, 0, 44281, 88562, 35424 },
+        { RatingsModifierType::BonusAverageSpeed, 0, 291271, 436906, 0 },
+        { RatingsModifierType::BonusDuration, 150, 26214, 0, 0 },
+        { RatingsModifierType::BonusGForces, 0, 24576, 38130, 49648 },
+        { RatingsModifierType::BonusTurns, 0, 26749, 34767, 45749 },
+        { RatingsModifierType::BonusDrops, 0, 29127, 46811, 49152 },
+        { RatingsModifierType::BonusSheltered, 0, 15420, 32768, 35108 },
+        { RatingsModifierType::BonusProximity, 0, 20130, 0, 0 },
+        { RatingsModifierType::BonusScenery, 0, 6693, 0, 0 },
+        { RatingsModifierType::RequirementInversions, 0, 4, 1, 1 },
+        { RatingsModifierType::RequirementMaxSpeed, 0xA0000, 2, 1, 1 },
+        { RatingsModifierType::RequirementNegativeGs, FIXED_2DP(0, 40), 2, 1, 1, true },
+        { RatingsModifierType::RequirementNumDrops, 2, 2, 1, 1, true },
+        { RatingsModifierType::PenaltyLateralGs, 0, 24576, 38130, 49648 },
+    }},
+};
 
-    ride_ratings_apply_excessive_lateral_g_penalty(&ratings, ride, 24576, 35746, 49648);
-    ride_ratings_apply_intensity_penalty(&ratings);
-    ride_ratings_apply_adjustments(ride, &ratings);
+static constexpr RideRatingsDescriptor FlyingRollerCoasterRatings = {
+    17, 17, { RIDE_RATING(4, 35), RIDE_RATING(1, 85), RIDE_RATING(4, 33) }, 0,
+    {{
+        { RatingsModifierType::BonusLength, 6000, 764, 0, 0 },
+        { RatingsModifierType::BonusSynchronisation, 0, RIDE_RATING(0, 40), RIDE_RATING(0, 05), 0 },
+        { RatingsModifierType::BonusTrainLength, 0, 187245, 0, 0 },
+        { RatingsModifierType::BonusMaxSpeed, 0, 44281, 88562, 35424 },
+        { RatingsModifierType::BonusAverageSpeed, 0, 291271, 436906, 0 },
+        { RatingsModifierType::BonusDuration, 150, 26214, 0, 0 },
+        { RatingsModifierType::BonusGForces, 0, 24576, 38130, 49648 },
+        { RatingsModifierType::BonusTurns, 0, 26749, 34767, 45749 },
+        { RatingsModifierType::BonusDrops, 0, 29127, 46811, 49152 },
+        { RatingsModifierType::BonusSheltered, 0, 15420, 32768, 35108 },
+        { RatingsModifierType::BonusProximity, 0, 20130, 0, 0 },
+        { RatingsModifierType::BonusScenery, 0, 6693, 0, 0 },
+        { RatingsModifierType::RequirementInversions, 0, 2, 1, 1 },
+        { RatingsModifierType::RequirementMaxSpeed, 0xA0000, 2, 1, 1 },
+        { RatingsModifierType::RequirementNegativeGs, FIXED_2DP(0, 40), 2, 1, 1, true },
+        { RatingsModifierType::RequirementNumDrops, 2, 2, 1, 1 },
+        { RatingsModifierType::PenaltyLateralGs, 0, 24576, 38130, 49648 },
+    }},
+};
 
-    ride->ratings = ratings;
+static constexpr RideRatingsDescriptor VirginiaReelRatings = {
+    19, 19, { RIDE_RATING(2, 10), RIDE_RATING(1, 90), RIDE_RATING(3, 70) }, 0,
+    {{
+        { RatingsModifierType::BonusLength, 6000, 873, 0, 0 },
+        { RatingsModifierType::BonusSynchronisation, 0, RIDE_RATING(0, 40), RIDE_RATING(0, 05), 0 },
+        { RatingsModifierType::BonusTrainLength, 0, 187245, 0, 0 },
+        { RatingsModifierType::BonusMaxSpeed, 0, 44281, 88562, 35424 },
+        { RatingsModifierType::BonusAverageSpeed, 0, 364088, 655360, 0 },
+        { RatingsModifierType::BonusDuration, 150, 26214, 0, 0 },
+        { RatingsModifierType::BonusGForces, 0, 110592, 29789, 59578 },
+        { RatingsModifierType::BonusTurns, 0, 52012, 26075, 45749 },
+        { RatingsModifierType::BonusDrops, 0, 43690, 46811, 49152 },
+        { RatingsModifierType::BonusSheltered, 0, 16705, 30583, 35108 },
+        { RatingsModifierType::BonusProximity, 0, 22367, 0, 0 },
+        { RatingsModifierType::BonusScenery, 0, 11155, 0, 0 },
+        { RatingsModifierType::RequirementLength, 0xD20000, 2, 2, 2 },
+        { RatingsModifierType::RequirementNumDrops, 2, 2, 2, 2 },
+        { RatingsModifierType::PenaltyLateralGs, 0, 110592, 29789, 59578 },
+    }},
+};
 
-    ride->upkeep_cost = ride_compute_upkeep(ride);
-    ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
+static constexpr RideRatingsDescriptor SplashBoatsRatings = {
+    15, 15, { RIDE_RATING(1, 46), RIDE_RATING(0, 35), RIDE_RATING(0, 30) }, 0,
+    {{
+        { RatingsModifierType::BonusLength, 2000, 7208, 0, 0 },
+        { RatingsModifierType::BonusSynchronisation, 0, RIDE_RATING(0, 40), RIDE_RATING(0, 05), 0 },
+        { RatingsModifierType::BonusMaxSpeed, 0, 797059, 655360, 301111 },
+        { RatingsModifierType::BonusDuration, 500, 13107, 0, 0 },
+        { RatingsModifierType::BonusTurns, 0, 22291, 20860, 4574 },
+        { RatingsModifierType::BonusDrops, 0, 87381, 93622, 62259 },
+        { RatingsModifierType::BonusSheltered, 0, 16705, 30583, 35108 },
+        { RatingsModifierType::BonusProximity, 0, 22367, 0, 0 },
+        { RatingsModifierType::BonusScenery, 0, 11155, 0, 0 },
+        { RatingsModifierType::RequirementDropHeight, 6, 2, 2, 2 },
+    }},
+};
 
-    ride->sheltered_eighths = get_num_of_sheltered_eighths(ride).TotalShelteredEighths;
-}
+static constexpr RideRatingsDescriptor LayDownRollerCoasterRatings = {
+    18, 18, { RIDE_RATING(3, 85), RIDE_RATING(1, 15), RIDE_RATING(2, 75) }, 0,
+    {{
+        { RatingsModifierType::BonusLength, 6000, 764, 0, 0 },
+        { RatingsModifierType::BonusSynchronisation, 0, RIDE_RATING(0, 40), RIDE_RATING(0, 05), 0 },
+        { RatingsModifierType::BonusTrainLength, 0, 187245, 0, 0 },
+        { RatingsModifierType::BonusMaxSpeed, 0, 44281, 88562, 35424 },
+        { RatingsModifierType::BonusAverageSpeed, 0, 291271, 436906, 0 },
+        { RatingsModifierType::BonusDuration, 150, 26214, 0, 0 },
+        { RatingsModifierType::BonusGForces, 0, 24576, 38130, 49648 },
+        { RatingsModifierType::BonusTurns, 0, 26749, 34767, 45749 },
+        { RatingsModifierType::BonusDrops, 0, 29127, 46811, 49152 },
+        { RatingsModifierType::BonusSheltered, 0, 15420, 32768, 35108 },
+        { RatingsModifierType::BonusProximity, 0, 20130, 0, 0 },
+        { RatingsModifierType::BonusScenery, 0, 6693, 0, 0 },
+        { RatingsModifierType::RequirementInversions, 0, 4, 2, 2 },
+        { RatingsModifierType::RequirementMaxSpeed, 0xA0000, 2, 2, 2 },
+        { RatingsModifierType::RequirementNegativeGs, FIXED_2DP(0, 40), 2, 2, 2, true },
+        { RatingsModifierType::RequirementNumDrops, 2, 2, 2, 2, true },
+        { RatingsModifierType::PenaltyLateralGs, 0, 24576, 38130, 49648 },
+    }},
+};
+
+static constexpr RideRatingsDescriptor SuspendedMonorailRatings = {
+    14, 14, { RIDE_RATING(2, 15), RIDE_RATING(0, 23), RIDE_RATING(0, 8) }, 4,
+    {{
+        { RatingsModifierType::BonusLength, 6000, 764, 0, 0 },
+        { RatingsModifierType::BonusTrainLength, 0, 93622, 0, 0 },
+        { RatingsModifierType::BonusMaxSpeed, 0, 44281, 70849, 35424 },
+        { RatingsModifierType::BonusAverageSpeed, 0, 291271, 218453, 0 },
+        { RatingsModifierType::BonusDuration, 150, 21845, 0, 0 },
+        { RatingsModifierType::BonusSheltered, 0, 5140, 6553, 18724 },
+        { RatingsModifierType::BonusProximity, 0, 12525, 0, 0 },
+        { RatingsModifierType::BonusScenery, 0, 25098, 0, 0 },
+        { RatingsModifierType::RequirementLength, 0xAA0000, 2, 2, 2 },
+    }},
+};
+
+static constexpr RideRatingsDescriptor HeartlineTwisterCoasterRatings = {
+    18, 18, { RIDE_RATING(1, 40), RIDE_RATING(1, 70), RIDE_RATING(1, 65) }, 0,
+    {{
+        { RatingsModifierType::BonusLength, 6000, 764, 0, 0 },
+        { RatingsModifierType::BonusSynchronisation, 0, RIDE_RATING(0, 20), RIDE_RATING(0, 04), 0 },
+        { RatingsModifierType::BonusTrainLength, 0, 187245, 0, 0 },
+        { RatingsModifierType::BonusMaxSpeed, 0, 97418, 123987, 70849 },
+        { RatingsModifierType::BonusAverageSpeed, 0, 291271, 436906, 0 },
+        { RatingsModifierType::BonusDuration, 150, 26214, 0, 0 },
+        { RatingsModifierType::BonusGForces, 0, 24576, 44683, 89367 },
+        { RatingsModifierType::BonusTurns, 0, 26749, 52150, 57186 },
+        { RatingsModifierType::BonusDrops, 0, 29127, 53052, 55705 },
+        { RatingsModifierType::BonusSheltered, 0, 15420, 34952, 35108 },
+        { RatingsModifierType::BonusProximity, 0, 9841, 0, 0 },
+        { RatingsModifierType::BonusScenery, 0, 3904, 0, 0 },
+        { RatingsModifierType::RequirementInversions, 0, 4, 1, 1 },
+        { RatingsModifierType::RequirementNumDrops, 1, 4, 1, 1 },
+        { RatingsModifierType::PenaltyLateralGs, 0, 24576, 44683, 89367 },
+    }},
+};
+
+static constexpr RideRatingsDescriptor GigaCoasterRatings = {
+    14, 14, { RIDE_RATING(3, 85), RIDE_RATING(0, 40), RIDE_RATING(0, 35) }, 0,
+    {{
+        { RatingsModifierType::BonusLength, 6000, 819, 0, 0 },
+        { RatingsModifierType::BonusSynchronisation, 0, RIDE_RATING(0, 40), RIDE_RATING(0, 05), 0 },
+        { RatingsModifierType::BonusTrainLength, 0, 140434, 0, 0 },
+        { RatingsModifierType::BonusMaxSpeed, 0, 51366, 85019, 35424 },
+        { RatingsModifierType::BonusAverageSpeed, 0, 364088, 400497, 0 },
+        { RatingsModifierType::BonusDuration, 150, 26214, 0, 0 },
+        { RatingsModifierType::BonusGForces, 0, 36864, 30384, 49648 },
+        { RatingsModifierType::BonusTurns, 0, 28235, 34767, 45749 },
+        { RatingsModifierType::BonusDrops, 0, 43690, 46811, 49152 },
+        { RatingsModifierType::BonusSheltered, 0, 15420, 32768, 35108 },
+        { RatingsModifierType::BonusProximity, 0, 20130, 0, 0 },
+        { RatingsModifierType::BonusScenery, 0, 6693, 0, 0 },
+        { RatingsModifierType::RequirementDropHeight, 16, 2, 2, 2, true },
+        { RatingsModifierType::RequirementMaxSpeed, 0xA0000, 2, 2, 2 },
+        { RatingsModifierType::RequirementNegativeGs, FIXED_2DP(0, 40), 2, 2, 2, true },
+        { RatingsModifierType::RequirementNumDrops, 2, 2, 2, 2, true },
+        { RatingsModifierType::PenaltyLateralGs, 0, 36864, 30384, 49648 },
+    }},
+};
+
+static constexpr RideRatingsDescriptor MonorailCyclesRatings = {
+    4, 4, { RIDE_RATING(1, 40), RIDE_RATING(0, 20), RIDE_RATING(0, 00) }, 0,
+    {{
+        { RatingsModifierType::BonusLength, 6000, 764, 0, 0 },
+        { RatingsModifierType::BonusSynchronisation, 0, RIDE_RATING(0, 15), RIDE_RATING(0, 00), 0 },
+        { RatingsModifierType::BonusTrainLength, 0, 187245, 0, 0 },
+        { RatingsModifierType::BonusMaxSpeed, 0, 44281, 88562, 35424 },
+        { RatingsModifierType::BonusAverageSpeed, 0, 291271, 436906, 0 },
+        { RatingsModifierType::BonusDuration, 150, 26214, 0, 0 },
+        { RatingsModifierType::BonusTurns, 0, 14860, 0, 4574 },
+        { RatingsModifierType::BonusDrops, 0, 8738, 0, 0 },
+        { RatingsModifierType::BonusSheltered, 0, 5140, 6553, 2340 },
+        { RatingsModifierType::BonusProximity, 0, 8946, 0, 0 },
+        { RatingsModifierType::BonusScenery, 0, 11155, 0, 0 },
+        { RatingsModifierType::RequirementLength, 0x8C0000, 2, 2, 2 },
+    }},
+};
+
+static constexpr RideRatingsDescriptor AirPoweredVerticalCoasterRatings = {
+    28, 28, { RIDE_RATING(4, 13), RIDE_RATING(2, 50), RIDE_RATING(2, 80) }, 0,
+    {{
+        { RatingsModifierType::BonusLength, 6000, 327, 0, 0 },
+        { RatingsModifierType::BonusSynchronisation, 0, RIDE_RATING(0, 60), RIDE_RATING(0, 05), 0 },
+        { RatingsModifierType::BonusMaxSpeed, 0, 509724, 364088, 320398 },
+        { RatingsModifierType::BonusGForces, 0, 24576, 35746, 59578 },
+        { RatingsModifierType::BonusSheltered, 0, 15420, 21845, 11702 },
+        { RatingsModifierType::BonusProximity, 0, 17893, 0, 0 },
+        { RatingsModifierType::BonusScenery, 0, 11155, 0, 0 },
+        { RatingsModifierType::RequirementDropHeight, 34, 2, 1, 1 },
+        { RatingsModifierType::PenaltyLateralGs, 0, 24576, 35746, 59578 },
+    }},
+};
+
+static constexpr RideRatingsDescriptor InvertedHairpinCoasterRatings = {
+    14, 14, { RIDE_RATING(3, 00), RIDE_RATING(2, 65), RIDE_RATING(2, 25) }, 0,
+    {{
+        { RatingsModifierType::BonusLength, 6000, 873, 0, 0 },
+        { RatingsModifierType::BonusSynchronisation, 0, RIDE_RATING(0, 40), RIDE_RATING(0, 8), 0 },
+        { RatingsModifierType::BonusTrainLength, 0, 187245, 0, 0 },
+        { RatingsModifierType::BonusMaxSpeed, 0, 44281, 88562, 35424 },
+        { RatingsModifierType::BonusAverageSpeed, 0, 364088, 655360, 0 },
+        { RatingsModifierType::BonusDuration, 150, 26214, 0, 0 },
+        { RatingsModifierType::BonusGForces, 0, 102400, 35746, 49648 },
+        { RatingsModifierType::BonusTurns, 0, 29721, 43458, 45749 },
+        { RatingsModifierType::BonusDrops, 0, 40777, 46811, 49152 },
+        { RatingsModifierType::BonusSheltered, 0, 16705, 30583, 35108 },
+        { RatingsModifierType::BonusProximity, 0, 17893, 0, 0 },
+        { RatingsModifierType::BonusScenery, 0, 5577, 0, 0 },
+        { RatingsModifierType::RequirementDropHeight, 8, 2, 2, 2 },
+        { RatingsModifierType::RequirementMaxSpeed, 0x70000, 2, 2, 2 },
+        { RatingsModifierType::RequirementNegativeGs, FIXED_2DP(0, 10), 2, 2, 2 },
+        { RatingsModifierType::RequirementLateralGs, FIXED_2DP(1, 50), 2, 2, 2 },
+        { RatingsModifierType::RequirementLength, 0xAA0000, 2, 2, 2 },
+        { RatingsModifierType::RequirementNumDrops, 3, 2, 2, 2 },
+        { RatingsModifierType::PenaltyLateralGs, 0, 102400, 35746, 49648 },
+    }},
+};
+
+static constexpr RideRatingsDescriptor RiverRaftsRatings = {
+    12, 12, { RIDE_RATING(1, 45), RIDE_RATING(0, 25), RIDE_RATING(0, 34) }, 0,
+    {{
+        { RatingsModifierType::BonusLength, 2000, 7208, 0, 0 },
+        { RatingsModifierType::BonusSynchronisation, 0, RIDE_RATING(0, 40), RIDE_RATING(0, 05), 0 },
+        { RatingsModifierType::BonusMaxSpeed, 0, 531372, 655360, 301111 },
+        { RatingsModifierType::BonusDuration, 500, 13107, 0, 0 },
+        { RatingsModifierType::BonusTurns, 0, 22291, 20860, 4574 },
+        { RatingsModifierType::BonusDrops, 0, 78643, 93622, 62259 },
+        { RatingsModifierType::BonusProximity, 0, 13420, 0, 0 },
+        { RatingsModifierType::BonusScenery, 0, 11155, 0, 0 },
+    }},
+};
+
+static constexpr RideRatingsDescriptor InvertedImpulseCoasterRatings = {
+    20, 20, { RIDE_RATING(4, 00), RIDE_RATING(3, 00), RIDE_RATING(3, 20) }, 0,
+    {{
+        { RatingsModifierType::BonusLength, 6000, 764, 0, 0 },
+        { RatingsModifierType::BonusSynchronisation, 0, RIDE_RATING(0, 42), RIDE_RATING(0, 05), 0 },
+        { RatingsModifierType::BonusTrainLength, 0, 187245, 0, 0 },
+        { RatingsModifierType::BonusMaxSpeed, 0, 44281, 88562, 35424 },
+        { RatingsModifierType::BonusAverageSpeed, 0, 291271, 436906, 0 },
+        { RatingsModifierType::BonusDuration, 150, 26214, 0, 0 },
+        { RatingsModifierType::BonusGForces, 0, 24576, 29789, 55606 },
+        { RatingsModifierType::BonusTurns, 0, 26749, 29552, 57186 },
+        { RatingsModifierType::BonusDrops, 0, 29127, 39009, 49152 },
+        { RatingsModifierType::BonusSheltered, 0, 15420, 15291, 35108 },
+        { RatingsModifierType::BonusProximity, 0, 15657, 0, 0 },
+        { RatingsModifierType::BonusScenery, 0, 9760, 0, 0 },
+        { RatingsModifierType::RequirementDropHeight, 20, 2, 2, 2 },
+        { RatingsModifierType::RequirementMaxSpeed, 0xA0000, 2, 2, 2 },
+        { RatingsModifierType::PenaltyLateralGs, 0, 24576, 29789, 55606 },
+    }},
+};
+
+static constexpr RideRatingsDescriptor MiniRollerCoasterRatings = {
+    13, 13, { RIDE_RATING(2, 55), RIDE_RATING(2, 40), RIDE_RATING(1, 85) }, 0,
+    {{
+        { RatingsModifierType::BonusLength, 6000, 764, 0, 0 },
+        { RatingsModifierType::BonusSynchronisation, 0, RIDE_RATING(0, 40), RIDE_RATING(0, 05), 0 },
+        { RatingsModifierType::BonusTrainLength, 0, 187245, 0, 0 },
+        { RatingsModifierType::BonusMaxSpeed, 0, 44281, 88562, 35424 },
+        { RatingsModifierType::BonusAverageSpeed, 0, 291271, 436906, 0 },
+        { RatingsModifierType::BonusDuration, 150, 26214, 0, 0 },
+        { RatingsModifierType::BonusGForces, 0, 20480, 23831, 49648 },
+        { RatingsModifierType::BonusTurns, 0, 26749, 34767, 45749 },
+        { RatingsModifierType::BonusDrops, 0, 29127, 46811, 49152 },
+        { RatingsModifierType::BonusSheltered, 0, 25700, 30583, 35108 },
+        { RatingsModifierType::BonusProximity, 0, 20130, 0, 0 },
+        { RatingsModifierType::BonusScenery, 0, 9760, 0, 0 },
+        { RatingsModifierType::RequirementDropHeight, 12, 2, 2, 2 },
+        { RatingsModifierType::RequirementMaxSpeed, 0x70000, 2, 2, 2 },
+        { RatingsModifierType::RequirementNegativeGs, FIXED_2DP(0, 50), 2, 2, 2 },
+        { RatingsModifierType::RequirementNumDrops, 2, 2, 2, 2 },
+        { RatingsModifierType::PenaltyLateralGs, 0, 20480, 23831, 49648 },
+    }},
+};
+
+static constexpr RideRatingsDescriptor MineRideRatings = {
+    16, 16, { RIDE_RATING(2, 75), RIDE_RATING(1, 00), RIDE_RATING(1, 80) }, 0,
+    {{
+        { RatingsModifierType::BonusLength, 6000, 764, 0, 0 },
+        { RatingsModifierType::BonusSynchronisation, 0, RIDE_RATING(0, 40), RIDE_RATING(0, 05), 0 },
+        { RatingsModifierType::BonusTrainLength, 0, 187245, 0, 0 },
+        { RatingsModifierType::BonusMaxSpeed, 0, 44281, 88562, 35424 },
+        { RatingsModifierType::BonusAverageSpeed, 0, 291271, 436906, 0 },
+        { RatingsModifierType::BonusDuration, 150, 26214, 0, 0 },
+        { RatingsModifierType::BonusGForces, 0, 40960, 29789, 49648 },
+        { RatingsModifierType::BonusTurns, 0, 29721, 34767, 45749 },
+        { RatingsModifierType::BonusDrops, 0, 29127, 46811, 49152 },
+        { RatingsModifierType::BonusSheltered, 0, 19275, 32768, 35108 },
+        { RatingsModifierType::BonusProximity, 0, 21472, 0, 0 },
+        { RatingsModifierType::BonusScenery, 0, 16732, 0, 0 },
+        { RatingsModifierType::RequirementLength, 0x10E0000, 2, 2, 2 },
+        { RatingsModifierType::PenaltyLateralGs, 0, 40960, 29789, 49648 },
+    }},
+};
+
+static constexpr RideRatingsDescriptor LimLaunchedRollerCoasterRatings = {
+    25, 25, { RIDE_RATING(2, 90), RIDE_RATING(1, 50), RIDE_RATING(2, 20) }, 0,
+    {{
+        { RatingsModifierType::BonusLength, 6000, 764, 0, 0 },
+        { RatingsModifierType::BonusSynchronisation, 0, RIDE_RATING(0, 40), RIDE_RATING(0, 05), 0 },
+        { RatingsModifierType::BonusTrainLength, 0, 187245, 0, 0 },
+        { RatingsModifierType::BonusMaxSpeed, 0, 44281, 88562, 35424 },
+        { RatingsModifierType::BonusAverageSpeed, 0, 291271, 436906, 0 },
+        { RatingsModifierType::BonusDuration, 150, 26214, 0, 0 },
+        { RatingsModifierType::BonusGForces, 0, 24576, 35746, 49648 },
+        { RatingsModifierType::BonusTurns, 0, 26749, 34767, 45749 },
+        { RatingsModifierType::BonusDrops, 0, 29127, 46811, 49152 },
+        { RatingsModifierType::BonusSheltered, 0, 15420, 32768, 35108 },
+        { RatingsModifierType::BonusProximity, 0, 20130, 0, 0 },
+        { RatingsModifierType::BonusScenery, 0, 6693, 0, 0 },
+        { RatingsModifierType::RequirementDropHeight, 10, 2, 2, 2, true },
+        { RatingsModifierType::RequirementMaxSpeed, 0xA0000, 2, 2, 2 },
+        { RatingsModifierType::RequirementNegativeGs, 10, 2, 2, 2, true },
+        { RatingsModifierType::RequirementNumDrops, 2, 2, 2, 2, true },
+        { RatingsModifierType::PenaltyLateralGs, 0, 24576, 35746, 49648 },
+    }},
+};
+// clang-format on
 
 #pragma endregion
 
@@ -4349,97 +3806,97 @@ static void ride_ratings_calculate_lim_launched_roller_coaster(Ride* ride)
 
 // rct2: 0x0097E050
 static const ride_ratings_calculation RideRatingsCalculateFuncTable[RIDE_TYPE_COUNT] = {
-    ride_ratings_calculate_spiral_roller_coaster,          // SPIRAL_ROLLER_COASTER
-    ride_ratings_calculate_stand_up_roller_coaster,        // STAND_UP_ROLLER_COASTER
-    ride_ratings_calculate_suspended_swinging_coaster,     // SUSPENDED_SWINGING_COASTER
-    ride_ratings_calculate_inverted_roller_coaster,        // INVERTED_ROLLER_COASTER
-    ride_ratings_calculate_junior_roller_coaster,          // JUNIOR_ROLLER_COASTER
-    ride_ratings_calculate_miniature_railway,              // MINIATURE_RAILWAY
-    ride_ratings_calculate_monorail,                       // MONORAIL
-    ride_ratings_calculate_mini_suspended_coaster,         // MINI_SUSPENDED_COASTER
-    ride_ratings_calculate_boat_hire,                      // BOAT_HIRE
-    ride_ratings_calculate_wooden_wild_mouse,              // WOODEN_WILD_MOUSE
-    ride_ratings_calculate_steeplechase,                   // STEEPLECHASE
-    ride_ratings_calculate_car_ride,                       // CAR_RIDE
-    ride_ratings_calculate_launched_freefall,              // LAUNCHED_FREEFALL
-    ride_ratings_calculate_bobsleigh_coaster,              // BOBSLEIGH_COASTER
-    ride_ratings_calculate_observation_tower,              // OBSERVATION_TOWER
-    ride_ratings_calculate_looping_roller_coaster,         // LOOPING_ROLLER_COASTER
-    ride_ratings_calculate_dinghy_slide,                   // DINGHY_SLIDE
-    ride_ratings_calculate_mine_train_coaster,             // MINE_TRAIN_COASTER
-    ride_ratings_calculate_chairlift,                      // CHAIRLIFT
-    ride_ratings_calculate_corkscrew_roller_coaster,       // CORKSCREW_ROLLER_COASTER
-    ride_ratings_calculate_maze,                           // MAZE
-    ride_ratings_calculate_spiral_slide,                   // SPIRAL_SLIDE
-    ride_ratings_calculate_go_karts,                       // GO_KARTS
-    ride_ratings_calculate_log_flume,                      // LOG_FLUME
-    ride_ratings_calculate_river_rapids,                   // RIVER_RAPIDS
-    ride_ratings_calculate_dodgems,                        // DODGEMS
-    ride_ratings_calculate_pirate_ship,                    // PIRATE_SHIP
-    ride_ratings_calculate_inverter_ship,                  // SWINGING_INVERTER_SHIP
-    ride_ratings_calculate_food_stall,                     // FOOD_STALL
-    ride_ratings_calculate_food_stall,                     // 1D
-    ride_ratings_calculate_drink_stall,                    // DRINK_STALL
-    ride_ratings_calculate_drink_stall,                    // 1F
-    ride_ratings_calculate_shop,                           // SHOP
-    ride_ratings_calculate_merry_go_round,                 // MERRY_GO_ROUND
-    ride_ratings_calculate_shop,                           // 22
-    ride_ratings_calculate_information_kiosk,              // INFORMATION_KIOSK
-    ride_ratings_calculate_toilets,                        // TOILETS
-    ride_ratings_calculate_ferris_wheel,                   // FERRIS_WHEEL
-    ride_ratings_calculate_motion_simulator,               // MOTION_SIMULATOR
-    ride_ratings_calculate_3d_cinema,                      // 3D_CINEMA
-    ride_ratings_calculate_top_spin,                       // TOP_SPIN
-    ride_ratings_calculate_space_rings,                    // SPACE_RINGS
-    ride_ratings_calculate_reverse_freefall_coaster,       // REVERSE_FREEFALL_COASTER
-    ride_ratings_calculate_lift,                           // LIFT
-    ride_ratings_calculate_vertical_drop_roller_coaster,   // VERTICAL_DROP_ROLLER_COASTER
-    ride_ratings_calculate_cash_machine,                   // CASH_MACHINE
-    ride_ratings_calculate_twist,                          // TWIST
-    ride_ratings_calculate_haunted_house,                  // HAUNTED_HOUSE
-    ride_ratings_calculate_first_aid,                      // FIRST_AID
-    ride_ratings_calculate_circus_show,                    // CIRCUS_SHOW
-    ride_ratings_calculate_ghost_train,                    // GHOST_TRAIN
-    ride_ratings_calculate_twister_roller_coaster,         // TWISTER_ROLLER_COASTER
-    ride_ratings_calculate_wooden_roller_coaster,          // WOODEN_ROLLER_COASTER
-    ride_ratings_calculate_side_friction_roller_coaster,   // SIDE_FRICTION_ROLLER_COASTER
-    ride_ratings_calculate_wild_mouse,                     // WILD_MOUSE
-    ride_ratings_calculate_multi_dimension_roller_coaster, // MULTI_DIMENSION_ROLLER_COASTER
-    ride_ratings_calculate_multi_dimension_roller_coaster, // 38
-    ride_ratings_calculate_flying_roller_coaster,          // FLYING_ROLLER_COASTER
-    ride_ratings_calculate_flying_roller_coaster,          // 3A
-    ride_ratings_calculate_virginia_reel,                  // VIRGINIA_REEL
-    ride_ratings_calculate_splash_boats,                   // SPLASH_BOATS
-    ride_ratings_calculate_mini_helicopters,               // MINI_HELICOPTERS
-    ride_ratings_calculate_lay_down_roller_coaster,        // LAY_DOWN_ROLLER_COASTER
-    ride_ratings_calculate_suspended_monorail,             // SUSPENDED_MONORAIL
-    ride_ratings_calculate_lay_down_roller_coaster,        // 40
-    ride_ratings_calculate_reverser_roller_coaster,        // REVERSER_ROLLER_COASTER
-    ride_ratings_calculate_heartline_twister_coaster,      // HEARTLINE_TWISTER_COASTER
-    ride_ratings_calculate_mini_golf,                      // MINI_GOLF
-    ride_ratings_calculate_giga_coaster,                   // GIGA_COASTER
-    ride_ratings_calculate_roto_drop,                      // ROTO_DROP
-    ride_ratings_calculate_flying_saucers,                 // FLYING_SAUCERS
-    ride_ratings_calculate_crooked_house,                  // CROOKED_HOUSE
-    ride_ratings_calculate_monorail_cycles,                // MONORAIL_CYCLES
-    ride_ratings_calculate_compact_inverted_coaster,       // COMPACT_INVERTED_COASTER
-    ride_ratings_calculate_water_coaster,                  // WATER_COASTER
-    ride_ratings_calculate_air_powered_vertical_coaster,   // AIR_POWERED_VERTICAL_COASTER
-    ride_ratings_calculate_inverted_hairpin_coaster,       // INVERTED_HAIRPIN_COASTER
-    ride_ratings_calculate_magic_carpet,                   // MAGIC_CARPET
-    ride_ratings_calculate_submarine_ride,                 // SUBMARINE_RIDE
-    ride_ratings_calculate_river_rafts,                    // RIVER_RAFTS
-    nullptr,                                               // 50
-    ride_ratings_calculate_enterprise,                     // ENTERPRISE
-    nullptr,                                               // 52
-    nullptr,                                               // 53
-    nullptr,                                               // 54
-    nullptr,                                               // 55
-    ride_ratings_calculate_inverted_impulse_coaster,       // INVERTED_IMPULSE_COASTER
-    ride_ratings_calculate_mini_roller_coaster,            // MINI_ROLLER_COASTER
-    ride_ratings_calculate_mine_ride,                      // MINE_RIDE
-    nullptr,                                               // 59
-    ride_ratings_calculate_lim_launched_roller_coaster,    // LIM_LAUNCHED_ROLLER_COASTER
+    ride_ratings_calculate_tracked<SpiralRollerCoasterRatings>,         // SPIRAL_ROLLER_COASTER
+    ride_ratings_calculate_tracked<StandUpRollerCoasterRatings>,        // STAND_UP_ROLLER_COASTER
+    ride_ratings_calculate_tracked<SuspendedSwingingCoasterRatings>,    // SUSPENDED_SWINGING_COASTER
+    ride_ratings_calculate_tracked<InvertedRollerCoasterRatings>,       // INVERTED_ROLLER_COASTER
+    ride_ratings_calculate_tracked<JuniorRollerCoasterRatings>,         // JUNIOR_ROLLER_COASTER
+    ride_ratings_calculate_tracked<MiniatureRailwayRatings>,            // MINIATURE_RAILWAY
+    ride_ratings_calculate_tracked<MonorailRatings>,                    // MONORAIL
+    ride_ratings_calculate_tracked<MiniSuspendedCoasterRatings>,        // MINI_SUSPENDED_COASTER
+    ride_ratings_calculate_boat_hire,                                   // BOAT_HIRE
+    ride_ratings_calculate_tracked<WoodenWildMouseRatings>,             // WOODEN_WILD_MOUSE
+    ride_ratings_calculate_tracked<SteeplechaseRatings>,                // STEEPLECHASE
+    ride_ratings_calculate_tracked<CarRideRatings>,                     // CAR_RIDE
+    ride_ratings_calculate_launched_freefall,                           // LAUNCHED_FREEFALL
+    ride_ratings_calculate_tracked<BobsleighCoasterRatings>,            // BOBSLEIGH_COASTER
+    ride_ratings_calculate_observation_tower,                           // OBSERVATION_TOWER
+    ride_ratings_calculate_tracked<LoopingRollerCoasterRatings>,        // LOOPING_ROLLER_COASTER
+    ride_ratings_calculate_tracked<DinghySlideRatings>,                 // DINGHY_SLIDE
+    ride_ratings_calculate_tracked<MineTrainCoasterRatings>,            // MINE_TRAIN_COASTER
+    ride_ratings_calculate_chairlift,                                   // CHAIRLIFT
+    ride_ratings_calculate_tracked<CorkscrewRollerCoasterRatings>,      // CORKSCREW_ROLLER_COASTER
+    ride_ratings_calculate_maze,                                        // MAZE
+    ride_ratings_calculate_spiral_slide,                                // SPIRAL_SLIDE
+    ride_ratings_calculate_go_karts,                                    // GO_KARTS
+    ride_ratings_calculate_tracked<LogFlumeRatings>,                    // LOG_FLUME
+    ride_ratings_calculate_tracked<RiverRapidsRatings>,                 // RIVER_RAPIDS
+    ride_ratings_calculate_dodgems,                                     // DODGEMS
+    ride_ratings_calculate_pirate_ship,                                 // PIRATE_SHIP
+    ride_ratings_calculate_inverter_ship,                               // SWINGING_INVERTER_SHIP
+    ride_ratings_calculate_food_stall,                                  // FOOD_STALL
+    ride_ratings_calculate_food_stall,                                  // 1D
+    ride_ratings_calculate_drink_stall,                                 // DRINK_STALL
+    ride_ratings_calculate_drink_stall,                                 // 1F
+    ride_ratings_calculate_shop,                                        // SHOP
+    ride_ratings_calculate_merry_go_round,                              // MERRY_GO_ROUND
+    ride_ratings_calculate_shop,                                        // 22
+    ride_ratings_calculate_information_kiosk,                           // INFORMATION_KIOSK
+    ride_ratings_calculate_toilets,                                     // TOILETS
+    ride_ratings_calculate_ferris_wheel,                                // FERRIS_WHEEL
+    ride_ratings_calculate_motion_simulator,                            // MOTION_SIMULATOR
+    ride_ratings_calculate_3d_cinema,                                   // 3D_CINEMA
+    ride_ratings_calculate_top_spin,                                    // TOP_SPIN
+    ride_ratings_calculate_space_rings,                                 // SPACE_RINGS
+    ride_ratings_calculate_tracked<ReverseFreefallCoasterRatings>,      // REVERSE_FREEFALL_COASTER
+    ride_ratings_calculate_lift,                                        // LIFT
+    ride_ratings_calculate_tracked<VerticalDropRollerCoasterRatings>,   // VERTICAL_DROP_ROLLER_COASTER
+    ride_ratings_calculate_cash_machine,                                // CASH_MACHINE
+    ride_ratings_calculate_twist,                                       // TWIST
+    ride_ratings_calculate_haunted_house,                               // HAUNTED_HOUSE
+    ride_ratings_calculate_first_aid,                                   // FIRST_AID
+    ride_ratings_calculate_circus_show,                                 // CIRCUS_SHOW
+    ride_ratings_calculate_tracked<GhostTrainRatings>,                  // GHOST_TRAIN
+    ride_ratings_calculate_tracked<TwisterRollerCoasterRatings>,        // TWISTER_ROLLER_COASTER
+    ride_ratings_calculate_tracked<WoodenRollerCoasterRatings>,         // WOODEN_ROLLER_COASTER
+    ride_ratings_calculate_tracked<SideFrictionRollerCoasterRatings>,   // SIDE_FRICTION_ROLLER_COASTER
+    ride_ratings_calculate_tracked<WildMouseRatings>,                   // WILD_MOUSE
+    ride_ratings_calculate_tracked<MultiDimensionRollerCoasterRatings>, // MULTI_DIMENSION_ROLLER_COASTER
+    ride_ratings_calculate_tracked<MultiDimensionRollerCoasterRatings>, // 38
+    ride_ratings_calculate_tracked<FlyingRollerCoasterRatings>,         // FLYING_ROLLER_COASTER
+    ride_ratings_calculate_tracked<FlyingRollerCoasterRatings>,         // 3A
+    ride_ratings_calculate_tracked<VirginiaReelRatings>,                // VIRGINIA_REEL
+    ride_ratings_calculate_tracked<SplashBoatsRatings>,                 // SPLASH_BOATS
+    ride_ratings_calculate_mini_helicopters,                            // MINI_HELICOPTERS
+    ride_ratings_calculate_tracked<LayDownRollerCoasterRatings>,        // LAY_DOWN_ROLLER_COASTER
+    ride_ratings_calculate_tracked<SuspendedMonorailRatings>,           // SUSPENDED_MONORAIL
+    ride_ratings_calculate_tracked<LayDownRollerCoasterRatings>,        // 40
+    ride_ratings_calculate_reverser_roller_coaster,                     // REVERSER_ROLLER_COASTER
+    ride_ratings_calculate_tracked<HeartlineTwisterCoasterRatings>,     // HEARTLINE_TWISTER_COASTER
+    ride_ratings_calculate_mini_golf,                                   // MINI_GOLF
+    ride_ratings_calculate_tracked<GigaCoasterRatings>,                 // GIGA_COASTER
+    ride_ratings_calculate_roto_drop,                                   // ROTO_DROP
+    ride_ratings_calculate_flying_saucers,                              // FLYING_SAUCERS
+    ride_ratings_calculate_crooked_house,                               // CROOKED_HOUSE
+    ride_ratings_calculate_tracked<MonorailCyclesRatings>,              // MONORAIL_CYCLES
+    ride_ratings_calculate_compact_inverted_coaster,                    // COMPACT_INVERTED_COASTER
+    ride_ratings_calculate_water_coaster,                               // WATER_COASTER
+    ride_ratings_calculate_tracked<AirPoweredVerticalCoasterRatings>,   // AIR_POWERED_VERTICAL_COASTER
+    ride_ratings_calculate_tracked<InvertedHairpinCoasterRatings>,      // INVERTED_HAIRPIN_COASTER
+    ride_ratings_calculate_magic_carpet,                                // MAGIC_CARPET
+    ride_ratings_calculate_submarine_ride,                              // SUBMARINE_RIDE
+    ride_ratings_calculate_tracked<RiverRaftsRatings>,                  // RIVER_RAFTS
+    nullptr,                                                            // 50
+    ride_ratings_calculate_enterprise,                                  // ENTERPRISE
+    nullptr,                                                            // 52
+    nullptr,                                                            // 53
+    nullptr,                                                            // 54
+    nullptr,                                                            // 55
+    ride_ratings_calculate_tracked<InvertedImpulseCoasterRatings>,      // INVERTED_IMPULSE_COASTER
+    ride_ratings_calculate_tracked<MiniRollerCoasterRatings>,           // MINI_ROLLER_COASTER
+    ride_ratings_calculate_tracked<MineRideRatings>,                    // MINE_RIDE
+    nullptr,                                                            // 59
+    ride_ratings_calculate_tracked<LimLaunchedRollerCoasterRatings>,    // LIM_LAUNCHED_ROLLER_COASTER
 };
 
 static ride_ratings_calculation ride_ratings_get_calculate_func(uint8_t rideType)
@@ -0,0 +1,101 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "StationQueues.h"
+
+#include "../peep/Peep.h"
+#include "../world/Sprite.h"
+#include "Ride.h"
+
+#include <array>
+
+using namespace StationQueues;
+
+struct QueueEnd
+{
+    // The queue end is only known while this matches _queueEndGeneration.
+    uint32_t Generation = 0;
+    TileCoordsXYZ Entrance;
+    TileCoordsXYZ End;
+};
+
+static std::array<QueueEnd, MAX_RIDES * MAX_STATIONS> _queueEnds;
+static uint32_t _queueEndGeneration = 1;
+static std::array<uint16_t, MAX_SPRITES> _guestsBehind;
+
+void StationQueues::Reset()
+{
+    InvalidateQueueEnds();
+
+    _guestsBehind.fill(SPRITE_INDEX_NULL);
+    for (const auto& ride : GetRideManager())
+    {
+        for (const auto& station : ride.stations)
+        {
+            // A broken save could have a queue that loops, don't follow it for longer than there are sprites.
+            uint16_t behindIndex = SPRITE_INDEX_NULL;
+            uint16_t spriteIndex = station.LastPeepInQueue;
+            Peep* peep;
+            for (int32_t i = 0; i < MAX_SPRITES && (peep = try_get_guest(spriteIndex)) != nullptr; i++)
+            {
+                _guestsBehind[spriteIndex] = behindIndex;
+                behindIndex = spriteIndex;
+                spriteIndex = peep->next_in_queue;
+            }
+        }
+    }
+}
+
+void StationQueues::InvalidateQueueEnds()
+{
+    _queueEndGeneration++;
+    if (_queueEndGeneration == 0)
+    {
+        _queueEnds.fill({});
+        _queueEndGeneration = 1;
+    }
+}
+
+bool StationQueues::GetQueueEnd(ride_id_t rideIndex, StationIndex stationIndex, TileCoordsXYZ& loc)
+{
+    if (rideIndex >= MAX_RIDES || stationIndex >= MAX_STATIONS)
+        return false;
+
+    const auto& queueEnd = _queueEnds[rideIndex * MAX_STATIONS + stationIndex];
+    if (queueEnd.Generation != _queueEndGeneration || queueEnd.Entrance != loc)
+        return false;
+
+    loc = queueEnd.End;
+    return true;
+}
+
+void StationQueues::SetQueueEnd(
+    ride_id_t rideIndex, StationIndex stationIndex, const TileCoordsXYZ& entrance, const TileCoordsXYZ& end)
+{
+    if (rideIndex >= MAX_RIDES || stationIndex >= MAX_STATIONS)
+        return;
+
+    auto& queueEnd = _queueEnds[rideIndex * MAX_STATIONS + stationIndex];
+    queueEnd.Generation = _queueEndGeneration;
+    queueEnd.Entrance = entrance;
+    queueEnd.End = end;
+}
+
+uint16_t StationQueues::GetGuestBehind(uint16_t spriteIndex)
+{
+    return spriteIndex < MAX_SPRITES ? _guestsBehind[spriteIndex] : SPRITE_INDEX_NULL;
+}
+
+void StationQueues::SetGuestBehind(uint16_t spriteIndex, uint16_t behindIndex)
+{
+    if (spriteIndex < MAX_SPRITES)
+    {
+        _guestsBehind[spriteIndex] = behindIndex;
+    }
+}
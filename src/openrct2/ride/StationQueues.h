@@ -0,0 +1,43 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+#include "../world/Location.hpp"
+#include "RideTypes.h"
+#include "Station.h"
+
+/**
+ * What the game would otherwise have to walk the queues of the stations for. The end of the queue path leading to each
+ * station entrance is remembered until a game action or a tile element change could have altered the path. For the
+ * guests in a queue, which are linked from the last guest to the one at the front, the guest behind each of them is
+ * kept so a guest can leave the queue without the queue being walked.
+ */
+namespace StationQueues
+{
+    /**
+     * Links the guests in every queue again and forgets the queue ends, used when a park is loaded.
+     */
+    void Reset();
+    void InvalidateQueueEnds();
+
+    /**
+     * Sets loc to the end of the queue path leading to the entrance at loc, if it is known.
+     */
+    bool GetQueueEnd(ride_id_t rideIndex, StationIndex stationIndex, TileCoordsXYZ& loc);
+    void SetQueueEnd(ride_id_t rideIndex, StationIndex stationIndex, const TileCoordsXYZ& entrance, const TileCoordsXYZ& end);
+
+    /**
+     * The guest whose next_in_queue is the given guest, or SPRITE_INDEX_NULL. The guest has to be checked by the caller as
+     * the link is not removed when a ride or a guest is.
+     */
+    uint16_t GetGuestBehind(uint16_t spriteIndex);
+    void SetGuestBehind(uint16_t spriteIndex, uint16_t behindIndex);
+} // namespace StationQueues
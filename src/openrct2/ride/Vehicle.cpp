@@ -43,6 +43,7 @@
 #include "VehicleSubpositionData.h"
 
 #include <algorithm>
+#include <array>
 #include <iterator>
 
 static void vehicle_update_crossings(const Vehicle* vehicle);
@@ -107,6 +108,25 @@ uint8_t _vehicleF64E2C;
 Vehicle* _vehicleFrontVehicle;
 CoordsXYZ unk_F64E20;
 
+/**
+ * A train waiting for passengers that nothing can happen to other than its waiting time going up. It is only woken when
+ * its waiting time reaches a value that changes what the train does, something about its ride changes or a guest takes a
+ * seat on the ride.
+ */
+struct VehicleSleep
+{
+    // The train is only asleep while these match _vehicleSleepGeneration and the ride's entry in _rideWakeGenerations.
+    uint32_t Generation;
+    uint32_t RideGeneration;
+    uint32_t WakeTimeWaiting;
+    uint16_t NumRiders;
+    uint8_t RideStatus;
+};
+
+static std::array<VehicleSleep, MAX_SPRITES> _vehicleSleeps;
+static std::array<uint32_t, MAX_RIDES> _rideWakeGenerations;
+static uint32_t _vehicleSleepGeneration = 1;
+
 // clang-format off
 static constexpr const SoundId byte_9A3A14[] = { SoundId::Scream8, SoundId::Scream1 };
 static constexpr const SoundId byte_9A3A16[] = { SoundId::Scream1, SoundId::Scream6 };
@@ -1350,6 +1370,113 @@ void vehicle_sounds_update()
     }
 }
 
+void vehicle_wake_all()
+{
+    _vehicleSleepGeneration++;
+    if (_vehicleSleepGeneration == 0)
+    {
+        _vehicleSleeps.fill({});
+        _vehicleSleepGeneration = 1;
+    }
+}
+
+void vehicle_wake_ride(ride_id_t rideIndex)
+{
+    if (rideIndex < MAX_RIDES)
+    {
+        _rideWakeGenerations[rideIndex]++;
+    }
+}
+
+static bool vehicle_is_waiting_for_passengers(const Vehicle* vehicle)
+{
+    return vehicle->status == VEHICLE_STATUS_WAITING_FOR_PASSENGERS && vehicle->sub_state == 1;
+}
+
+/**
+ * Puts the train to sleep if its last update, which was already spent waiting for passengers, only counted up its
+ * waiting time while it is empty and not making a sound. The train is woken at the next waiting time a departure check
+ * depends on.
+ */
+static void vehicle_try_sleep(Vehicle* vehicle)
+{
+    if (!vehicle_is_waiting_for_passengers(vehicle) || vehicle->velocity != 0)
+        return;
+    if (vehicle->update_flags & VEHICLE_UPDATE_FLAG_TESTING)
+        return;
+    if (vehicle->sound1_id != SoundId::Null || vehicle->sound1_volume != 255 || vehicle->sound2_id != SoundId::Null
+        || vehicle->sound2_volume != 255 || vehicle->scream_sound_id != SoundId::Null || vehicle->sound_vector_factor != 0
+        || (vehicle->sound2_flags & VEHICLE_SOUND2_FLAGS_LIFT_HILL))
+        return;
+
+    auto ride = get_ride(vehicle->ride);
+    if (ride == nullptr || ride->id >= MAX_RIDES || get_ride_entry(vehicle->ride_subtype) == nullptr)
+        return;
+    if (ride->lifecycle_flags & (RIDE_LIFECYCLE_BREAKDOWN_PENDING | RIDE_LIFECYCLE_BROKEN_DOWN))
+        return;
+    // The other trains arriving could make this one leave.
+    if (ride->depart_flags & RIDE_DEPART_LEAVE_WHEN_ANOTHER_ARRIVES)
+        return;
+
+    for (uint16_t spriteId = vehicle->sprite_index; spriteId != SPRITE_INDEX_NULL;)
+    {
+        Vehicle* car = GET_VEHICLE(spriteId);
+        if (car->num_peeps != 0 || car->next_free_seat != 0)
+            return;
+        spriteId = car->next_vehicle_on_train;
+    }
+
+    // The waiting times the departure checks compare against, whether the ride uses them or not.
+    uint32_t timeWaiting = vehicle->time_waiting;
+    uint32_t wakeTimeWaiting = 0x10000;
+    for (uint32_t checkedTime : { 20u, ride->min_waiting_time * 32u, ride->max_waiting_time * 32u + 1 })
+    {
+        if (checkedTime > timeWaiting)
+        {
+            wakeTimeWaiting = std::min(wakeTimeWaiting, checkedTime);
+        }
+    }
+
+    auto& sleep = _vehicleSleeps[vehicle->sprite_index];
+    sleep.Generation = _vehicleSleepGeneration;
+    sleep.RideGeneration = _rideWakeGenerations[ride->id];
+    sleep.WakeTimeWaiting = wakeTimeWaiting;
+    sleep.NumRiders = ride->num_riders;
+    sleep.RideStatus = ride->status;
+}
+
+/**
+ * Counts up the waiting time of a sleeping train, returns false if the train has to be updated instead.
+ */
+static bool vehicle_update_asleep(Vehicle* vehicle)
+{
+    auto& sleep = _vehicleSleeps[vehicle->sprite_index];
+    if (sleep.Generation != _vehicleSleepGeneration)
+        return false;
+
+    // Anything not woken by an event is checked here.
+    sleep.Generation = 0;
+    if (!vehicle_is_waiting_for_passengers(vehicle))
+        return false;
+
+    auto ride = get_ride(vehicle->ride);
+    if (ride == nullptr || ride->id >= MAX_RIDES || sleep.RideGeneration != _rideWakeGenerations[ride->id])
+        return false;
+    if (ride->status != sleep.RideStatus || ride->num_riders != sleep.NumRiders
+        || (ride->lifecycle_flags & (RIDE_LIFECYCLE_BREAKDOWN_PENDING | RIDE_LIFECYCLE_BROKEN_DOWN)))
+        return false;
+
+    uint32_t timeWaiting = vehicle->time_waiting;
+    if (timeWaiting != 0xFFFF)
+        timeWaiting++;
+    if (timeWaiting >= sleep.WakeTimeWaiting)
+        return false;
+
+    vehicle->time_waiting = timeWaiting;
+    sleep.Generation = _vehicleSleepGeneration;
+    return true;
+}
+
 /**
  *
  *  rct2: 0x006D4204
@@ -1371,7 +1498,15 @@ void vehicle_update_all()
         vehicle = GET_VEHICLE(sprite_index);
         sprite_index = vehicle->next;
 
+        if (vehicle_update_asleep(vehicle))
+            continue;
+
+        bool wasWaiting = vehicle_is_waiting_for_passengers(vehicle);
         vehicle->Update();
+        if (wasWaiting)
+        {
+            vehicle_try_sleep(vehicle);
+        }
     }
 }
 
@@ -501,6 +501,8 @@ struct GForces
 
 Vehicle* try_get_vehicle(uint16_t spriteIndex);
 void vehicle_update_all();
+void vehicle_wake_all();
+void vehicle_wake_ride(ride_id_t rideIndex);
 void vehicle_sounds_update();
 GForces vehicle_get_g_forces(const Vehicle* vehicle);
 void vehicle_set_map_toolbar(const Vehicle* vehicle);
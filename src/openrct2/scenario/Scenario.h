@@ -24,6 +24,8 @@
 #include "../world/MapAnimation.h"
 #include "../world/Sprite.h"
 
+#include <functional>
+
 using random_engine_t = Random::Rct2::Engine;
 
 struct ParkLoadResult;
@@ -412,6 +414,9 @@ uint32_t scenario_rand_max(uint32_t max);
 
 bool scenario_prepare_for_save();
 int32_t scenario_save(const utf8* path, int32_t flags);
+bool scenario_save_async(const utf8* path, int32_t flags, std::function<void(bool)> callback);
+void scenario_save_async_update();
+void scenario_save_async_flush();
 void scenario_remove_trackless_rides(rct_s6_data* s6);
 void scenario_fix_ghosts(rct_s6_data* s6);
 void scenario_failure();
@@ -262,6 +262,38 @@ static size_t decode_chunk_rle_with_size(const uint8_t* src_buffer, uint8_t* dst
 
 #pragma region Encoding
 
+// Sets the high bit of exactly those bytes in word that are zero. Byte n of a loaded word is the nth byte in memory as
+// the game only runs on little endian.
+static uint64_t find_zero_bytes(uint64_t word)
+{
+    constexpr uint64_t lowBits = 0x7F7F7F7F7F7F7F7FULL;
+    return ~(((word & lowBits) + lowBits) | word | lowBits);
+}
+
+static uint64_t load_word(const uint8_t* src)
+{
+    uint64_t word;
+    std::memcpy(&word, src, sizeof(word));
+    return word;
+}
+
+/**
+ * Returns how many of the first maxCount bytes at src are not followed by an equal byte, i.e. where the next run starts.
+ */
+static size_t count_literal_bytes(const uint8_t* src, size_t maxCount)
+{
+    size_t count = 0;
+    while (count + sizeof(uint64_t) <= maxCount && find_zero_bytes(load_word(src + count) ^ load_word(src + count + 1)) == 0)
+    {
+        count += sizeof(uint64_t);
+    }
+    while (count < maxCount && src[count] != src[count + 1])
+    {
+        count++;
+    }
+    return count;
+}
+
 /**
  * Ensure dst_buffer is bigger than src_buffer then resize afterwards
  * returns length of dst_buffer
@@ -286,6 +318,13 @@ static size_t encode_chunk_rle(const uint8_t* src_buffer, uint8_t* dst_buffer, s
         }
         if (*src == src[1])
         {
+            // Measure the run a word at a time first
+            const uint64_t pattern = *src * 0x0101010101010101ULL;
+            while (count + sizeof(uint64_t) <= 125 && src + count + sizeof(uint64_t) <= end_src
+                   && load_word(src + count) == pattern)
+            {
+                count += sizeof(uint64_t);
+            }
             for (; (count < 125) && ((src + count) < end_src); count++)
             {
                 if (*src != src[count])
@@ -299,8 +338,11 @@ static size_t encode_chunk_rle(const uint8_t* src_buffer, uint8_t* dst_buffer, s
         }
         else
         {
-            count++;
-            src++;
+            // Skip straight to the start of the next run or to where the literal block is full
+            size_t literalLength = count_literal_bytes(src, std::min<size_t>(126 - count, end_src - 1 - src));
+            literalLength = std::max<size_t>(literalLength, 1);
+            count += (uint8_t)literalLength;
+            src += literalLength;
         }
     }
     if (src == end_src - 1)
@@ -314,6 +356,21 @@ static size_t encode_chunk_rle(const uint8_t* src_buffer, uint8_t* dst_buffer, s
     return dst - dst_buffer;
 }
 
+/**
+ * Returns how many leading bytes of a and b are equal, at most eight.
+ */
+static size_t count_matching_bytes(const uint8_t* a, const uint8_t* b)
+{
+    uint64_t difference = load_word(a) ^ load_word(b);
+    size_t count = 0;
+    while (count < sizeof(uint64_t) && (difference & 0xFF) == 0)
+    {
+        difference >>= 8;
+        count++;
+    }
+    return count;
+}
+
 static size_t encode_chunk_repeat(const uint8_t* src_buffer, uint8_t* dst_buffer, size_t length)
 {
     if (length == 0)
@@ -334,32 +391,60 @@ static size_t encode_chunk_repeat(const uint8_t* src_buffer, uint8_t* dst_buffer
 
         size_t bestRepeatIndex = 0;
         size_t bestRepeatCount = 0;
-        for (size_t repeatIndex = searchIndex; repeatIndex <= searchEnd; repeatIndex++)
+        if (i >= 32 && i + sizeof(uint64_t) <= length)
         {
-            size_t repeatCount = 0;
-            size_t maxRepeatCount = std::min(std::min((size_t)7, searchEnd - repeatIndex), length - i - 1);
-            // maxRepeatCount should not exceed length
-            assert(repeatIndex + maxRepeatCount < length);
-            assert(i + maxRepeatCount < length);
-            for (size_t j = 0; j <= maxRepeatCount; j++)
+            // Only candidates starting with the current byte can match, find those eight at a time
+            const uint64_t pattern = src_buffer[i] * 0x0101010101010101ULL;
+            for (size_t wordIndex = searchIndex; wordIndex <= searchEnd && bestRepeatCount < 8; wordIndex += sizeof(uint64_t))
             {
-                if (src_buffer[repeatIndex + j] == src_buffer[i + j])
+                uint64_t candidates = find_zero_bytes(load_word(src_buffer + wordIndex) ^ pattern);
+                for (size_t repeatIndex = wordIndex; candidates != 0; repeatIndex++, candidates >>= 8)
                 {
-                    repeatCount++;
-                }
-                else
-                {
-                    break;
+                    if (!(candidates & 0x80))
+                        continue;
+
+                    size_t maxRepeatCount = std::min((size_t)7, searchEnd - repeatIndex);
+                    size_t repeatCount = std::min(
+                        count_matching_bytes(src_buffer + repeatIndex, src_buffer + i), maxRepeatCount + 1);
+                    if (repeatCount > bestRepeatCount)
+                    {
+                        bestRepeatIndex = repeatIndex;
+                        bestRepeatCount = repeatCount;
+                        if (repeatCount == 8)
+                            break;
+                    }
                 }
             }
-            if (repeatCount > bestRepeatCount)
+        }
+        else
+        {
+            for (size_t repeatIndex = searchIndex; repeatIndex <= searchEnd; repeatIndex++)
             {
-                bestRepeatIndex = repeatIndex;
-                bestRepeatCount = repeatCount;
+                size_t repeatCount = 0;
+                size_t maxRepeatCount = std::min(std::min((size_t)7, searchEnd - repeatIndex), length - i - 1);
+                // maxRepeatCount should not exceed length
+                assert(repeatIndex + maxRepeatCount < length);
+                assert(i + maxRepeatCount < length);
+                for (size_t j = 0; j <= maxRepeatCount; j++)
+                {
+                    if (src_buffer[repeatIndex + j] == src_buffer[i + j])
+                    {
+                        repeatCount++;
+                    }
+                    else
+                    {
+                        break;
+                    }
+                }
+                if (repeatCount > bestRepeatCount)
+                {
+                    bestRepeatIndex = repeatIndex;
+                    bestRepeatCount = repeatCount;
 
-                // Maximum repeat count is 8
-                if (repeatCount == 8)
-                    break;
+                    // Maximum repeat count is 8
+                    if (repeatCount == 8)
+                        break;
+                }
             }
         }
 
@@ -383,9 +468,17 @@ static size_t encode_chunk_repeat(const uint8_t* src_buffer, uint8_t* dst_buffer
 
 static void encode_chunk_rotate(uint8_t* buffer, size_t length)
 {
-    size_t i;
+    // The rotation cycles through 1, 3, 5 and 7 bits, unrolling by that period lets the compiler vectorise the loop.
+    size_t i = 0;
+    for (; i + 4 <= length; i += 4)
+    {
+        buffer[i + 0] = rol8(buffer[i + 0], 1);
+        buffer[i + 1] = rol8(buffer[i + 1], 3);
+        buffer[i + 2] = rol8(buffer[i + 2], 5);
+        buffer[i + 3] = rol8(buffer[i + 3], 7);
+    }
     uint8_t code = 1;
-    for (i = 0; i < length; i++)
+    for (; i < length; i++)
     {
         buffer[i] = rol8(buffer[i], code);
         code = (code + 2) % 8;
@@ -0,0 +1,157 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "ActiveTiles.h"
+
+#include "Footpath.h"
+#include "Map.h"
+#include "Surface.h"
+
+#include <algorithm>
+#include <array>
+
+using namespace ActiveTiles;
+
+constexpr uint32_t LOOP_LENGTH = MAXIMUM_MAP_SIZE_TECHNICAL * MAXIMUM_MAP_SIZE_TECHNICAL;
+constexpr uint32_t BITS_PER_WORD = 64;
+static_assert(LOOP_LENGTH == 0x10000, "The tile loop position is 16 bits");
+
+// One bit for each position of the grass and scenery tile loop.
+static std::array<uint64_t, LOOP_LENGTH / BITS_PER_WORD> _activePositions;
+static bool _rebuildNeeded = true;
+
+static void Rebuild()
+{
+    _activePositions.fill(0);
+    for (int32_t y = 0; y < MAXIMUM_MAP_SIZE_TECHNICAL; y++)
+    {
+        for (int32_t x = 0; x < MAXIMUM_MAP_SIZE_TECHNICAL; x++)
+        {
+            TileCoordsXY tileLoc{ x, y };
+            if (HasUpdates(tileLoc.ToCoordsXY()))
+            {
+                uint16_t position = GetTileLoopPosition(tileLoc);
+                _activePositions[position / BITS_PER_WORD] |= 1ULL << (position % BITS_PER_WORD);
+            }
+        }
+    }
+    _rebuildNeeded = false;
+}
+
+void ActiveTiles::Reset()
+{
+    _rebuildNeeded = true;
+}
+
+void ActiveTiles::MarkActive(const CoordsXY& loc)
+{
+    if (_rebuildNeeded || !map_is_location_valid(loc))
+        return;
+
+    uint16_t position = GetTileLoopPosition(TileCoordsXY(loc));
+    _activePositions[position / BITS_PER_WORD] |= 1ULL << (position % BITS_PER_WORD);
+}
+
+bool ActiveTiles::IsActive(const CoordsXY& loc)
+{
+    if (_rebuildNeeded)
+    {
+        Rebuild();
+    }
+    if (!map_is_location_valid(loc))
+        return false;
+
+    uint16_t position = GetTileLoopPosition(TileCoordsXY(loc));
+    return (_activePositions[position / BITS_PER_WORD] & (1ULL << (position % BITS_PER_WORD))) != 0;
+}
+
+bool ActiveTiles::HasUpdates(const CoordsXY& loc)
+{
+    auto* surfaceElement = map_get_surface_element_at(loc);
+    if (surfaceElement == nullptr)
+        return false;
+    if (surfaceElement->CanGrassGrow())
+        return true;
+
+    // Ghosts are counted too, they are updated when not in a network game.
+    const TileElement* tileElement = map_get_first_element_at(loc);
+    do
+    {
+        switch (tileElement->GetType())
+        {
+            case TILE_ELEMENT_TYPE_SMALL_SCENERY:
+                return true;
+            case TILE_ELEMENT_TYPE_PATH:
+                if (tileElement->AsPath()->HasAddition())
+                    return true;
+                break;
+        }
+    } while (!(tileElement++)->IsLastForTile());
+    return false;
+}
+
+uint32_t ActiveTiles::GetNextActive(uint32_t position, uint32_t end)
+{
+    if (_rebuildNeeded)
+    {
+        Rebuild();
+    }
+
+    while (position < end)
+    {
+        uint32_t index = position % LOOP_LENGTH;
+        uint64_t word = _activePositions[index / BITS_PER_WORD] >> (index % BITS_PER_WORD);
+        if (word != 0)
+        {
+            while (!(word & 1))
+            {
+                word >>= 1;
+                position++;
+            }
+            return std::min(position, end);
+        }
+        position += BITS_PER_WORD - (index % BITS_PER_WORD);
+    }
+    return end;
+}
+
+void ActiveTiles::Refresh(const CoordsXY& loc)
+{
+    if (_rebuildNeeded || !map_is_location_valid(loc) || HasUpdates(loc))
+        return;
+
+    uint16_t position = GetTileLoopPosition(TileCoordsXY(loc));
+    _activePositions[position / BITS_PER_WORD] &= ~(1ULL << (position % BITS_PER_WORD));
+}
+
+CoordsXY ActiveTiles::GetLoopPositionTile(uint16_t position)
+{
+    // The bits of the position alternate between x and y, starting with the highest bit of each.
+    int32_t x = 0;
+    int32_t y = 0;
+    for (int32_t i = 0; i < 8; i++)
+    {
+        x = (x << 1) | (position & 1);
+        position >>= 1;
+        y = (y << 1) | (position & 1);
+        position >>= 1;
+    }
+    return TileCoordsXY{ x, y }.ToCoordsXY();
+}
+
+uint16_t ActiveTiles::GetTileLoopPosition(const TileCoordsXY& loc)
+{
+    uint16_t position = 0;
+    for (int32_t i = 0; i < 8; i++)
+    {
+        position |= ((loc.x >> (7 - i)) & 1) << (2 * i);
+        position |= ((loc.y >> (7 - i)) & 1) << (2 * i + 1);
+    }
+    return position;
+}
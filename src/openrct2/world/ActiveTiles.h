@@ -0,0 +1,48 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+#include "Location.hpp"
+
+/**
+ * The tiles map_update_tiles has something to do on: grass that can grow, small scenery that ages or path additions that
+ * can be fountains. The tiles are kept in the order of the grass and scenery tile loop so the loop can skip the rest of
+ * them while still visiting the same tiles on the same ticks. Tiles are marked as active again whenever something that
+ * could need updating is placed on them and become inactive once the loop finds nothing to do on them.
+ */
+namespace ActiveTiles
+{
+    /**
+     * Finds the active tiles again before the next update, used when a park is loaded or the tile elements are moved.
+     */
+    void Reset();
+    void MarkActive(const CoordsXY& loc);
+    bool IsActive(const CoordsXY& loc);
+
+    /**
+     * Whether there is anything for map_update_tiles to update on the tile.
+     */
+    bool HasUpdates(const CoordsXY& loc);
+
+    /**
+     * The first active loop position from position up to end, or end if there are none. Positions past 0xFFFF wrap
+     * around to the start of the loop.
+     */
+    uint32_t GetNextActive(uint32_t position, uint32_t end);
+
+    /**
+     * Checks the tile after it has been updated, making it inactive if there is nothing left to update on it.
+     */
+    void Refresh(const CoordsXY& loc);
+
+    CoordsXY GetLoopPositionTile(uint16_t position);
+    uint16_t GetTileLoopPosition(const TileCoordsXY& loc);
+} // namespace ActiveTiles
@@ -37,18 +37,21 @@
 #include "../object/ObjectManager.h"
 #include "../object/TerrainSurfaceObject.h"
 #include "../ride/RideData.h"
+#include "../ride/StationQueues.h"
 #include "../ride/Track.h"
 #include "../ride/TrackData.h"
 #include "../ride/TrackDesign.h"
 #include "../scenario/Scenario.h"
 #include "../util/Util.h"
 #include "../windows/Intent.h"
+#include "ActiveTiles.h"
 #include "Banner.h"
 #include "Climate.h"
 #include "Footpath.h"
 #include "LargeScenery.h"
 #include "MapAnimation.h"
 #include "Park.h"
+#include "RegionSummary.h"
 #include "Scenery.h"
 #include "SmallScenery.h"
 #include "Surface.h"
@@ -402,6 +405,9 @@ void map_update_tile_pointers()
     }
 
     gNextFreeTileElement = tileElement;
+    RegionSummary::Reset();
+    ActiveTiles::Reset();
+    StationQueues::InvalidateQueueEnds();
 }
 
 /**
@@ -925,6 +931,8 @@ bool map_is_location_at_edge(const CoordsXY& loc)
  */
 void tile_element_remove(TileElement* tileElement)
 {
+    StationQueues::InvalidateQueueEnds();
+
     // Replace Nth element by (N+1)th element.
     // This loop will make tileElement point to the old last element position,
     // after copy it to it's new position
@@ -1197,6 +1205,9 @@ TileElement* tile_element_insert(const CoordsXYZ& loc, int32_t occupiedQuadrants
     }
 
     gNextFreeTileElement = newTileElement;
+    RegionSummary::Invalidate(loc);
+    ActiveTiles::MarkActive(loc);
+    StationQueues::InvalidateQueueEnds();
     return insertedElement;
 }
 
@@ -1487,32 +1498,21 @@ void map_update_tiles()
     if (gScreenFlags & ignoreScreenFlags)
         return;
 
-    // Update 43 more tiles
-    for (int32_t j = 0; j < 43; j++)
+    // Update 43 more tiles, skipping the ones with nothing on them to update
+    uint32_t end = gGrassSceneryTileLoopPosition + 43;
+    for (uint32_t position = ActiveTiles::GetNextActive(gGrassSceneryTileLoopPosition, end); position < end;
+         position = ActiveTiles::GetNextActive(position + 1, end))
     {
-        int32_t x = 0;
-        int32_t y = 0;
-
-        uint16_t interleaved_xy = gGrassSceneryTileLoopPosition;
-        for (int32_t i = 0; i < 8; i++)
-        {
-            x = (x << 1) | (interleaved_xy & 1);
-            interleaved_xy >>= 1;
-            y = (y << 1) | (interleaved_xy & 1);
-            interleaved_xy >>= 1;
-        }
-
-        auto mapPos = TileCoordsXY{ x, y }.ToCoordsXY();
+        auto mapPos = ActiveTiles::GetLoopPositionTile(position & 0xFFFF);
         auto* surfaceElement = map_get_surface_element_at(mapPos);
         if (surfaceElement != nullptr)
         {
             surfaceElement->UpdateGrassLength(mapPos);
             scenery_update_tile(mapPos);
         }
-
-        gGrassSceneryTileLoopPosition++;
-        gGrassSceneryTileLoopPosition &= 0xFFFF;
+        ActiveTiles::Refresh(mapPos);
     }
+    gGrassSceneryTileLoopPosition = end & 0xFFFF;
 }
 
 void map_remove_provisional_elements()
@@ -1650,6 +1650,7 @@ void map_extend_boundary_surface()
         if (existingTileElement && newTileElement)
         {
             map_extend_boundary_surface_extend_tile(*existingTileElement, *newTileElement);
+            ActiveTiles::MarkActive(TileCoordsXY{ x, y }.ToCoordsXY());
         }
 
         update_park_fences({ x << 5, y << 5 });
@@ -1664,6 +1665,7 @@ void map_extend_boundary_surface()
         if (existingTileElement && newTileElement)
         {
             map_extend_boundary_surface_extend_tile(*existingTileElement, *newTileElement);
+            ActiveTiles::MarkActive(TileCoordsXY{ x, y }.ToCoordsXY());
         }
 
         update_park_fences({ x << 5, y << 5 });
@@ -1689,6 +1691,7 @@ static void clear_element_at(const CoordsXY& loc, TileElement** elementPtr)
             element->AsSurface()->SetOwnership(OWNERSHIP_UNOWNED);
             element->AsSurface()->SetParkFences(0);
             element->AsSurface()->SetWaterHeight(0);
+            ActiveTiles::MarkActive(loc);
             // Because this element is not completely removed, the pointer must be updated manually
             // The rest of the elements are removed from the array, so the pointer doesn't need to be updated.
             (*elementPtr)++;
@@ -37,11 +37,13 @@
 #include "../windows/Intent.h"
 #include "Entrance.h"
 #include "Map.h"
+#include "ParkStatistics.h"
 #include "Sprite.h"
 #include "Surface.h"
 
 #include <algorithm>
 #include <limits>
+#include <vector>
 
 using namespace OpenRCT2;
 
@@ -383,24 +385,12 @@ int32_t Park::CalculateParkRating() const
         result -= 150 - (std::min<int16_t>(2000, gNumGuestsInPark) / 13);
 
         // Find the number of happy peeps and the number of peeps who can't find the park exit
-        uint32_t happyGuestCount = 0;
-        uint32_t lostGuestCount = 0;
-        uint16_t spriteIndex;
-        Peep* peep;
-        FOR_ALL_GUESTS (spriteIndex, peep)
-        {
-            if (peep->outside_of_park == 0)
-            {
-                if (peep->happiness > 128)
-                {
-                    happyGuestCount++;
-                }
-                if ((peep->peep_flags & PEEP_FLAGS_LEAVING_PARK) && (peep->peep_is_lost_countdown < 90))
-                {
-                    lostGuestCount++;
-                }
-            }
-        }
+#if defined(DEBUG_LEVEL_1) && DEBUG_LEVEL_1
+        ParkStatistics::Verify();
+#endif // defined(DEBUG_LEVEL_1) && DEBUG_LEVEL_1
+        const auto& guestCounts = ParkStatistics::GetGuestCounts();
+        uint32_t happyGuestCount = guestCounts.Happy;
+        uint32_t lostGuestCount = guestCounts.Lost;
 
         // Peep happiness -500 to +0
         result -= 500;
@@ -736,6 +726,123 @@ Peep* Park::GenerateGuest()
     return peep;
 }
 
+// The footpaths inside the park that guests can be placed on.
+static std::vector<CoordsXYZ> GetGuestSpawnFootpaths()
+{
+    std::vector<CoordsXYZ> footpaths;
+    tile_element_iterator it;
+    tile_element_iterator_begin(&it);
+    do
+    {
+        if (it.element->GetType() != TILE_ELEMENT_TYPE_PATH || it.element->IsGhost() || it.element->AsPath()->IsQueue())
+            continue;
+
+        auto loc = TileCoordsXY{ it.x, it.y }.ToCoordsXY().ToTileCentre();
+        if (!map_is_location_in_park(loc))
+            continue;
+
+        auto pathElement = it.element->AsPath();
+        auto z = map_height_from_slope(loc, pathElement->GetSlopeDirection(), pathElement->IsSloped())
+            + pathElement->GetBaseZ();
+        footpaths.push_back({ loc, z });
+    } while (tile_element_iterator_next(&it));
+    return footpaths;
+}
+
+int32_t Park::SpawnGuests(int32_t count)
+{
+    if (count <= 0)
+        return 0;
+
+    auto footpaths = GetGuestSpawnFootpaths();
+    if (footpaths.empty())
+        return 0;
+
+    // Peep::Generate needs 400 free sprites, so it can use all but the last 399.
+    count = std::min<int32_t>(count, std::max<int32_t>(gSpriteListCount[SPRITE_LIST_FREE] - 399, 0));
+
+    int32_t spawned = 0;
+    for (; spawned < count; spawned++)
+    {
+        const auto& loc = footpaths[scenario_rand_max((uint32_t)footpaths.size())];
+        auto peep = Peep::Generate(loc);
+        if (peep == nullptr)
+            break;
+
+        auto direction = scenario_rand() & 3;
+        peep->sprite_direction = direction << 3;
+        peep->direction = direction;
+        peep->destination_x = loc.x;
+        peep->destination_y = loc.y;
+        peep->destination_tolerance = 5;
+        peep->var_37 = 0;
+
+        // The same as Guest::UpdateEnteringPark once the guest is through the entrance.
+        peep->outside_of_park = 0;
+        peep->time_in_park = gScenarioTicks;
+        increment_guests_in_park();
+        decrement_guests_heading_for_park();
+        ParkStatistics::UpdateGuest(peep);
+    }
+
+    if (spawned > 0)
+    {
+        auto intent = Intent(INTENT_ACTION_UPDATE_GUEST_COUNT);
+        context_broadcast_intent(&intent);
+        window_invalidate_by_class(WC_GUEST_LIST);
+    }
+    return spawned;
+}
+
+int32_t Park::DespawnGuests(int32_t count)
+{
+    if (count <= 0)
+        return 0;
+
+    std::vector<uint16_t> guestIndices;
+    uint16_t spriteIndex;
+    Peep* peep;
+    FOR_ALL_GUESTS (spriteIndex, peep)
+    {
+        if ((int32_t)guestIndices.size() >= count)
+            break;
+        if (peep->outside_of_park != 0)
+            continue;
+        // The vehicles refer to guests on a ride, a picked up guest is still held by the player.
+        if (peep->state == PEEP_STATE_ON_RIDE || peep->state == PEEP_STATE_ENTERING_RIDE
+            || peep->state == PEEP_STATE_LEAVING_RIDE || peep->state == PEEP_STATE_PICKED)
+            continue;
+        guestIndices.push_back(spriteIndex);
+    }
+
+    // Only the guest count intent of Peep::Remove is left out, it is sent once for all the guests.
+    for (auto guestIndex : guestIndices)
+    {
+        decrement_guests_in_park();
+        peep_sprite_remove(GET_PEEP(guestIndex));
+    }
+
+    if (!guestIndices.empty())
+    {
+        auto intent = Intent(INTENT_ACTION_UPDATE_GUEST_COUNT);
+        context_broadcast_intent(&intent);
+    }
+    return (int32_t)guestIndices.size();
+}
+
+void Park::SetGuestCount(int32_t count)
+{
+    auto current = (int32_t)gNumGuestsInPark;
+    if (count > current)
+    {
+        SpawnGuests(count - current);
+    }
+    else if (count < current)
+    {
+        DespawnGuests(current - count);
+    }
+}
+
 template<typename T, size_t TSize> static void HistoryPushRecord(T history[TSize], T newItem)
 {
     for (size_t i = TSize - 1; i > 0; i--)
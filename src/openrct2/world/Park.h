@@ -75,6 +75,24 @@ namespace OpenRCT2
 
         Peep* GenerateGuest();
 
+        /**
+         * Places up to count new guests on random footpaths inside the park, as if they had just entered it. Returns how
+         * many were placed, fewer when the park has no footpaths or there are not enough free sprites.
+         */
+        int32_t SpawnGuests(int32_t count);
+
+        /**
+         * Removes up to count guests that are in the park. Guests on or entering and leaving a ride are kept as the
+         * vehicles refer to them, so are guests the player has picked up. Returns how many were removed.
+         */
+        int32_t DespawnGuests(int32_t count);
+
+        /**
+         * Spawns or despawns guests until there are count guests in the park, or as close to it as possible. This draws
+         * from the scenario random number generator, use the SetGuestCount cheat so replays and other players get it.
+         */
+        void SetGuestCount(int32_t count);
+
         void ResetHistories();
         void UpdateHistories();
 
@@ -0,0 +1,142 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "ParkStatistics.h"
+
+#include "../Diagnostic.h"
+#include "Sprite.h"
+
+using namespace ParkStatistics;
+
+// What each guest adds to the counts, so it can be taken away again when the guest changes.
+constexpr uint16_t GUEST_KEY_IN_PARK = 1 << 0;
+constexpr uint16_t GUEST_KEY_HAPPY = 1 << 1;
+constexpr uint16_t GUEST_KEY_LOST = 1 << 2;
+constexpr uint16_t GUEST_KEY_THOUGHT_SHIFT = 8;
+
+static GuestCounts _guestCounts;
+static std::array<uint16_t, MAX_SPRITES> _guestKeys;
+
+bool GuestCounts::operator==(const GuestCounts& other) const
+{
+    return InPark == other.InPark && Happy == other.Happy && Lost == other.Lost && FreshThoughts == other.FreshThoughts;
+}
+
+bool GuestCounts::operator!=(const GuestCounts& other) const
+{
+    return !(*this == other);
+}
+
+static uint16_t GetGuestKey(const Peep* peep)
+{
+    if (peep->outside_of_park != 0)
+        return 0;
+
+    uint16_t key = GUEST_KEY_IN_PARK;
+    if (peep->happiness > 128)
+    {
+        key |= GUEST_KEY_HAPPY;
+    }
+    if ((peep->peep_flags & PEEP_FLAGS_LEAVING_PARK) && (peep->peep_is_lost_countdown < 90))
+    {
+        key |= GUEST_KEY_LOST;
+    }
+    uint8_t thoughtType = peep->thoughts[0].freshness <= 5 ? peep->thoughts[0].type : PEEP_THOUGHT_TYPE_NONE;
+    return key | (thoughtType << GUEST_KEY_THOUGHT_SHIFT);
+}
+
+static void AddGuestKey(GuestCounts& counts, uint16_t key, int32_t delta)
+{
+    if (!(key & GUEST_KEY_IN_PARK))
+        return;
+
+    counts.InPark += delta;
+    if (key & GUEST_KEY_HAPPY)
+    {
+        counts.Happy += delta;
+    }
+    if (key & GUEST_KEY_LOST)
+    {
+        counts.Lost += delta;
+    }
+    counts.FreshThoughts[key >> GUEST_KEY_THOUGHT_SHIFT] += delta;
+}
+
+static bool IsGuest(const Peep* peep)
+{
+    return peep->sprite_index < MAX_SPRITES && peep->sprite_identifier == SPRITE_IDENTIFIER_PEEP
+        && peep->linked_list_index == SPRITE_LIST_PEEP && peep->type == PEEP_TYPE_GUEST;
+}
+
+void ParkStatistics::Reset()
+{
+    _guestKeys.fill(0);
+    _guestCounts = {};
+
+    uint16_t spriteIndex;
+    Peep* peep;
+    FOR_ALL_GUESTS (spriteIndex, peep)
+    {
+        UpdateGuest(peep);
+    }
+}
+
+void ParkStatistics::UpdateGuest(const Peep* peep)
+{
+    if (!IsGuest(peep))
+        return;
+
+    auto& oldKey = _guestKeys[peep->sprite_index];
+    uint16_t newKey = GetGuestKey(peep);
+    if (newKey != oldKey)
+    {
+        AddGuestKey(_guestCounts, oldKey, -1);
+        AddGuestKey(_guestCounts, newKey, 1);
+        oldKey = newKey;
+    }
+}
+
+void ParkStatistics::RemoveGuest(const Peep* peep)
+{
+    if (peep->sprite_index < MAX_SPRITES)
+    {
+        AddGuestKey(_guestCounts, _guestKeys[peep->sprite_index], -1);
+        _guestKeys[peep->sprite_index] = 0;
+    }
+}
+
+const GuestCounts& ParkStatistics::GetGuestCounts()
+{
+    return _guestCounts;
+}
+
+GuestCounts ParkStatistics::CountGuests()
+{
+    GuestCounts counts;
+    uint16_t spriteIndex;
+    Peep* peep;
+    FOR_ALL_GUESTS (spriteIndex, peep)
+    {
+        AddGuestKey(counts, GetGuestKey(peep), 1);
+    }
+    return counts;
+}
+
+bool ParkStatistics::Verify()
+{
+    auto counts = CountGuests();
+    if (counts == _guestCounts)
+        return true;
+
+    log_error(
+        "Park statistics are out of date: %u guests in park, %u happy, %u lost, counted %u, %u and %u.", _guestCounts.InPark,
+        _guestCounts.Happy, _guestCounts.Lost, counts.InPark, counts.Happy, counts.Lost);
+    Reset();
+    return false;
+}
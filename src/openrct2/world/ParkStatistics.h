@@ -0,0 +1,54 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+#include "../peep/Peep.h"
+
+#include <array>
+
+/**
+ * Counts of the guests in the park that the park rating and the awards look at, kept up to date as guests change rather
+ * than counted by going through every guest. Guests are counted again after they are updated each tick and whenever they
+ * are changed outside of their update, e.g. by a new thought, a cheat or being renamed.
+ */
+namespace ParkStatistics
+{
+    struct GuestCounts
+    {
+        uint32_t InPark = 0;
+        uint32_t Happy = 0;
+        // Guests leaving the park that are lost.
+        uint32_t Lost = 0;
+        // Guests whose latest thought is still fresh, by the type of the thought.
+        std::array<uint32_t, PEEP_THOUGHT_TYPE_NONE + 1> FreshThoughts{};
+
+        bool operator==(const GuestCounts& other) const;
+        bool operator!=(const GuestCounts& other) const;
+    };
+
+    /**
+     * Counts every guest again, used when a park is loaded.
+     */
+    void Reset();
+    void UpdateGuest(const Peep* peep);
+    void RemoveGuest(const Peep* peep);
+    const GuestCounts& GetGuestCounts();
+
+    /**
+     * Counts the guests by going through all of them, the way the counts were made before they were kept up to date.
+     */
+    GuestCounts CountGuests();
+
+    /**
+     * Checks the counts against CountGuests, logging and counting every guest again when they differ.
+     */
+    bool Verify();
+} // namespace ParkStatistics
@@ -0,0 +1,230 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "RegionSummary.h"
+
+#include "../Game.h"
+#include "Footpath.h"
+#include "Map.h"
+#include "Scenery.h"
+
+#include <algorithm>
+#include <array>
+
+using namespace RegionSummary;
+
+constexpr int32_t BLOCKS_PER_ROW = MAXIMUM_MAP_SIZE_TECHNICAL / BLOCK_SIZE;
+constexpr int32_t TILES_PER_BLOCK = BLOCK_SIZE * BLOCK_SIZE;
+constexpr uint32_t BLOCK_INVALID_TICK = 0xFFFFFFFF;
+
+struct RegionBlock
+{
+    uint32_t Tick = BLOCK_INVALID_TICK;
+    std::bitset<MAX_RIDES> Rides;
+    uint64_t TrackTiles;
+    uint64_t InvalidAdditionTiles;
+    uint16_t Scenery[TILES_PER_BLOCK];
+    uint16_t Fountains[TILES_PER_BLOCK];
+    uint16_t BrokenAdditions[TILES_PER_BLOCK];
+};
+
+static std::array<RegionBlock, BLOCKS_PER_ROW * BLOCKS_PER_ROW> _blocks;
+
+static void SummariseBlock(RegionBlock& block, int32_t blockX, int32_t blockY)
+{
+    block.Tick = gCurrentTicks;
+    block.Rides.reset();
+    block.TrackTiles = 0;
+    block.InvalidAdditionTiles = 0;
+    for (int32_t i = 0; i < TILES_PER_BLOCK; i++)
+    {
+        block.Scenery[i] = 0;
+        block.Fountains[i] = 0;
+        block.BrokenAdditions[i] = 0;
+
+        int32_t x = blockX * BLOCK_SIZE + (i % BLOCK_SIZE);
+        int32_t y = blockY * BLOCK_SIZE + (i / BLOCK_SIZE);
+        const TileElement* tileElement = gTileElementTilePointers[x + y * MAXIMUM_MAP_SIZE_TECHNICAL];
+        if (tileElement == nullptr)
+            continue;
+
+        do
+        {
+            switch (tileElement->GetType())
+            {
+                case TILE_ELEMENT_TYPE_PATH:
+                {
+                    auto pathElement = tileElement->AsPath();
+                    if (!pathElement->HasAddition())
+                        break;
+
+                    auto scenery = pathElement->GetAdditionEntry();
+                    if (scenery == nullptr)
+                    {
+                        block.InvalidAdditionTiles |= 1ULL << i;
+                        break;
+                    }
+                    if (pathElement->AdditionIsGhost())
+                        break;
+
+                    if (scenery->path_bit.flags & (PATH_BIT_FLAG_JUMPING_FOUNTAIN_WATER | PATH_BIT_FLAG_JUMPING_FOUNTAIN_SNOW))
+                    {
+                        block.Fountains[i]++;
+                    }
+                    else if (pathElement->IsBroken())
+                    {
+                        block.BrokenAdditions[i]++;
+                    }
+                    break;
+                }
+                case TILE_ELEMENT_TYPE_LARGE_SCENERY:
+                case TILE_ELEMENT_TYPE_SMALL_SCENERY:
+                    block.Scenery[i]++;
+                    break;
+                case TILE_ELEMENT_TYPE_TRACK:
+                {
+                    auto rideIndex = tileElement->AsTrack()->GetRideIndex();
+                    if (rideIndex < MAX_RIDES)
+                    {
+                        block.Rides[rideIndex] = true;
+                    }
+                    block.TrackTiles |= 1ULL << i;
+                    break;
+                }
+            }
+        } while (!(tileElement++)->IsLastForTile());
+    }
+}
+
+static void AddRidesOnTile(int32_t x, int32_t y, std::bitset<MAX_RIDES>& rides)
+{
+    const TileElement* tileElement = gTileElementTilePointers[x + y * MAXIMUM_MAP_SIZE_TECHNICAL];
+    do
+    {
+        if (tileElement->GetType() == TILE_ELEMENT_TYPE_TRACK)
+        {
+            auto rideIndex = tileElement->AsTrack()->GetRideIndex();
+            if (rideIndex < MAX_RIDES)
+            {
+                rides[rideIndex] = true;
+            }
+        }
+    } while (!(tileElement++)->IsLastForTile());
+}
+
+/**
+ * Calls the function for every block overlapping the area with the overlapping tiles, summarising blocks that are out of
+ * date first.
+ */
+template<typename TFunc> static void ForEachBlockInArea(const TileCoordsXY& min, const TileCoordsXY& max, TFunc func)
+{
+    int32_t minX = std::max(min.x, 0);
+    int32_t minY = std::max(min.y, 0);
+    int32_t maxX = std::min(max.x, MAXIMUM_MAP_SIZE_TECHNICAL - 1);
+    int32_t maxY = std::min(max.y, MAXIMUM_MAP_SIZE_TECHNICAL - 1);
+    for (int32_t blockY = minY / BLOCK_SIZE; minY <= maxY && blockY <= maxY / BLOCK_SIZE; blockY++)
+    {
+        for (int32_t blockX = minX / BLOCK_SIZE; minX <= maxX && blockX <= maxX / BLOCK_SIZE; blockX++)
+        {
+            auto& block = _blocks[blockX + blockY * BLOCKS_PER_ROW];
+            if (block.Tick != gCurrentTicks)
+            {
+                SummariseBlock(block, blockX, blockY);
+            }
+
+            TileCoordsXY blockMin{ std::max(minX, blockX * BLOCK_SIZE), std::max(minY, blockY * BLOCK_SIZE) };
+            TileCoordsXY blockMax{ std::min(maxX, blockX * BLOCK_SIZE + BLOCK_SIZE - 1),
+                                   std::min(maxY, blockY * BLOCK_SIZE + BLOCK_SIZE - 1) };
+            func(block, blockMin, blockMax);
+        }
+    }
+}
+
+static bool IsWholeBlock(const TileCoordsXY& min, const TileCoordsXY& max)
+{
+    return max.x - min.x == BLOCK_SIZE - 1 && max.y - min.y == BLOCK_SIZE - 1;
+}
+
+static int32_t GetTileIndex(int32_t x, int32_t y)
+{
+    return (x % BLOCK_SIZE) + (y % BLOCK_SIZE) * BLOCK_SIZE;
+}
+
+static void AddRidesInBlock(
+    const RegionBlock& block, const TileCoordsXY& min, const TileCoordsXY& max, std::bitset<MAX_RIDES>& rides)
+{
+    if (block.TrackTiles == 0)
+        return;
+
+    if (IsWholeBlock(min, max))
+    {
+        rides |= block.Rides;
+        return;
+    }
+
+    for (int32_t y = min.y; y <= max.y; y++)
+    {
+        for (int32_t x = min.x; x <= max.x; x++)
+        {
+            if (block.TrackTiles & (1ULL << GetTileIndex(x, y)))
+            {
+                AddRidesOnTile(x, y, rides);
+            }
+        }
+    }
+}
+
+void RegionSummary::Reset()
+{
+    for (auto& block : _blocks)
+    {
+        block.Tick = BLOCK_INVALID_TICK;
+    }
+}
+
+void RegionSummary::Invalidate(const CoordsXY& loc)
+{
+    if (map_is_location_valid(loc))
+    {
+        auto tileLoc = TileCoordsXY(loc);
+        _blocks[tileLoc.x / BLOCK_SIZE + (tileLoc.y / BLOCK_SIZE) * BLOCKS_PER_ROW].Tick = BLOCK_INVALID_TICK;
+    }
+}
+
+void RegionSummary::GetRidesInArea(const TileCoordsXY& min, const TileCoordsXY& max, std::bitset<MAX_RIDES>& rides)
+{
+    auto addBlock = [&rides](const RegionBlock& block, const TileCoordsXY& blockMin, const TileCoordsXY& blockMax) {
+        AddRidesInBlock(block, blockMin, blockMax, rides);
+    };
+    ForEachBlockInArea(min, max, addBlock);
+}
+
+SurroundingsCounts RegionSummary::CountSurroundings(const TileCoordsXY& min, const TileCoordsXY& max)
+{
+    SurroundingsCounts counts;
+    auto countBlock = [&counts](const RegionBlock& block, const TileCoordsXY& blockMin, const TileCoordsXY& blockMax) {
+        for (int32_t y = blockMin.y; y <= blockMax.y; y++)
+        {
+            for (int32_t x = blockMin.x; x <= blockMax.x; x++)
+            {
+                auto i = GetTileIndex(x, y);
+                counts.Scenery += block.Scenery[i];
+                counts.Fountains += block.Fountains[i];
+                counts.BrokenAdditions += block.BrokenAdditions[i];
+                if (block.InvalidAdditionTiles & (1ULL << i))
+                {
+                    counts.HasInvalidAddition = true;
+                }
+            }
+        }
+        AddRidesInBlock(block, blockMin, blockMax, counts.Rides);
+    };
+    ForEachBlockInArea(min, max, countBlock);
+    return counts;
+}
@@ -0,0 +1,49 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+#include "../ride/Ride.h"
+#include "Location.hpp"
+
+#include <bitset>
+
+/**
+ * Summaries of the tile elements in blocks of 8x8 tiles, used by guests to look at their surroundings without walking
+ * every tile element around them. A block is summarised the first time it is queried in a tick and reused for the rest
+ * of that tick, inserting a tile element or calling Invalidate summarises the block again.
+ */
+namespace RegionSummary
+{
+    constexpr int32_t BLOCK_SIZE = 8;
+
+    struct SurroundingsCounts
+    {
+        uint16_t Scenery = 0;
+        uint16_t Fountains = 0;
+        uint16_t BrokenAdditions = 0;
+        // A path addition whose object is not loaded, guests ignore their surroundings then.
+        bool HasInvalidAddition = false;
+        std::bitset<MAX_RIDES> Rides;
+    };
+
+    void Reset();
+    void Invalidate(const CoordsXY& loc);
+
+    /**
+     * Marks the rides with track pieces in the area, both corners are inclusive.
+     */
+    void GetRidesInArea(const TileCoordsXY& min, const TileCoordsXY& max, std::bitset<MAX_RIDES>& rides);
+
+    /**
+     * Counts what guests care about in the area, both corners are inclusive.
+     */
+    SurroundingsCounts CountSurroundings(const TileCoordsXY& min, const TileCoordsXY& max);
+} // namespace RegionSummary
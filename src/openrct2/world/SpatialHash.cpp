@@ -0,0 +1,155 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "SpatialHash.h"
+
+#include "../peep/Peep.h"
+
+#include <array>
+
+using namespace SpatialHash;
+
+constexpr size_t TILES_PER_KIND = MAXIMUM_MAP_SIZE_TECHNICAL * MAXIMUM_MAP_SIZE_TECHNICAL;
+constexpr size_t KIND_COUNT = static_cast<size_t>(Kind::Count);
+constexpr uint32_t BUCKET_NONE = 0xFFFFFFFF;
+
+struct SpatialHashNode
+{
+    uint32_t Bucket = BUCKET_NONE;
+    uint16_t Next = SPRITE_INDEX_NULL;
+    uint16_t Previous = SPRITE_INDEX_NULL;
+};
+
+static std::array<uint16_t, TILES_PER_KIND * KIND_COUNT> _buckets;
+static std::array<SpatialHashNode, MAX_SPRITES> _nodes;
+static std::array<size_t, KIND_COUNT> _counts;
+
+static bool GetKind(const SpriteBase* sprite, Kind& kind)
+{
+    switch (sprite->sprite_identifier)
+    {
+        case SPRITE_IDENTIFIER_LITTER:
+            kind = Kind::Litter;
+            return true;
+        case SPRITE_IDENTIFIER_PEEP:
+            if (static_cast<const Peep*>(sprite)->type == PEEP_TYPE_STAFF)
+            {
+                kind = Kind::Staff;
+                return true;
+            }
+            return false;
+        default:
+            return false;
+    }
+}
+
+static uint32_t GetBucket(const SpriteBase* sprite)
+{
+    Kind kind;
+    if (sprite->x == LOCATION_NULL || !GetKind(sprite, kind))
+        return BUCKET_NONE;
+
+    auto tileLoc = TileCoordsXY(CoordsXY{ sprite->x, sprite->y });
+    if (tileLoc.x < 0 || tileLoc.y < 0 || tileLoc.x >= MAXIMUM_MAP_SIZE_TECHNICAL || tileLoc.y >= MAXIMUM_MAP_SIZE_TECHNICAL)
+        return BUCKET_NONE;
+
+    return static_cast<uint32_t>(kind) * TILES_PER_KIND + tileLoc.x + tileLoc.y * MAXIMUM_MAP_SIZE_TECHNICAL;
+}
+
+static void Link(uint16_t spriteIndex, uint32_t bucket)
+{
+    auto& node = _nodes[spriteIndex];
+    node.Bucket = bucket;
+    node.Previous = SPRITE_INDEX_NULL;
+    node.Next = _buckets[bucket];
+    if (node.Next != SPRITE_INDEX_NULL)
+    {
+        _nodes[node.Next].Previous = spriteIndex;
+    }
+    _buckets[bucket] = spriteIndex;
+    _counts[bucket / TILES_PER_KIND]++;
+}
+
+static void Unlink(uint16_t spriteIndex)
+{
+    auto& node = _nodes[spriteIndex];
+    if (node.Previous == SPRITE_INDEX_NULL)
+    {
+        _buckets[node.Bucket] = node.Next;
+    }
+    else
+    {
+        _nodes[node.Previous].Next = node.Next;
+    }
+    if (node.Next != SPRITE_INDEX_NULL)
+    {
+        _nodes[node.Next].Previous = node.Previous;
+    }
+    _counts[node.Bucket / TILES_PER_KIND]--;
+    node = {};
+}
+
+void SpatialHash::Reset()
+{
+    _buckets.fill(SPRITE_INDEX_NULL);
+    _nodes.fill({});
+    _counts.fill(0);
+    for (uint16_t i = 0; i < MAX_SPRITES; i++)
+    {
+        auto sprite = &get_sprite(i)->generic;
+        if (sprite->sprite_identifier != SPRITE_IDENTIFIER_NULL)
+        {
+            Update(sprite);
+        }
+    }
+}
+
+void SpatialHash::Update(const SpriteBase* sprite)
+{
+    uint16_t spriteIndex = sprite->sprite_index;
+    if (spriteIndex >= MAX_SPRITES)
+        return;
+
+    uint32_t bucket = GetBucket(sprite);
+    if (_nodes[spriteIndex].Bucket == bucket)
+        return;
+
+    if (_nodes[spriteIndex].Bucket != BUCKET_NONE)
+    {
+        Unlink(spriteIndex);
+    }
+    if (bucket != BUCKET_NONE)
+    {
+        Link(spriteIndex, bucket);
+    }
+}
+
+void SpatialHash::Remove(const SpriteBase* sprite)
+{
+    uint16_t spriteIndex = sprite->sprite_index;
+    if (spriteIndex < MAX_SPRITES && _nodes[spriteIndex].Bucket != BUCKET_NONE)
+    {
+        Unlink(spriteIndex);
+    }
+}
+
+size_t SpatialHash::GetCount(Kind kind)
+{
+    return _counts[static_cast<size_t>(kind)];
+}
+
+uint16_t SpatialHash::GetFirstInTile(Kind kind, int32_t tileX, int32_t tileY)
+{
+    return _buckets[static_cast<size_t>(kind) * TILES_PER_KIND + tileX + tileY * MAXIMUM_MAP_SIZE_TECHNICAL];
+}
+
+uint16_t SpatialHash::GetNextInTile(uint16_t spriteIndex)
+{
+    return _nodes[spriteIndex].Next;
+}
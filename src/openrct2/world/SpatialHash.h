@@ -0,0 +1,151 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+#include "Location.hpp"
+#include "Map.h"
+#include "Sprite.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+
+/**
+ * Per tile buckets of the sprites staff look for, one set of buckets for each kind of sprite, so looking for the litter or
+ * the staff near a location does not have to go through every litter or staff sprite, or every guest sharing the tiles.
+ * Sprites are added, moved and removed by sprite_move and sprite_remove, Reset rebuilds the buckets from the sprites.
+ */
+namespace SpatialHash
+{
+    enum class Kind : uint8_t
+    {
+        Litter,
+        Staff,
+        Count,
+    };
+
+    struct Entry
+    {
+        // Manhattan distance on the x and y axes.
+        int32_t Distance;
+        uint16_t SpriteIndex;
+    };
+
+    void Reset();
+    void Update(const SpriteBase* sprite);
+    void Remove(const SpriteBase* sprite);
+
+    size_t GetCount(Kind kind);
+    uint16_t GetFirstInTile(Kind kind, int32_t tileX, int32_t tileY);
+    uint16_t GetNextInTile(uint16_t spriteIndex);
+
+    /**
+     * Calls the function with the index of every sprite of the kind on the tiles within the radius of the centre, on the
+     * x and y axes. The sprites are not filtered by their exact distance.
+     */
+    template<typename TFunc> void ForEachInRadius(Kind kind, const CoordsXY& centre, int32_t radius, TFunc func)
+    {
+        if (GetCount(kind) == 0)
+            return;
+
+        int32_t minX = std::max(centre.x - radius, 0) / COORDS_XY_STEP;
+        int32_t minY = std::max(centre.y - radius, 0) / COORDS_XY_STEP;
+        int32_t maxX = std::min(centre.x + radius, MAXIMUM_MAP_SIZE_TECHNICAL * COORDS_XY_STEP - 1) / COORDS_XY_STEP;
+        int32_t maxY = std::min(centre.y + radius, MAXIMUM_MAP_SIZE_TECHNICAL * COORDS_XY_STEP - 1) / COORDS_XY_STEP;
+        for (int32_t y = minY; y <= maxY; y++)
+        {
+            for (int32_t x = minX; x <= maxX; x++)
+            {
+                for (uint16_t spriteIndex = GetFirstInTile(kind, x, y); spriteIndex != SPRITE_INDEX_NULL;)
+                {
+                    // Read the next sprite first, the function may move or remove the sprite.
+                    uint16_t nextSpriteIndex = GetNextInTile(spriteIndex);
+                    func(spriteIndex);
+                    spriteIndex = nextSpriteIndex;
+                }
+            }
+        }
+    }
+
+    /**
+     * Finds the nearest sprites of the kind within the maximum distance that pass the predicate, searching the tiles in
+     * rings around the centre. Returns up to count entries ordered by distance then sprite index, followed by any other
+     * sprites at the same distance as the last one, so callers can break ties their own way.
+     */
+    template<typename TPredicate>
+    std::vector<Entry> GetNearest(Kind kind, const CoordsXY& centre, int32_t maxDistance, size_t count, TPredicate predicate)
+    {
+        std::vector<Entry> result;
+        if (count == 0 || GetCount(kind) == 0)
+            return result;
+
+        auto byDistance = [](const Entry& a, const Entry& b) {
+            return a.Distance < b.Distance || (a.Distance == b.Distance && a.SpriteIndex < b.SpriteIndex);
+        };
+        auto addTile = [&](int32_t x, int32_t y) {
+            if (x < 0 || y < 0 || x >= MAXIMUM_MAP_SIZE_TECHNICAL || y >= MAXIMUM_MAP_SIZE_TECHNICAL)
+                return;
+
+            for (uint16_t spriteIndex = GetFirstInTile(kind, x, y); spriteIndex != SPRITE_INDEX_NULL;
+                 spriteIndex = GetNextInTile(spriteIndex))
+            {
+                auto sprite = &get_sprite(spriteIndex)->generic;
+                int32_t distance = std::abs(sprite->x - centre.x) + std::abs(sprite->y - centre.y);
+                if (distance <= maxDistance && predicate(spriteIndex))
+                {
+                    result.push_back({ distance, spriteIndex });
+                }
+            }
+        };
+
+        int32_t centreX = std::clamp(centre.x / COORDS_XY_STEP, 0, MAXIMUM_MAP_SIZE_TECHNICAL - 1);
+        int32_t centreY = std::clamp(centre.y / COORDS_XY_STEP, 0, MAXIMUM_MAP_SIZE_TECHNICAL - 1);
+        for (int32_t ring = 0; ring < MAXIMUM_MAP_SIZE_TECHNICAL; ring++)
+        {
+            // Nothing on this ring of tiles or further out can be nearer than this.
+            int32_t ringDistance = ring == 0 ? 0 : ring * COORDS_XY_STEP - (COORDS_XY_STEP - 1);
+            if (ringDistance > maxDistance)
+                break;
+            if (result.size() >= count)
+            {
+                std::sort(result.begin(), result.end(), byDistance);
+                if (result[count - 1].Distance < ringDistance)
+                    break;
+            }
+
+            if (ring == 0)
+            {
+                addTile(centreX, centreY);
+                continue;
+            }
+            for (int32_t i = -ring; i <= ring; i++)
+            {
+                addTile(centreX + i, centreY - ring);
+                addTile(centreX + i, centreY + ring);
+            }
+            for (int32_t i = -ring + 1; i < ring; i++)
+            {
+                addTile(centreX - ring, centreY + i);
+                addTile(centreX + ring, centreY + i);
+            }
+        }
+
+        std::sort(result.begin(), result.end(), byDistance);
+        if (result.size() > count)
+        {
+            auto lastDistance = result[count - 1].Distance;
+            auto end = std::find_if(
+                result.begin() + count, result.end(), [lastDistance](const Entry& e) { return e.Distance != lastDistance; });
+            result.erase(end, result.end());
+        }
+        return result;
+    }
+} // namespace SpatialHash
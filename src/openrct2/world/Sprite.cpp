@@ -20,6 +20,8 @@
 #include "../localisation/Localisation.h"
 #include "../scenario/Scenario.h"
 #include "Fountain.h"
+#include "ParkStatistics.h"
+#include "SpatialHash.h"
 
 #include <algorithm>
 #include <cmath>
@@ -204,6 +206,7 @@ void reset_sprite_spatial_index()
             spr->generic.next_in_quadrant = nextSpriteId;
         }
     }
+    SpatialHash::Reset();
 }
 
 static size_t GetSpatialIndexOffset(int32_t x, int32_t y)
@@ -697,6 +700,8 @@ void sprite_move(int16_t x, int16_t y, int16_t z, SpriteBase* sprite)
     {
         sprite_set_coordinates(x, y, z, sprite);
     }
+
+    SpatialHash::Update(sprite);
 }
 
 void sprite_set_coordinates(int16_t x, int16_t y, int16_t z, SpriteBase* sprite)
@@ -723,6 +728,7 @@ void sprite_remove(SpriteBase* sprite)
     if (peep != nullptr)
     {
         peep->SetName({});
+        ParkStatistics::RemoveGuest(peep);
     }
 
     move_sprite_to_list(sprite, SPRITE_LIST_FREE);
@@ -737,6 +743,8 @@ void sprite_remove(SpriteBase* sprite)
         spriteIndex = &quadrantSprite->next_in_quadrant;
     }
     *spriteIndex = sprite->next_in_quadrant;
+
+    SpatialHash::Remove(sprite);
 }
 
 static bool litter_can_be_at(int32_t x, int32_t y, int32_t z)
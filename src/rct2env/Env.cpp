@@ -5,8 +5,10 @@
 #include <openrct2/drawing/Drawing.h>
 #include <openrct2/drawing/IDrawingEngine.h>
 #include <openrct2/Context.h>
+#include <openrct2/GameState.h>
 #include <openrct2/OpenRCT2.h>
 #include <openrct2/PlatformEnvironment.h>
+#include <openrct2/ReplayManager.h>
 #include <openrct2/audio/AudioContext.h>
 #include <openrct2/cmdline/CommandLine.hpp>
 #include <openrct2/platform/platform.h>
@@ -19,6 +21,7 @@
 #include <openrct2/interface/Viewport.h>
 #include <openrct2/interface/Screenshot.h>
 #include <openrct2/world/Map.h>
+#include <openrct2/world/Park.h>
 #include <openrct2/ride/Track.h>
 
 #include <openrct2/actions/GameAction.h>
@@ -28,6 +31,7 @@
 #include <openrct2/actions/RideSetStatus.hpp>
 #include <openrct2/actions/RideEntranceExitPlaceAction.hpp>
 #include <openrct2/actions/RideDemolishAction.hpp>
+#include <openrct2/actions/SetCheatAction.hpp>
 #include <openrct2/world/Location.hpp>
 #include <torch/torch.h>
 #include <algorithm>
@@ -138,11 +142,28 @@ torch::Tensor RCT2Env::Reset() {
     auto rideDemolishResult = GameActions::Execute(&rideDemolishAction);
     CoordsXYE build_trg;
     count = 0;
+    if (reset_guest_count >= 0) {
+        // As a game action the guests are part of any replay or trajectory being recorded.
+        auto setGuestCountAction = SetCheatAction(CheatType::SetGuestCount, reset_guest_count);
+        GameActions::Execute(&setGuestCountAction);
+    }
     state = torch::zeros({n_chan, map_width, map_width}).to(torch::kBool);
     this->n_step = 0;
     return Observe();
 }
 
+void RCT2Env::SetResetGuestCount(int count) {
+    reset_guest_count = count;
+}
+
+bool RCT2Env::StartTrajectory(const std::string& path) {
+    return context->GetReplayManager()->StartTrajectoryRecording(path);
+}
+
+void RCT2Env::StopTrajectory() {
+    context->GetReplayManager()->StopTrajectoryRecording();
+}
+
 torch::Tensor RCT2Env::Observe() {
   //Image image = get_observation();
   //std::vector<uint8_t> pixels = image.Pixels;
@@ -263,7 +284,7 @@ StepResult RCT2Env::Step(std::vector<std::vector<bool>> actions) {
 
   //int32_t trackType = 76;
     int32_t brakeSpeed = 0;
-    int32_t colour = rand() % 25;
+    int32_t colour = context->GetGameState()->GetRandomStream(RandomStream::EnvActions)() % 25;
     int32_t seatRotation = 4;
     int trackPlaceFlags = 0;
     int32_t liftHillAndAlternativeState = 0;
@@ -462,6 +483,11 @@ StepResult RCT2Env::Step(std::vector<std::vector<bool>> actions) {
   //  this->Reset();
   //}
     std::vector<std::vector<bool> > dones = {{0}};
+    // Record the step before resetting, the reset belongs to the next episode.
+    auto replayManager = context->GetReplayManager();
+    if (replayManager->IsRecordingTrajectory()) {
+        replayManager->AddTrajectoryStep(rewards.sum().item<float>(), this->n_step == max_step);
+    }
     if (this->n_step == max_step) {
         dones[0][0] = 1;
         this->Reset();
@@ -50,6 +50,8 @@ namespace OpenRCT2
 			torch::Tensor  rewards;
 			int n_step = 0;
 			int max_step = 100;
+			// Guests in the park after each reset, negative to leave the guests as they are.
+			int reset_guest_count = -1;
 			int prev_success = false;
 			Agent * agent;
 			std::string observation_space_type;
@@ -70,6 +72,11 @@ namespace OpenRCT2
 ////		std::vector<std::vector<float>> Reset();
 			torch::Tensor Observe();
 			torch::Tensor Reset();
+			// Spawns or despawns guests on every reset until the park has count guests, see Park::SetGuestCount.
+			void SetResetGuestCount(int count);
+			// Records actions, rewards and dones of every step, see IReplayManager::StartTrajectoryRecording.
+			bool StartTrajectory(const std::string& path);
+			void StopTrajectory();
 	//torch::Tensor* Step(int* actions_tensor);
 
 	};
@@ -0,0 +1,64 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "LoadedParkTest.hpp"
+
+#include <openrct2/world/ActiveTiles.h>
+#include <openrct2/world/Map.h>
+
+using namespace OpenRCT2;
+
+constexpr int32_t updatesToTest = 3000;
+
+class ActiveTilesTest : public LoadedParkTest
+{
+protected:
+    // Every tile the tile loop would do something on has to be active, returns how many there are.
+    static int32_t CheckTilesWithUpdatesAreActive()
+    {
+        int32_t tilesWithUpdates = 0;
+        for (int32_t y = 0; y < MAXIMUM_MAP_SIZE_TECHNICAL; y++)
+        {
+            for (int32_t x = 0; x < MAXIMUM_MAP_SIZE_TECHNICAL; x++)
+            {
+                auto loc = TileCoordsXY{ x, y }.ToCoordsXY();
+                if (ActiveTiles::HasUpdates(loc))
+                {
+                    EXPECT_TRUE(ActiveTiles::IsActive(loc)) << "tile " << x << ", " << y;
+                    tilesWithUpdates++;
+                }
+            }
+        }
+        return tilesWithUpdates;
+    }
+};
+
+TEST_F(ActiveTilesTest, LoopPositionsMatchTiles)
+{
+    for (uint32_t position = 0; position <= 0xFFFF; position++)
+    {
+        auto loc = ActiveTiles::GetLoopPositionTile(position);
+        ASSERT_EQ(ActiveTiles::GetTileLoopPosition(TileCoordsXY(loc)), position);
+    }
+}
+
+TEST_F(ActiveTilesTest, TilesWithUpdatesAreActive)
+{
+    ASSERT_GT(CheckTilesWithUpdatesAreActive(), 0);
+    CheckWhileRunning(updatesToTest, updatesToTest, []() { CheckTilesWithUpdatesAreActive(); });
+}
+
+TEST_F(ActiveTilesTest, LoopPositionAdvancesEveryTick)
+{
+    auto gs = _context->GetGameState();
+    ASSERT_NE(gs, nullptr);
+    uint16_t position = gGrassSceneryTileLoopPosition;
+    gs->UpdateLogic();
+    ASSERT_EQ(gGrassSceneryTileLoopPosition, (position + 43) & 0xFFFF);
+}
@@ -0,0 +1,131 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <gtest/gtest.h>
+#include <openrct2/drawing/Drawing.h>
+#include <openrct2/util/Util.h>
+#include <random>
+#include <vector>
+
+// Not a multiple of any vector width, so the remainders are covered as well.
+constexpr int32_t TEST_FRAME_WIDTH = 131;
+constexpr int32_t TEST_FRAME_HEIGHT = 37;
+constexpr int32_t TEST_FRAME_PITCH = 5;
+
+using FrameConvertRowFunc = decltype(frame_convert_row_fn);
+
+class FrameConversionTests : public testing::Test
+{
+protected:
+    std::vector<uint8_t> _bits;
+    rct_palette _palette{};
+    rct_drawpixelinfo _dpi{};
+
+    void SetUp() override
+    {
+        std::mt19937 prng(0x5EED);
+        _bits.resize((TEST_FRAME_WIDTH + TEST_FRAME_PITCH) * TEST_FRAME_HEIGHT);
+        for (auto& pixel : _bits)
+        {
+            pixel = static_cast<uint8_t>(prng());
+        }
+        for (auto& entry : _palette.entries)
+        {
+            entry.red = static_cast<uint8_t>(prng());
+            entry.green = static_cast<uint8_t>(prng());
+            entry.blue = static_cast<uint8_t>(prng());
+        }
+
+        _dpi.bits = _bits.data();
+        _dpi.width = TEST_FRAME_WIDTH;
+        _dpi.height = TEST_FRAME_HEIGHT;
+        _dpi.pitch = TEST_FRAME_PITCH;
+    }
+
+    std::vector<uint8_t> Convert(FrameConvertRowFunc rowFn, FrameFormat format, int32_t downsample)
+    {
+        auto previousFn = frame_convert_row_fn;
+        frame_convert_row_fn = rowFn;
+
+        std::vector<uint8_t> result(gfx_frame_get_size(TEST_FRAME_WIDTH, TEST_FRAME_HEIGHT, format, downsample));
+        gfx_frame_convert(&_dpi, &_palette, format, downsample, result.data());
+
+        frame_convert_row_fn = previousFn;
+        return result;
+    }
+
+    void CompareWithScalar(FrameConvertRowFunc rowFn)
+    {
+        for (auto format : { FrameFormat::RGB, FrameFormat::RGBA, FrameFormat::PlanarFloat })
+        {
+            for (int32_t downsample : { 1, 2, 3, 8 })
+            {
+                auto expected = Convert(frame_convert_row_scalar, format, downsample);
+                auto actual = Convert(rowFn, format, downsample);
+                ASSERT_EQ(expected, actual) << "format " << static_cast<int32_t>(format) << ", downsample " << downsample;
+            }
+        }
+    }
+};
+
+TEST_F(FrameConversionTests, ScalarRGBA)
+{
+    auto result = Convert(frame_convert_row_scalar, FrameFormat::RGBA, 1);
+    for (int32_t y = 0; y < TEST_FRAME_HEIGHT; y++)
+    {
+        for (int32_t x = 0; x < TEST_FRAME_WIDTH; x++)
+        {
+            auto index = _bits[y * (TEST_FRAME_WIDTH + TEST_FRAME_PITCH) + x];
+            const auto& entry = _palette.entries[index];
+            const uint8_t* pixel = &result[(y * TEST_FRAME_WIDTH + x) * 4];
+            ASSERT_EQ(pixel[0], entry.red);
+            ASSERT_EQ(pixel[1], entry.green);
+            ASSERT_EQ(pixel[2], entry.blue);
+            ASSERT_EQ(pixel[3], index == 0 ? 0 : 255);
+        }
+    }
+}
+
+TEST_F(FrameConversionTests, ScalarPlanarFloatDownsampled)
+{
+    constexpr int32_t downsample = 2;
+    constexpr int32_t width = (TEST_FRAME_WIDTH + downsample - 1) / downsample;
+    constexpr int32_t height = (TEST_FRAME_HEIGHT + downsample - 1) / downsample;
+    auto result = Convert(frame_convert_row_scalar, FrameFormat::PlanarFloat, downsample);
+    ASSERT_EQ(result.size(), width * height * 3 * sizeof(float));
+
+    auto planes = reinterpret_cast<const float*>(result.data());
+    for (int32_t y = 0; y < height; y++)
+    {
+        for (int32_t x = 0; x < width; x++)
+        {
+            auto index = _bits[y * downsample * (TEST_FRAME_WIDTH + TEST_FRAME_PITCH) + x * downsample];
+            const auto& entry = _palette.entries[index];
+            ASSERT_FLOAT_EQ(planes[y * width + x], entry.red / 255.0f);
+            ASSERT_FLOAT_EQ(planes[width * height + y * width + x], entry.green / 255.0f);
+            ASSERT_FLOAT_EQ(planes[2 * width * height + y * width + x], entry.blue / 255.0f);
+        }
+    }
+}
+
+TEST_F(FrameConversionTests, SSE41MatchesScalar)
+{
+    if (sse41_available())
+    {
+        CompareWithScalar(frame_convert_row_sse4_1);
+    }
+}
+
+TEST_F(FrameConversionTests, AVX2MatchesScalar)
+{
+    if (avx2_available())
+    {
+        CompareWithScalar(frame_convert_row_avx2);
+    }
+}
@@ -0,0 +1,150 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "LoadedParkTest.hpp"
+
+#include <openrct2/GameStateSnapshots.h>
+#include <openrct2/core/MemoryStream.h>
+#include <openrct2/peep/Peep.h>
+#include <openrct2/ride/Ride.h>
+#include <openrct2/world/Map.h>
+#include <openrct2/world/Sprite.h>
+
+using namespace OpenRCT2;
+
+class GameStateSnapshotTest : public LoadedParkTest
+{
+protected:
+    std::unique_ptr<IGameStateSnapshots> _snapshots = CreateGameStateSnapshots();
+
+    GameStateSnapshot_t& Capture()
+    {
+        auto& snapshot = _snapshots->CreateSnapshot();
+        _snapshots->Capture(snapshot);
+        return snapshot;
+    }
+
+    static Peep* GetFirstGuest()
+    {
+        uint16_t spriteIndex;
+        Peep* peep;
+        FOR_ALL_GUESTS (spriteIndex, peep)
+        {
+            return peep;
+        }
+        return nullptr;
+    }
+};
+
+TEST_F(GameStateSnapshotTest, SameStateHasNoDifferences)
+{
+    auto& base = Capture();
+    auto& cmp = Capture();
+    auto res = _snapshots->Compare(base, cmp);
+    ASSERT_FALSE(res.HasDifferences());
+
+    RunUpdates(100);
+    auto& later = Capture();
+    res = _snapshots->Compare(base, later);
+    ASSERT_TRUE(res.HasDifferences());
+}
+
+TEST_F(GameStateSnapshotTest, ReportsModifiedGuestField)
+{
+    auto& base = Capture();
+    auto guest = GetFirstGuest();
+    ASSERT_NE(guest, nullptr);
+    guest->tshirt_colour ^= 1;
+    auto& cmp = Capture();
+
+    auto res = _snapshots->Compare(base, cmp);
+    ASSERT_EQ(res.spriteChanges.size(), 1u);
+    ASSERT_TRUE(res.rideChanges.empty());
+    ASSERT_TRUE(res.tileChanges.empty());
+
+    const auto& change = res.spriteChanges[0];
+    ASSERT_EQ(change.changeType, GameStateSpriteChange_t::MODIFIED);
+    ASSERT_EQ(change.spriteIndex, guest->sprite_index);
+    ASSERT_EQ(change.diffs.size(), 1u);
+    ASSERT_STREQ(change.diffs[0].fieldname, "tshirt_colour");
+}
+
+TEST_F(GameStateSnapshotTest, IgnoresRenderingOnlyFields)
+{
+    auto& base = Capture();
+    auto guest = GetFirstGuest();
+    ASSERT_NE(guest, nullptr);
+    // The stored bytes differ, but no compared field does.
+    guest->sprite_width++;
+    auto& cmp = Capture();
+
+    auto res = _snapshots->Compare(base, cmp);
+    ASSERT_FALSE(res.HasDifferences());
+}
+
+TEST_F(GameStateSnapshotTest, ReportsModifiedRide)
+{
+    auto& base = Capture();
+    auto rideManager = GetRideManager();
+    ASSERT_GT(rideManager.size(), 0u);
+    auto& ride = *rideManager.begin();
+    ride.price++;
+    auto& cmp = Capture();
+
+    auto res = _snapshots->Compare(base, cmp);
+    ASSERT_TRUE(res.spriteChanges.empty());
+    ASSERT_EQ(res.rideChanges.size(), 1u);
+
+    const auto& change = res.rideChanges[0];
+    ASSERT_EQ(change.changeType, GameStateSpriteChange_t::MODIFIED);
+    ASSERT_EQ(change.rideIndex, ride.id);
+    ASSERT_EQ(change.diffs.size(), 1u);
+    ASSERT_STREQ(change.diffs[0].fieldname, "price");
+}
+
+TEST_F(GameStateSnapshotTest, ReportsRegionOfModifiedTile)
+{
+    auto& base = Capture();
+    auto loc = TileCoordsXY{ gMapSize / 2, gMapSize / 2 };
+    auto element = map_get_first_element_at(loc.ToCoordsXY());
+    ASSERT_NE(element, nullptr);
+    element->base_height++;
+    auto& cmp = Capture();
+
+    auto res = _snapshots->Compare(base, cmp);
+    ASSERT_TRUE(res.spriteChanges.empty());
+    ASSERT_TRUE(res.rideChanges.empty());
+    ASSERT_EQ(res.tileChanges.size(), 1u);
+
+    const auto& change = res.tileChanges[0];
+    ASSERT_LE(change.x, loc.x);
+    ASSERT_LT(loc.x, change.x + change.size);
+    ASSERT_LE(change.y, loc.y);
+    ASSERT_LT(loc.y, change.y + change.size);
+}
+
+TEST_F(GameStateSnapshotTest, SerialisedSnapshotHasNoDifferences)
+{
+    auto& base = Capture();
+    _snapshots->LinkSnapshot(base, 1234, 5678);
+
+    MemoryStream stream;
+    DataSerialiser saver(true, stream);
+    _snapshots->SerialiseSnapshot(base, saver);
+
+    auto& loaded = _snapshots->CreateSnapshot();
+    stream.SetPosition(0);
+    DataSerialiser loader(false, stream);
+    _snapshots->SerialiseSnapshot(loaded, loader);
+
+    auto res = _snapshots->Compare(base, loaded);
+    ASSERT_EQ(res.tick, 1234u);
+    ASSERT_EQ(res.srand0Left, res.srand0Right);
+    ASSERT_FALSE(res.HasDifferences());
+}
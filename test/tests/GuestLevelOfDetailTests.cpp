@@ -0,0 +1,171 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "LoadedParkTest.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <openrct2/ParkImporter.h>
+#include <openrct2/ReplayManager.h>
+#include <openrct2/core/MemoryStream.h>
+#include <openrct2/management/Finance.h>
+#include <openrct2/object/ObjectManager.h>
+#include <openrct2/peep/Peep.h>
+#include <openrct2/rct2/S6Exporter.h>
+#include <openrct2/ride/Ride.h>
+#include <openrct2/world/Park.h>
+#include <openrct2/world/ParkStatistics.h>
+#include <openrct2/world/Sprite.h>
+
+using namespace OpenRCT2;
+
+constexpr int32_t updatesToTest = 5000;
+
+struct ParkSummary
+{
+    uint32_t ParkRating;
+    uint32_t GuestsInPark;
+    uint32_t RideCustomers;
+    money32 Income;
+};
+
+class GuestLevelOfDetailTest : public LoadedParkTest
+{
+protected:
+    void TearDown() override
+    {
+        gGuestLevelOfDetail = false;
+    }
+
+    ParkSummary RunPark(bool levelOfDetail)
+    {
+        LoadPark();
+
+        money32 cashBefore = gCash;
+        gGuestLevelOfDetail = levelOfDetail;
+        RunUpdates(updatesToTest);
+        gGuestLevelOfDetail = false;
+
+        ParkSummary summary{};
+        summary.ParkRating = gParkRating;
+        summary.GuestsInPark = ParkStatistics::GetGuestCounts().InPark;
+        for (const auto& ride : GetRideManager())
+        {
+            summary.RideCustomers += ride.total_customers;
+        }
+        summary.Income = gCash - cashBefore;
+        return summary;
+    }
+
+    std::string RunParkChecksum(bool levelOfDetail, bool recordReplay)
+    {
+        LoadPark();
+
+        auto replayManager = _context->GetReplayManager();
+        if (recordReplay)
+        {
+            EXPECT_TRUE(replayManager->StartRecording("guest_lod_test"));
+        }
+        gGuestLevelOfDetail = levelOfDetail;
+        RunUpdates(1001);
+        gGuestLevelOfDetail = false;
+        if (recordReplay)
+        {
+            replayManager->StopRecording(true);
+        }
+        return sprite_checksum().ToString();
+    }
+};
+
+static void AssertWithin(double expected, double actual, double fraction)
+{
+    ASSERT_NEAR(actual, expected, std::max(1.0, std::abs(expected) * fraction));
+}
+
+TEST_F(GuestLevelOfDetailTest, AggregatesMatchFullSimulation)
+{
+    auto full = RunPark(false);
+    auto coarse = RunPark(true);
+
+    AssertWithin(full.ParkRating, coarse.ParkRating, 0.05);
+    AssertWithin(full.GuestsInPark, coarse.GuestsInPark, 0.05);
+    AssertWithin(full.RideCustomers, coarse.RideCustomers, 0.1);
+    AssertWithin(full.Income, coarse.Income, 0.1);
+}
+
+TEST_F(GuestLevelOfDetailTest, GuestCountsStayUpToDate)
+{
+    RunPark(true);
+    ASSERT_EQ(ParkStatistics::GetGuestCounts(), ParkStatistics::CountGuests());
+}
+
+TEST_F(GuestLevelOfDetailTest, NotUsedWhileRecordingReplay)
+{
+    auto full = RunParkChecksum(false, true);
+    auto coarse = RunParkChecksum(true, true);
+    ASSERT_EQ(full, coarse);
+}
+
+TEST_F(GuestLevelOfDetailTest, NotUsedWhilePlayingTrajectory)
+{
+    constexpr uint32_t stepCount = 10;
+    constexpr int32_t ticksPerStep = 100;
+    const std::string trajectoryFile = "guest_lod_trajectory_test.bin";
+
+    auto replayManager = _context->GetReplayManager();
+    ASSERT_TRUE(replayManager->StartTrajectoryRecording(trajectoryFile));
+    for (uint32_t step = 0; step < stepCount; step++)
+    {
+        RunUpdates(ticksPerStep);
+        ASSERT_TRUE(replayManager->AddTrajectoryStep(0.0f, step + 1 == stepCount));
+    }
+    ASSERT_TRUE(replayManager->StopTrajectoryRecording());
+    auto recorded = sprite_checksum().ToString();
+
+    LoadPark();
+    gGuestLevelOfDetail = true;
+    ASSERT_TRUE(replayManager->StartTrajectoryPlayback(trajectoryFile));
+    ASSERT_TRUE(replayManager->IsPlayingTrajectory());
+    for (uint32_t i = 0; i < stepCount; i++)
+    {
+        TrajectoryStep step;
+        ASSERT_TRUE(replayManager->PlayTrajectoryStep(step));
+    }
+    ASSERT_TRUE(replayManager->StopTrajectoryPlayback());
+    ASSERT_FALSE(replayManager->IsPlayingTrajectory());
+    gGuestLevelOfDetail = false;
+
+    ASSERT_EQ(sprite_checksum().ToString(), recorded);
+}
+
+TEST_F(GuestLevelOfDetailTest, SavesAreCaughtUp)
+{
+    // An odd number of ticks leaves guests in the middle of their interval.
+    gGuestLevelOfDetail = true;
+    RunUpdates(1001);
+    gGuestLevelOfDetail = false;
+
+    MemoryStream stream;
+    auto exporter = std::make_unique<S6Exporter>();
+    exporter->ExportObjectsList = _context->GetObjectManager().GetPackableObjects();
+    exporter->Export();
+    exporter->SaveGame(&stream);
+
+    // Nothing is left for the guests to catch up on, so the saved park is the one the game carries on from.
+    auto saved = sprite_checksum().ToString();
+    peep_catch_up_all();
+    ASSERT_EQ(sprite_checksum().ToString(), saved);
+
+    stream.SetPosition(0);
+    auto importer = ParkImporter::CreateS6(_context->GetObjectRepository());
+    auto loadResult = importer->LoadFromStream(&stream, false);
+    _context->GetObjectManager().LoadObjects(loadResult.RequiredObjects.data(), loadResult.RequiredObjects.size());
+    importer->Import();
+    ASSERT_EQ(sprite_checksum().ToString(), saved);
+}
@@ -0,0 +1,120 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "LoadedParkTest.hpp"
+
+#include <openrct2/ReplayManager.h>
+#include <openrct2/actions/SetCheatAction.hpp>
+#include <openrct2/core/File.h>
+#include <openrct2/peep/Peep.h>
+#include <openrct2/world/Park.h>
+#include <openrct2/world/ParkStatistics.h>
+#include <openrct2/world/Sprite.h>
+
+using namespace OpenRCT2;
+
+constexpr int32_t updatesToTest = 500;
+
+class GuestSpawnTest : public LoadedParkTest
+{
+protected:
+    static uint32_t CountGuestsInPark()
+    {
+        EXPECT_TRUE(ParkStatistics::Verify());
+
+        uint32_t guestsInPark = 0;
+        uint16_t spriteIndex;
+        Peep* peep;
+        FOR_ALL_GUESTS (spriteIndex, peep)
+        {
+            if (peep->outside_of_park == 0)
+            {
+                guestsInPark++;
+            }
+        }
+        return guestsInPark;
+    }
+};
+
+TEST_F(GuestSpawnTest, SpawnedGuestsAreInPark)
+{
+    auto& park = _context->GetGameState()->GetPark();
+    auto guestsBefore = gNumGuestsInPark;
+    ASSERT_EQ(park.SpawnGuests(100), 100);
+    ASSERT_EQ(gNumGuestsInPark, guestsBefore + 100);
+    ASSERT_EQ(CountGuestsInPark(), gNumGuestsInPark);
+
+    RunUpdates(updatesToTest);
+    ASSERT_EQ(CountGuestsInPark(), gNumGuestsInPark);
+}
+
+TEST_F(GuestSpawnTest, DespawnedGuestsAreRemoved)
+{
+    auto& park = _context->GetGameState()->GetPark();
+    auto guestsBefore = gNumGuestsInPark;
+    ASSERT_GT(guestsBefore, 100u);
+    ASSERT_EQ(park.DespawnGuests(100), 100);
+    ASSERT_EQ(gNumGuestsInPark, guestsBefore - 100);
+    ASSERT_EQ(CountGuestsInPark(), gNumGuestsInPark);
+
+    RunUpdates(updatesToTest);
+    ASSERT_EQ(CountGuestsInPark(), gNumGuestsInPark);
+}
+
+TEST_F(GuestSpawnTest, SetGuestCount)
+{
+    auto& park = _context->GetGameState()->GetPark();
+    park.SetGuestCount(gNumGuestsInPark + 250);
+    ASSERT_EQ(CountGuestsInPark(), gNumGuestsInPark);
+
+    // Guests on rides are kept as the vehicles refer to them, picked up guests as the player holds them.
+    uint32_t guestsOnRides = 0;
+    uint16_t spriteIndex;
+    Peep* peep;
+    FOR_ALL_GUESTS (spriteIndex, peep)
+    {
+        if (peep->outside_of_park == 0
+            && (peep->state == PEEP_STATE_ON_RIDE || peep->state == PEEP_STATE_ENTERING_RIDE
+                || peep->state == PEEP_STATE_LEAVING_RIDE || peep->state == PEEP_STATE_PICKED))
+        {
+            guestsOnRides++;
+        }
+    }
+    park.SetGuestCount(0);
+    ASSERT_EQ(gNumGuestsInPark, guestsOnRides);
+    ASSERT_EQ(CountGuestsInPark(), gNumGuestsInPark);
+
+    RunUpdates(updatesToTest);
+    ASSERT_EQ(CountGuestsInPark(), gNumGuestsInPark);
+}
+
+TEST_F(GuestSpawnTest, SetGuestCountIsReplayed)
+{
+#ifdef PLATFORM_32BIT
+    log_warning("Replay Tests have not been performed. OpenRCT2/OpenRCT2#11279.");
+    return;
+#else
+    // The spawned guests come from the scenario random numbers, so the replay has to run the same action.
+    auto replayManager = _context->GetReplayManager();
+    const std::string replayFile = "guest_spawn_replay_test.sv6r";
+    ASSERT_TRUE(replayManager->StartRecording(replayFile, updatesToTest));
+    RunUpdates(10);
+    auto setGuestCountAction = SetCheatAction(CheatType::SetGuestCount, gNumGuestsInPark + 250);
+    ASSERT_EQ(GameActions::Execute(&setGuestCountAction)->Error, GA_ERROR::OK);
+    while (replayManager->IsRecording())
+    {
+        RunUpdates(1);
+    }
+
+    ReplayVerifyResult result;
+    ASSERT_TRUE(replayManager->VerifyReplay(replayFile, result));
+    File::Delete(replayFile);
+    ASSERT_FALSE(result.Mismatch) << result.CompareText;
+#endif
+}
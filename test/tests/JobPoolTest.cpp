@@ -0,0 +1,137 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <array>
+#include <atomic>
+#include <gtest/gtest.h>
+#include <numeric>
+#include <openrct2/core/JobPool.hpp>
+#include <thread>
+#include <vector>
+
+// Amount of tasks to schedule, enough to fill several batches and deques.
+constexpr size_t TEST_TASK_COUNT = 5000;
+
+TEST(JobPoolTest, RunsAllTasks)
+{
+    std::vector<uint32_t> results(TEST_TASK_COUNT);
+
+    JobPool jobPool;
+    for (size_t i = 0; i < TEST_TASK_COUNT; i++)
+    {
+        jobPool.AddTask([&results, i]() { results[i] = static_cast<uint32_t>(i * 2); });
+    }
+    jobPool.Join();
+
+    for (size_t i = 0; i < TEST_TASK_COUNT; i++)
+    {
+        ASSERT_EQ(results[i], i * 2);
+    }
+    ASSERT_EQ(jobPool.CountPending(), 0);
+}
+
+TEST(JobPoolTest, ReuseAfterJoin)
+{
+    std::atomic<size_t> counter = { 0 };
+
+    JobPool jobPool;
+    for (int round = 0; round < 10; round++)
+    {
+        for (size_t i = 0; i < 100; i++)
+        {
+            jobPool.AddTask([&counter]() { counter++; });
+        }
+        jobPool.Join();
+        ASSERT_EQ(counter, (round + 1) * 100);
+    }
+}
+
+TEST(JobPoolTest, NestedTasks)
+{
+    std::atomic<size_t> counter = { 0 };
+
+    JobPool outer;
+    for (size_t i = 0; i < 16; i++)
+    {
+        outer.AddTask([&counter]() {
+            JobPool inner;
+            for (size_t j = 0; j < 64; j++)
+            {
+                inner.AddTask([&counter]() { counter++; });
+            }
+            inner.Join();
+        });
+    }
+    outer.Join();
+
+    ASSERT_EQ(counter, 16 * 64);
+}
+
+TEST(JobPoolTest, CompletionRunsOnJoiningThread)
+{
+    const auto joiningThread = std::this_thread::get_id();
+    size_t completed = 0;
+    bool allOnJoiningThread = true;
+
+    JobPool jobPool;
+    for (size_t i = 0; i < 100; i++)
+    {
+        jobPool.AddTask(
+            []() {},
+            [&]() {
+                completed++;
+                allOnJoiningThread &= std::this_thread::get_id() == joiningThread;
+            });
+    }
+    jobPool.Join();
+
+    ASSERT_EQ(completed, 100);
+    ASSERT_TRUE(allOnJoiningThread);
+}
+
+TEST(JobPoolTest, LargeCallable)
+{
+    // Larger than the inline storage of a job, must be boxed.
+    std::array<uint64_t, 64> values;
+    std::iota(values.begin(), values.end(), 0);
+    std::atomic<uint64_t> sum = { 0 };
+
+    JobPool jobPool;
+    for (size_t i = 0; i < 10; i++)
+    {
+        jobPool.AddTask([values, &sum]() { sum += std::accumulate(values.begin(), values.end(), uint64_t{ 0 }); });
+    }
+    jobPool.Join();
+
+    ASSERT_EQ(sum, 10 * (63 * 64 / 2));
+}
+
+TEST(JobPoolTest, ConcurrentPools)
+{
+    std::atomic<size_t> counter = { 0 };
+
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < 4; t++)
+    {
+        threads.emplace_back([&counter]() {
+            JobPool jobPool;
+            for (size_t i = 0; i < 1000; i++)
+            {
+                jobPool.AddTask([&counter]() { counter++; });
+            }
+            jobPool.Join();
+        });
+    }
+    for (auto&& th : threads)
+    {
+        th.join();
+    }
+
+    ASSERT_EQ(counter, 4 * 1000);
+}
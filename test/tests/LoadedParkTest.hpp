@@ -0,0 +1,87 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "TestData.h"
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <openrct2/Context.h>
+#include <openrct2/Game.h>
+#include <openrct2/GameState.h>
+#include <openrct2/OpenRCT2.h>
+#include <openrct2/platform/platform.h>
+#include <string>
+
+/**
+ * Fixture for tests that run against bpb.sv6. The context is created once per test case and every test starts from a
+ * freshly loaded park.
+ */
+class LoadedParkTest : public testing::Test
+{
+protected:
+    static void SetUpTestCase()
+    {
+        core_init();
+
+        gOpenRCT2Headless = true;
+        gOpenRCT2NoGraphics = true;
+        _context = OpenRCT2::CreateContext();
+        if (!_context->Initialise())
+        {
+            _context.reset();
+        }
+    }
+
+    static void TearDownTestCase()
+    {
+        _context.reset();
+    }
+
+    void SetUp() override
+    {
+        ASSERT_NE(_context, nullptr) << "Unable to initialise the context.";
+        LoadPark();
+    }
+
+    // Loads the park again, for tests that run it more than once.
+    static void LoadPark()
+    {
+        std::string parkPath = TestData::GetParkPath("bpb.sv6");
+        load_from_sv6(parkPath.c_str());
+        game_load_init();
+    }
+
+    static void RunUpdates(int32_t ticks)
+    {
+        auto gs = _context->GetGameState();
+        for (int32_t i = 0; i < ticks; i++)
+        {
+            gs->UpdateLogic();
+        }
+    }
+
+    // Runs check on the loaded park and then every interval ticks while the park runs for the given amount of ticks.
+    template<typename TFn> static void CheckWhileRunning(int32_t ticks, int32_t interval, TFn check)
+    {
+        check();
+        auto gs = _context->GetGameState();
+        for (int32_t i = 1; i <= ticks && !HasFatalFailure(); i++)
+        {
+            gs->UpdateLogic();
+            if (i % interval == 0)
+            {
+                check();
+            }
+        }
+    }
+
+    static inline std::unique_ptr<OpenRCT2::IContext> _context;
+};
@@ -0,0 +1,118 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <cstring>
+#include <gtest/gtest.h>
+#include <memory>
+#include <openrct2/core/MemoryStream.h>
+#include <openrct2/network/MapResync.h>
+#include <openrct2/scenario/Scenario.h>
+#include <openrct2/world/Map.h>
+
+/**
+ * Creates a map with a single surface element on every tile.
+ */
+static std::unique_ptr<rct_s6_data> CreateS6()
+{
+    auto s6 = std::make_unique<rct_s6_data>();
+    std::memset(s6.get(), 0, sizeof(rct_s6_data));
+    for (int32_t i = 0; i < MAXIMUM_MAP_SIZE_TECHNICAL * MAXIMUM_MAP_SIZE_TECHNICAL; i++)
+    {
+        s6->tile_elements[i].base_height = 14;
+        s6->tile_elements[i].SetLastForTile(true);
+    }
+    s6->next_free_tile_element_pointer_index = MAXIMUM_MAP_SIZE_TECHNICAL * MAXIMUM_MAP_SIZE_TECHNICAL;
+    return s6;
+}
+
+/**
+ * Adds an element on top of the given tile, shifting every element after it.
+ */
+static void AddTileElement(rct_s6_data& s6, int32_t x, int32_t y)
+{
+    size_t index = 0;
+    for (int32_t tile = 0; tile <= y * MAXIMUM_MAP_SIZE_TECHNICAL + x; tile++)
+    {
+        while (!s6.tile_elements[index++].IsLastForTile())
+            ;
+    }
+    std::memmove(
+        &s6.tile_elements[index], &s6.tile_elements[index - 1],
+        (RCT2_MAX_TILE_ELEMENTS - index) * sizeof(RCT12TileElement));
+    s6.tile_elements[index - 1].SetLastForTile(false);
+    s6.tile_elements[index].base_height = 20;
+    s6.next_free_tile_element_pointer_index++;
+}
+
+static void Resync(rct_s6_data& client, const rct_s6_data& server, size_t& deltaSize)
+{
+    MemoryStream hashes;
+    MapResync::WriteHashes(&hashes, MapResync::ComputeHashes(client));
+    hashes.SetPosition(0);
+
+    MemoryStream delta;
+    ASSERT_TRUE(MapResync::WriteDelta(&delta, server, MapResync::ReadHashes(&hashes)));
+    deltaSize = delta.GetLength();
+
+    delta.SetPosition(0);
+    MapResync::ApplyDelta(&delta, client);
+    ASSERT_EQ(delta.GetPosition(), delta.GetLength());
+}
+
+TEST(MapResyncTest, Unchanged)
+{
+    auto client = CreateS6();
+    auto server = CreateS6();
+
+    size_t deltaSize;
+    Resync(*client, *server, deltaSize);
+    ASSERT_EQ(deltaSize, 16);
+    ASSERT_EQ(std::memcmp(client.get(), server.get(), sizeof(rct_s6_data)), 0);
+}
+
+TEST(MapResyncTest, ChangedRegions)
+{
+    auto client = CreateS6();
+    auto server = CreateS6();
+
+    AddTileElement(*server, 40, 40);
+    AddTileElement(*server, 200, 3);
+    AddTileElement(*client, 100, 100);
+    server->sprites[1234].unknown.sprite_identifier = 2;
+    server->rides[7].type = 5;
+    server->park_rating = 650;
+
+    size_t deltaSize;
+    Resync(*client, *server, deltaSize);
+    ASSERT_EQ(std::memcmp(client.get(), server.get(), sizeof(rct_s6_data)), 0);
+
+    // Three tile regions, a block of sprites, a ride and a data block are far less than the whole park.
+    ASSERT_LT(deltaSize, 64 * 1024);
+}
+
+TEST(MapResyncTest, DifferentObjects)
+{
+    auto client = CreateS6();
+    auto server = CreateS6();
+    server->objects[3].flags = 1;
+
+    MemoryStream delta;
+    ASSERT_FALSE(MapResync::WriteDelta(&delta, *server, MapResync::ComputeHashes(*client)));
+    ASSERT_EQ(delta.GetLength(), 0);
+}
+
+TEST(MapResyncTest, InvalidDelta)
+{
+    auto client = CreateS6();
+    MemoryStream delta;
+    delta.WriteValue<uint32_t>(1);
+    delta.WriteValue<uint32_t>(0xFFFF);
+    delta.SetPosition(0);
+    ASSERT_THROW(MapResync::ApplyDelta(&delta, *client), IOException);
+}
@@ -0,0 +1,84 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <gtest/gtest.h>
+#include <openrct2/network/NetworkPacket.h>
+#include <string>
+
+static std::unique_ptr<NetworkPacket> CreateTestPacket()
+{
+    auto packet = NetworkPacket::Allocate();
+    *packet << (uint32_t)NETWORK_COMMAND_CHAT << (uint16_t)0x1234 << (int8_t)-5;
+    packet->WriteString("Hello guests");
+    *packet << (uint32_t)0xDEADBEEF;
+    packet->Size = (uint16_t)packet->Data->size();
+    return packet;
+}
+
+static void CheckTestPacket(NetworkPacket& packet)
+{
+    uint32_t command = 0;
+    uint16_t u16 = 0;
+    int8_t s8 = 0;
+    uint32_t u32 = 0;
+    packet >> command >> u16 >> s8;
+    const utf8* text = packet.ReadString();
+    packet >> u32;
+
+    ASSERT_EQ(packet.GetCommand(), NETWORK_COMMAND_CHAT);
+    ASSERT_EQ(command, (uint32_t)NETWORK_COMMAND_CHAT);
+    ASSERT_EQ(u16, 0x1234);
+    ASSERT_EQ(s8, -5);
+    ASSERT_NE(text, nullptr);
+    ASSERT_EQ(std::string(text), "Hello guests");
+    ASSERT_EQ(u32, 0xDEADBEEF);
+    ASSERT_EQ(packet.BytesRead, packet.Size);
+}
+
+TEST(NetworkPacketTest, RoundTrip)
+{
+    auto packet = CreateTestPacket();
+    CheckTestPacket(*packet);
+
+    uint32_t pastEnd = 1;
+    *packet >> pastEnd;
+    ASSERT_EQ(pastEnd, 0u);
+    ASSERT_EQ(packet->Read(1), nullptr);
+}
+
+TEST(NetworkPacketTest, DuplicateSharesPayload)
+{
+    auto packet = CreateTestPacket();
+    auto duplicate = NetworkPacket::Duplicate(*packet);
+    ASSERT_EQ(duplicate->Data, packet->Data);
+    ASSERT_EQ(duplicate->Size, packet->Size);
+
+    // Each duplicate keeps its own position.
+    CheckTestPacket(*duplicate);
+    ASSERT_EQ(packet->BytesRead, 0u);
+    CheckTestPacket(*packet);
+
+    auto data = packet->Data;
+    packet.reset();
+    ASSERT_EQ(duplicate->Data, data);
+    ASSERT_EQ(data.use_count(), 2);
+}
+
+TEST(NetworkPacketTest, ReleasedBuffersAreReused)
+{
+    auto packet = CreateTestPacket();
+    const std::vector<uint8_t>* buffer = packet->Data.get();
+    size_t capacity = buffer->capacity();
+    packet.reset();
+
+    auto reused = NetworkPacket::Allocate();
+    ASSERT_EQ(reused->Data.get(), buffer);
+    ASSERT_TRUE(reused->Data->empty());
+    ASSERT_EQ(reused->Data->capacity(), capacity);
+}
@@ -0,0 +1,47 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "LoadedParkTest.hpp"
+
+#include <openrct2/world/ParkStatistics.h>
+#include <openrct2/world/Sprite.h>
+
+using namespace OpenRCT2;
+
+constexpr int32_t updatesToTest = 1000;
+
+using ParkStatisticsTest = LoadedParkTest;
+
+TEST_F(ParkStatisticsTest, CountsMatchScan)
+{
+    ASSERT_GT(ParkStatistics::GetGuestCounts().InPark, 0u);
+    CheckWhileRunning(
+        updatesToTest, 1, []() { ASSERT_EQ(ParkStatistics::GetGuestCounts(), ParkStatistics::CountGuests()); });
+}
+
+TEST_F(ParkStatisticsTest, RemovedGuestIsNotCounted)
+{
+    uint16_t spriteIndex;
+    Peep* peep;
+    Peep* guestInPark = nullptr;
+    FOR_ALL_GUESTS (spriteIndex, peep)
+    {
+        if (peep->outside_of_park == 0)
+        {
+            guestInPark = peep;
+            break;
+        }
+    }
+    ASSERT_NE(guestInPark, nullptr);
+
+    auto inParkBefore = ParkStatistics::GetGuestCounts().InPark;
+    guestInPark->Remove();
+    ASSERT_EQ(ParkStatistics::GetGuestCounts().InPark, inParkBefore - 1);
+    ASSERT_EQ(ParkStatistics::GetGuestCounts(), ParkStatistics::CountGuests());
+}
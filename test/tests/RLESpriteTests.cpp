@@ -0,0 +1,226 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <gtest/gtest.h>
+#include <openrct2/drawing/Drawing.h>
+#include <openrct2/util/Util.h>
+#include <random>
+#include <vector>
+
+constexpr int32_t TEST_SPRITE_WIDTH = 250;
+constexpr int32_t TEST_SPRITE_HEIGHT = 64;
+constexpr uint32_t TEST_IMAGE_INDEX = 12345;
+
+using RLERunFunc = decltype(rle_run_fn);
+
+class RLESpriteTests : public testing::Test
+{
+protected:
+    std::mt19937 _prng{ 0x5EED };
+    std::vector<uint8_t> _sprite;
+    std::vector<uint8_t> _palette;
+    std::vector<uint8_t> _background;
+
+    void SetUp() override
+    {
+        _sprite = CreateSprite();
+
+        // Big enough for the blended remap table which is indexed by two pixels.
+        _palette.resize(256 * 256);
+        for (auto& entry : _palette)
+        {
+            entry = static_cast<uint8_t>(_prng());
+        }
+
+        _background.resize(TEST_SPRITE_WIDTH * (TEST_SPRITE_HEIGHT + 1));
+        for (auto& pixel : _background)
+        {
+            pixel = static_cast<uint8_t>(_prng());
+        }
+    }
+
+    // Creates an RLE sprite with a mix of short and long runs on each line.
+    std::vector<uint8_t> CreateSprite()
+    {
+        std::vector<uint8_t> data(TEST_SPRITE_HEIGHT * 2);
+        for (int32_t y = 0; y < TEST_SPRITE_HEIGHT; y++)
+        {
+            data[y * 2] = data.size() & 0xFF;
+            data[y * 2 + 1] = (data.size() >> 8) & 0xFF;
+
+            int32_t x = _prng() % 8;
+            while (true)
+            {
+                int32_t runLength = 1 + (_prng() % 127);
+                runLength = std::min(runLength, TEST_SPRITE_WIDTH - x);
+                int32_t nextX = x + runLength + 1 + (_prng() % 12);
+                bool isLast = nextX >= TEST_SPRITE_WIDTH - 1;
+
+                data.push_back(static_cast<uint8_t>(runLength | (isLast ? 0x80 : 0)));
+                data.push_back(static_cast<uint8_t>(x));
+                for (int32_t i = 0; i < runLength; i++)
+                {
+                    // Zero is never stored in RLE runs.
+                    data.push_back(static_cast<uint8_t>(1 + (_prng() % 255)));
+                }
+
+                if (isLast)
+                {
+                    break;
+                }
+                x = nextX;
+            }
+        }
+        return data;
+    }
+
+    std::vector<uint8_t> Draw(RLERunFunc runFn, ImageId imageId, int32_t zoomLevel, int32_t srcX, int32_t srcY)
+    {
+        auto previousFn = rle_run_fn;
+        rle_run_fn = runFn;
+
+        std::vector<uint8_t> dst = _background;
+        rct_drawpixelinfo dpi{};
+        dpi.bits = dst.data();
+        dpi.width = TEST_SPRITE_WIDTH;
+        dpi.height = TEST_SPRITE_HEIGHT;
+        dpi.pitch = TEST_SPRITE_WIDTH - (TEST_SPRITE_WIDTH >> zoomLevel);
+        dpi.zoom_level = zoomLevel;
+        gfx_rle_sprite_to_buffer(
+            _sprite.data(), dst.data(), _palette.data(), &dpi, imageId, srcY, TEST_SPRITE_HEIGHT - srcY, srcX,
+            TEST_SPRITE_WIDTH - srcX);
+
+        rle_run_fn = previousFn;
+        return dst;
+    }
+
+    std::vector<uint8_t> DrawCached(ImageId imageId, int32_t zoomLevel, int32_t srcX, int32_t srcY, int32_t width, int32_t height)
+    {
+        rct_g1_element g1{};
+        g1.offset = _sprite.data();
+        g1.width = TEST_SPRITE_WIDTH;
+        g1.height = TEST_SPRITE_HEIGHT;
+        g1.flags = G1_FLAG_RLE_COMPRESSION;
+
+        std::vector<uint8_t> dst = _background;
+        rct_drawpixelinfo dpi{};
+        dpi.bits = dst.data();
+        dpi.width = TEST_SPRITE_WIDTH;
+        dpi.height = TEST_SPRITE_HEIGHT;
+        dpi.pitch = TEST_SPRITE_WIDTH - (TEST_SPRITE_WIDTH >> zoomLevel);
+        dpi.zoom_level = zoomLevel;
+        if (!gfx_sprite_cache_draw(TEST_IMAGE_INDEX, &g1, dst.data(), _palette.data(), &dpi, imageId, srcY, height, srcX, width))
+        {
+            return {};
+        }
+        return dst;
+    }
+
+    std::vector<uint8_t> DrawDirect(ImageId imageId, int32_t zoomLevel, int32_t srcX, int32_t srcY, int32_t width, int32_t height)
+    {
+        std::vector<uint8_t> dst = _background;
+        rct_drawpixelinfo dpi{};
+        dpi.bits = dst.data();
+        dpi.width = TEST_SPRITE_WIDTH;
+        dpi.height = TEST_SPRITE_HEIGHT;
+        dpi.pitch = TEST_SPRITE_WIDTH - (TEST_SPRITE_WIDTH >> zoomLevel);
+        dpi.zoom_level = zoomLevel;
+        gfx_rle_sprite_to_buffer(_sprite.data(), dst.data(), _palette.data(), &dpi, imageId, srcY, height, srcX, width);
+        return dst;
+    }
+
+    void CompareWithScalar(RLERunFunc runFn)
+    {
+        const uint32_t imageTypes[] = { IMAGE_TYPE_DEFAULT, IMAGE_TYPE_REMAP, IMAGE_TYPE_TRANSPARENT,
+                                        IMAGE_TYPE_REMAP | IMAGE_TYPE_TRANSPARENT };
+        for (auto imageType : imageTypes)
+        {
+            auto imageId = ImageId::FromUInt32(imageType);
+            for (int32_t zoomLevel = 0; zoomLevel <= 3; zoomLevel++)
+            {
+                for (int32_t srcX : { 0, 3, 17 })
+                {
+                    auto expected = Draw(rle_run_scalar, imageId, zoomLevel, srcX, 0);
+                    auto actual = Draw(runFn, imageId, zoomLevel, srcX, 0);
+                    ASSERT_NE(expected, _background);
+                    ASSERT_EQ(expected, actual) << "image type " << imageType << ", zoom " << zoomLevel << ", x " << srcX;
+                }
+            }
+        }
+    }
+};
+
+TEST_F(RLESpriteTests, SSE41MatchesScalar)
+{
+    if (sse41_available())
+    {
+        CompareWithScalar(rle_run_sse4_1);
+    }
+}
+
+TEST_F(RLESpriteTests, AVX2MatchesScalar)
+{
+    if (avx2_available())
+    {
+        CompareWithScalar(rle_run_avx2);
+    }
+}
+
+TEST_F(RLESpriteTests, CacheMatchesDirectDraw)
+{
+    const uint32_t imageTypes[] = { IMAGE_TYPE_DEFAULT, IMAGE_TYPE_REMAP, IMAGE_TYPE_TRANSPARENT,
+                                    IMAGE_TYPE_REMAP | IMAGE_TYPE_TRANSPARENT };
+    // Source windows as passed by gfx_draw_sprite_palette_set_software, including the negative starts of zoomed sprites.
+    const int32_t windows[][4] = {
+        { 0, 0, TEST_SPRITE_WIDTH, TEST_SPRITE_HEIGHT }, { 3, 5, 200, 40 }, { 17, 1, 100, 63 },
+        { -3, -1, 120, 30 },                             { -7, -1, 90, 50 }, { 40, 30, 7, 3 },
+    };
+
+    gfx_sprite_cache_clear();
+    for (auto imageType : imageTypes)
+    {
+        auto imageId = ImageId::FromUInt32(imageType);
+        for (int32_t zoomLevel = 0; zoomLevel <= 3; zoomLevel++)
+        {
+            for (const auto& [srcX, srcY, width, height] : windows)
+            {
+                auto expected = DrawDirect(imageId, zoomLevel, srcX, srcY, width, height);
+                // Once decoding the entry and once reusing it.
+                for (int32_t pass = 0; pass < 2; pass++)
+                {
+                    auto actual = DrawCached(imageId, zoomLevel, srcX, srcY, width, height);
+                    ASSERT_EQ(expected, actual) << "image type " << imageType << ", zoom " << zoomLevel << ", x " << srcX
+                                                << ", y " << srcY << ", pass " << pass;
+                }
+            }
+        }
+    }
+}
+
+TEST_F(RLESpriteTests, CacheInvalidate)
+{
+    auto imageId = ImageId::FromUInt32(IMAGE_TYPE_DEFAULT);
+    gfx_sprite_cache_clear();
+    auto before = DrawCached(imageId, 0, 0, 0, TEST_SPRITE_WIDTH, TEST_SPRITE_HEIGHT);
+
+    // Change the sprite in place, the cached copy must not be used any more after invalidation.
+    _sprite = CreateSprite();
+    gfx_sprite_cache_invalidate(TEST_IMAGE_INDEX);
+    auto after = DrawCached(imageId, 0, 0, 0, TEST_SPRITE_WIDTH, TEST_SPRITE_HEIGHT);
+    ASSERT_NE(before, after);
+    ASSERT_EQ(DrawDirect(imageId, 0, 0, 0, TEST_SPRITE_WIDTH, TEST_SPRITE_HEIGHT), after);
+}
+
+TEST_F(RLESpriteTests, CacheDisabled)
+{
+    gfx_sprite_cache_set_budget(0);
+    auto result = DrawCached(ImageId::FromUInt32(IMAGE_TYPE_DEFAULT), 0, 0, 0, TEST_SPRITE_WIDTH, TEST_SPRITE_HEIGHT);
+    gfx_sprite_cache_set_budget(16 * 1024 * 1024);
+    ASSERT_TRUE(result.empty());
+}
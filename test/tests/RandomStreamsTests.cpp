@@ -0,0 +1,82 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <gtest/gtest.h>
+#include <openrct2/GameState.h>
+#include <openrct2/scenario/Scenario.h>
+#include <openrct2/world/Park.h>
+#include <vector>
+
+using namespace OpenRCT2;
+
+constexpr size_t numbersToDraw = 64;
+
+static std::vector<uint32_t> Draw(Random::Rct2::Engine& engine)
+{
+    std::vector<uint32_t> numbers;
+    for (size_t i = 0; i < numbersToDraw; i++)
+    {
+        numbers.push_back(engine());
+    }
+    return numbers;
+}
+
+TEST(RandomStreamsTest, SplitIsDeterministic)
+{
+    auto a = Random::Rct2::Split(1234, 0, 5);
+    auto b = Random::Rct2::Split(1234, 0, 5);
+    ASSERT_EQ(Draw(a), Draw(b));
+}
+
+TEST(RandomStreamsTest, SplitStreamsDiffer)
+{
+    auto seed = Random::Rct2::Split(1234, 0);
+    auto otherSeed = Random::Rct2::Split(1235, 0);
+    auto otherStream = Random::Rct2::Split(1234, 1);
+    auto otherKey = Random::Rct2::Split(1234, 0, 1);
+    auto numbers = Draw(seed);
+    ASSERT_NE(numbers, Draw(otherSeed));
+    ASSERT_NE(numbers, Draw(otherStream));
+    ASSERT_NE(numbers, Draw(otherKey));
+}
+
+TEST(RandomStreamsTest, StreamsDoNotAffectEachOther)
+{
+    GameState a;
+    GameState b;
+    a.SeedRandomStreams(42);
+    b.SeedRandomStreams(42);
+
+    Draw(a.GetRandomStream(RandomStream::AgentTesting));
+    ASSERT_EQ(Draw(a.GetRandomStream(RandomStream::EnvActions)), Draw(b.GetRandomStream(RandomStream::EnvActions)));
+
+    // Split engines do not depend on how much has been drawn from the streams.
+    auto splitA = a.SplitRandomStream(RandomStream::EnvActions, 7);
+    auto splitB = b.SplitRandomStream(RandomStream::EnvActions, 7);
+    ASSERT_EQ(Draw(splitA), Draw(splitB));
+    ASSERT_NE(Draw(b.GetRandomStream(RandomStream::EnvActions)), Draw(splitA));
+}
+
+TEST(RandomStreamsTest, ResetFollowsScenarioRandom)
+{
+    GameState a;
+    GameState b;
+    scenario_rand_seed(0x12345678, 0x9ABCDEF0);
+    a.ResetRandomStreams();
+    Draw(a.GetRandomStream(RandomStream::EnvActions));
+    scenario_rand_seed(0x12345678, 0x9ABCDEF0);
+    a.ResetRandomStreams();
+    b.ResetRandomStreams();
+    ASSERT_EQ(Draw(a.GetRandomStream(RandomStream::EnvActions)), Draw(b.GetRandomStream(RandomStream::EnvActions)));
+
+    // Drawing from the streams leaves the scenario random sequence alone.
+    auto state = scenario_rand_state();
+    ASSERT_EQ(state.s0, 0x12345678u);
+    ASSERT_EQ(state.s1, 0x9ABCDEF0u);
+}
@@ -0,0 +1,119 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "LoadedParkTest.hpp"
+
+#include <openrct2/world/Footpath.h>
+#include <openrct2/world/Map.h>
+#include <openrct2/world/RegionSummary.h>
+#include <openrct2/world/Scenery.h>
+
+using namespace OpenRCT2;
+
+class RegionSummaryTest : public LoadedParkTest
+{
+protected:
+    // Walks every tile element of the area, the way guests did before the summaries.
+    static RegionSummary::SurroundingsCounts ScanTiles(const TileCoordsXY& min, const TileCoordsXY& max)
+    {
+        RegionSummary::SurroundingsCounts counts;
+        for (int32_t y = min.y; y <= max.y; y++)
+        {
+            for (int32_t x = min.x; x <= max.x; x++)
+            {
+                auto loc = TileCoordsXY{ x, y }.ToCoordsXY();
+                if (!map_is_location_valid(loc))
+                    continue;
+
+                auto tileElement = map_get_first_element_at(loc);
+                do
+                {
+                    switch (tileElement->GetType())
+                    {
+                        case TILE_ELEMENT_TYPE_PATH:
+                        {
+                            auto pathElement = tileElement->AsPath();
+                            if (!pathElement->HasAddition())
+                                break;
+                            auto scenery = pathElement->GetAdditionEntry();
+                            if (scenery == nullptr)
+                                counts.HasInvalidAddition = true;
+                            else if (pathElement->AdditionIsGhost())
+                                break;
+                            else if (
+                                scenery->path_bit.flags
+                                & (PATH_BIT_FLAG_JUMPING_FOUNTAIN_WATER | PATH_BIT_FLAG_JUMPING_FOUNTAIN_SNOW))
+                                counts.Fountains++;
+                            else if (pathElement->IsBroken())
+                                counts.BrokenAdditions++;
+                            break;
+                        }
+                        case TILE_ELEMENT_TYPE_LARGE_SCENERY:
+                        case TILE_ELEMENT_TYPE_SMALL_SCENERY:
+                            counts.Scenery++;
+                            break;
+                        case TILE_ELEMENT_TYPE_TRACK:
+                            counts.Rides[tileElement->AsTrack()->GetRideIndex()] = true;
+                            break;
+                    }
+                } while (!(tileElement++)->IsLastForTile());
+            }
+        }
+        return counts;
+    }
+};
+
+TEST_F(RegionSummaryTest, MatchesTileScan)
+{
+    // Windows of the sizes guests use, at offsets that do and do not line up with the blocks, including the map edges.
+    for (int32_t size : { 10, 21 })
+    {
+        for (int32_t y = -12; y < MAXIMUM_MAP_SIZE_TECHNICAL; y += 13)
+        {
+            for (int32_t x = -12; x < MAXIMUM_MAP_SIZE_TECHNICAL; x += 11)
+            {
+                TileCoordsXY min{ x, y };
+                TileCoordsXY max{ x + size - 1, y + size - 1 };
+                auto expected = ScanTiles(min, max);
+                auto counts = RegionSummary::CountSurroundings(min, max);
+                ASSERT_EQ(counts.Scenery, expected.Scenery);
+                ASSERT_EQ(counts.Fountains, expected.Fountains);
+                ASSERT_EQ(counts.BrokenAdditions, expected.BrokenAdditions);
+                ASSERT_EQ(counts.HasInvalidAddition, expected.HasInvalidAddition);
+                ASSERT_EQ(counts.Rides, expected.Rides);
+
+                std::bitset<MAX_RIDES> rides;
+                RegionSummary::GetRidesInArea(min, max, rides);
+                ASSERT_EQ(rides, expected.Rides);
+            }
+        }
+    }
+    SUCCEED();
+}
+
+TEST_F(RegionSummaryTest, InsertedElementIsCounted)
+{
+    TileCoordsXY min{ 40, 40 };
+    TileCoordsXY max{ 49, 49 };
+    auto before = RegionSummary::CountSurroundings(min, max);
+
+    // Same tick, the block has to be summarised again because of the insert.
+    auto loc = TileCoordsXY{ 44, 45 }.ToCoordsXY();
+    auto tileElement = tile_element_insert({ loc, 200 * COORDS_Z_STEP }, 0b1111);
+    ASSERT_NE(tileElement, nullptr);
+    tileElement->SetType(TILE_ELEMENT_TYPE_SMALL_SCENERY);
+
+    auto after = RegionSummary::CountSurroundings(min, max);
+    ASSERT_EQ(after.Scenery, before.Scenery + 1);
+    ASSERT_EQ(after.Scenery, ScanTiles(min, max).Scenery);
+
+    tile_element_remove(tileElement);
+    RegionSummary::Invalidate(loc);
+    SUCCEED();
+}
@@ -7,6 +7,7 @@
  * OpenRCT2 is licensed under the GNU General Public License version 3.
  *****************************************************************************/
 
+#include "LoadedParkTest.hpp"
 #include "TestData.h"
 
 #include <gtest/gtest.h>
@@ -15,14 +16,19 @@
 #include <openrct2/GameState.h>
 #include <openrct2/OpenRCT2.h>
 #include <openrct2/ReplayManager.h>
+#include <openrct2/actions/RideSetPriceAction.hpp>
 #include <openrct2/audio/AudioContext.h>
 #include <openrct2/core/File.h>
 #include <openrct2/core/FileScanner.h>
 #include <openrct2/core/Path.hpp>
 #include <openrct2/core/String.hpp>
+#include <openrct2/management/Finance.h>
+#include <openrct2/peep/Peep.h>
 #include <openrct2/platform/platform.h>
 #include <openrct2/ride/Ride.h>
+#include <openrct2/world/Sprite.h>
 #include <string>
+#include <vector>
 
 using namespace OpenRCT2;
 
@@ -103,6 +109,224 @@ TEST_P(ReplayTests, RunReplay)
 #endif
 }
 
+TEST_P(ReplayTests, SeekReplay)
+{
+#ifdef PLATFORM_32BIT
+    log_warning("Replay Tests have not been performed. OpenRCT2/OpenRCT2#11279.");
+    return;
+#else
+    gOpenRCT2Headless = true;
+    gOpenRCT2NoGraphics = true;
+    core_init();
+
+    auto testData = GetParam();
+    auto replayFile = testData.filePath;
+
+    auto context = CreateContext();
+    bool initialised = context->Initialise();
+    ASSERT_TRUE(initialised);
+
+    auto gs = context->GetGameState();
+    ASSERT_NE(gs, nullptr);
+
+    IReplayManager* replayManager = context->GetReplayManager();
+    ASSERT_NE(replayManager, nullptr);
+
+    bool startedReplay = replayManager->StartPlayback(replayFile);
+    ASSERT_TRUE(startedReplay);
+
+    ReplayRecordInfo info;
+    replayManager->GetCurrentReplayInfo(info);
+
+    // Seek forward past the middle and back again, the state has to match the recording afterwards.
+    ASSERT_TRUE(replayManager->SeekPlayback(info.Ticks * 3 / 4));
+    ASSERT_FALSE(replayManager->IsPlaybackStateMismatching());
+    if (replayManager->IsReplaying())
+    {
+        ASSERT_TRUE(replayManager->SeekPlayback(info.Ticks / 4));
+    }
+
+    while (replayManager->IsReplaying())
+    {
+        gs->UpdateLogic();
+        ASSERT_TRUE(replayManager->IsPlaybackStateMismatching() == false);
+    }
+#endif
+}
+
+// Replays recorded by the tests themselves, from bpb.sv6.
+using ReplayRecordingTests = LoadedParkTest;
+
+// Returns false as soon as the playback stops matching the recording.
+static bool UpdateReplay(GameState* gs, IReplayManager* replayManager, uint32_t ticks)
+{
+    for (uint32_t i = 0; i < ticks && replayManager->IsReplaying(); i++)
+    {
+        gs->UpdateLogic();
+        if (replayManager->IsPlaybackStateMismatching())
+            return false;
+    }
+    return true;
+}
+
+TEST_F(ReplayRecordingTests, SeekAcrossKeyframes)
+{
+#ifdef PLATFORM_32BIT
+    log_warning("Replay Tests have not been performed. OpenRCT2/OpenRCT2#11279.");
+    return;
+#else
+    auto gs = _context->GetGameState();
+    IReplayManager* replayManager = _context->GetReplayManager();
+
+    // Record ten keyframe intervals, the recording stops by itself once the ticks are used up.
+    constexpr uint32_t keyframeTicks = 100;
+    constexpr uint32_t replayTicks = 10 * keyframeTicks;
+    const std::string replayFile = "replay_keyframe_seek_test.sv6r";
+    ASSERT_TRUE(replayManager->StartRecording(replayFile, replayTicks, IReplayManager::RecordType::NORMAL, keyframeTicks));
+    while (replayManager->IsRecording())
+    {
+        gs->UpdateLogic();
+    }
+
+    ASSERT_TRUE(replayManager->StartPlayback(replayFile));
+
+    ReplayRecordInfo info;
+    replayManager->GetCurrentReplayInfo(info);
+    ASSERT_EQ(info.Ticks, replayTicks);
+    ASSERT_GE(info.NumKeyframes, 5u);
+
+    // Forward past several keyframes, back across them and forward again, the state has to match each time.
+    for (uint32_t tick : { 750u, 150u, 550u, 50u })
+    {
+        ASSERT_TRUE(replayManager->SeekPlayback(tick));
+        ASSERT_FALSE(replayManager->IsPlaybackStateMismatching());
+        ASSERT_TRUE(UpdateReplay(gs, replayManager, keyframeTicks / 2));
+    }
+    ASSERT_TRUE(UpdateReplay(gs, replayManager, replayTicks));
+    ASSERT_FALSE(replayManager->IsReplaying());
+
+    File::Delete(replayFile);
+#endif
+}
+
+TEST_F(ReplayRecordingTests, VerifyReportsCorruptedReplay)
+{
+#ifdef PLATFORM_32BIT
+    log_warning("Replay Tests have not been performed. OpenRCT2/OpenRCT2#11279.");
+    return;
+#else
+    auto gs = _context->GetGameState();
+    IReplayManager* replayManager = _context->GetReplayManager();
+
+    // Change a guest behind the recording's back, playing it back can not reproduce that.
+    constexpr uint32_t keyframeTicks = 100;
+    constexpr uint32_t corruptTick = 250;
+    const std::string replayFile = "replay_verify_corrupt_test.sv6r";
+    ASSERT_TRUE(
+        replayManager->StartRecording(replayFile, 10 * keyframeTicks, IReplayManager::RecordType::NORMAL, keyframeTicks));
+    for (uint32_t i = 0; i < corruptTick; i++)
+    {
+        gs->UpdateLogic();
+    }
+    uint16_t spriteIndex;
+    Peep* peep;
+    FOR_ALL_GUESTS (spriteIndex, peep)
+    {
+        peep->tshirt_colour ^= 1;
+        break;
+    }
+    while (replayManager->IsRecording())
+    {
+        gs->UpdateLogic();
+    }
+
+    ReplayVerifyResult result;
+    ASSERT_TRUE(replayManager->VerifyReplay(replayFile, result));
+    File::Delete(replayFile);
+
+    ASSERT_TRUE(result.Mismatch);
+    ASSERT_EQ(result.FirstMismatchTick, corruptTick);
+    // The differences come from the keyframe after the mismatch.
+    ASSERT_NE(result.CompareText.find("tshirt_colour"), std::string::npos) << result.CompareText;
+#endif
+}
+
+// What playing a trajectory step has to reproduce: the sprites, the money and the ride prices the actions change.
+static std::string GetTrajectoryState()
+{
+    std::string state = sprite_checksum().ToString() + " " + std::to_string(gCash);
+    for (const auto& ride : GetRideManager())
+    {
+        state += " " + std::to_string(ride.price);
+    }
+    return state;
+}
+
+TEST_F(ReplayRecordingTests, TrajectoryPlaybackMatchesRecording)
+{
+#ifdef PLATFORM_32BIT
+    log_warning("Replay Tests have not been performed. OpenRCT2/OpenRCT2#11279.");
+    return;
+#else
+    IReplayManager* replayManager = _context->GetReplayManager();
+
+    std::vector<ride_id_t> rides;
+    for (const auto& ride : GetRideManager())
+    {
+        rides.push_back(ride.id);
+    }
+    ASSERT_FALSE(rides.empty());
+
+    // Every step changes a ride price between ticks and runs the park, like an environment step does.
+    constexpr uint32_t keyframeSteps = 5;
+    constexpr uint32_t stepCount = 12;
+    constexpr int32_t ticksPerStep = 40;
+    const std::string trajectoryFile = "trajectory_playback_test.bin";
+    ASSERT_TRUE(replayManager->StartTrajectoryRecording(trajectoryFile, keyframeSteps));
+    std::vector<std::string> recordedStates;
+    for (uint32_t step = 0; step < stepCount; step++)
+    {
+        RunUpdates(ticksPerStep);
+        auto setPrice = RideSetPriceAction(rides[step % rides.size()], MONEY(step % 4, 50), true);
+        ASSERT_EQ(GameActions::Execute(&setPrice)->Error, GA_ERROR::OK);
+        RunUpdates(ticksPerStep);
+        ASSERT_TRUE(replayManager->AddTrajectoryStep(static_cast<float>(step), step + 1 == stepCount));
+        recordedStates.push_back(GetTrajectoryState());
+    }
+    ASSERT_TRUE(replayManager->StopTrajectoryRecording());
+
+    // From the first keyframe, every step has to end in the recorded state.
+    LoadPark();
+    ASSERT_TRUE(replayManager->StartTrajectoryPlayback(trajectoryFile));
+    for (uint32_t step = 0; step < stepCount; step++)
+    {
+        TrajectoryStep result;
+        ASSERT_TRUE(replayManager->PlayTrajectoryStep(result));
+        ASSERT_EQ(result.Step, step);
+        ASSERT_EQ(result.NumActions, 1u);
+        ASSERT_EQ(result.Done, step + 1 == stepCount);
+        ASSERT_EQ(GetTrajectoryState(), recordedStates[step]) << "step " << step;
+    }
+    TrajectoryStep pastEnd;
+    ASSERT_FALSE(replayManager->PlayTrajectoryStep(pastEnd));
+    ASSERT_TRUE(replayManager->StopTrajectoryPlayback());
+
+    // Starting part way through goes through a later keyframe.
+    constexpr uint32_t startStep = keyframeSteps + 2;
+    ASSERT_TRUE(replayManager->StartTrajectoryPlayback(trajectoryFile, startStep));
+    ASSERT_EQ(GetTrajectoryState(), recordedStates[startStep - 1]);
+    for (uint32_t step = startStep; step < stepCount; step++)
+    {
+        TrajectoryStep result;
+        ASSERT_TRUE(replayManager->PlayTrajectoryStep(result));
+        ASSERT_EQ(GetTrajectoryState(), recordedStates[step]) << "step " << step;
+    }
+    ASSERT_TRUE(replayManager->StopTrajectoryPlayback());
+
+    File::Delete(trajectoryFile);
+#endif
+}
+
 static void PrintTo(const ReplayTestData& testData, std::ostream* os)
 {
     *os << testData.filePath;
@@ -16,6 +16,7 @@
 #include <openrct2/GameState.h>
 #include <openrct2/OpenRCT2.h>
 #include <openrct2/ParkImporter.h>
+#include <openrct2/ParkSnapshot.h>
 #include <openrct2/audio/AudioContext.h>
 #include <openrct2/config/Config.h>
 #include <openrct2/core/File.h>
@@ -29,8 +30,10 @@
 #include <openrct2/ride/Ride.h>
 #include <openrct2/world/Park.h>
 #include <openrct2/world/Sprite.h>
+#include <cstring>
 #include <stdio.h>
 #include <string>
+#include <vector>
 
 using namespace OpenRCT2;
 
@@ -102,6 +105,31 @@ static bool ExportSave(MemoryStream& stream, std::unique_ptr<IContext>& context)
     return true;
 }
 
+static bool ImportSnapshot(MemoryStream& stream, std::unique_ptr<IContext>& context)
+{
+    stream.SetPosition(0);
+
+    auto& objManager = context->GetObjectManager();
+
+    auto importer = ParkImporter::CreateParkSnapshot(context->GetObjectRepository());
+    auto loadResult = importer->LoadFromStream(&stream, false);
+    objManager.LoadObjects(loadResult.RequiredObjects.data(), loadResult.RequiredObjects.size());
+    importer->Import();
+
+    GameInit(true);
+
+    return true;
+}
+
+static bool ExportSnapshot(MemoryStream& stream)
+{
+    auto exporter = std::make_unique<S6Exporter>();
+    exporter->ExportSnapshot();
+    exporter->SaveSnapshot(&stream);
+
+    return true;
+}
+
 static std::unique_ptr<GameState_t> GetGameState(std::unique_ptr<IContext>& context)
 {
     std::unique_ptr<GameState_t> res = std::make_unique<GameState_t>();
@@ -566,3 +594,114 @@ TEST(S6ImportExportAdvanceTicks, all)
 
     SUCCEED();
 }
+
+TEST(S6ImportExportParkSnapshot, all)
+{
+    gOpenRCT2Headless = true;
+    gOpenRCT2NoGraphics = true;
+
+    core_init();
+
+    MemoryStream importBuffer;
+    MemoryStream s6Buffer;
+    MemoryStream snapshotBuffer;
+    MemoryStream s6ReexportBuffer;
+    MemoryStream snapshotReexportBuffer;
+
+    std::unique_ptr<GameState_t> s6State;
+    std::unique_ptr<GameState_t> snapshotState;
+
+    // Save the same park state once as S6 and once as a park snapshot.
+    {
+        std::unique_ptr<IContext> context = CreateContext();
+        EXPECT_NE(context, nullptr);
+
+        bool initialised = context->Initialise();
+        ASSERT_TRUE(initialised);
+
+        std::string testParkPath = TestData::GetParkPath("BigMapTest.sv6");
+        ASSERT_TRUE(LoadFileToBuffer(importBuffer, testParkPath));
+        ASSERT_TRUE(ImportSave(importBuffer, context, false));
+        AdvanceGameTicks(1000, context);
+        ASSERT_TRUE(ExportSave(s6Buffer, context));
+        ASSERT_TRUE(ExportSnapshot(snapshotBuffer));
+    }
+
+    // Load the S6 version.
+    {
+        std::unique_ptr<IContext> context = CreateContext();
+        EXPECT_NE(context, nullptr);
+
+        bool initialised = context->Initialise();
+        ASSERT_TRUE(initialised);
+
+        ASSERT_TRUE(ImportSave(s6Buffer, context, true));
+        s6State = GetGameState(context);
+        ASSERT_NE(s6State, nullptr);
+        ASSERT_TRUE(ExportSave(s6ReexportBuffer, context));
+    }
+
+    // Load the park snapshot.
+    {
+        std::unique_ptr<IContext> context = CreateContext();
+        EXPECT_NE(context, nullptr);
+
+        bool initialised = context->Initialise();
+        ASSERT_TRUE(initialised);
+
+        ASSERT_TRUE(ImportSnapshot(snapshotBuffer, context));
+        snapshotState = GetGameState(context);
+        ASSERT_NE(snapshotState, nullptr);
+        ASSERT_TRUE(ExportSave(snapshotReexportBuffer, context));
+    }
+
+    CompareStates(s6ReexportBuffer, snapshotReexportBuffer, s6State, snapshotState);
+
+    // Both loads have to result in the same park, so saving them again as S6 has to give the same file.
+    ASSERT_EQ(s6ReexportBuffer.GetLength(), snapshotReexportBuffer.GetLength());
+    ASSERT_EQ(
+        std::memcmp(s6ReexportBuffer.GetData(), snapshotReexportBuffer.GetData(), s6ReexportBuffer.GetLength()), 0);
+
+    SUCCEED();
+}
+
+TEST(S6ImportExportParkSnapshot, corrupt)
+{
+    gOpenRCT2Headless = true;
+    gOpenRCT2NoGraphics = true;
+
+    core_init();
+
+    MemoryStream importBuffer;
+    MemoryStream snapshotBuffer;
+
+    std::unique_ptr<IContext> context = CreateContext();
+    EXPECT_NE(context, nullptr);
+
+    bool initialised = context->Initialise();
+    ASSERT_TRUE(initialised);
+
+    std::string testParkPath = TestData::GetParkPath("BigMapTest.sv6");
+    ASSERT_TRUE(LoadFileToBuffer(importBuffer, testParkPath));
+    ASSERT_TRUE(ImportSave(importBuffer, context, false));
+    ASSERT_TRUE(ExportSnapshot(snapshotBuffer));
+
+    // Flip a bit inside the sprites, the section checksum has to catch it.
+    auto data = static_cast<const uint8_t*>(snapshotBuffer.GetData());
+    std::vector<uint8_t> corrupt(data, data + snapshotBuffer.GetLength());
+    ParkSnapshot::Header header;
+    std::memcpy(&header, corrupt.data(), sizeof(header));
+    for (uint16_t i = 0; i < header.SectionCount; i++)
+    {
+        ParkSnapshot::Section section;
+        std::memcpy(&section, corrupt.data() + sizeof(header) + i * sizeof(section), sizeof(section));
+        if (section.Id == static_cast<uint32_t>(ParkSnapshot::SectionId::Sprites))
+        {
+            corrupt[section.Offset + section.Length / 2] ^= 1;
+        }
+    }
+    MemoryStream corruptBuffer(corrupt.data(), corrupt.size());
+
+    auto importer = ParkImporter::CreateParkSnapshot(context->GetObjectRepository());
+    ASSERT_THROW(importer->LoadFromStream(&corruptBuffer, false), IOException);
+}
@@ -0,0 +1,117 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "LoadedParkTest.hpp"
+
+#include <algorithm>
+#include <openrct2/peep/Peep.h>
+#include <openrct2/world/Map.h>
+#include <openrct2/world/SpatialHash.h>
+#include <openrct2/world/Sprite.h>
+#include <vector>
+
+using namespace OpenRCT2;
+
+class SpatialHashTest : public LoadedParkTest
+{
+protected:
+    // Goes through every staff member, the way the nearest staff was found before the spatial hash.
+    static std::vector<SpatialHash::Entry> ScanStaff(const CoordsXY& centre, size_t count)
+    {
+        std::vector<SpatialHash::Entry> entries;
+        uint16_t spriteIndex;
+        Peep* peep;
+        FOR_ALL_STAFF (spriteIndex, peep)
+        {
+            if (peep->x != LOCATION_NULL)
+            {
+                entries.push_back({ std::abs(peep->x - centre.x) + std::abs(peep->y - centre.y), spriteIndex });
+            }
+        }
+        std::sort(entries.begin(), entries.end(), [](const SpatialHash::Entry& a, const SpatialHash::Entry& b) {
+            return a.Distance < b.Distance || (a.Distance == b.Distance && a.SpriteIndex < b.SpriteIndex);
+        });
+        size_t end = std::min(count, entries.size());
+        while (end > 0 && end < entries.size() && entries[end].Distance == entries[end - 1].Distance)
+        {
+            end++;
+        }
+        entries.resize(end);
+        return entries;
+    }
+};
+
+TEST_F(SpatialHashTest, NearestStaffMatchesScan)
+{
+    auto any = [](uint16_t) { return true; };
+    for (int32_t y = 0; y < MAXIMUM_MAP_SIZE_TECHNICAL * COORDS_XY_STEP; y += 13 * COORDS_XY_STEP + 5)
+    {
+        for (int32_t x = 0; x < MAXIMUM_MAP_SIZE_TECHNICAL * COORDS_XY_STEP; x += 11 * COORDS_XY_STEP + 7)
+        {
+            auto expected = ScanStaff({ x, y }, 3);
+            auto nearest = SpatialHash::GetNearest(SpatialHash::Kind::Staff, { x, y }, INT32_MAX, 3, any);
+            ASSERT_EQ(nearest.size(), expected.size());
+            for (size_t i = 0; i < nearest.size(); i++)
+            {
+                ASSERT_EQ(nearest[i].Distance, expected[i].Distance);
+                ASSERT_EQ(nearest[i].SpriteIndex, expected[i].SpriteIndex);
+            }
+        }
+    }
+    SUCCEED();
+}
+
+TEST_F(SpatialHashTest, EveryLitterIsInRadius)
+{
+    size_t litterCount = 0;
+    for (uint16_t spriteIndex = gSpriteListHead[SPRITE_LIST_LITTER]; spriteIndex != SPRITE_INDEX_NULL;
+         spriteIndex = get_sprite(spriteIndex)->generic.next)
+    {
+        auto litter = &get_sprite(spriteIndex)->litter;
+        size_t found = 0;
+        auto countLitter = [&found, spriteIndex](uint16_t i) {
+            if (i == spriteIndex)
+                found++;
+        };
+        SpatialHash::ForEachInRadius(SpatialHash::Kind::Litter, { litter->x, litter->y }, 0, countLitter);
+        ASSERT_EQ(found, 1u);
+        litterCount++;
+    }
+    ASSERT_EQ(SpatialHash::GetCount(SpatialHash::Kind::Litter), litterCount);
+}
+
+TEST_F(SpatialHashTest, MovedStaffIsFoundAtNewLocation)
+{
+    uint16_t spriteIndex;
+    Peep* peep;
+    Peep* staff = nullptr;
+    FOR_ALL_STAFF (spriteIndex, peep)
+    {
+        if (peep->x != LOCATION_NULL)
+        {
+            staff = peep;
+            break;
+        }
+    }
+    if (staff == nullptr)
+        return;
+
+    CoordsXYZ oldLoc{ staff->x, staff->y, staff->z };
+    CoordsXY newLoc{ oldLoc.x + 5 * COORDS_XY_STEP, oldLoc.y };
+    auto isStaff = [staff](uint16_t i) { return i == staff->sprite_index; };
+
+    sprite_move(newLoc.x, newLoc.y, oldLoc.z, staff);
+    auto atNew = SpatialHash::GetNearest(SpatialHash::Kind::Staff, newLoc, 0, 1, isStaff);
+    auto atOld = SpatialHash::GetNearest(SpatialHash::Kind::Staff, oldLoc, COORDS_XY_STEP, 1, isStaff);
+    ASSERT_EQ(atNew.size(), 1u);
+    ASSERT_EQ(atOld.size(), 0u);
+
+    sprite_move(oldLoc.x, oldLoc.y, oldLoc.z, staff);
+    ASSERT_EQ(SpatialHash::GetNearest(SpatialHash::Kind::Staff, oldLoc, 0, 1, isStaff).size(), 1u);
+}
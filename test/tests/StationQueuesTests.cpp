@@ -0,0 +1,135 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "LoadedParkTest.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <openrct2/peep/Peep.h>
+#include <openrct2/ride/Ride.h>
+#include <openrct2/ride/StationQueues.h>
+#include <openrct2/world/Sprite.h>
+
+using namespace OpenRCT2;
+
+constexpr int32_t updatesToTest = 2000;
+
+class StationQueuesTest : public LoadedParkTest
+{
+protected:
+    // Walks every queue, checking each guest is linked to the guest behind it.
+    static size_t CheckGuestsBehind()
+    {
+        size_t guestsQueuing = 0;
+        for (const auto& ride : GetRideManager())
+        {
+            for (const auto& station : ride.stations)
+            {
+                uint16_t behindIndex = SPRITE_INDEX_NULL;
+                uint16_t spriteIndex = station.LastPeepInQueue;
+                Peep* peep;
+                while ((peep = try_get_guest(spriteIndex)) != nullptr)
+                {
+                    EXPECT_EQ(StationQueues::GetGuestBehind(spriteIndex), behindIndex);
+                    behindIndex = spriteIndex;
+                    spriteIndex = peep->next_in_queue;
+                    guestsQueuing++;
+                }
+            }
+        }
+        return guestsQueuing;
+    }
+};
+
+TEST_F(StationQueuesTest, GuestsBehindMatchQueues)
+{
+    ASSERT_GT(CheckGuestsBehind(), 0u);
+    CheckWhileRunning(updatesToTest, updatesToTest, []() { CheckGuestsBehind(); });
+}
+
+TEST_F(StationQueuesTest, EstimatedQueueTimeIsZeroWithoutQueue)
+{
+    for (const auto& ride : GetRideManager())
+    {
+        if (ride.GetTotalQueueLength() == 0)
+        {
+            ASSERT_EQ(ride.GetEstimatedQueueTime(), 0);
+        }
+        else
+        {
+            ASSERT_GE(ride.GetEstimatedQueueTime(), 0);
+        }
+    }
+}
+
+TEST_F(StationQueuesTest, CachedQueueEndsMatchQueuePaths)
+{
+    auto gs = _context->GetGameState();
+    ASSERT_NE(gs, nullptr);
+    for (int32_t i = 0; i < updatesToTest; i++)
+    {
+        gs->UpdateLogic();
+    }
+
+    size_t queueEndsCached = 0;
+    for (const auto& ride : GetRideManager())
+    {
+        for (StationIndex stationIndex = 0; stationIndex < MAX_STATIONS; stationIndex++)
+        {
+            auto entrance = ride_get_entrance_location(&ride, stationIndex);
+            if (entrance.isNull())
+                continue;
+
+            TileCoordsXYZ cachedEnd{ entrance.x, entrance.y, entrance.z };
+            if (!StationQueues::GetQueueEnd(ride.id, stationIndex, cachedEnd))
+                continue;
+
+            TileCoordsXYZ queueEnd{ entrance.x, entrance.y, entrance.z };
+            get_ride_queue_end(queueEnd);
+            ASSERT_EQ(cachedEnd, queueEnd);
+            queueEndsCached++;
+        }
+    }
+    ASSERT_GT(queueEndsCached, 0u);
+}
+
+TEST_F(StationQueuesTest, EstimatedQueueTimeMatchesMeasured)
+{
+    auto gs = _context->GetGameState();
+    ASSERT_NE(gs, nullptr);
+    for (int32_t i = 0; i < updatesToTest; i++)
+    {
+        gs->UpdateLogic();
+    }
+
+    // The ride with the most customers, its queue time has been measured on many guests.
+    const Ride* busiestRide = nullptr;
+    uint32_t mostCustomers = 0;
+    for (const auto& ride : GetRideManager())
+    {
+        if (ride.GetTotalQueueLength() == 0 || ride.GetMaxQueueTime() == 0)
+            continue;
+
+        uint32_t customers = ride.cur_num_customers;
+        for (auto intervalCustomers : ride.num_customers)
+        {
+            customers += intervalCustomers;
+        }
+        if (customers > mostCustomers)
+        {
+            mostCustomers = customers;
+            busiestRide = &ride;
+        }
+    }
+    ASSERT_NE(busiestRide, nullptr);
+
+    int32_t measured = busiestRide->GetMaxQueueTime();
+    int32_t estimated = busiestRide->GetEstimatedQueueTime();
+    ASSERT_LE(std::abs(estimated - measured), std::max(3, measured / 3));
+}
@@ -0,0 +1,110 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <cstring>
+#include <gtest/gtest.h>
+#include <openrct2/TrajectoryFile.h>
+#include <openrct2/core/IStream.hpp>
+#include <openrct2/core/MemoryStream.h>
+#include <vector>
+
+using namespace Trajectory;
+
+static std::vector<uint8_t> CreatePayload(size_t length, uint8_t seed)
+{
+    std::vector<uint8_t> payload(length);
+    for (size_t i = 0; i < length; i++)
+    {
+        payload[i] = static_cast<uint8_t>(seed + (i % 7));
+    }
+    return payload;
+}
+
+static void WriteTestTrajectory(MemoryStream& ms)
+{
+    TrajectoryWriter writer(&ms);
+    auto keyframe = CreatePayload(5000, 1);
+    writer.WriteChunk(ChunkType::Keyframe, 0, 0, keyframe.data(), keyframe.size(), 1);
+    auto steps = CreatePayload(300, 2);
+    writer.WriteChunk(ChunkType::Steps, 0, 100, steps.data(), steps.size(), 6);
+    keyframe = CreatePayload(5000, 3);
+    writer.WriteChunk(ChunkType::Keyframe, 100, 0, keyframe.data(), keyframe.size(), 1);
+    steps = CreatePayload(150, 4);
+    writer.WriteChunk(ChunkType::Steps, 100, 50, steps.data(), steps.size(), 6);
+}
+
+TEST(TrajectoryFileTest, ReadBack)
+{
+    MemoryStream ms;
+    WriteTestTrajectory(ms);
+    ms.SetPosition(0);
+
+    TrajectoryReader reader(&ms);
+    ASSERT_FALSE(reader.IsTruncated());
+
+    const auto& chunks = reader.GetChunks();
+    ASSERT_EQ(chunks.size(), 4);
+    ASSERT_EQ(chunks[1].Type, ChunkType::Steps);
+    ASSERT_EQ(chunks[1].StepCount, 100);
+    ASSERT_EQ(chunks[3].FirstStep, 100);
+    ASSERT_EQ(reader.GetStepCount(), 150);
+
+    ASSERT_EQ(reader.FindKeyframe(0), 0);
+    ASSERT_EQ(reader.FindKeyframe(99), 0);
+    ASSERT_EQ(reader.FindKeyframe(100), 2);
+    ASSERT_EQ(reader.FindKeyframe(149), 2);
+
+    // Chunks compress well, so the whole file has to be smaller than its payloads.
+    ASSERT_LT(ms.GetLength(), 10450);
+
+    ASSERT_EQ(reader.ReadChunk(2), CreatePayload(5000, 3));
+    ASSERT_EQ(reader.ReadChunk(1), CreatePayload(300, 2));
+}
+
+TEST(TrajectoryFileTest, TruncatedTail)
+{
+    MemoryStream ms;
+    WriteTestTrajectory(ms);
+
+    // Cut off the end of the last chunk, as if the process died while writing it.
+    std::vector<uint8_t> data(
+        static_cast<const uint8_t*>(ms.GetData()), static_cast<const uint8_t*>(ms.GetData()) + ms.GetLength());
+    MemoryStream truncated(data.data(), data.size() - 10);
+
+    TrajectoryReader reader(&truncated);
+    ASSERT_TRUE(reader.IsTruncated());
+    ASSERT_EQ(reader.GetChunks().size(), 3);
+    ASSERT_EQ(reader.GetStepCount(), 100);
+    ASSERT_EQ(reader.ReadChunk(2), CreatePayload(5000, 3));
+}
+
+TEST(TrajectoryFileTest, CorruptPayload)
+{
+    MemoryStream ms;
+    WriteTestTrajectory(ms);
+
+    std::vector<uint8_t> data(
+        static_cast<const uint8_t*>(ms.GetData()), static_cast<const uint8_t*>(ms.GetData()) + ms.GetLength());
+    MemoryStream original(data.data(), data.size());
+    TrajectoryReader originalReader(&original);
+    data[originalReader.GetChunks()[1].Offset] ^= 0x10;
+
+    MemoryStream corrupt(data.data(), data.size());
+    TrajectoryReader reader(&corrupt);
+    ASSERT_EQ(reader.GetChunks().size(), 4);
+    ASSERT_THROW(reader.ReadChunk(1), IOException);
+    ASSERT_EQ(reader.ReadChunk(3), CreatePayload(150, 4));
+}
+
+TEST(TrajectoryFileTest, NotATrajectory)
+{
+    auto data = CreatePayload(64, 0);
+    MemoryStream ms(data.data(), data.size());
+    ASSERT_THROW(TrajectoryReader reader(&ms), IOException);
+}
@@ -0,0 +1,46 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2019 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "LoadedParkTest.hpp"
+
+#include <openrct2/ride/Vehicle.h>
+#include <openrct2/world/Sprite.h>
+
+using namespace OpenRCT2;
+
+constexpr int32_t updatesToTest = 2000;
+
+class VehicleSleepTest : public LoadedParkTest
+{
+protected:
+    // Runs the park, either letting trains sleep or waking them all before every tick.
+    static std::string RunPark(bool sleeping)
+    {
+        LoadPark();
+
+        auto gs = _context->GetGameState();
+        for (int32_t i = 0; i < updatesToTest; i++)
+        {
+            if (!sleeping)
+            {
+                vehicle_wake_all();
+            }
+            gs->UpdateLogic();
+        }
+        return sprite_checksum().ToString();
+    }
+
+};
+
+TEST_F(VehicleSleepTest, SleepingMatchesFullUpdates)
+{
+    auto awake = RunPark(false);
+    auto sleeping = RunPark(true);
+    ASSERT_EQ(awake, sleeping);
+}
@@ -11,6 +11,8 @@
 #include <openrct2/core/MemoryStream.h>
 #include <openrct2/rct12/SawyerChunkReader.h>
 #include <openrct2/util/SawyerCoding.h>
+#include <random>
+#include <vector>
 
 constexpr size_t BUFFER_SIZE = 0x600000;
 
@@ -59,6 +61,48 @@ protected:
         auto result = memcmp(chunk->GetData(), randomdata, sizeof(randomdata));
         ASSERT_EQ(result, 0);
     }
+
+    // Park data has long runs of zeros, repeated tile elements and noise in between.
+    static std::vector<uint8_t> create_park_like_data(size_t length, uint32_t seed)
+    {
+        std::mt19937 prng(seed);
+        std::vector<uint8_t> data;
+        data.reserve(length);
+        while (data.size() < length)
+        {
+            switch (prng() % 3)
+            {
+                case 0:
+                    data.insert(data.end(), prng() % 300, 0);
+                    break;
+                case 1:
+                {
+                    uint8_t element[16];
+                    for (auto& b : element)
+                        b = prng() % 4;
+                    for (size_t i = prng() % 20; i > 0; i--)
+                        data.insert(data.end(), element, element + 1 + (prng() % 15));
+                    break;
+                }
+                default:
+                    for (size_t i = prng() % 200; i > 0; i--)
+                        data.push_back(static_cast<uint8_t>(prng()));
+                    break;
+            }
+        }
+        data.resize(length);
+        return data;
+    }
+
+    static std::vector<uint8_t> encode_chunk(const std::vector<uint8_t>& data, uint8_t encoding)
+    {
+        sawyercoding_chunk_header header;
+        header.encoding = encoding;
+        header.length = static_cast<uint32_t>(data.size());
+        std::vector<uint8_t> encoded(BUFFER_SIZE);
+        encoded.resize(sawyercoding_write_chunk_buffer(encoded.data(), data.data(), header));
+        return encoded;
+    }
 };
 
 TEST_F(SawyerCodingTest, write_read_chunk_none)
@@ -81,6 +125,77 @@ TEST_F(SawyerCodingTest, write_read_chunk_rotate)
     test_encode_decode(CHUNK_ENCODING_ROTATE);
 }
 
+TEST_F(SawyerCodingTest, write_read_park_like_data)
+{
+    const uint8_t encodings[] = { CHUNK_ENCODING_NONE, CHUNK_ENCODING_RLE, CHUNK_ENCODING_RLECOMPRESSED,
+                                  CHUNK_ENCODING_ROTATE };
+    for (auto encoding : encodings)
+    {
+        for (size_t length : { 1, 7, 33, 4099, 200003 })
+        {
+            auto data = create_park_like_data(length, static_cast<uint32_t>(length));
+            auto encoded = encode_chunk(data, encoding);
+
+            MemoryStream ms(encoded.data(), encoded.size());
+            SawyerChunkReader reader(&ms);
+            auto chunk = reader.ReadChunk();
+            ASSERT_EQ(chunk->GetLength(), data.size()) << "encoding " << (int)encoding << ", length " << length;
+            ASSERT_EQ(memcmp(chunk->GetData(), data.data(), data.size()), 0)
+                << "encoding " << (int)encoding << ", length " << length;
+        }
+    }
+}
+
+TEST_F(SawyerCodingTest, read_chunks)
+{
+    auto first = create_park_like_data(100000, 1);
+    auto second = create_park_like_data(300, 2);
+    auto third = create_park_like_data(50000, 3);
+
+    std::vector<uint8_t> stream;
+    for (const auto& encoded : { encode_chunk(first, CHUNK_ENCODING_RLECOMPRESSED), encode_chunk(second, CHUNK_ENCODING_ROTATE),
+                                 encode_chunk(third, CHUNK_ENCODING_RLE) })
+    {
+        stream.insert(stream.end(), encoded.begin(), encoded.end());
+    }
+
+    // The second destination is too small and the third too big, like ReadChunk(dst, length) does.
+    std::vector<uint8_t> firstResult(first.size());
+    std::vector<uint8_t> secondResult(200);
+    std::vector<uint8_t> thirdResult(third.size() + 100, 0xCC);
+
+    MemoryStream ms(stream.data(), stream.size());
+    SawyerChunkReader reader(&ms);
+    reader.ReadChunks({ { firstResult.data(), firstResult.size() },
+                        { secondResult.data(), secondResult.size() },
+                        { thirdResult.data(), thirdResult.size() } });
+    ASSERT_EQ(ms.GetPosition(), stream.size());
+
+    ASSERT_EQ(firstResult, first);
+    ASSERT_EQ(secondResult, std::vector<uint8_t>(second.begin(), second.begin() + secondResult.size()));
+    third.resize(thirdResult.size(), 0);
+    ASSERT_EQ(thirdResult, third);
+}
+
+TEST_F(SawyerCodingTest, read_chunks_corrupt)
+{
+    auto data = create_park_like_data(1000, 4);
+    auto stream = encode_chunk(data, CHUNK_ENCODING_RLE);
+    auto corrupt = encode_chunk(data, CHUNK_ENCODING_RLECOMPRESSED);
+    // A back reference before the start of the chunk
+    corrupt[sizeof(sawyercoding_chunk_header) + 1] = 0x00;
+    corrupt[sizeof(sawyercoding_chunk_header) + 2] = 0x00;
+    stream.insert(stream.end(), corrupt.begin(), corrupt.end());
+
+    std::vector<uint8_t> first(data.size());
+    std::vector<uint8_t> second(data.size());
+    MemoryStream ms(stream.data(), stream.size());
+    SawyerChunkReader reader(&ms);
+    ASSERT_THROW(
+        reader.ReadChunks({ { first.data(), first.size() }, { second.data(), second.size() } }), std::exception);
+    ASSERT_EQ(ms.GetPosition(), 0);
+}
+
 // Note we only check if provided data decompresses to the same data, not if it compresses the same.
 // The reason for that is we may improve encoding at some point, but the test won't be affected,
 // as we already do a decode test and rountrip (encode + decode), which validates all uses.